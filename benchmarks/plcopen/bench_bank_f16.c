@@ -0,0 +1,160 @@
+/**
+ * @file bench_bank_f16.c
+ * @brief 半精度存储 bank 与 float32 实例数组的内存带宽扩展基准
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 实例数从 1K 扫描到上限（默认 2M），对比：
+ * - aos_f32：FB_PT1_t / FB_DERIVATIVE_t 数组逐个调用 Execute（现有 float32 存储）
+ * - bank_f16：FB_PT1_Bank16 / FB_DERIVATIVE_Bank16 整体 Execute
+ *
+ * 实例数超过末级缓存后吞吐由内存带宽决定，每实例字节数越少越快。
+ *
+ * 用法：bench_bank_f16 [最大实例数=2097152]
+ * 输出（stdout，CSV）：fb,layout,instances,bytes_per_instance,ns_per_instance,gb_per_s
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <stdio.h>
+
+/* 每个规模的目标总实例步数，保证小规模也有足够测量时间 */
+#define TARGET_STEPS 20000000L
+
+/* 每实例额外移动的输入/输出字节数 */
+#define IO_BYTES (2 * sizeof(float))
+
+static float* inputs;
+static float* outputs;
+
+static void fill_inputs(size_t n, long iteration) {
+    for (size_t i = 0; i < n; i++) {
+        inputs[i] = 50.0f + (float)((i + (size_t)iteration) % 64) * 0.25f;
+    }
+}
+
+static void report(const char* fb, const char* layout, size_t n, size_t bytes,
+                   uint64_t elapsed_ns, long iterations) {
+    double steps = (double)n * (double)iterations;
+    double ns_per_instance = (double)elapsed_ns / steps;
+    printf("%s,%s,%zu,%zu,%.3f,%.3f\n", fb, layout, n, bytes, ns_per_instance,
+           (double)bytes / ns_per_instance);
+}
+
+static void bench_pt1(size_t n, long iterations) {
+    FB_PT1_t* aos = malloc(n * sizeof(FB_PT1_t));
+    plc_half_t* out_h = malloc(n * sizeof(plc_half_t));
+    plc_half_t* alpha_h = malloc(n * sizeof(plc_half_t));
+    int8_t* status = malloc(n);
+    FB_PT1_Bank16_t bank;
+
+    FB_PT1_Config_t config = { .time_constant = 1.0f, .sample_time = 0.01f };
+    FB_PT1_Bank16_Init(&bank, out_h, alpha_h, status, n, config.sample_time);
+    for (size_t i = 0; i < n; i++) {
+        config.time_constant = 0.5f + (float)(i % 16) * 0.1f;
+        FB_PT1_Init(&aos[i], &config);
+        FB_PT1_Bank16_Configure(&bank, i, config.time_constant);
+    }
+
+    fill_inputs(n, 0);
+    uint64_t t0 = bench_now_ns();
+    for (long it = 0; it < iterations; it++) {
+        for (size_t i = 0; i < n; i++) {
+            outputs[i] = FB_PT1_Execute(&aos[i], inputs[i]);
+        }
+    }
+    uint64_t t1 = bench_now_ns();
+    bench_consume(outputs[n - 1]);
+    report("PT1", "aos_f32", n, sizeof(FB_PT1_t) + IO_BYTES, t1 - t0, iterations);
+
+    t0 = bench_now_ns();
+    for (long it = 0; it < iterations; it++) {
+        FB_PT1_Bank16_Execute(&bank, inputs, outputs);
+    }
+    t1 = bench_now_ns();
+    bench_consume(outputs[n - 1]);
+    report("PT1", "bank_f16", n, 2 * sizeof(plc_half_t) + 1 + IO_BYTES, t1 - t0, iterations);
+
+    free(aos);
+    free(out_h);
+    free(alpha_h);
+    free(status);
+}
+
+static void bench_derivative(size_t n, long iterations) {
+    FB_DERIVATIVE_t* aos = malloc(n * sizeof(FB_DERIVATIVE_t));
+    plc_half_t* prev_h = malloc(n * sizeof(plc_half_t));
+    plc_half_t* filt_h = malloc(n * sizeof(plc_half_t));
+    plc_half_t* alpha_h = malloc(n * sizeof(plc_half_t));
+    int8_t* status = malloc(n);
+    FB_DERIVATIVE_Bank16_t bank;
+
+    FB_DERIVATIVE_Config_t config = { .sample_time = 0.01f, .filter_time_constant = 0.1f };
+    FB_DERIVATIVE_Bank16_Init(&bank, prev_h, filt_h, alpha_h, status, n, config.sample_time);
+    for (size_t i = 0; i < n; i++) {
+        FB_DERIVATIVE_Init(&aos[i], &config);
+        FB_DERIVATIVE_Bank16_Configure(&bank, i, config.filter_time_constant);
+    }
+
+    /* 输入逐次变化，避免微分恒为零 */
+    uint64_t elapsed = 0;
+    for (long it = 0; it < iterations; it++) {
+        fill_inputs(n, it);
+        uint64_t t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            outputs[i] = FB_DERIVATIVE_Execute(&aos[i], inputs[i]);
+        }
+        elapsed += bench_now_ns() - t0;
+    }
+    bench_consume(outputs[n - 1]);
+    report("DERIVATIVE", "aos_f32", n, sizeof(FB_DERIVATIVE_t) + IO_BYTES, elapsed, iterations);
+
+    elapsed = 0;
+    for (long it = 0; it < iterations; it++) {
+        fill_inputs(n, it);
+        uint64_t t0 = bench_now_ns();
+        FB_DERIVATIVE_Bank16_Execute(&bank, inputs, outputs);
+        elapsed += bench_now_ns() - t0;
+    }
+    bench_consume(outputs[n - 1]);
+    report("DERIVATIVE", "bank_f16", n, 3 * sizeof(plc_half_t) + 1 + IO_BYTES, elapsed, iterations);
+
+    free(aos);
+    free(prev_h);
+    free(filt_h);
+    free(alpha_h);
+    free(status);
+}
+
+int main(int argc, char** argv) {
+    size_t max_instances = (size_t)bench_arg(argc, argv, 1, 1L << 21);
+
+    inputs = malloc(max_instances * sizeof(float));
+    outputs = malloc(max_instances * sizeof(float));
+    if (inputs == NULL || outputs == NULL) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+
+#if defined(__F16C__)
+    fprintf(stderr, "半精度转换：F16C\n");
+#elif defined(PLC_HALF_HAVE_ARM_FP16)
+    fprintf(stderr, "半精度转换：ARM VCVT\n");
+#else
+    fprintf(stderr, "半精度转换：软件实现（x86 可用 -DPLCOPEN_ENABLE_F16C=ON）\n");
+#endif
+
+    printf("fb,layout,instances,bytes_per_instance,ns_per_instance,gb_per_s\n");
+    for (size_t n = 1024; n <= max_instances; n *= 4) {
+        long iterations = TARGET_STEPS / (long)n;
+        if (iterations < 3) {
+            iterations = 3;
+        }
+        bench_pt1(n, iterations);
+        bench_derivative(n, iterations);
+    }
+
+    free(inputs);
+    free(outputs);
+    return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file bench_bank_f32.c
+ * @brief float32 bank（AArch64 NEON）与 FB_xxx_t 实例数组的吞吐对比基准
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 实例数从 64 按 4 倍扫描到上限（默认 64K），对 PID / PT1 / DERIVATIVE / LIMIT 对比：
+ * - aos：FB_xxx_t 数组逐个调用 Execute
+ * - bank32：FB_xxx_Bank32 整体 Execute（AArch64 每 4 个实例一组 NEON，其他平台为标量）
+ *
+ * 两种布局从相同配置、相同输入序列出发，计时结束后逐位比较最后一个扫描周期的输出；
+ * 任一不一致时 match 列为 0、退出码为 1，因此交叉构建经 qemu-aarch64 运行冒烟测试时
+ * 同时完成 NEON 路径的等价检查。qemu 用户态模拟下的耗时只有相对意义。
+ *
+ * 用法：bench_bank_f32 [最大实例数=65536]
+ * 输出（stdout，CSV）：fb,layout,instances,ns_per_instance,speedup,match
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 每个规模的目标总实例步数 */
+#define TARGET_STEPS 4000000L
+
+static float* setpoints;
+static float* inputs;
+static float* out_aos;
+static float* out_bank;
+
+static void fill_inputs(size_t n, long iteration) {
+    for (size_t i = 0; i < n; i++) {
+        setpoints[i] = (iteration / 50) % 2 ? 60.0f : 40.0f;
+        inputs[i] = 50.0f + (float)((i + (size_t)iteration) % 64) * 0.5f - 16.0f;
+    }
+}
+
+static int report(const char* fb, size_t n, long iterations, uint64_t aos_ns, uint64_t bank_ns) {
+    double steps = (double)n * (double)iterations;
+    int match = memcmp(out_aos, out_bank, n * sizeof(float)) == 0;
+    printf("%s,aos,%zu,%.3f,1.00,%d\n", fb, n, (double)aos_ns / steps, match);
+    printf("%s,bank32,%zu,%.3f,%.2f,%d\n", fb, n, (double)bank_ns / steps,
+           (double)aos_ns / (double)bank_ns, match);
+    return match ? 0 : 1;
+}
+
+/* ========== 各功能块 ========== */
+
+static int bench_pid(size_t n, long iterations) {
+    FB_PID_t* aos = malloc(n * sizeof(FB_PID_t));
+    float* floats = malloc(FB_PID_BANK32_FLOATS * n * sizeof(float));
+    uint8_t* flags = malloc(n);
+    int8_t* status = malloc(n);
+    FB_PID_Bank32_t bank;
+
+    FB_PID_Config_t config = {
+        .kp = 1.0f, .ki = 0.1f, .kd = 0.05f, .sample_time = 0.01f,
+        .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+    };
+    FB_PID_Bank32_Init(&bank, floats, flags, status, n, config.sample_time);
+    for (size_t i = 0; i < n; i++) {
+        config.kp = 0.5f + (float)(i % 8) * 0.25f;
+        FB_PID_Init(&aos[i], &config);
+        FB_PID_Bank32_Configure(&bank, i, &config);
+    }
+
+    uint64_t aos_ns = 0;
+    uint64_t bank_ns = 0;
+    for (long it = 0; it < iterations; it++) {
+        fill_inputs(n, it);
+        uint64_t t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            out_aos[i] = FB_PID_Execute(&aos[i], setpoints[i], inputs[i]);
+        }
+        uint64_t t1 = bench_now_ns();
+        FB_PID_Bank32_Execute(&bank, setpoints, inputs, out_bank);
+        uint64_t t2 = bench_now_ns();
+        aos_ns += t1 - t0;
+        bank_ns += t2 - t1;
+    }
+    int rc = report("PID", n, iterations, aos_ns, bank_ns);
+
+    free(aos);
+    free(floats);
+    free(flags);
+    free(status);
+    return rc;
+}
+
+static int bench_pt1(size_t n, long iterations) {
+    FB_PT1_t* aos = malloc(n * sizeof(FB_PT1_t));
+    float* floats = malloc(FB_PT1_BANK32_FLOATS * n * sizeof(float));
+    uint8_t* flags = malloc(n);
+    int8_t* status = malloc(n);
+    FB_PT1_Bank32_t bank;
+
+    FB_PT1_Config_t config = { .time_constant = 1.0f, .sample_time = 0.01f };
+    FB_PT1_Bank32_Init(&bank, floats, flags, status, n, config.sample_time);
+    for (size_t i = 0; i < n; i++) {
+        config.time_constant = 0.5f + (float)(i % 16) * 0.1f;
+        FB_PT1_Init(&aos[i], &config);
+        FB_PT1_Bank32_Configure(&bank, i, config.time_constant);
+    }
+
+    uint64_t aos_ns = 0;
+    uint64_t bank_ns = 0;
+    for (long it = 0; it < iterations; it++) {
+        fill_inputs(n, it);
+        uint64_t t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            out_aos[i] = FB_PT1_Execute(&aos[i], inputs[i]);
+        }
+        uint64_t t1 = bench_now_ns();
+        FB_PT1_Bank32_Execute(&bank, inputs, out_bank);
+        uint64_t t2 = bench_now_ns();
+        aos_ns += t1 - t0;
+        bank_ns += t2 - t1;
+    }
+    int rc = report("PT1", n, iterations, aos_ns, bank_ns);
+
+    free(aos);
+    free(floats);
+    free(flags);
+    free(status);
+    return rc;
+}
+
+static int bench_derivative(size_t n, long iterations) {
+    FB_DERIVATIVE_t* aos = malloc(n * sizeof(FB_DERIVATIVE_t));
+    float* floats = malloc(FB_DERIVATIVE_BANK32_FLOATS * n * sizeof(float));
+    uint8_t* flags = malloc(n);
+    int8_t* status = malloc(n);
+    FB_DERIVATIVE_Bank32_t bank;
+
+    FB_DERIVATIVE_Config_t config = { .sample_time = 0.01f, .filter_time_constant = 0.1f };
+    FB_DERIVATIVE_Bank32_Init(&bank, floats, flags, status, n, config.sample_time);
+    for (size_t i = 0; i < n; i++) {
+        FB_DERIVATIVE_Init(&aos[i], &config);
+        FB_DERIVATIVE_Bank32_Configure(&bank, i, config.filter_time_constant);
+    }
+
+    uint64_t aos_ns = 0;
+    uint64_t bank_ns = 0;
+    for (long it = 0; it < iterations; it++) {
+        fill_inputs(n, it);
+        uint64_t t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            out_aos[i] = FB_DERIVATIVE_Execute(&aos[i], inputs[i]);
+        }
+        uint64_t t1 = bench_now_ns();
+        FB_DERIVATIVE_Bank32_Execute(&bank, inputs, out_bank);
+        uint64_t t2 = bench_now_ns();
+        aos_ns += t1 - t0;
+        bank_ns += t2 - t1;
+    }
+    int rc = report("DERIVATIVE", n, iterations, aos_ns, bank_ns);
+
+    free(aos);
+    free(floats);
+    free(flags);
+    free(status);
+    return rc;
+}
+
+static int bench_limit(size_t n, long iterations) {
+    FB_LIMIT_t* aos = malloc(n * sizeof(FB_LIMIT_t));
+    float* floats = malloc(FB_LIMIT_BANK32_FLOATS * n * sizeof(float));
+    int8_t* status = malloc(n);
+    FB_LIMIT_Bank32_t bank;
+
+    FB_LIMIT_Config_t config = { .min_val = 40.0f, .max_val = 60.0f };
+    FB_LIMIT_Bank32_Init(&bank, floats, status, n);
+    for (size_t i = 0; i < n; i++) {
+        FB_LIMIT_Init(&aos[i], &config);
+        FB_LIMIT_Bank32_Configure(&bank, i, config.min_val, config.max_val);
+    }
+
+    uint64_t aos_ns = 0;
+    uint64_t bank_ns = 0;
+    for (long it = 0; it < iterations; it++) {
+        fill_inputs(n, it);
+        uint64_t t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            out_aos[i] = FB_LIMIT_Execute(&aos[i], inputs[i]);
+        }
+        uint64_t t1 = bench_now_ns();
+        FB_LIMIT_Bank32_Execute(&bank, inputs, out_bank);
+        uint64_t t2 = bench_now_ns();
+        aos_ns += t1 - t0;
+        bank_ns += t2 - t1;
+    }
+    int rc = report("LIMIT", n, iterations, aos_ns, bank_ns);
+
+    free(aos);
+    free(floats);
+    free(status);
+    return rc;
+}
+
+int main(int argc, char** argv) {
+    size_t max_instances = (size_t)bench_arg(argc, argv, 1, 1L << 16);
+
+    setpoints = malloc(max_instances * sizeof(float));
+    inputs = malloc(max_instances * sizeof(float));
+    out_aos = malloc(max_instances * sizeof(float));
+    out_bank = malloc(max_instances * sizeof(float));
+    if (setpoints == NULL || inputs == NULL || out_aos == NULL || out_bank == NULL) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    fprintf(stderr, "bank32 向量路径：AArch64 NEON\n");
+#else
+    fprintf(stderr, "bank32 向量路径：无（标量实现，AArch64 交叉构建见 toolchain-aarch64-linux.cmake）\n");
+#endif
+
+    int mismatches = 0;
+    printf("fb,layout,instances,ns_per_instance,speedup,match\n");
+    for (size_t n = 64; n <= max_instances; n *= 4) {
+        long iterations = TARGET_STEPS / (long)n;
+        if (iterations < 3) {
+            iterations = 3;
+        }
+        mismatches += bench_pid(n, iterations);
+        mismatches += bench_pt1(n, iterations);
+        mismatches += bench_derivative(n, iterations);
+        mismatches += bench_limit(n, iterations);
+    }
+
+    free(setpoints);
+    free(inputs);
+    free(out_aos);
+    free(out_bank);
+
+    if (mismatches != 0) {
+        fprintf(stderr, "bank32 与标量功能块输出不一致（%d 项）\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file bench_command_queue.c
+ * @brief SPSC 命令队列基准：持续吞吐量与 drain 最坏延迟
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 场景：
+ * - full_queue：单线程把队列填满（PLCOPEN_CMDQ_CAPACITY 条混合命令）后计时 drain，
+ *   即控制任务每周期为命令处理付出的最坏时间
+ * - sustained：操作员线程以最快速度投递设定值写入及手动/自动切换，
+ *   控制线程每周期 drain 后执行 16 个 PID 并让出 CPU（代替等待下一个节拍），
+ *   统计整体吞吐量和每次 drain 的耗时
+ *
+ * 单核主机上两个线程分时运行，sustained 的吞吐量受调度粒度限制，
+ * 每次 drain 的批量往往接近队列容量。
+ *
+ * 用法：bench_command_queue [命令总数=1000000] [full_queue 重复次数=20000]
+ * 输出（stdout，CSV）：
+ *   scenario,commands,drains,commands_per_sec,drain_p50_ns,drain_p99_ns,drain_max_ns,max_batch
+ */
+
+#include "bench_common.h"
+#include "plcopen/command_queue.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#define LOOPS 16
+
+static plcopen_cmdq_t queue;
+static FB_PID_t pids[LOOPS];
+static float setpoints[LOOPS];
+static atomic_int producer_done;
+
+static const FB_PID_Config_t pid_config = {
+    .kp = 1.0f, .ki = 0.1f, .kd = 0.01f, .sample_time = 0.01f,
+    .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+};
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void report(const char* scenario, long commands, double commands_per_sec,
+                   uint64_t* samples, long n, size_t max_batch) {
+    qsort(samples, (size_t)n, sizeof(uint64_t), compare_u64);
+    printf("%s,%ld,%ld,%.0f,%llu,%llu,%llu,%zu\n", scenario, commands, n, commands_per_sec,
+           (unsigned long long)samples[n / 2],
+           (unsigned long long)samples[(n * 99) / 100],
+           (unsigned long long)samples[n - 1], max_batch);
+}
+
+/* 混合命令：以设定值写入为主，每 8 条夹一次手动/自动切换 */
+static int push_mixed(long i) {
+    int loop = (int)(i % LOOPS);
+    switch (i & 7) {
+    case 3:
+        return plcopen_cmdq_push_pid_set_manual(&queue, &pids[loop], 30.0f);
+    case 7:
+        return plcopen_cmdq_push_pid_set_auto(&queue, &pids[loop]);
+    default:
+        return plcopen_cmdq_push_write_setpoint(&queue, &setpoints[loop], (float)(i & 63));
+    }
+}
+
+static void bench_full_queue(long repeats, uint64_t* samples) {
+    long pushed = 0;
+    for (long r = 0; r < repeats; r++) {
+        while (push_mixed(pushed) == 0) {
+            pushed++;
+        }
+        uint64_t t0 = bench_now_ns();
+        plcopen_cmdq_drain(&queue);
+        samples[r] = bench_now_ns() - t0;
+    }
+    report("full_queue", pushed, 0.0, samples, repeats, PLCOPEN_CMDQ_CAPACITY);
+}
+
+static void* producer_main(void* arg) {
+    long commands = *(const long*)arg;
+    for (long i = 0; i < commands; i++) {
+        while (push_mixed(i) != 0) {
+            sched_yield();
+        }
+    }
+    atomic_store(&producer_done, 1);
+    return NULL;
+}
+
+static void bench_sustained(long commands, uint64_t* samples, long max_samples) {
+    atomic_store(&producer_done, 0);
+    pthread_t producer;
+    uint64_t t0 = bench_now_ns();
+    pthread_create(&producer, NULL, producer_main, &commands);
+
+    long n = 0;
+    size_t max_batch = 0;
+    float acc = 0.0f;
+    for (;;) {
+        bool done = atomic_load(&producer_done);
+        uint64_t d0 = bench_now_ns();
+        size_t batch = plcopen_cmdq_drain(&queue);
+        uint64_t d1 = bench_now_ns();
+        if (batch > 0u && n < max_samples) {
+            samples[n++] = d1 - d0;
+        }
+        max_batch = batch > max_batch ? batch : max_batch;
+
+        for (int i = 0; i < LOOPS; i++) {
+            acc += FB_PID_Execute(&pids[i], setpoints[i], 20.0f);
+        }
+        if (done && plcopen_cmdq_size(&queue) == 0u) {
+            break;
+        }
+        /* 周期结束：让出 CPU，相当于周期任务等待下一个节拍 */
+        sched_yield();
+    }
+    uint64_t elapsed = bench_now_ns() - t0;
+    pthread_join(producer, NULL);
+    bench_consume(acc);
+
+    report("sustained", commands, (double)commands * 1e9 / (double)elapsed,
+           samples, n > 0 ? n : 1, max_batch);
+}
+
+int main(int argc, char** argv) {
+    long commands = bench_arg(argc, argv, 1, 1000000);
+    long repeats = bench_arg(argc, argv, 2, 20000);
+
+    plcopen_cmdq_init(&queue);
+    for (int i = 0; i < LOOPS; i++) {
+        FB_PID_Init(&pids[i], &pid_config);
+        setpoints[i] = 50.0f;
+    }
+
+    long max_samples = commands > repeats ? commands : repeats;
+    uint64_t* samples = calloc((size_t)max_samples, sizeof(uint64_t));
+    if (samples == NULL) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+
+    fprintf(stderr, "队列容量 %d 条，命令 %zu 字节\n", PLCOPEN_CMDQ_CAPACITY, sizeof(plcopen_cmd_t));
+    printf("scenario,commands,drains,commands_per_sec,drain_p50_ns,drain_p99_ns,drain_max_ns,max_batch\n");
+    bench_full_queue(repeats, samples);
+    bench_sustained(commands, samples, max_samples);
+
+    free(samples);
+    return 0;
+}
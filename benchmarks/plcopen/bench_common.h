@@ -0,0 +1,128 @@
+/**
+ * @file bench_common.h
+ * @brief PLCopen 基准测试公共计时工具
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 为主机（Linux）基准程序提供单调时钟和防优化辅助函数。
+ * 基准程序统一输出 CSV 到 stdout，便于脚本解析和绘图。
+ */
+
+#ifndef PLCOPEN_BENCH_COMMON_H
+#define PLCOPEN_BENCH_COMMON_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief 读取单调时钟（纳秒）
+ */
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief 防止编译器将基准结果优化掉
+ */
+static volatile float bench_sink;
+
+static inline void bench_consume(float value) {
+    bench_sink = value;
+}
+
+/**
+ * @brief 解析正整数命令行参数，缺省或无效时返回默认值
+ */
+static inline long bench_arg(int argc, char** argv, int index, long default_value) {
+    if (argc > index) {
+        long value = strtol(argv[index], NULL, 10);
+        if (value > 0) {
+            return value;
+        }
+    }
+    return default_value;
+}
+
+/**
+ * @brief 打开一个硬件性能计数器（仅本线程、仅用户态）
+ *
+ * @param config PERF_COUNT_HW_xxx
+ * @return 文件描述符；平台不支持或无权限（容器、虚拟机）时返回 -1
+ */
+static inline int bench_perf_open(uint64_t config) {
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    (void)config;
+    return -1;
+#endif
+}
+
+/**
+ * @brief 清零并启动计数器（fd < 0 时为空操作）
+ */
+static inline void bench_perf_start(int fd) {
+#if defined(__linux__)
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#else
+    (void)fd;
+#endif
+}
+
+/**
+ * @brief 停止计数器并读取计数值
+ *
+ * @return 计数值；计数器不可用时返回 -1
+ */
+static inline long long bench_perf_stop(int fd) {
+#if defined(__linux__)
+    long long count = -1;
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) {
+            count = -1;
+        }
+    }
+    return count;
+#else
+    (void)fd;
+    return -1;
+#endif
+}
+
+/**
+ * @brief 关闭计数器（fd < 0 时为空操作）
+ */
+static inline void bench_perf_close(int fd) {
+#if defined(__linux__)
+    if (fd >= 0) {
+        close(fd);
+    }
+#else
+    (void)fd;
+#endif
+}
+
+#endif /* PLCOPEN_BENCH_COMMON_H */
@@ -0,0 +1,208 @@
+/**
+ * @file bench_compact_layout.c
+ * @brief 标准实例、紧凑实例与享元实例的缓存行为对比基准
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 对 PT1 / PID 各分配 N 个实例（默认 1M，远超末级缓存），分别以
+ * - seq：按数组顺序执行（硬件预取有效，吞吐由带宽决定）
+ * - shuffled：按随机排列执行（模拟按组态顺序而非内存顺序调度的大型工程，
+ *   每个实例一次缓存未命中）
+ * 两种顺序执行一轮扫描。PT1 另外测量共享配置的享元实例（FB_PT1_Shared）。
+ *
+ * lines_per_instance 为解析值：seq 为 sizeof / 64（相邻实例共享缓存行），
+ * shuffled 为实例跨越的缓存行数平均值（数组按 64 字节对齐）。
+ * cache_misses_per_instance 来自 perf_event_open(PERF_COUNT_HW_CACHE_MISSES)，
+ * 容器或虚拟机中不可用时为 -1。
+ *
+ * 用法：bench_compact_layout [实例数=1048576] [扫描轮数=10]
+ * 输出（stdout，CSV）：
+ *   fb,layout,order,instances,bytes_per_instance,lines_per_instance,
+ *   ns_per_instance,cache_misses_per_instance
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <stdio.h>
+#include <string.h>
+
+#define CACHE_LINE 64
+
+static float* inputs;
+static uint32_t* order_seq;
+static uint32_t* order_shuffled;
+static int perf_fd = -1;
+static FB_PT1_SharedConfig_t pt1_shared;  /* 享元实例共用的配置 */
+
+/**
+ * @brief 64 字节对齐数组中，每个 size 字节实例平均跨越的缓存行数
+ */
+static double lines_spanned(size_t size) {
+    size_t total = 0;
+    for (size_t i = 0; i < CACHE_LINE; i++) {
+        size_t start = i * size;
+        size_t end = start + size - 1;
+        total += end / CACHE_LINE - start / CACHE_LINE + 1;
+    }
+    return (double)total / CACHE_LINE;
+}
+
+static void report(const char* fb, const char* layout, const char* order, size_t n,
+                   size_t size, uint64_t elapsed_ns, long long misses, long scans) {
+    double steps = (double)n * (double)scans;
+    double lines = (strcmp(order, "seq") == 0) ? (double)size / CACHE_LINE : lines_spanned(size);
+    printf("%s,%s,%s,%zu,%zu,%.3f,%.3f,%.3f\n", fb, layout, order, n, size, lines,
+           (double)elapsed_ns / steps, misses < 0 ? -1.0 : (double)misses / steps);
+}
+
+/* xorshift 伪随机数，保证各次运行排列一致 */
+static uint32_t rng_state = 2463534242u;
+
+static uint32_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/*
+ * 以宏生成各功能块/布局的计时函数：每轮扫描按 order 遍历全部实例。
+ * 首轮扫描（含首次运行分支、冷缓存）不计时。
+ */
+#define DEFINE_RUN(name, type, call)                                            \
+    static void name(type* fbs, const uint32_t* order, size_t n, long scans,    \
+                     uint64_t* elapsed, long long* misses) {                    \
+        float acc = 0.0f;                                                       \
+        for (size_t k = 0; k < n; k++) {                                        \
+            type* fb = &fbs[order[k]];                                          \
+            float u = inputs[order[k]];                                         \
+            acc += call;                                                        \
+        }                                                                       \
+        bench_perf_start(perf_fd);                                              \
+        uint64_t t0 = bench_now_ns();                                           \
+        for (long s = 0; s < scans; s++) {                                      \
+            float offset = (float)(s & 7);                                      \
+            for (size_t k = 0; k < n; k++) {                                    \
+                type* fb = &fbs[order[k]];                                      \
+                float u = inputs[order[k]] + offset;                            \
+                acc += call;                                                    \
+            }                                                                   \
+        }                                                                       \
+        *elapsed = bench_now_ns() - t0;                                         \
+        *misses = bench_perf_stop(perf_fd);                                     \
+        bench_consume(acc);                                                     \
+    }
+
+DEFINE_RUN(run_pt1_std, FB_PT1_t, FB_PT1_Execute(fb, u))
+DEFINE_RUN(run_pt1_cmp, FB_PT1_Compact_t, FB_PT1_Compact_Execute(fb, u))
+DEFINE_RUN(run_pt1_shr, FB_PT1_Shared_t, FB_PT1_Shared_Execute(fb, &pt1_shared, u))
+DEFINE_RUN(run_pid_std, FB_PID_t, FB_PID_Execute(fb, 50.0f, u))
+DEFINE_RUN(run_pid_cmp, FB_PID_Compact_t, FB_PID_Compact_Execute(fb, 50.0f, u))
+
+static void* alloc_lines(size_t bytes) {
+    size_t rounded = (bytes + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    return aligned_alloc(CACHE_LINE, rounded);
+}
+
+static void bench_pt1(size_t n, long scans) {
+    FB_PT1_t* std_fbs = alloc_lines(n * sizeof(FB_PT1_t));
+    FB_PT1_Compact_t* cmp_fbs = alloc_lines(n * sizeof(FB_PT1_Compact_t));
+    FB_PT1_Shared_t* shr_fbs = alloc_lines(n * sizeof(FB_PT1_Shared_t));
+    FB_PT1_Config_t config = { .time_constant = 1.0f, .sample_time = 0.01f };
+    uint64_t elapsed;
+    long long misses;
+
+    const uint32_t* orders[2] = { order_seq, order_shuffled };
+    const char* order_names[2] = { "seq", "shuffled" };
+    for (int o = 0; o < 2; o++) {
+        for (size_t i = 0; i < n; i++) {
+            config.time_constant = 0.5f + (float)(i % 16) * 0.1f;
+            FB_PT1_Init(&std_fbs[i], &config);
+            FB_PT1_Compact_Init(&cmp_fbs[i], &config);
+        }
+        /* 享元实例共用一个配置 */
+        FB_PT1_SharedConfig_Set(&pt1_shared, &config);
+        for (size_t i = 0; i < n; i++) {
+            FB_PT1_Shared_Init(&shr_fbs[i], &pt1_shared);
+        }
+        run_pt1_std(std_fbs, orders[o], n, scans, &elapsed, &misses);
+        report("PT1", "standard", order_names[o], n, sizeof(FB_PT1_t), elapsed, misses, scans);
+        run_pt1_cmp(cmp_fbs, orders[o], n, scans, &elapsed, &misses);
+        report("PT1", "compact", order_names[o], n, sizeof(FB_PT1_Compact_t), elapsed, misses, scans);
+        run_pt1_shr(shr_fbs, orders[o], n, scans, &elapsed, &misses);
+        report("PT1", "shared", order_names[o], n, sizeof(FB_PT1_Shared_t), elapsed, misses, scans);
+    }
+
+    free(std_fbs);
+    free(cmp_fbs);
+    free(shr_fbs);
+}
+
+static void bench_pid(size_t n, long scans) {
+    FB_PID_t* std_fbs = alloc_lines(n * sizeof(FB_PID_t));
+    FB_PID_Compact_t* cmp_fbs = alloc_lines(n * sizeof(FB_PID_Compact_t));
+    FB_PID_Config_t config = {
+        .kp = 1.5f, .ki = 0.2f, .kd = 0.01f, .sample_time = 0.01f,
+        .out_min = 0.0f, .out_max = 100.0f, .int_min = -100.0f, .int_max = 100.0f
+    };
+    uint64_t elapsed;
+    long long misses;
+
+    const uint32_t* orders[2] = { order_seq, order_shuffled };
+    const char* order_names[2] = { "seq", "shuffled" };
+    for (int o = 0; o < 2; o++) {
+        for (size_t i = 0; i < n; i++) {
+            FB_PID_Init(&std_fbs[i], &config);
+            FB_PID_Compact_Init(&cmp_fbs[i], &config);
+        }
+        run_pid_std(std_fbs, orders[o], n, scans, &elapsed, &misses);
+        report("PID", "standard", order_names[o], n, sizeof(FB_PID_t), elapsed, misses, scans);
+        run_pid_cmp(cmp_fbs, orders[o], n, scans, &elapsed, &misses);
+        report("PID", "compact", order_names[o], n, sizeof(FB_PID_Compact_t), elapsed, misses, scans);
+    }
+
+    free(std_fbs);
+    free(cmp_fbs);
+}
+
+int main(int argc, char** argv) {
+    size_t n = (size_t)bench_arg(argc, argv, 1, 1L << 20);
+    long scans = bench_arg(argc, argv, 2, 10);
+
+    inputs = malloc(n * sizeof(float));
+    order_seq = malloc(n * sizeof(uint32_t));
+    order_shuffled = malloc(n * sizeof(uint32_t));
+    if (inputs == NULL || order_seq == NULL || order_shuffled == NULL) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        inputs[i] = 40.0f + (float)(i % 32) * 0.5f;
+        order_seq[i] = (uint32_t)i;
+        order_shuffled[i] = (uint32_t)i;
+    }
+    /* Fisher-Yates 洗牌 */
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = rng_next() % (i + 1);
+        uint32_t tmp = order_shuffled[i];
+        order_shuffled[i] = order_shuffled[j];
+        order_shuffled[j] = tmp;
+    }
+
+    perf_fd = bench_perf_open(PERF_COUNT_HW_CACHE_MISSES);
+    if (perf_fd < 0) {
+        fprintf(stderr, "硬件性能计数器不可用，cache_misses_per_instance 输出 -1\n");
+    }
+
+    printf("fb,layout,order,instances,bytes_per_instance,lines_per_instance,"
+           "ns_per_instance,cache_misses_per_instance\n");
+    bench_pt1(n, scans);
+    bench_pid(n, scans);
+
+    bench_perf_close(perf_fd);
+    free(inputs);
+    free(order_seq);
+    free(order_shuffled);
+    return 0;
+}
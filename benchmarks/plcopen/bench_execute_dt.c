@@ -0,0 +1,262 @@
+/**
+ * @file bench_execute_dt.c
+ * @brief 可变步长接口（FB_xxx_ExecuteDt）的精度与单次调用开销基准
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 模拟 Linux 主机上有抖动的扫描周期：名义 1 ms，实测间隔在 0.5 ms 到 1.5 ms 之间随机变化。
+ * - expm1 行：fast_expm1f 与 libm expm1f 的单次调用开销，以及在 [-20, 0] 上相对
+ *   双精度 expm1 的最大相对误差
+ * - 功能块行：PT1 / DERIVATIVE / INTEGRATOR / RAMP / PID 对比
+ *   fixed（FB_xxx_Execute，忽略抖动）与 dt（FB_xxx_ExecuteDt，使用实测间隔），
+ *   误差为相对按实测间隔精确离散化的双精度参考模型的最大绝对误差（工程单位）；
+ *   PID 以输入序列为测量值、设定值固定为 50，输出不饱和
+ *
+ * fast_expm1f 的误差超出 FAST_EXPM1F_MAX_REL_ERROR 时退出码为 1。
+ *
+ * 用法：bench_execute_dt [每种方式的调用次数=4000000]
+ * 输出（stdout，CSV）：item,mode,ns_per_call,max_error
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <math.h>
+#include <stdio.h>
+
+#define NOMINAL_DT 0.001f
+
+/* 输入与间隔序列循环使用 */
+#define RING 4096
+
+static float inputs[RING];
+static float dts[RING];
+static float outputs[RING];
+
+static void fill_trace(void) {
+    uint32_t seed = 12345u;
+    double t = 0.0;
+    for (size_t i = 0; i < RING; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        dts[i] = NOMINAL_DT * (0.5f + (float)(seed >> 8) / 16777216.0f);
+        t += dts[i];
+        /* 慢速正弦 + 每 1024 个周期一次设定值阶跃 */
+        inputs[i] = 50.0f + 30.0f * (float)sin(12.0 * t) + (((i / 1024u) % 2u) ? 15.0f : -15.0f);
+    }
+}
+
+/* ========== 参考模型（双精度，按实测间隔精确离散化） ========== */
+
+typedef struct {
+    double y;
+    double prev;
+} ref_state_t;
+
+static double ref_pt1(ref_state_t* s, float input, float dt, bool first) {
+    s->y = first ? input : s->y - expm1(-(double)dt / 0.02) * ((double)input - s->y);
+    return s->y;
+}
+
+static double ref_derivative(ref_state_t* s, float input, float dt, bool first) {
+    if (first) {
+        s->y = 0.0;
+    } else {
+        double raw = ((double)input - s->prev) / dt;
+        s->y -= expm1(-(double)dt / 0.005) * (raw - s->y);
+    }
+    s->prev = input;
+    return s->y;
+}
+
+static double ref_integrator(ref_state_t* s, float input, float dt, bool first) {
+    (void)first;
+    s->y += (double)input * dt;
+    return s->y;
+}
+
+static double ref_ramp(ref_state_t* s, float input, float dt, bool first) {
+    if (first) {
+        s->y = input;
+    } else {
+        double error = (double)input - s->y;
+        double max_change = ((error > 0.0) ? 5000.0 : 2000.0) * dt;
+        s->y = (fabs(error) <= max_change) ? input : s->y + ((error > 0.0) ? max_change : -max_change);
+    }
+    return s->y;
+}
+
+static void report(const char* item, const char* mode, uint64_t ns, long calls, double max_error) {
+    printf("%s,%s,%.3f,%.3g\n", item, mode, (double)ns / (double)calls, max_error);
+}
+
+/*
+ * 为一种功能块生成对比函数：先分别计时 Execute 与 ExecuteDt，
+ * 再以新实例各跑一遍输入序列，与参考模型比较。
+ */
+#define DEFINE_DT_BENCH(fn, label, PREFIX, ref_step, ...)                                 \
+    static void fn(long rounds) {                                                         \
+        PREFIX##_Config_t config = __VA_ARGS__;                                           \
+        PREFIX##_t fixed;                                                                 \
+        PREFIX##_t variable;                                                              \
+        PREFIX##_Init(&fixed, &config);                                                   \
+        PREFIX##_Init(&variable, &config);                                                \
+                                                                                          \
+        uint64_t t0 = bench_now_ns();                                                     \
+        for (long r = 0; r < rounds; r++) {                                               \
+            for (size_t i = 0; i < RING; i++) {                                           \
+                outputs[i] = PREFIX##_Execute(&fixed, inputs[i]);                         \
+            }                                                                             \
+        }                                                                                 \
+        uint64_t t1 = bench_now_ns();                                                     \
+        for (long r = 0; r < rounds; r++) {                                              \
+            for (size_t i = 0; i < RING; i++) {                                           \
+                outputs[i] = PREFIX##_ExecuteDt(&variable, inputs[i], dts[i]);            \
+            }                                                                             \
+        }                                                                                 \
+        uint64_t t2 = bench_now_ns();                                                     \
+        bench_consume(outputs[RING - 1]);                                                 \
+                                                                                          \
+        PREFIX##_Init(&fixed, &config);                                                   \
+        PREFIX##_Init(&variable, &config);                                                \
+        ref_state_t ref = { 0.0, 0.0 };                                                   \
+        double fixed_error = 0.0;                                                         \
+        double dt_error = 0.0;                                                            \
+        for (size_t i = 0; i < RING; i++) {                                               \
+            double expected = ref_step(&ref, inputs[i], dts[i], i == 0);                  \
+            fixed_error = fmax(fixed_error,                                               \
+                               fabs(PREFIX##_Execute(&fixed, inputs[i]) - expected));     \
+            dt_error = fmax(dt_error,                                                     \
+                            fabs(PREFIX##_ExecuteDt(&variable, inputs[i], dts[i]) - expected)); \
+        }                                                                                 \
+                                                                                          \
+        long calls = rounds * RING;                                                       \
+        report(label, "fixed", t1 - t0, calls, fixed_error);                              \
+        report(label, "dt", t2 - t1, calls, dt_error);                                    \
+    }
+
+DEFINE_DT_BENCH(bench_pt1, "PT1", FB_PT1, ref_pt1,
+                { .time_constant = 0.02f, .sample_time = NOMINAL_DT })
+DEFINE_DT_BENCH(bench_derivative, "DERIVATIVE", FB_DERIVATIVE, ref_derivative,
+                { .sample_time = NOMINAL_DT, .filter_time_constant = 0.005f })
+DEFINE_DT_BENCH(bench_integrator, "INTEGRATOR", FB_INTEGRATOR, ref_integrator,
+                { .sample_time = NOMINAL_DT, .enable_limit = false })
+DEFINE_DT_BENCH(bench_ramp, "RAMP", FB_RAMP, ref_ramp,
+                { .rise_rate = 5000.0f, .fall_rate = 2000.0f, .sample_time = NOMINAL_DT })
+
+/* PID 有设定值与测量值两个输入，单独计时与比较 */
+#define PID_SETPOINT 50.0f
+
+typedef struct {
+    double integral;
+    double prev;
+} ref_pid_t;
+
+static double ref_pid(ref_pid_t* s, const FB_PID_Config_t* c, float measurement, float dt, bool first) {
+    if (first) {
+        s->prev = measurement;
+        s->integral = 0.0;
+        return measurement;
+    }
+    double error = (double)PID_SETPOINT - measurement;
+    double output = c->kp * error - c->kd * ((double)measurement - s->prev) / dt + s->integral;
+    s->integral += c->ki * error * dt;
+    s->prev = measurement;
+    return output;
+}
+
+static void bench_pid(long rounds) {
+    FB_PID_Config_t config = {
+        .kp = 0.5f, .ki = 20.0f, .kd = 0.002f, .sample_time = NOMINAL_DT,
+        .out_min = -1.0e4f, .out_max = 1.0e4f, .int_min = -1.0e4f, .int_max = 1.0e4f,
+    };
+    FB_PID_t fixed;
+    FB_PID_t variable;
+    FB_PID_Init(&fixed, &config);
+    FB_PID_Init(&variable, &config);
+
+    uint64_t t0 = bench_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < RING; i++) {
+            outputs[i] = FB_PID_Execute(&fixed, PID_SETPOINT, inputs[i]);
+        }
+    }
+    uint64_t t1 = bench_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < RING; i++) {
+            outputs[i] = FB_PID_ExecuteDt(&variable, PID_SETPOINT, inputs[i], dts[i]);
+        }
+    }
+    uint64_t t2 = bench_now_ns();
+    bench_consume(outputs[RING - 1]);
+
+    FB_PID_Init(&fixed, &config);
+    FB_PID_Init(&variable, &config);
+    ref_pid_t ref = { 0.0, 0.0 };
+    double fixed_error = 0.0;
+    double dt_error = 0.0;
+    for (size_t i = 0; i < RING; i++) {
+        double expected = ref_pid(&ref, &config, inputs[i], dts[i], i == 0);
+        fixed_error = fmax(fixed_error, fabs(FB_PID_Execute(&fixed, PID_SETPOINT, inputs[i]) - expected));
+        dt_error = fmax(dt_error,
+                        fabs(FB_PID_ExecuteDt(&variable, PID_SETPOINT, inputs[i], dts[i]) - expected));
+    }
+
+    long calls = rounds * RING;
+    report("PID", "fixed", t1 - t0, calls, fixed_error);
+    report("PID", "dt", t2 - t1, calls, dt_error);
+}
+
+/* ========== exp 近似 ========== */
+
+static int bench_expm1(long rounds) {
+    float acc = 0.0f;
+    uint64_t t0 = bench_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < RING; i++) {
+            acc += expm1f(-dts[i] * 50.0f);
+        }
+    }
+    uint64_t t1 = bench_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < RING; i++) {
+            acc += fast_expm1f(-dts[i] * 50.0f);
+        }
+    }
+    uint64_t t2 = bench_now_ns();
+    bench_consume(acc);
+
+    double libm_error = 0.0;
+    double fast_error = 0.0;
+    for (float x = -20.0f; x < 0.0f; x += 1.1e-4f) {
+        double reference = expm1((double)x);
+        libm_error = fmax(libm_error, fabs(((double)expm1f(x) - reference) / reference));
+        fast_error = fmax(fast_error, fabs(((double)fast_expm1f(x) - reference) / reference));
+    }
+
+    long calls = rounds * RING;
+    report("expm1", "libm", t1 - t0, calls, libm_error);
+    report("expm1", "fast", t2 - t1, calls, fast_error);
+    return fast_error <= FAST_EXPM1F_MAX_REL_ERROR ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    long target = bench_arg(argc, argv, 1, 4000000L);
+    long rounds = target / RING;
+    if (rounds < 1) {
+        rounds = 1;
+    }
+    fill_trace();
+
+    printf("item,mode,ns_per_call,max_error\n");
+    int failed = bench_expm1(rounds);
+    bench_pt1(rounds);
+    bench_derivative(rounds);
+    bench_integrator(rounds);
+    bench_ramp(rounds);
+    bench_pid(rounds);
+
+    if (failed) {
+        fprintf(stderr, "fast_expm1f 相对误差超出 FAST_EXPM1F_MAX_REL_ERROR\n");
+        return 1;
+    }
+    return 0;
+}
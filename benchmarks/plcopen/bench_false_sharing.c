@@ -0,0 +1,137 @@
+/**
+ * @file bench_false_sharing.c
+ * @brief 多线程伪共享基准：交错全局数组 vs plcopen_arena 任务分组
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * T 个线程各自执行 K 个 PT1 实例（默认 K = 16，全部位于 L1 中）：
+ * - interleaved：实例在一个全局数组中按 i * T + t 交错分配，
+ *   相邻实例属于不同线程（模拟任意声明的全局实例）
+ * - arena：每个线程的实例从独立的 plcopen_arena 分组中分配，
+ *   分组之间不共享缓存行
+ *
+ * 每个线程尽可能绑定到不同的 CPU；CPU 数少于线程数时线程分时运行，
+ * 伪共享不会出现，两种布局耗时相同。
+ *
+ * 用法：bench_false_sharing [线程数=4] [每线程实例数=16] [每线程扫描次数=200000]
+ * 输出（stdout，CSV）：layout,threads,instances_per_thread,ns_per_execute
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include "plcopen/arena.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#define MAX_THREADS 64
+#define MAX_PER_THREAD 256
+
+typedef struct {
+    FB_PT1_t* fbs[MAX_PER_THREAD]; /**< 本线程拥有的实例 */
+    int count;                     /**< 实例数 */
+    long scans;                    /**< 扫描次数 */
+    int cpu;                       /**< 绑定的 CPU */
+    pthread_barrier_t* start;      /**< 同时开始 */
+} worker_t;
+
+/* 交错布局的全局实例数组 */
+static FB_PT1_t interleaved[MAX_THREADS * MAX_PER_THREAD];
+
+/* arena 布局的存储：每个分组多留一行余量 */
+PLCOPEN_ARENA_STORAGE(arena_storage,
+                      MAX_THREADS * (MAX_PER_THREAD * sizeof(FB_PT1_t) + PLCOPEN_CACHE_LINE));
+
+static void* worker_main(void* arg) {
+    worker_t* w = arg;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(w->cpu, &set);
+    /* 尽力而为：容器可能禁止设置亲和性 */
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+
+    pthread_barrier_wait(w->start);
+
+    float acc = 0.0f;
+    for (long s = 0; s < w->scans; s++) {
+        float u = (float)(s & 63);
+        for (int i = 0; i < w->count; i++) {
+            acc += FB_PT1_Execute(w->fbs[i], u);
+        }
+    }
+    bench_consume(acc);
+    return NULL;
+}
+
+static double run(worker_t* workers, int threads) {
+    pthread_t tids[MAX_THREADS];
+    pthread_barrier_t start;
+    pthread_barrier_init(&start, NULL, (unsigned)threads + 1u);
+
+    for (int t = 0; t < threads; t++) {
+        workers[t].start = &start;
+        pthread_create(&tids[t], NULL, worker_main, &workers[t]);
+    }
+    pthread_barrier_wait(&start);
+    uint64_t t0 = bench_now_ns();
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    uint64_t elapsed = bench_now_ns() - t0;
+    pthread_barrier_destroy(&start);
+
+    /* 以墙钟时间计：所有线程并行时，无伪共享的理想值等于单线程耗时 */
+    return (double)elapsed / ((double)workers[0].scans * (double)workers[0].count);
+}
+
+int main(int argc, char** argv) {
+    int threads = (int)bench_arg(argc, argv, 1, 4);
+    int per_thread = (int)bench_arg(argc, argv, 2, 16);
+    long scans = bench_arg(argc, argv, 3, 200000);
+    if (threads > MAX_THREADS) {
+        threads = MAX_THREADS;
+    }
+    if (per_thread > MAX_PER_THREAD) {
+        per_thread = MAX_PER_THREAD;
+    }
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < threads) {
+        fprintf(stderr, "在线 CPU 数 %ld < 线程数 %d，线程将分时运行，伪共享不可见\n", cpus, threads);
+    }
+
+    FB_PT1_Config_t config = { .time_constant = 0.5f, .sample_time = 0.01f };
+    static worker_t workers[MAX_THREADS];
+
+    printf("layout,threads,instances_per_thread,ns_per_execute\n");
+
+    /* 交错布局 */
+    for (int t = 0; t < threads; t++) {
+        workers[t].count = per_thread;
+        workers[t].scans = scans;
+        workers[t].cpu = (int)(t % (cpus > 0 ? cpus : 1));
+        for (int i = 0; i < per_thread; i++) {
+            workers[t].fbs[i] = &interleaved[i * threads + t];
+            FB_PT1_Init(workers[t].fbs[i], &config);
+        }
+    }
+    printf("interleaved,%d,%d,%.3f\n", threads, per_thread, run(workers, threads));
+
+    /* arena 任务分组布局 */
+    plcopen_arena_t root;
+    plcopen_arena_t groups[MAX_THREADS];
+    plcopen_arena_init(&root, arena_storage, sizeof(arena_storage));
+    for (int t = 0; t < threads; t++) {
+        if (plcopen_arena_split(&root, &groups[t], (size_t)per_thread * sizeof(FB_PT1_t)) != 0) {
+            fprintf(stderr, "arena 空间不足\n");
+            return 1;
+        }
+        for (int i = 0; i < per_thread; i++) {
+            workers[t].fbs[i] = PLCOPEN_ARENA_NEW(&groups[t], FB_PT1_t);
+            FB_PT1_Init(workers[t].fbs[i], &config);
+        }
+    }
+    printf("arena,%d,%d,%.3f\n", threads, per_thread, run(workers, threads));
+
+    return 0;
+}
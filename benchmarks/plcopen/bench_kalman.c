@@ -0,0 +1,220 @@
+/**
+ * @file bench_kalman.c
+ * @brief 卡尔曼滤波（FB_KALMAN）按状态维数的单次开销：特化展开内核、稳态增益与通用循环对比
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 对 n = 1 ~ FB_KALMAN_MAX_STATES 个状态（1 个测量、1 个输入的阻尼振子链）测量：
+ * - looped：本文件中的通用实现，运算与 FB_KALMAN 完整模式相同（Cholesky 求增益、Joseph 更新、
+ *   上三角镜像），但维数为运行时值，所有循环保留
+ * - full：FB_KALMAN 完整模式（按 n 特化、完全展开的内核）
+ * - steady：FB_KALMAN 稳态模式（x = F·x + G·u + K·z）
+ *
+ * cycles_per_call 来自 perf_event_open(PERF_COUNT_HW_CPU_CYCLES)，计数器不可用（容器、虚拟机）
+ * 时为 -1。speedup 为相对 looped 的耗时比。计时结束后比较 looped 与 full 的状态估计，
+ * 相对偏差超过 1e-4 时 match 列为 0、退出码为 1。
+ *
+ * Cortex-M4 上的周期数需在目标板上以 DWT 或 PLCOPEN_ENABLE_PROFILING 测量，
+ * 本程序给出的是主机上的相对关系。
+ *
+ * 用法：bench_kalman [每种方式的计时调用次数=1000000]
+ * 输出（stdout，CSV）：states,outputs,method,ns_per_call,cycles_per_call,speedup,match
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define KN FB_KALMAN_MAX_STATES
+
+/* 计时用测量/输入序列循环使用 */
+#define RING 1024
+
+static float measurements[RING];
+static float inputs[RING];
+static int perf_fd = -1;
+
+static void fill_traces(void) {
+    uint32_t seed = 77u;
+    for (size_t i = 0; i < RING; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        measurements[i] = sinf(0.01f * (float)i) + 0.05f * ((float)(seed >> 8) / 8388608.0f - 1.0f);
+        inputs[i] = ((i / 128u) % 2u) ? 1.0f : -1.0f;
+    }
+}
+
+static FB_KALMAN_Config_t chain_config(unsigned n, bool steady_state) {
+    FB_KALMAN_Config_t config;
+    memset(&config, 0, sizeof(config));
+    config.states = (uint8_t)n;
+    config.outputs = 1;
+    config.inputs = 1;
+    config.steady_state = steady_state;
+    for (unsigned i = 0; i < n; i++) {
+        config.a[i][i] = 0.95f;
+        if (i + 1 < n) config.a[i][i + 1] = 0.1f;
+        if (i > 0) config.a[i][i - 1] = -0.05f;
+        config.q[i][i] = 1e-3f;
+        config.p0[i][i] = 1.0f;
+    }
+    config.b[n - 1][0] = 0.1f;
+    config.h[0][0] = 1.0f;
+    config.r[0][0] = 0.04f;
+    return config;
+}
+
+/* ========== 通用循环实现（对照） ========== */
+
+typedef struct {
+    float x[KN];
+    float p[KN][KN];
+} looped_t;
+
+static void __attribute__((noinline)) looped_step(const FB_KALMAN_Config_t* c, looped_t* s, float z, float u) {
+    const unsigned n = c->states;
+    float xm[KN], pm[KN][KN], t[KN][KN], ikh[KN][KN], k[KN], pht[KN];
+
+    for (unsigned i = 0; i < n; i++) {
+        float sum = c->b[i][0] * u;
+        for (unsigned j = 0; j < n; j++) sum += c->a[i][j] * s->x[j];
+        xm[i] = sum;
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            float sum = 0.0f;
+            for (unsigned l = 0; l < n; l++) sum += c->a[i][l] * s->p[l][j];
+            t[i][j] = sum;
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = i; j < n; j++) {
+            float sum = c->q[i][j];
+            for (unsigned l = 0; l < n; l++) sum += t[i][l] * c->a[j][l];
+            pm[i][j] = sum;
+            pm[j][i] = sum;
+        }
+    }
+
+    /* 单测量时 Cholesky 退化为 sqrt(S) */
+    for (unsigned i = 0; i < n; i++) {
+        float sum = 0.0f;
+        for (unsigned j = 0; j < n; j++) sum += pm[i][j] * c->h[0][j];
+        pht[i] = sum;
+    }
+    float sv = c->r[0][0];
+    for (unsigned j = 0; j < n; j++) sv += c->h[0][j] * pht[j];
+    float inv = 1.0f / sqrtf(sv);
+    float innovation = z;
+    for (unsigned j = 0; j < n; j++) innovation -= c->h[0][j] * xm[j];
+    for (unsigned i = 0; i < n; i++) {
+        k[i] = pht[i] * inv * inv;
+        s->x[i] = xm[i] + k[i] * innovation;
+    }
+
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) ikh[i][j] = ((i == j) ? 1.0f : 0.0f) - k[i] * c->h[0][j];
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            float sum = 0.0f;
+            for (unsigned l = 0; l < n; l++) sum += ikh[i][l] * pm[l][j];
+            t[i][j] = sum;
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = i; j < n; j++) {
+            float sum = 0.0f;
+            for (unsigned l = 0; l < n; l++) sum += t[i][l] * ikh[j][l];
+            sum += k[i] * c->r[0][0] * k[j];
+            s->p[i][j] = sum;
+            s->p[j][i] = sum;
+        }
+    }
+}
+
+/* ========== 计时 ========== */
+
+typedef struct {
+    double ns;
+    double cycles;
+} cost_t;
+
+#define TIME_LOOP(cost, rounds, body)                                              \
+    do {                                                                           \
+        bench_perf_start(perf_fd);                                                 \
+        uint64_t t0_ = bench_now_ns();                                             \
+        for (long r_ = 0; r_ < (rounds); r_++) {                                   \
+            for (size_t i = 0; i < RING; i++) {                                    \
+                body;                                                              \
+            }                                                                      \
+        }                                                                          \
+        uint64_t t1_ = bench_now_ns();                                             \
+        long long cycles_ = bench_perf_stop(perf_fd);                              \
+        double calls_ = (double)(rounds) * RING;                                   \
+        (cost).ns = (double)(t1_ - t0_) / calls_;                                  \
+        (cost).cycles = (cycles_ < 0) ? -1.0 : (double)cycles_ / calls_;           \
+    } while (0)
+
+static void report(unsigned n, const char* method, cost_t cost, cost_t baseline, int match) {
+    printf("%u,1,%s,%.2f,%.1f,%.2f,%d\n", n, method, cost.ns, cost.cycles, baseline.ns / cost.ns, match);
+}
+
+static int bench_states(unsigned n, long rounds) {
+    FB_KALMAN_Config_t full_config = chain_config(n, false);
+    FB_KALMAN_Config_t steady_config = chain_config(n, true);
+    static FB_KALMAN_t full;
+    static FB_KALMAN_t steady;
+    static looped_t looped;
+    if (FB_KALMAN_Init(&full, &full_config) != 0 || FB_KALMAN_Init(&steady, &steady_config) != 0) {
+        fprintf(stderr, "%u 个状态的模型初始化失败\n", n);
+        return 1;
+    }
+    memset(&looped, 0, sizeof(looped));
+    memcpy(looped.p, full_config.p0, sizeof(looped.p));
+
+    cost_t looped_cost, full_cost, steady_cost;
+    TIME_LOOP(looped_cost, rounds, looped_step(&full_config, &looped, measurements[i], inputs[i]));
+    TIME_LOOP(full_cost, rounds, FB_KALMAN_Execute(&full, &measurements[i], &inputs[i]));
+    TIME_LOOP(steady_cost, rounds, FB_KALMAN_Execute(&steady, &measurements[i], &inputs[i]));
+
+    /* 两者处理了相同的序列：状态估计只差舍入 */
+    int match = 1;
+    for (unsigned i = 0; i < n; i++) {
+        float scale = fmaxf(1.0f, fabsf(looped.x[i]));
+        match &= fabsf(full.state.x[i] - looped.x[i]) <= 1e-4f * scale;
+    }
+    report(n, "looped", looped_cost, looped_cost, 1);
+    report(n, "full", full_cost, looped_cost, match);
+    report(n, "steady", steady_cost, looped_cost, 1);
+    bench_consume(steady.state.x[0] + looped.x[0]);
+    return !match;
+}
+
+int main(int argc, char** argv) {
+    long target = bench_arg(argc, argv, 1, 1000000L);
+    long rounds = target / RING;
+    if (rounds < 1) {
+        rounds = 1;
+    }
+    fill_traces();
+
+    perf_fd = bench_perf_open(PERF_COUNT_HW_CPU_CYCLES);
+    if (perf_fd < 0) {
+        fprintf(stderr, "硬件性能计数器不可用，cycles_per_call 输出 -1\n");
+    }
+
+    int failed = 0;
+    printf("states,outputs,method,ns_per_call,cycles_per_call,speedup,match\n");
+    for (unsigned n = 1; n <= FB_KALMAN_MAX_STATES; n++) {
+        failed |= bench_states(n, rounds);
+    }
+    bench_perf_close(perf_fd);
+
+    if (failed) {
+        fprintf(stderr, "特化内核与通用循环实现的状态估计不一致\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file bench_process_image.c
+ * @brief 三缓冲过程映像基准：单次操作开销与跨进程延迟
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 1. 单次操作开销：同一进程内连续 publish / acquire（含整表写入）
+ * 2. 跨进程往返：父进程为控制进程，子进程（fork）为 I/O 进程
+ *    - I/O 进程写输入表并发布扫描计数 s
+ *    - 控制进程等到输入扫描计数为 s 后，写输出表并发布 s
+ *    - I/O 进程等到输出扫描计数为 s，记录往返时间
+ *    单程延迟取"发布时间戳 → 对端 acquire 看到"的间隔
+ *
+ * 等待对端时每次轮询失败都 sched_yield，因此单核主机上测得的是
+ * 调度器切换延迟；多核且两进程绑定不同 CPU 时才是缓存行传递延迟。
+ *
+ * 用法：bench_process_image [每通道 float 数=256] [往返次数=20000]
+ * 输出（stdout，CSV）：metric,floats,samples,p50_ns,p99_ns,max_ns
+ */
+
+#include "bench_common.h"
+#include "plcopen/process_image.h"
+#include <sched.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define CH_INPUT  0u
+#define CH_OUTPUT 1u
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void report(const char* metric, long floats, uint64_t* samples, long n) {
+    qsort(samples, (size_t)n, sizeof(uint64_t), compare_u64);
+    printf("%s,%ld,%ld,%llu,%llu,%llu\n", metric, floats, n,
+           (unsigned long long)samples[n / 2],
+           (unsigned long long)samples[(n * 99) / 100],
+           (unsigned long long)samples[n - 1]);
+}
+
+static void pin_to_cpu(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    /* 尽力而为：容器可能禁止设置亲和性 */
+    (void)sched_setaffinity(0, sizeof(set), &set);
+}
+
+static void fill(float* table, long floats, uint64_t scan) {
+    for (long i = 0; i < floats; i++) {
+        table[i] = (float)scan;
+    }
+}
+
+/* 单次操作开销：批量计时后取平均，每批 64 次 */
+static void bench_single_process(plcopen_pi_t* pi, long floats, long rounds,
+                                 uint64_t* samples) {
+    const long batch = 64;
+    long n = rounds / batch > 0 ? rounds / batch : 1;
+
+    for (long r = 0; r < n; r++) {
+        uint64_t t0 = bench_now_ns();
+        for (long b = 0; b < batch; b++) {
+            fill(plcopen_pi_write_begin(pi, CH_OUTPUT), floats, (uint64_t)(r * batch + b + 1));
+            plcopen_pi_publish(pi, CH_OUTPUT, (uint64_t)(r * batch + b + 1));
+        }
+        samples[r] = (bench_now_ns() - t0) / (uint64_t)batch;
+    }
+    report("publish_with_fill", floats, samples, n);
+
+    float acc = 0.0f;
+    for (long r = 0; r < n; r++) {
+        uint64_t t0 = bench_now_ns();
+        for (long b = 0; b < batch; b++) {
+            plcopen_pi_publish(pi, CH_INPUT, (uint64_t)b);
+            acc += plcopen_pi_acquire(pi, CH_INPUT, NULL)[0];
+        }
+        samples[r] = (bench_now_ns() - t0) / (uint64_t)batch;
+    }
+    bench_consume(acc);
+    report("publish_acquire_pair", floats, samples, n);
+}
+
+static int io_process(const char* name, long floats, long rounds, int result_fd) {
+    pin_to_cpu(1);
+    plcopen_pi_t pi;
+    if (plcopen_pi_open(&pi, name) != 0) {
+        return 2;
+    }
+
+    uint64_t* rtt = malloc((size_t)rounds * sizeof(uint64_t));
+    uint64_t* one_way = malloc((size_t)rounds * sizeof(uint64_t));
+    if (rtt == NULL || one_way == NULL) {
+        return 3;
+    }
+
+    for (long s = 1; s <= rounds; s++) {
+        fill(plcopen_pi_write_begin(&pi, CH_INPUT), floats, (uint64_t)s);
+        uint64_t t0 = bench_now_ns();
+        plcopen_pi_publish(&pi, CH_INPUT, (uint64_t)s);
+
+        uint64_t scan = 0;
+        while (plcopen_pi_acquire(&pi, CH_OUTPUT, &scan), scan != (uint64_t)s) {
+            sched_yield();
+        }
+        uint64_t t1 = bench_now_ns();
+        rtt[s - 1] = t1 - t0;
+        one_way[s - 1] = t1 - plcopen_pi_timestamp(&pi, CH_OUTPUT);
+    }
+
+    /* 结果经管道交给父进程统一输出，避免两个进程交错写 stdout */
+    ssize_t want = (ssize_t)((size_t)rounds * sizeof(uint64_t));
+    int ok = write(result_fd, rtt, (size_t)want) == want &&
+             write(result_fd, one_way, (size_t)want) == want;
+    plcopen_pi_close(&pi);
+    return ok ? 0 : 4;
+}
+
+static int read_all(int fd, void* buffer, size_t size) {
+    uint8_t* p = buffer;
+    while (size > 0u) {
+        ssize_t n = read(fd, p, size);
+        if (n <= 0) {
+            return -1;
+        }
+        p += n;
+        size -= (size_t)n;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    long floats = bench_arg(argc, argv, 1, 256);
+    long rounds = bench_arg(argc, argv, 2, 20000);
+
+    char name[PLCOPEN_PI_NAME_MAX];
+    snprintf(name, sizeof(name), "/plcopen_bench_pi_%ld", (long)getpid());
+    const uint32_t sizes[] = { (uint32_t)floats, (uint32_t)floats };
+
+    plcopen_pi_t pi;
+    if (plcopen_pi_create(&pi, name, sizes, 2, 0) != 0) {
+        perror("plcopen_pi_create");
+        return 1;
+    }
+
+    uint64_t* samples = malloc((size_t)rounds * sizeof(uint64_t));
+    if (samples == NULL) {
+        return 1;
+    }
+
+    printf("metric,floats,samples,p50_ns,p99_ns,max_ns\n");
+    bench_single_process(&pi, floats, rounds, samples);
+    plcopen_pi_close(&pi);
+
+    /* 重新创建，使跨进程部分从初始缓冲区分配开始 */
+    if (plcopen_pi_create(&pi, name, sizes, 2, PLCOPEN_PI_FORCE) != 0) {
+        perror("plcopen_pi_create");
+        return 1;
+    }
+
+    int pipe_fds[2];
+    if (pipe(pipe_fds) != 0) {
+        perror("pipe");
+        return 1;
+    }
+    fflush(stdout);
+    pid_t child = fork();
+    if (child < 0) {
+        perror("fork");
+        return 1;
+    }
+    if (child == 0) {
+        close(pipe_fds[0]);
+        _exit(io_process(name, floats, rounds, pipe_fds[1]));
+    }
+    close(pipe_fds[1]);
+
+    /* 控制进程：看到新输入后立即回写输出 */
+    pin_to_cpu(0);
+    float acc = 0.0f;
+    for (long s = 1; s <= rounds; s++) {
+        uint64_t scan = 0;
+        const float* in;
+        while (in = plcopen_pi_acquire(&pi, CH_INPUT, &scan), scan != (uint64_t)s) {
+            sched_yield();
+        }
+        acc += in[0];
+        fill(plcopen_pi_write_begin(&pi, CH_OUTPUT), floats, (uint64_t)s);
+        plcopen_pi_publish(&pi, CH_OUTPUT, (uint64_t)s);
+    }
+    bench_consume(acc);
+
+    uint64_t* one_way = malloc((size_t)rounds * sizeof(uint64_t));
+    int status = 0;
+    int ok = one_way != NULL &&
+             read_all(pipe_fds[0], samples, (size_t)rounds * sizeof(uint64_t)) == 0 &&
+             read_all(pipe_fds[0], one_way, (size_t)rounds * sizeof(uint64_t)) == 0;
+    close(pipe_fds[0]);
+    waitpid(child, &status, 0);
+    plcopen_pi_close(&pi);
+    plcopen_pi_unlink(name);
+
+    if (!ok || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "I/O 进程失败（状态 %d）\n", status);
+        return 1;
+    }
+    report("cross_process_round_trip", floats, samples, rounds);
+    report("cross_process_one_way", floats, one_way, rounds);
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 2) {
+        fprintf(stderr, "在线 CPU 数 %ld < 2，跨进程延迟主要是 sched_yield 引起的进程切换\n", cpus);
+    }
+    free(one_way);
+    free(samples);
+    return 0;
+}
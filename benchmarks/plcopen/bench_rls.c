@@ -0,0 +1,260 @@
+/**
+ * @file bench_rls.c
+ * @brief 数千个回路的在线辨识（FB_RLS）：UD 分解与标准形式递推最小二乘对比
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 模拟慢速任务中对 loops 个回路同时辨识 FOPDT 模型。每个回路是零阶保持采样的
+ * K·e^(−θs) / (T·s + 1) 过程（K、T、θ 与工作点各不相同，带方程误差噪声），
+ * 以 ARX(na = 1, nb = 2, d, 偏置) 辨识，遗忘因子 0.995。输入为围绕工作点的伪随机二进制序列，
+ * 中间三分之一的周期输入保持不变（稳态运行、无激励）。对比两种实现：
+ * - standard：本文件中的标准形式，直接更新对称矩阵 P = (P − P·φ·φᵀ·P / s) / λ（单精度）
+ * - ud：FB_RLS（Bierman UD 分解，D 限幅）
+ *
+ * 只对辨识部分计时，过程仿真不计入。结束时将参数换算为 FOPDT 模型，
+ * 给出增益与时间常数相对误差的中位数；diverged 为参数出现 NaN/Inf 或协方差对角元
+ * 非正的回路数。ud 出现发散时退出码为 1。
+ *
+ * 用法：bench_rls [回路数=4096] [每个回路的采样数=3000]
+ * 输出（stdout，CSV）：method,loops,samples,ns_per_update,gain_error_pct,time_constant_error_pct,diverged
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NP 4           /* a1, b1, b2, c */
+#define U_HISTORY 16   /* 不小于最大滞后 + nb */
+#define MAX_DELAY 8
+#define FORGETTING 0.995f
+#define COVARIANCE 100.0f
+
+typedef struct {
+    double pole;
+    double b1, b2, c;
+    double y;
+    float u[U_HISTORY];  /* u[0] 为 u(k−1) */
+    unsigned delay;
+    float gain, tau;     /* 真实值 */
+    float u0;
+    float level;
+} plant_t;
+
+typedef struct {
+    float theta[NP];
+    float p[NP][NP];
+    float y_last;        /* y(k−1) */
+} standard_t;
+
+static size_t loops;
+static plant_t* plants;
+static FB_RLS_t* ud;
+static standard_t* standard;
+static float* inputs;
+static float* outputs;
+static float* errors;
+
+static uint32_t seed = 2026u;
+
+static float uniform(void) {
+    seed = seed * 1664525u + 1013904223u;
+    return (float)(seed >> 8) / 16777216.0f;
+}
+
+static void plants_init(void) {
+    for (size_t i = 0; i < loops; i++) {
+        plant_t* p = &plants[i];
+        memset(p, 0, sizeof(*p));
+        p->gain = 0.5f + 1.5f * uniform();
+        p->tau = 5.0f + 45.0f * uniform();
+        p->delay = (unsigned)(uniform() * (MAX_DELAY + 1));
+        if (p->delay > MAX_DELAY) p->delay = MAX_DELAY;
+        double fraction = uniform();
+        p->pole = exp(-1.0 / p->tau);
+        double mid = pow(p->pole, 1.0 - fraction);
+        p->b1 = p->gain * (1.0 - mid);
+        p->b2 = p->gain * (mid - p->pole);
+        p->u0 = 100.0f * uniform();
+        double y0 = 100.0 * uniform();
+        p->c = (1.0 - p->pole) * (y0 - p->gain * p->u0);
+        p->y = y0;
+        for (unsigned j = 0; j < U_HISTORY; j++) p->u[j] = p->u0;
+        p->level = 1.0f;
+
+        FB_RLS_Config_t config = {
+            .sample_time = 1.0f, .forgetting = FORGETTING, .initial_covariance = COVARIANCE,
+            .na = 1, .nb = 2, .delay = (uint8_t)p->delay, .bias = true,
+        };
+        if (FB_RLS_Init(&ud[i], &config) != 0) {
+            fprintf(stderr, "FB_RLS 初始化失败\n");
+            exit(1);
+        }
+        memset(&standard[i], 0, sizeof(standard_t));
+        for (unsigned j = 0; j < NP; j++) standard[i].p[j][j] = COVARIANCE;
+        standard[i].y_last = (float)y0;
+    }
+}
+
+/* 过程前进一个周期：生成本周期的 u(k) 与 y(k) */
+static void plants_step(long k, long samples) {
+    bool steady = k >= samples / 3 && k < 2 * samples / 3;
+    for (size_t i = 0; i < loops; i++) {
+        plant_t* p = &plants[i];
+        if (!steady && k % 8 == 0 && uniform() < 0.5f) {
+            p->level = -p->level;
+        }
+        float u = steady ? p->u0 : p->u0 + p->level;
+        p->y = p->pole * p->y + p->b1 * p->u[p->delay] + p->b2 * p->u[p->delay + 1] + p->c
+               + 0.01 * (uniform() - 0.5f);
+        memmove(&p->u[1], &p->u[0], (U_HISTORY - 1) * sizeof(float));
+        p->u[0] = u;
+        inputs[i] = u;
+        outputs[i] = (float)p->y;
+    }
+}
+
+/* 标准形式：u 的历史直接取自过程（plants_step 已移入 u(k)，u(k−d−1) 位于 u[d + 1]） */
+static void __attribute__((noinline)) standard_step(standard_t* s, const plant_t* p, float y) {
+    const float phi[NP] = { -s->y_last, p->u[p->delay + 1], p->u[p->delay + 2], 1.0f };
+    float pphi[NP];
+    float den = FORGETTING;
+    float e = y;
+    for (unsigned i = 0; i < NP; i++) {
+        float sum = 0.0f;
+        for (unsigned j = 0; j < NP; j++) sum += s->p[i][j] * phi[j];
+        pphi[i] = sum;
+        den += phi[i] * sum;
+        e -= phi[i] * s->theta[i];
+    }
+    float inv = 1.0f / den;
+    for (unsigned i = 0; i < NP; i++) {
+        s->theta[i] += pphi[i] * inv * e;
+        for (unsigned j = i; j < NP; j++) {
+            float v = (s->p[i][j] - pphi[i] * pphi[j] * inv) * (1.0f / FORGETTING);
+            s->p[i][j] = v;
+            s->p[j][i] = v;
+        }
+    }
+    s->y_last = y;
+}
+
+/* na = 1、nb = 2 的参数换算为 FOPDT 增益与时间常数，极点不在 (0, 1) 内时返回 false */
+static bool fopdt(const float* theta, float* gain, float* tau) {
+    float pole = -theta[0];
+    if (!(pole > 0.0f && pole < 1.0f)) {
+        return false;
+    }
+    *gain = (theta[1] + theta[2]) / (1.0f - pole);
+    *tau = -1.0f / logf(pole);
+    return true;
+}
+
+static int compare_float(const void* a, const void* b) {
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+/* 中位数；无效回路记为 100% 误差 */
+static float median(float* values) {
+    qsort(values, loops, sizeof(float), compare_float);
+    return values[loops / 2];
+}
+
+static void report(const char* method, long samples, double ns, const float* const* thetas, size_t diverged) {
+    float* gain_errors = errors;
+    float* tau_errors = errors + loops;
+    for (size_t i = 0; i < loops; i++) {
+        float gain, tau;
+        if (fopdt(thetas[i], &gain, &tau)) {
+            gain_errors[i] = 100.0f * fabsf(gain - plants[i].gain) / plants[i].gain;
+            tau_errors[i] = 100.0f * fabsf(tau - plants[i].tau) / plants[i].tau;
+        } else {
+            gain_errors[i] = 100.0f;
+            tau_errors[i] = 100.0f;
+        }
+    }
+    float gain_error = median(gain_errors);
+    float tau_error = median(tau_errors);
+    printf("%s,%zu,%ld,%.2f,%.2f,%.2f,%zu\n", method, loops, samples, ns / ((double)samples * (double)loops),
+           gain_error, tau_error, diverged);
+}
+
+static bool finite_all(const float* v, unsigned n) {
+    for (unsigned i = 0; i < n; i++) {
+        if (!isfinite(v[i])) return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    loops = (size_t)bench_arg(argc, argv, 1, 4096);
+    long samples = bench_arg(argc, argv, 2, 3000L);
+
+    plants = malloc(loops * sizeof(plant_t));
+    ud = malloc(loops * sizeof(FB_RLS_t));
+    standard = malloc(loops * sizeof(standard_t));
+    inputs = malloc(loops * sizeof(float));
+    outputs = malloc(loops * sizeof(float));
+    errors = malloc(2 * loops * sizeof(float));
+    const float** thetas = malloc(loops * sizeof(const float*));
+    if (plants == NULL || ud == NULL || standard == NULL || inputs == NULL || outputs == NULL ||
+        errors == NULL || thetas == NULL) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+    plants_init();
+
+    double ud_ns = 0.0;
+    double standard_ns = 0.0;
+    for (long k = 0; k < samples; k++) {
+        plants_step(k, samples);
+
+        uint64_t t0 = bench_now_ns();
+        for (size_t i = 0; i < loops; i++) {
+            FB_RLS_Execute(&ud[i], inputs[i], outputs[i]);
+        }
+        uint64_t t1 = bench_now_ns();
+        for (size_t i = 0; i < loops; i++) {
+            standard_step(&standard[i], &plants[i], outputs[i]);
+        }
+        uint64_t t2 = bench_now_ns();
+        ud_ns += (double)(t1 - t0);
+        standard_ns += (double)(t2 - t1);
+    }
+
+    size_t standard_diverged = 0;
+    size_t ud_diverged = 0;
+    for (size_t i = 0; i < loops; i++) {
+        bool bad = !finite_all(standard[i].theta, NP);
+        for (unsigned j = 0; j < NP; j++) bad |= !(standard[i].p[j][j] > 0.0f);
+        standard_diverged += bad;
+        bad = !finite_all(ud[i].state.theta, NP);
+        for (unsigned j = 0; j < NP; j++) bad |= !(ud[i].state.d[j] > 0.0f);
+        ud_diverged += bad;
+    }
+
+    printf("method,loops,samples,ns_per_update,gain_error_pct,time_constant_error_pct,diverged\n");
+    for (size_t i = 0; i < loops; i++) thetas[i] = standard[i].theta;
+    report("standard", samples, standard_ns, thetas, standard_diverged);
+    for (size_t i = 0; i < loops; i++) thetas[i] = ud[i].state.theta;
+    report("ud", samples, ud_ns, thetas, ud_diverged);
+
+    bench_consume(ud[0].state.error + standard[0].theta[0]);
+    free(thetas);
+    free(errors);
+    free(outputs);
+    free(inputs);
+    free(standard);
+    free(ud);
+    free(plants);
+
+    if (ud_diverged != 0) {
+        fprintf(stderr, "UD 分解出现发散的回路\n");
+        return 1;
+    }
+    return 0;
+}
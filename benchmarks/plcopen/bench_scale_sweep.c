@@ -0,0 +1,451 @@
+/**
+ * @file bench_scale_sweep.c
+ * @brief 实例规模扫描基准：1 ~ 10^7 个实例跨越 L1 / L2 / L3 / DRAM 时的吞吐变化
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 实例数按 1-2-5 序列从 1 增长到上限（默认 10^7），每个规模下对每种功能块、
+ * 每种布局执行若干轮扫描：
+ *
+ * | layout | order | 适用功能块 |
+ * |--------|-------|------------|
+ * | aos | seq / shuffled | 全部七种（现有 FB_xxx_t 数组） |
+ * | compact | seq | PID / PT1 / RAMP / INTEGRATOR / DERIVATIVE（FB_xxx_Compact_t） |
+ * | shared | seq | PT1 / LIMIT（享元实例，配置共享） |
+ * | bank16 | seq | PT1 / DERIVATIVE（半精度 SoA bank，整 bank 一次 Execute） |
+ * | bank32 | seq | PID / PT1 / DERIVATIVE / LIMIT（float32 SoA bank，AArch64 上为 NEON 路径） |
+ *
+ * DEADBAND / RAMP / INTEGRATOR 目前没有 float SoA 实现，只测已有布局。
+ * shuffled 按随机排列访问 aos 数组，模拟按组态顺序调度的大型工程。
+ *
+ * 每轮扫描交替读取两个输入数组，避免输入恒定时滤波状态衰减到次正规数。
+ * 每个测量点的扫描轮数为 max(1, 目标执行次数 / 实例数)；首轮（含首次运行分支、
+ * 冷缓存）不计时。
+ *
+ * 列说明：
+ * - working_set_bytes：实例状态 + 输入（bank 另加输出，PID bank 另加设定值）的总字节数，用于对照各级缓存容量
+ * - state_bytes：每实例状态字节数（bank 为各 SoA 数组元素之和）
+ * - bytes_per_instance：工作集超出缓存后每实例每次执行需搬运的字节数（解析值）：
+ *   状态读取 + 写回（shuffled 按跨越的缓存行计），加 4 字节输入、4 字节排列索引（shuffled）
+ *   与 4 字节输出（bank）
+ * - cache_misses_per_instance：perf_event_open(PERF_COUNT_HW_CACHE_MISSES)，
+ *   容器或虚拟机中不可用时为 -1
+ *
+ * 用法：bench_scale_sweep [最大实例数=10000000] [每点目标执行次数=10000000]
+ * 输出（stdout，CSV，可直接以 instances 为对数横轴作图）：
+ *   fb,layout,order,instances,scans,working_set_bytes,state_bytes,
+ *   bytes_per_instance,ns_per_instance,cache_misses_per_instance
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <stdio.h>
+#include <string.h>
+
+#define CACHE_LINE 64
+
+static size_t max_instances;
+static long target_execs;
+static float* inputs[2];
+static float* outputs;
+static float* setpoints;
+static uint32_t* order;
+static int perf_fd = -1;
+
+static const FB_PID_Config_t pid_config = {
+    .kp = 1.5f, .ki = 0.2f, .kd = 0.01f, .sample_time = 0.01f,
+    .out_min = 0.0f, .out_max = 100.0f, .int_min = -100.0f, .int_max = 100.0f
+};
+static const FB_PT1_Config_t pt1_config = { .time_constant = 1.0f, .sample_time = 0.01f };
+static const FB_RAMP_Config_t ramp_config = {
+    .rise_rate = 10.0f, .fall_rate = 10.0f, .sample_time = 0.01f
+};
+static const FB_LIMIT_Config_t limit_config = { .min_val = 20.0f, .max_val = 80.0f };
+static const FB_DEADBAND_Config_t deadband_config = { .width = 5.0f, .center = 50.0f };
+static const FB_INTEGRATOR_Config_t integrator_config = {
+    .sample_time = 0.01f, .out_min = -100.0f, .out_max = 100.0f, .enable_limit = true
+};
+static const FB_DERIVATIVE_Config_t derivative_config = {
+    .sample_time = 0.01f, .filter_time_constant = 0.05f
+};
+static FB_PT1_SharedConfig_t pt1_shared;
+static FB_LIMIT_SharedConfig_t limit_shared;
+
+/* ========== 规模与排列 ========== */
+
+/** 1-2-5 序列的下一个规模；超过上限返回 0 */
+static size_t next_size(size_t n) {
+    size_t decade = 1;
+    while (decade * 10 <= n) {
+        decade *= 10;
+    }
+    size_t lead = n / decade;
+    size_t next = (lead == 1) ? 2 * decade : (lead == 2) ? 5 * decade : 10 * decade;
+    return next <= max_instances ? next : 0;
+}
+
+static long scans_for(size_t n) {
+    long scans = target_execs / (long)n;
+    return scans > 0 ? scans : 1;
+}
+
+/* xorshift 伪随机数，保证各次运行排列一致 */
+static uint32_t rng_state = 2463534242u;
+
+static uint32_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/** 生成 0..n-1 的随机排列（Fisher-Yates） */
+static void shuffle_order(size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        order[i] = (uint32_t)i;
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = rng_next() % (i + 1);
+        uint32_t tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+}
+
+/**
+ * @brief 64 字节对齐数组中，每个 size 字节实例平均跨越的缓存行数
+ */
+static double lines_spanned(size_t size) {
+    size_t total = 0;
+    for (size_t i = 0; i < CACHE_LINE; i++) {
+        size_t start = i * size;
+        size_t end = start + size - 1;
+        total += end / CACHE_LINE - start / CACHE_LINE + 1;
+    }
+    return (double)total / CACHE_LINE;
+}
+
+static void* alloc_lines(size_t bytes) {
+    size_t rounded = (bytes + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    return aligned_alloc(CACHE_LINE, rounded);
+}
+
+/* ========== 报告 ========== */
+
+typedef enum { ORDER_SEQ, ORDER_SHUFFLED } order_t;
+
+static void report(const char* fb, const char* layout, order_t ord, size_t n, long scans,
+                   size_t state_bytes, size_t io_bytes, uint64_t elapsed_ns, long long misses) {
+    double steps = (double)n * (double)scans;
+    double state_moved = (ord == ORDER_SEQ)
+                             ? 2.0 * (double)state_bytes
+                             : 2.0 * lines_spanned(state_bytes) * CACHE_LINE;
+    double moved = state_moved + (double)io_bytes + (ord == ORDER_SHUFFLED ? 4.0 : 0.0);
+    printf("%s,%s,%s,%zu,%ld,%zu,%zu,%.1f,%.3f,%.3f\n", fb, layout,
+           ord == ORDER_SEQ ? "seq" : "shuffled", n, scans, n * (state_bytes + io_bytes),
+           state_bytes, moved, (double)elapsed_ns / steps,
+           misses < 0 ? -1.0 : (double)misses / steps);
+    fflush(stdout);
+}
+
+/* ========== 逐实例布局（aos / compact / shared） ========== */
+
+/*
+ * 以宏生成各功能块/布局的规模扫描函数：数组按最大规模分配一次，
+ * 每个规模重新初始化前 n 个实例后计时。shuffled 非零时额外测量乱序访问。
+ */
+#define DEFINE_SWEEP(name, fb_name, layout, type, init, call, shuffled)                \
+    static void name(void) {                                                           \
+        type* fbs = alloc_lines(max_instances * sizeof(type));                         \
+        if (fbs == NULL) {                                                             \
+            fprintf(stderr, "%s/%s: 内存不足，跳过\n", fb_name, layout);               \
+            return;                                                                    \
+        }                                                                              \
+        for (size_t n = 1; n != 0; n = next_size(n)) {                                 \
+            long scans = scans_for(n);                                                 \
+            for (int o = 0; o < ((shuffled) ? 2 : 1); o++) {                           \
+                if (o == ORDER_SHUFFLED) {                                             \
+                    shuffle_order(n);                                                  \
+                }                                                                      \
+                for (size_t i = 0; i < n; i++) {                                       \
+                    type* fb = &fbs[i];                                                \
+                    init;                                                              \
+                }                                                                      \
+                float acc = 0.0f;                                                      \
+                uint64_t t0 = 0;                                                       \
+                for (long s = -1; s < scans; s++) {                                    \
+                    if (s == 0) {                                                      \
+                        bench_perf_start(perf_fd);                                     \
+                        t0 = bench_now_ns();                                           \
+                    }                                                                  \
+                    const float* in = inputs[s & 1];                                   \
+                    if (o == ORDER_SEQ) {                                              \
+                        for (size_t k = 0; k < n; k++) {                               \
+                            type* fb = &fbs[k];                                        \
+                            float u = in[k];                                           \
+                            acc += call;                                               \
+                        }                                                              \
+                    } else {                                                           \
+                        for (size_t k = 0; k < n; k++) {                               \
+                            type* fb = &fbs[order[k]];                                 \
+                            float u = in[order[k]];                                    \
+                            acc += call;                                               \
+                        }                                                              \
+                    }                                                                  \
+                }                                                                      \
+                uint64_t elapsed = bench_now_ns() - t0;                                \
+                long long misses = bench_perf_stop(perf_fd);                           \
+                bench_consume(acc);                                                    \
+                report(fb_name, layout, (order_t)o, n, scans, sizeof(type),            \
+                       sizeof(float), elapsed, misses);                                \
+            }                                                                          \
+        }                                                                              \
+        free(fbs);                                                                     \
+    }
+
+DEFINE_SWEEP(sweep_pid_aos, "PID", "aos", FB_PID_t,
+             FB_PID_Init(fb, &pid_config), FB_PID_Execute(fb, 50.0f, u), 1)
+DEFINE_SWEEP(sweep_pid_compact, "PID", "compact", FB_PID_Compact_t,
+             FB_PID_Compact_Init(fb, &pid_config), FB_PID_Compact_Execute(fb, 50.0f, u), 0)
+DEFINE_SWEEP(sweep_pt1_aos, "PT1", "aos", FB_PT1_t,
+             FB_PT1_Init(fb, &pt1_config), FB_PT1_Execute(fb, u), 1)
+DEFINE_SWEEP(sweep_pt1_compact, "PT1", "compact", FB_PT1_Compact_t,
+             FB_PT1_Compact_Init(fb, &pt1_config), FB_PT1_Compact_Execute(fb, u), 0)
+DEFINE_SWEEP(sweep_pt1_shared, "PT1", "shared", FB_PT1_Shared_t,
+             FB_PT1_Shared_Init(fb, &pt1_shared), FB_PT1_Shared_Execute(fb, &pt1_shared, u), 0)
+DEFINE_SWEEP(sweep_ramp_aos, "RAMP", "aos", FB_RAMP_t,
+             FB_RAMP_Init(fb, &ramp_config), FB_RAMP_Execute(fb, u), 1)
+DEFINE_SWEEP(sweep_ramp_compact, "RAMP", "compact", FB_RAMP_Compact_t,
+             FB_RAMP_Compact_Init(fb, &ramp_config), FB_RAMP_Compact_Execute(fb, u), 0)
+DEFINE_SWEEP(sweep_limit_aos, "LIMIT", "aos", FB_LIMIT_t,
+             FB_LIMIT_Init(fb, &limit_config), FB_LIMIT_Execute(fb, u), 1)
+DEFINE_SWEEP(sweep_limit_shared, "LIMIT", "shared", FB_LIMIT_Shared_t,
+             FB_LIMIT_Shared_Init(fb, &limit_shared), FB_LIMIT_Shared_Execute(fb, &limit_shared, u), 0)
+DEFINE_SWEEP(sweep_deadband_aos, "DEADBAND", "aos", FB_DEADBAND_t,
+             FB_DEADBAND_Init(fb, &deadband_config), FB_DEADBAND_Execute(fb, u), 1)
+DEFINE_SWEEP(sweep_integrator_aos, "INTEGRATOR", "aos", FB_INTEGRATOR_t,
+             FB_INTEGRATOR_Init(fb, &integrator_config), FB_INTEGRATOR_Execute(fb, u), 1)
+DEFINE_SWEEP(sweep_integrator_compact, "INTEGRATOR", "compact", FB_INTEGRATOR_Compact_t,
+             FB_INTEGRATOR_Compact_Init(fb, &integrator_config),
+             FB_INTEGRATOR_Compact_Execute(fb, u), 0)
+DEFINE_SWEEP(sweep_derivative_aos, "DERIVATIVE", "aos", FB_DERIVATIVE_t,
+             FB_DERIVATIVE_Init(fb, &derivative_config), FB_DERIVATIVE_Execute(fb, u), 1)
+DEFINE_SWEEP(sweep_derivative_compact, "DERIVATIVE", "compact", FB_DERIVATIVE_Compact_t,
+             FB_DERIVATIVE_Compact_Init(fb, &derivative_config),
+             FB_DERIVATIVE_Compact_Execute(fb, u), 0)
+
+/* ========== SoA bank ========== */
+
+/* 整 bank 一次 Execute（call 中 in 为本轮输入）；输出写入 outputs 数组 */
+#define TIME_BANK(fb_name, layout, state_bytes, io_bytes, call)                   \
+    do {                                                                          \
+        long scans = scans_for(n);                                                \
+        uint64_t t0 = 0;                                                          \
+        for (long s = -1; s < scans; s++) {                                       \
+            if (s == 0) {                                                         \
+                bench_perf_start(perf_fd);                                        \
+                t0 = bench_now_ns();                                              \
+            }                                                                     \
+            const float* in = inputs[s & 1];                                      \
+            call;                                                                 \
+        }                                                                         \
+        uint64_t elapsed = bench_now_ns() - t0;                                   \
+        long long misses = bench_perf_stop(perf_fd);                              \
+        bench_consume(outputs[n - 1]);                                            \
+        report(fb_name, layout, ORDER_SEQ, n, scans, state_bytes,                 \
+               io_bytes, elapsed, misses);                                        \
+    } while (0)
+
+static void sweep_pt1_bank16(void) {
+    plc_half_t* out = alloc_lines(max_instances * sizeof(plc_half_t));
+    plc_half_t* alpha = alloc_lines(max_instances * sizeof(plc_half_t));
+    int8_t* status = alloc_lines(max_instances * sizeof(int8_t));
+    if (out != NULL && alpha != NULL && status != NULL) {
+        for (size_t n = 1; n != 0; n = next_size(n)) {
+            FB_PT1_Bank16_t bank;
+            FB_PT1_Bank16_Init(&bank, out, alpha, status, n, pt1_config.sample_time);
+            for (size_t i = 0; i < n; i++) {
+                FB_PT1_Bank16_Configure(&bank, i, pt1_config.time_constant);
+            }
+            TIME_BANK("PT1", "bank16", 2 * sizeof(plc_half_t) + sizeof(int8_t), 2 * sizeof(float),
+                      FB_PT1_Bank16_Execute(&bank, in, outputs));
+        }
+    } else {
+        fprintf(stderr, "PT1/bank16: 内存不足，跳过\n");
+    }
+    free(out);
+    free(alpha);
+    free(status);
+}
+
+static void sweep_derivative_bank16(void) {
+    plc_half_t* prev = alloc_lines(max_instances * sizeof(plc_half_t));
+    plc_half_t* filtered = alloc_lines(max_instances * sizeof(plc_half_t));
+    plc_half_t* alpha = alloc_lines(max_instances * sizeof(plc_half_t));
+    int8_t* status = alloc_lines(max_instances * sizeof(int8_t));
+    if (prev != NULL && filtered != NULL && alpha != NULL && status != NULL) {
+        for (size_t n = 1; n != 0; n = next_size(n)) {
+            FB_DERIVATIVE_Bank16_t bank;
+            FB_DERIVATIVE_Bank16_Init(&bank, prev, filtered, alpha, status, n,
+                                      derivative_config.sample_time);
+            for (size_t i = 0; i < n; i++) {
+                FB_DERIVATIVE_Bank16_Configure(&bank, i, derivative_config.filter_time_constant);
+            }
+            TIME_BANK("DERIVATIVE", "bank16", 3 * sizeof(plc_half_t) + sizeof(int8_t),
+                      2 * sizeof(float), FB_DERIVATIVE_Bank16_Execute(&bank, in, outputs));
+        }
+    } else {
+        fprintf(stderr, "DERIVATIVE/bank16: 内存不足，跳过\n");
+    }
+    free(prev);
+    free(filtered);
+    free(alpha);
+    free(status);
+}
+
+/* float32 bank：浮点存储按最大规模分配一次，每个规模重新 Init 前 n 个实例 */
+static void sweep_pid_bank32(void) {
+    float* floats = alloc_lines(max_instances * FB_PID_BANK32_FLOATS * sizeof(float));
+    uint8_t* flags = alloc_lines(max_instances * sizeof(uint8_t));
+    int8_t* status = alloc_lines(max_instances * sizeof(int8_t));
+    if (floats != NULL && flags != NULL && status != NULL) {
+        for (size_t n = 1; n != 0; n = next_size(n)) {
+            FB_PID_Bank32_t bank;
+            FB_PID_Bank32_Init(&bank, floats, flags, status, n, pid_config.sample_time);
+            for (size_t i = 0; i < n; i++) {
+                FB_PID_Bank32_Configure(&bank, i, &pid_config);
+            }
+            TIME_BANK("PID", "bank32", FB_PID_BANK32_FLOATS * sizeof(float) + 2 * sizeof(int8_t),
+                      3 * sizeof(float), FB_PID_Bank32_Execute(&bank, setpoints, in, outputs));
+        }
+    } else {
+        fprintf(stderr, "PID/bank32: 内存不足，跳过\n");
+    }
+    free(floats);
+    free(flags);
+    free(status);
+}
+
+static void sweep_pt1_bank32(void) {
+    float* floats = alloc_lines(max_instances * FB_PT1_BANK32_FLOATS * sizeof(float));
+    uint8_t* flags = alloc_lines(max_instances * sizeof(uint8_t));
+    int8_t* status = alloc_lines(max_instances * sizeof(int8_t));
+    if (floats != NULL && flags != NULL && status != NULL) {
+        for (size_t n = 1; n != 0; n = next_size(n)) {
+            FB_PT1_Bank32_t bank;
+            FB_PT1_Bank32_Init(&bank, floats, flags, status, n, pt1_config.sample_time);
+            for (size_t i = 0; i < n; i++) {
+                FB_PT1_Bank32_Configure(&bank, i, pt1_config.time_constant);
+            }
+            TIME_BANK("PT1", "bank32", FB_PT1_BANK32_FLOATS * sizeof(float) + 2 * sizeof(int8_t),
+                      2 * sizeof(float), FB_PT1_Bank32_Execute(&bank, in, outputs));
+        }
+    } else {
+        fprintf(stderr, "PT1/bank32: 内存不足，跳过\n");
+    }
+    free(floats);
+    free(flags);
+    free(status);
+}
+
+static void sweep_derivative_bank32(void) {
+    float* floats = alloc_lines(max_instances * FB_DERIVATIVE_BANK32_FLOATS * sizeof(float));
+    uint8_t* flags = alloc_lines(max_instances * sizeof(uint8_t));
+    int8_t* status = alloc_lines(max_instances * sizeof(int8_t));
+    if (floats != NULL && flags != NULL && status != NULL) {
+        for (size_t n = 1; n != 0; n = next_size(n)) {
+            FB_DERIVATIVE_Bank32_t bank;
+            FB_DERIVATIVE_Bank32_Init(&bank, floats, flags, status, n, derivative_config.sample_time);
+            for (size_t i = 0; i < n; i++) {
+                FB_DERIVATIVE_Bank32_Configure(&bank, i, derivative_config.filter_time_constant);
+            }
+            TIME_BANK("DERIVATIVE", "bank32",
+                      FB_DERIVATIVE_BANK32_FLOATS * sizeof(float) + 2 * sizeof(int8_t),
+                      2 * sizeof(float), FB_DERIVATIVE_Bank32_Execute(&bank, in, outputs));
+        }
+    } else {
+        fprintf(stderr, "DERIVATIVE/bank32: 内存不足，跳过\n");
+    }
+    free(floats);
+    free(flags);
+    free(status);
+}
+
+static void sweep_limit_bank32(void) {
+    float* floats = alloc_lines(max_instances * FB_LIMIT_BANK32_FLOATS * sizeof(float));
+    int8_t* status = alloc_lines(max_instances * sizeof(int8_t));
+    if (floats != NULL && status != NULL) {
+        for (size_t n = 1; n != 0; n = next_size(n)) {
+            FB_LIMIT_Bank32_t bank;
+            FB_LIMIT_Bank32_Init(&bank, floats, status, n);
+            for (size_t i = 0; i < n; i++) {
+                FB_LIMIT_Bank32_Configure(&bank, i, limit_config.min_val, limit_config.max_val);
+            }
+            TIME_BANK("LIMIT", "bank32", FB_LIMIT_BANK32_FLOATS * sizeof(float) + sizeof(int8_t),
+                      2 * sizeof(float), FB_LIMIT_Bank32_Execute(&bank, in, outputs));
+        }
+    } else {
+        fprintf(stderr, "LIMIT/bank32: 内存不足，跳过\n");
+    }
+    free(floats);
+    free(status);
+}
+
+int main(int argc, char** argv) {
+    max_instances = (size_t)bench_arg(argc, argv, 1, 10000000L);
+    target_execs = bench_arg(argc, argv, 2, 10000000L);
+
+    inputs[0] = malloc(max_instances * sizeof(float));
+    inputs[1] = malloc(max_instances * sizeof(float));
+    outputs = malloc(max_instances * sizeof(float));
+    setpoints = malloc(max_instances * sizeof(float));
+    order = malloc(max_instances * sizeof(uint32_t));
+    if (inputs[0] == NULL || inputs[1] == NULL || outputs == NULL || setpoints == NULL ||
+        order == NULL) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+    for (size_t i = 0; i < max_instances; i++) {
+        inputs[0][i] = 40.0f + (float)(i % 32) * 0.5f;
+        inputs[1][i] = inputs[0][i] + 1.0f;
+        setpoints[i] = 50.0f;
+    }
+    FB_PT1_SharedConfig_Set(&pt1_shared, &pt1_config);
+    FB_LIMIT_SharedConfig_Set(&limit_shared, &limit_config);
+
+    perf_fd = bench_perf_open(PERF_COUNT_HW_CACHE_MISSES);
+    if (perf_fd < 0) {
+        fprintf(stderr, "硬件性能计数器不可用，cache_misses_per_instance 输出 -1\n");
+    }
+
+    printf("fb,layout,order,instances,scans,working_set_bytes,state_bytes,"
+           "bytes_per_instance,ns_per_instance,cache_misses_per_instance\n");
+    sweep_pid_aos();
+    sweep_pid_compact();
+    sweep_pid_bank32();
+    sweep_pt1_aos();
+    sweep_pt1_compact();
+    sweep_pt1_shared();
+    sweep_pt1_bank16();
+    sweep_pt1_bank32();
+    sweep_ramp_aos();
+    sweep_ramp_compact();
+    sweep_limit_aos();
+    sweep_limit_shared();
+    sweep_limit_bank32();
+    sweep_deadband_aos();
+    sweep_integrator_aos();
+    sweep_integrator_compact();
+    sweep_derivative_aos();
+    sweep_derivative_compact();
+    sweep_derivative_bank16();
+    sweep_derivative_bank32();
+
+    bench_perf_close(perf_fd);
+    free(inputs[0]);
+    free(inputs[1]);
+    free(outputs);
+    free(setpoints);
+    free(order);
+    return 0;
+}
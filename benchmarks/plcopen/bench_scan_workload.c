@@ -0,0 +1,150 @@
+/**
+ * @file bench_scan_workload.c
+ * @brief 代表性扫描负载：PID/PT1/RAMP 混合回路网络
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 模拟一个典型软 PLC 扫描周期，每个回路包含：
+ * - RAMP：设定值斜坡（目标值周期性阶跃）
+ * - PT1：测量值滤波
+ * - PID：回路控制器（部分回路会进入饱和，部分回路周期性切手动）
+ * - PT1：被控对象模型（一阶惯性过程）
+ *
+ * 每个扫描周期按功能块类型分阶段执行，分别计时，得到每类功能块的
+ * 平均单次执行时间。该负载同时作为 PGO 的训练负载
+ * （见 scripts/build/pgo-pipeline.sh），因此覆盖了正常调节、饱和、
+ * 手动/自动切换等主要分支。
+ *
+ * 用法：bench_scan_workload [回路数=256] [扫描周期数=20000]
+ * 输出（stdout，CSV）：fb,calls,total_ns,ns_per_call
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <stdio.h>
+
+/* 回路数上限（静态分配） */
+#define MAX_LOOPS 4096
+
+/* 设定值阶跃周期（扫描次数） */
+#define TARGET_PERIOD 500
+
+/* 手动模式切换周期（扫描次数） */
+#define MANUAL_PERIOD 2000
+
+typedef struct {
+    FB_RAMP_t sp_ramp;    /**< 设定值斜坡 */
+    FB_PT1_t pv_filter;   /**< 测量值滤波 */
+    FB_PID_t pid;         /**< 回路控制器 */
+    FB_PT1_t plant;       /**< 被控对象模型 */
+    float setpoint;       /**< 当前斜坡后设定值 */
+    float pv;             /**< 当前滤波后测量值 */
+    float mv;             /**< 当前控制输出 */
+} Loop_t;
+
+static Loop_t loops[MAX_LOOPS];
+
+enum { PHASE_RAMP, PHASE_PT1, PHASE_PID, PHASE_COUNT };
+
+static const char* const phase_names[PHASE_COUNT] = { "RAMP", "PT1", "PID" };
+
+static void init_loops(int n_loops) {
+    for (int i = 0; i < n_loops; i++) {
+        Loop_t* loop = &loops[i];
+
+        FB_RAMP_Config_t ramp_cfg = {
+            .rise_rate = 5.0f + (float)(i % 7),
+            .fall_rate = 8.0f + (float)(i % 5),
+            .sample_time = 0.01f
+        };
+        FB_PT1_Config_t filter_cfg = { .time_constant = 0.05f, .sample_time = 0.01f };
+        FB_PT1_Config_t plant_cfg = {
+            .time_constant = 0.5f + 0.1f * (float)(i % 10),
+            .sample_time = 0.01f
+        };
+        /* 每 4 个回路中有 1 个输出范围偏窄，必然进入饱和 */
+        FB_PID_Config_t pid_cfg = {
+            .kp = 2.0f, .ki = 0.5f, .kd = 0.02f,
+            .sample_time = 0.01f,
+            .out_min = 0.0f, .out_max = (i % 4 == 0) ? 40.0f : 100.0f,
+            .int_min = -50.0f, .int_max = 50.0f
+        };
+
+        FB_RAMP_Init(&loop->sp_ramp, &ramp_cfg);
+        FB_PT1_Init(&loop->pv_filter, &filter_cfg);
+        FB_PID_Init(&loop->pid, &pid_cfg);
+        FB_PT1_Init(&loop->plant, &plant_cfg);
+        loop->setpoint = 0.0f;
+        loop->pv = 0.0f;
+        loop->mv = 0.0f;
+    }
+}
+
+static float target_for(int loop_index, long scan) {
+    long step = (scan + loop_index * 37) / TARGET_PERIOD;
+    return (step % 2 == 0) ? 20.0f + (float)(loop_index % 30) : 60.0f;
+}
+
+int main(int argc, char** argv) {
+    int n_loops = (int)bench_arg(argc, argv, 1, 256);
+    long n_scans = bench_arg(argc, argv, 2, 20000);
+    if (n_loops > MAX_LOOPS) {
+        n_loops = MAX_LOOPS;
+    }
+
+    uint64_t phase_ns[PHASE_COUNT] = { 0 };
+    uint64_t phase_calls[PHASE_COUNT] = { 0 };
+
+    init_loops(n_loops);
+    fprintf(stderr, "扫描负载：%d 个回路 × %ld 个扫描周期\n", n_loops, n_scans);
+
+    for (long scan = 0; scan < n_scans; scan++) {
+        /* 周期性将 1/16 的回路切到手动再切回，覆盖无扰切换路径 */
+        if (scan % MANUAL_PERIOD == MANUAL_PERIOD / 2) {
+            for (int i = 0; i < n_loops; i += 16) {
+                FB_PID_SetManual(&loops[i].pid, loops[i].mv);
+            }
+        } else if (scan % MANUAL_PERIOD == 0) {
+            for (int i = 0; i < n_loops; i += 16) {
+                FB_PID_SetAuto(&loops[i].pid);
+            }
+        }
+
+        uint64_t t0 = bench_now_ns();
+        for (int i = 0; i < n_loops; i++) {
+            loops[i].setpoint = FB_RAMP_Execute(&loops[i].sp_ramp, target_for(i, scan));
+        }
+        uint64_t t1 = bench_now_ns();
+        for (int i = 0; i < n_loops; i++) {
+            float process = FB_PT1_Execute(&loops[i].plant, loops[i].mv);
+            loops[i].pv = FB_PT1_Execute(&loops[i].pv_filter, process);
+        }
+        uint64_t t2 = bench_now_ns();
+        for (int i = 0; i < n_loops; i++) {
+            loops[i].mv = FB_PID_Execute(&loops[i].pid, loops[i].setpoint, loops[i].pv);
+        }
+        uint64_t t3 = bench_now_ns();
+
+        phase_ns[PHASE_RAMP] += t1 - t0;
+        phase_ns[PHASE_PT1] += t2 - t1;
+        phase_ns[PHASE_PID] += t3 - t2;
+        phase_calls[PHASE_RAMP] += (uint64_t)n_loops;
+        phase_calls[PHASE_PT1] += 2u * (uint64_t)n_loops;
+        phase_calls[PHASE_PID] += (uint64_t)n_loops;
+    }
+
+    float checksum = 0.0f;
+    for (int i = 0; i < n_loops; i++) {
+        checksum += loops[i].mv;
+    }
+    bench_consume(checksum);
+
+    printf("fb,calls,total_ns,ns_per_call\n");
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        printf("%s,%llu,%llu,%.3f\n", phase_names[p],
+               (unsigned long long)phase_calls[p],
+               (unsigned long long)phase_ns[p],
+               (double)phase_ns[p] / (double)phase_calls[p]);
+    }
+    return 0;
+}
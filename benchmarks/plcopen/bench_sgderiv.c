@@ -0,0 +1,193 @@
+/**
+ * @file bench_sgderiv.c
+ * @brief 最小二乘微分器（FB_SGDERIV）与 FB_DERIVATIVE + PT1 滤波在相同噪声抑制下的对比基准
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 采样周期 1 ms，对每个窗口长度 N：
+ * 1. 以均匀白噪声（±0.01，模拟 ADC 量化）测得 FB_SGDERIV 输出的噪声 RMS
+ * 2. 二分 FB_DERIVATIVE 的 filter_time_constant，使其噪声 RMS 与 FB_SGDERIV 相同
+ * 3. 在相同噪声抑制下比较：
+ *    - ns_per_call：单次 Execute 开销（窗口长度不影响 FB_SGDERIV 的开销）
+ *    - settle_ms：斜坡起点之后输出进入真实斜率 ±5 % 并保持的时间
+ *    - sine_rms_error：2 Hz 正弦（无噪声）上相对真实导数的 RMS 误差（反映滞后）
+ *
+ * FB_SGDERIV 的噪声 RMS 偏离理论值 σ·sqrt(12 / (N(N² - 1)))/Ts 超过 10 % 时退出码为 1。
+ *
+ * 用法：bench_sgderiv [每种方式的计时调用次数=4000000]
+ * 输出（stdout，CSV）：method,window,tf_ms,ns_per_call,noise_rms,settle_ms,sine_rms_error
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <math.h>
+#include <stdio.h>
+
+#define SAMPLE_TIME 0.001f
+#define NOISE_AMPLITUDE 0.01f
+#define NOISE_SAMPLES 20000
+#define SINE_FREQ 2.0
+
+/* 计时用输入序列循环使用 */
+#define RING 4096
+
+static float noise_trace[NOISE_SAMPLES];
+static float timing_inputs[RING];
+static float outputs[RING];
+
+static void fill_traces(void) {
+    uint32_t seed = 2024u;
+    for (size_t i = 0; i < NOISE_SAMPLES; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        noise_trace[i] = NOISE_AMPLITUDE * ((float)(seed >> 8) / 8388608.0f - 1.0f);
+    }
+    for (size_t i = 0; i < RING; i++) {
+        timing_inputs[i] = 50.0f + 10.0f * sinf(0.003f * (float)i) + noise_trace[i];
+    }
+}
+
+/* ========== 两种微分器的统一接口 ========== */
+
+typedef struct {
+    bool use_sg;
+    FB_SGDERIV_t sg;
+    FB_DERIVATIVE_t derivative;
+} differentiator_t;
+
+static void diff_init(differentiator_t* d, bool use_sg, uint16_t window, float tf) {
+    d->use_sg = use_sg;
+    if (use_sg) {
+        FB_SGDERIV_Config_t config = { .sample_time = SAMPLE_TIME, .window = window };
+        FB_SGDERIV_Init(&d->sg, &config);
+    } else {
+        FB_DERIVATIVE_Config_t config = { .sample_time = SAMPLE_TIME, .filter_time_constant = tf };
+        FB_DERIVATIVE_Init(&d->derivative, &config);
+    }
+}
+
+static float diff_execute(differentiator_t* d, float input) {
+    return d->use_sg ? FB_SGDERIV_Execute(&d->sg, input) : FB_DERIVATIVE_Execute(&d->derivative, input);
+}
+
+/* ========== 度量 ========== */
+
+static double noise_rms(bool use_sg, uint16_t window, float tf) {
+    differentiator_t d;
+    diff_init(&d, use_sg, window, tf);
+    double power = 0.0;
+    size_t counted = 0;
+    for (size_t i = 0; i < NOISE_SAMPLES; i++) {
+        double y = diff_execute(&d, noise_trace[i]);
+        if (i >= NOISE_SAMPLES / 10) {  /* 跳过建立过程 */
+            power += y * y;
+            counted++;
+        }
+    }
+    return sqrt(power / (double)counted);
+}
+
+/* 斜坡（1 单位/秒）从第 100 个采样开始，返回进入 ±5 % 后不再离开的时间 */
+static double settle_ms(bool use_sg, uint16_t window, float tf) {
+    differentiator_t d;
+    diff_init(&d, use_sg, window, tf);
+    const size_t start = 100;
+    const size_t count = 5000;
+    size_t last_outside = start;
+    for (size_t i = 0; i < count; i++) {
+        float input = (i > start) ? (float)(i - start) * SAMPLE_TIME : 0.0f;
+        float output = diff_execute(&d, input);
+        if (i >= start && fabsf(output - 1.0f) > 0.05f) {
+            last_outside = i + 1;
+        }
+    }
+    return (double)(last_outside - start) * SAMPLE_TIME * 1000.0;
+}
+
+static double sine_rms_error(bool use_sg, uint16_t window, float tf) {
+    differentiator_t d;
+    diff_init(&d, use_sg, window, tf);
+    const double w = 2.0 * M_PI * SINE_FREQ;
+    const size_t count = 5000;
+    double power = 0.0;
+    size_t counted = 0;
+    for (size_t i = 0; i < count; i++) {
+        double t = (double)i * SAMPLE_TIME;
+        float output = diff_execute(&d, (float)sin(w * t));
+        if (i >= count / 5) {
+            double error = (double)output - w * cos(w * t);
+            power += error * error;
+            counted++;
+        }
+    }
+    return sqrt(power / (double)counted);
+}
+
+static double ns_per_call(bool use_sg, uint16_t window, float tf, long rounds) {
+    differentiator_t d;
+    diff_init(&d, use_sg, window, tf);
+    uint64_t t0 = bench_now_ns();
+    if (use_sg) {
+        for (long r = 0; r < rounds; r++) {
+            for (size_t i = 0; i < RING; i++) {
+                outputs[i] = FB_SGDERIV_Execute(&d.sg, timing_inputs[i]);
+            }
+        }
+    } else {
+        for (long r = 0; r < rounds; r++) {
+            for (size_t i = 0; i < RING; i++) {
+                outputs[i] = FB_DERIVATIVE_Execute(&d.derivative, timing_inputs[i]);
+            }
+        }
+    }
+    uint64_t t1 = bench_now_ns();
+    bench_consume(outputs[RING - 1]);
+    return (double)(t1 - t0) / (double)(rounds * RING);
+}
+
+/* 噪声 RMS 随 Tf 单调下降：在对数尺度上二分出与目标相同的 Tf */
+static float matching_filter_time(double target_rms) {
+    double lo = log(1e-5);
+    double hi = log(10.0);
+    for (int i = 0; i < 40; i++) {
+        double mid = 0.5 * (lo + hi);
+        if (noise_rms(false, 0, (float)exp(mid)) > target_rms) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return (float)exp(hi);
+}
+
+static void report(const char* method, uint16_t window, float tf, double ns, double rms, bool use_sg) {
+    printf("%s,%u,%.3f,%.3f,%.4g,%.1f,%.4g\n", method, (unsigned)window, (double)tf * 1000.0, ns, rms,
+           settle_ms(use_sg, window, tf), sine_rms_error(use_sg, window, tf));
+}
+
+int main(int argc, char** argv) {
+    long target = bench_arg(argc, argv, 1, 4000000L);
+    long rounds = target / RING;
+    if (rounds < 1) {
+        rounds = 1;
+    }
+    fill_traces();
+
+    int failed = 0;
+    printf("method,window,tf_ms,ns_per_call,noise_rms,settle_ms,sine_rms_error\n");
+    for (uint16_t window = 4; window <= FB_SGDERIV_MAX_WINDOW; window *= 2) {
+        double sg_rms = noise_rms(true, window, 0.0f);
+        double n = (double)window;
+        double sigma = NOISE_AMPLITUDE / sqrt(3.0);
+        double theory = sigma * sqrt(12.0 / (n * (n * n - 1.0))) / SAMPLE_TIME;
+        if (fabs(sg_rms - theory) > 0.1 * theory) {
+            fprintf(stderr, "窗口 %u：噪声 RMS %.4g 偏离理论值 %.4g\n", (unsigned)window, sg_rms, theory);
+            failed = 1;
+        }
+
+        float tf = matching_filter_time(sg_rms);
+        report("sgderiv", window, 0.0f, ns_per_call(true, window, 0.0f, rounds), sg_rms, true);
+        report("derivative_pt1", window, tf, ns_per_call(false, window, tf, rounds),
+               noise_rms(false, window, tf), false);
+    }
+    return failed;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file bench_stats.c
+ * @brief 流式统计（FB_STATS / FB_STATS_Bank）与逐周期重新扫描历史数组的对比基准
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 模拟诊断任务：每个扫描周期对 signals 个信号各加入一个采样，求累计均值/方差与最近 window 个
+ * 周期的最小/最大值。对比三种方式：
+ * - rescan：每个信号保存 window 个历史采样，每周期重新扫描求极值（均值/方差用 Σx、Σx² 累加）
+ * - single：FB_STATS 实例数组，逐实例调用 FB_STATS_Execute（window <= FB_STATS_MAX_WINDOW 时）
+ * - bank：一次调用 FB_STATS_Bank_Execute
+ *
+ * 窗口长度从 16 按 4 倍扫描到上限（默认 1024）。计时结束后逐信号比较极值，
+ * 与 rescan 不一致时 match 列为 0、退出码为 1。
+ *
+ * 用法：bench_stats [信号数=4096] [最大窗口=1024] [每种方式的总采样数=4000000]
+ * 输出（stdout，CSV）：method,window,signals,ns_per_sample,speedup,match
+ */
+
+#include "bench_common.h"
+#include "plcopen/plcopen.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/* 每周期输入在 RING 组之间循环 */
+#define RING 64
+
+static size_t signals;
+static float* inputs;         /* RING × signals */
+static float* history;        /* signals × window */
+static float* scan_min;
+static float* scan_max;
+static double* scan_sum;
+static double* scan_sum_sq;
+static FB_STATS_t* singles;
+static float* bank_floats;
+static uint16_t* bank_words;
+static uint32_t* bank_counts;
+static int8_t* bank_status;
+
+static void fill_inputs(void) {
+    uint32_t seed = 4242u;
+    for (size_t r = 0; r < RING; r++) {
+        for (size_t i = 0; i < signals; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            float drift = 10.0f * sinf(0.1f * (float)r + 0.7f * (float)i);
+            inputs[r * signals + i] = 50.0f + drift + (float)(seed >> 8) / 16777216.0f;
+        }
+    }
+}
+
+/* 现有做法：历史环形数组 + 每周期重新扫描 */
+static void rescan_cycle(const float* in, size_t window, size_t position) {
+    for (size_t i = 0; i < signals; i++) {
+        float* h = history + i * window;
+        float x = in[i];
+        h[position] = x;
+        scan_sum[i] += x;
+        scan_sum_sq[i] += (double)x * x;
+        float lo = h[0];
+        float hi = h[0];
+        for (size_t j = 1; j < window; j++) {
+            lo = (h[j] < lo) ? h[j] : lo;
+            hi = (h[j] > hi) ? h[j] : hi;
+        }
+        scan_min[i] = lo;
+        scan_max[i] = hi;
+    }
+}
+
+static bool extremes_match(size_t i, float min, float max) {
+    return min == scan_min[i] && max == scan_max[i];
+}
+
+static void report(const char* method, size_t window, uint64_t ns, long samples, uint64_t rescan_ns,
+                   int match) {
+    printf("%s,%zu,%zu,%.3f,%.2f,%d\n", method, window, signals, (double)ns / (double)samples,
+           (double)rescan_ns / (double)ns, match);
+}
+
+static int bench_window(size_t window, long cycles) {
+    /* 历史先以第一组输入填满，与 FB_STATS 窗口未满时的极值一致 */
+    for (size_t i = 0; i < signals; i++) {
+        for (size_t j = 0; j < window; j++) {
+            history[i * window + j] = inputs[i];
+        }
+        scan_sum[i] = 0.0;
+        scan_sum_sq[i] = 0.0;
+    }
+    uint64_t t0 = bench_now_ns();
+    for (long c = 0; c < cycles; c++) {
+        rescan_cycle(inputs + (size_t)(c % RING) * signals, window, (size_t)c % window);
+    }
+    uint64_t t1 = bench_now_ns();
+    uint64_t rescan_ns = t1 - t0;
+    long samples = cycles * (long)signals;
+    report("rescan", window, rescan_ns, samples, rescan_ns, 1);
+
+    int failed = 0;
+    if (window <= FB_STATS_MAX_WINDOW) {
+        FB_STATS_Config_t config = { .window = (uint16_t)window };
+        for (size_t i = 0; i < signals; i++) {
+            FB_STATS_Init(&singles[i], &config);
+        }
+        t0 = bench_now_ns();
+        for (long c = 0; c < cycles; c++) {
+            const float* in = inputs + (size_t)(c % RING) * signals;
+            for (size_t i = 0; i < signals; i++) {
+                FB_STATS_Execute(&singles[i], in[i]);
+            }
+        }
+        t1 = bench_now_ns();
+        int match = 1;
+        for (size_t i = 0; i < signals; i++) {
+            match &= extremes_match(i, singles[i].state.min, singles[i].state.max);
+        }
+        report("single", window, t1 - t0, samples, rescan_ns, match);
+        failed |= !match;
+    }
+
+    FB_STATS_Bank_t bank;
+    FB_STATS_Bank_Init(&bank, bank_floats, bank_words, bank_counts, bank_status, signals,
+                       (uint16_t)window);
+    t0 = bench_now_ns();
+    for (long c = 0; c < cycles; c++) {
+        FB_STATS_Bank_Execute(&bank, inputs + (size_t)(c % RING) * signals);
+    }
+    t1 = bench_now_ns();
+    int match = 1;
+    for (size_t i = 0; i < signals; i++) {
+        match &= extremes_match(i, FB_STATS_Bank_GetMin(&bank, i), FB_STATS_Bank_GetMax(&bank, i));
+    }
+    report("bank", window, t1 - t0, samples, rescan_ns, match);
+    failed |= !match;
+    return failed;
+}
+
+int main(int argc, char** argv) {
+    signals = (size_t)bench_arg(argc, argv, 1, 4096);
+    size_t max_window = (size_t)bench_arg(argc, argv, 2, 1024);
+    long target = bench_arg(argc, argv, 3, 4000000L);
+    if (max_window > FB_STATS_WINDOW_LIMIT) {
+        max_window = FB_STATS_WINDOW_LIMIT;
+    }
+
+    inputs = malloc(RING * signals * sizeof(float));
+    history = malloc(signals * max_window * sizeof(float));
+    scan_min = malloc(signals * sizeof(float));
+    scan_max = malloc(signals * sizeof(float));
+    scan_sum = malloc(signals * sizeof(double));
+    scan_sum_sq = malloc(signals * sizeof(double));
+    singles = malloc(signals * sizeof(FB_STATS_t));
+    bank_floats = malloc(FB_STATS_BANK_FLOATS(max_window) * signals * sizeof(float));
+    bank_words = malloc(FB_STATS_BANK_WORDS(max_window) * signals * sizeof(uint16_t));
+    bank_counts = malloc(signals * sizeof(uint32_t));
+    bank_status = malloc(signals * sizeof(int8_t));
+    if (inputs == NULL || history == NULL || scan_min == NULL || scan_max == NULL || scan_sum == NULL ||
+        scan_sum_sq == NULL || singles == NULL || bank_floats == NULL || bank_words == NULL ||
+        bank_counts == NULL || bank_status == NULL) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+    fill_inputs();
+
+    int failed = 0;
+    printf("method,window,signals,ns_per_sample,speedup,match\n");
+    for (size_t window = 16; window <= max_window; window *= 4) {
+        long cycles = target / (long)signals;
+        /* 至少让窗口滑过两轮，极值比较覆盖到期出队 */
+        if (cycles < (long)(2 * window)) {
+            cycles = (long)(2 * window);
+        }
+        failed |= bench_window(window, cycles);
+    }
+    bench_consume(scan_min[0] + (float)scan_sum[0] + (float)scan_sum_sq[0]);
+
+    free(inputs);
+    free(history);
+    free(scan_min);
+    free(scan_max);
+    free(scan_sum);
+    free(scan_sum_sq);
+    free(singles);
+    free(bank_floats);
+    free(bank_words);
+    free(bank_counts);
+    free(bank_status);
+
+    if (failed) {
+        fprintf(stderr, "窗口极值与重新扫描的结果不一致\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file bench_trace.c
+ * @brief 追踪环基准：每次 PID 执行附加一条追踪记录的开销
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 场景（每个扫描周期执行 LOOPS 个 PID）：
+ * - untraced：只执行 PID
+ * - traced：每个扫描写扫描标记，每个 PID 执行后追加一条记录
+ * - traced_drainer：同 traced，转储线程同时运行，每 256 个扫描手动触发一次，
+ *   转储线程在写者运行期间复制整个环并写入临时文件
+ *
+ * 用法：bench_trace [扫描次数=20000] [环容量=65536]
+ * 输出（stdout，CSV）：
+ *   scenario,loops,scans,ns_per_exec,overhead_ns_per_exec,dumps
+ */
+
+#include "bench_common.h"
+#include "plcopen/trace_drainer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define LOOPS 64
+
+static FB_PID_t pids[LOOPS];
+static plcopen_trace_ring_t ring;
+
+static const FB_PID_Config_t pid_config = {
+    .kp = 1.0f, .ki = 0.1f, .kd = 0.01f, .sample_time = 0.01f,
+    .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+};
+
+static double run(long scans, bool traced, bool trigger) {
+    float acc = 0.0f;
+    uint64_t t0 = bench_now_ns();
+    for (long s = 0; s < scans; s++) {
+        float pv = (float)(s & 63);
+        if (traced) {
+            plcopen_trace_begin_scan(&ring, bench_now_ns());
+        }
+        for (int i = 0; i < LOOPS; i++) {
+            float out = FB_PID_Execute(&pids[i], 50.0f, pv);
+            if (traced) {
+                plcopen_trace_pid(&ring, (uint16_t)i, &pids[i], 50.0f, pv, out);
+            }
+            acc += out;
+        }
+        if (trigger && (s & 255) == 255) {
+            plcopen_trace_trigger(&ring);
+        }
+    }
+    uint64_t elapsed = bench_now_ns() - t0;
+    bench_consume(acc);
+    return (double)elapsed / ((double)scans * LOOPS);
+}
+
+int main(int argc, char** argv) {
+    long scans = bench_arg(argc, argv, 1, 20000);
+    long capacity = bench_arg(argc, argv, 2, 65536);
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0) {
+        fprintf(stderr, "环容量必须是 2 的幂\n");
+        return 1;
+    }
+
+    plcopen_trace_slot_t* storage = aligned_alloc(PLCOPEN_CACHE_LINE,
+                                                  (size_t)capacity * sizeof(plcopen_trace_slot_t));
+    if (storage == NULL || plcopen_trace_init(&ring, 0u, storage, (uint32_t)capacity) != 0) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+    for (int i = 0; i < LOOPS; i++) {
+        FB_PID_Init(&pids[i], &pid_config);
+    }
+
+    fprintf(stderr, "环容量 %ld 条（%zu KB），记录 %zu 字节\n", capacity,
+            (size_t)capacity * sizeof(plcopen_trace_slot_t) / 1024u,
+            sizeof(plcopen_trace_record_t));
+    printf("scenario,loops,scans,ns_per_exec,overhead_ns_per_exec,dumps\n");
+
+    /* 预热 */
+    run(scans / 10 + 1, true, false);
+
+    double base = run(scans, false, false);
+    printf("untraced,%d,%ld,%.2f,%.2f,0\n", LOOPS, scans, base, 0.0);
+
+    double traced = run(scans, true, false);
+    printf("traced,%d,%ld,%.2f,%.2f,0\n", LOOPS, scans, traced, traced - base);
+
+    char prefix[64];
+    snprintf(prefix, sizeof(prefix), "/tmp/bench_trace_%ld", (long)getpid());
+    plcopen_trace_ring_t* rings[] = { &ring };
+    plcopen_trace_drainer_config_t cfg = { .poll_ms = 1u, .post_trigger_ms = 0u,
+                                           .holdoff_ms = 0u };
+    plcopen_trace_drainer_t drainer;
+    if (plcopen_trace_drainer_start(&drainer, rings, 1, prefix, &cfg) != 0) {
+        fprintf(stderr, "转储线程启动失败\n");
+        return 1;
+    }
+    double drained = run(scans, true, true);
+    plcopen_trace_drainer_stop(&drainer);
+    unsigned dumps = plcopen_trace_drainer_dumps(&drainer);
+    printf("traced_drainer,%d,%ld,%.2f,%.2f,%u\n", LOOPS, scans, drained, drained - base, dumps);
+
+    for (unsigned d = 0; d < dumps; d++) {
+        char path[96];
+        snprintf(path, sizeof(path), "%s-%u.plct", prefix, d);
+        remove(path);
+    }
+    free(storage);
+    return 0;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file bench_m4_icount.c
+ * @brief Cortex-M4 确定性指令计数基准（QEMU netduinoplus2，-icount shift=0）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * test_performance.c 只有在 STM32F4 实物板上才能得到真实耗时。本固件以
+ * templates/cmake/toolchain-arm-cortex-m4.cmake 交叉编译（-O2，硬浮点），
+ * 在 QEMU 中以指令计数模式运行，对每个标准功能块的 Execute 报告：
+ *
+ * - insns_avg：ITERATIONS 次调用的平均指令数
+ * - insns_max：逐次测量中的最大指令数（SysTick 量化，可能高估约 6 条）
+ * - est_cycles_max：insns_max × CPI 上界（PLCOPEN_M4_CPI_BOUND，默认 3）
+ *
+ * 并与 SC-002 预算（10 µs @ 168 MHz = 1680 周期）比较，超出时该行标记
+ * OVER_BUDGET，固件以退出码 1 结束。
+ *
+ * 指令数不随宿主机负载变化，适合在构建服务器上捕捉回归；周期数只是估计，
+ * 真实的 CPI 取决于 Flash 等待周期、ART 加速器命中率和 VDIV/VSQRT 等多周期指令，
+ * 最终仍以实物板 DWT 测量为准。
+ *
+ * 每次调用经一个适配函数进入 Execute；以同样形式调用空适配函数作为基线扣除
+ * 循环与测量开销，因此结果包含参数准备和进入 Execute 的跳转。
+ *
+ * 输出（stdout，CSV）：
+ *   fb,calls,insns_avg,insns_max,est_cycles_max,budget_cycles,est_us_max,result
+ */
+
+#include "m4_runtime.h"
+#include "plcopen/plcopen.h"
+
+#ifndef PLCOPEN_M4_CPI_BOUND
+#define PLCOPEN_M4_CPI_BOUND 3u
+#endif
+
+/** SC-002：10 µs @ 168 MHz */
+#define BUDGET_CYCLES (10u * 168u)
+
+#define ITERATIONS 1024u
+#define INPUTS 64u
+
+typedef float (*run_fn_t)(void* fb, float input);
+
+static float inputs[INPUTS];
+static volatile float sink;
+
+static FB_PID_t pid;
+static FB_PT1_t pt1;
+static FB_RAMP_t ramp;
+static FB_LIMIT_t limit;
+static FB_DEADBAND_t deadband;
+static FB_INTEGRATOR_t integrator;
+static FB_DERIVATIVE_t derivative;
+
+/* ========== 适配函数 ========== */
+
+static float __attribute__((noinline)) run_empty(void* fb, float input) {
+    (void)fb;
+    return input;
+}
+
+static float __attribute__((noinline)) run_pid(void* fb, float input) {
+    return FB_PID_Execute(fb, 50.0f, input);
+}
+
+static float __attribute__((noinline)) run_pt1(void* fb, float input) {
+    return FB_PT1_Execute(fb, input);
+}
+
+static float __attribute__((noinline)) run_ramp(void* fb, float input) {
+    return FB_RAMP_Execute(fb, input);
+}
+
+static float __attribute__((noinline)) run_limit(void* fb, float input) {
+    return FB_LIMIT_Execute(fb, input);
+}
+
+static float __attribute__((noinline)) run_deadband(void* fb, float input) {
+    return FB_DEADBAND_Execute(fb, input);
+}
+
+static float __attribute__((noinline)) run_integrator(void* fb, float input) {
+    return FB_INTEGRATOR_Execute(fb, input);
+}
+
+static float __attribute__((noinline)) run_derivative(void* fb, float input) {
+    return FB_DERIVATIVE_Execute(fb, input);
+}
+
+/* ========== 测量 ========== */
+
+typedef struct {
+    uint32_t total;        /**< ITERATIONS 次调用的总指令数 */
+    uint32_t single_max;   /**< 逐次测量的最大值 */
+    uint32_t single_min;   /**< 逐次测量的最小值 */
+} sample_t;
+
+static sample_t measure(run_fn_t run, void* fb) {
+    sample_t s = { 0u, 0u, UINT32_MAX };
+
+    uint32_t start = m4_systick_now();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        sink = run(fb, inputs[i & (INPUTS - 1u)]);
+    }
+    s.total = m4_icount_since(start);
+
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        uint32_t t0 = m4_systick_now();
+        sink = run(fb, inputs[i & (INPUTS - 1u)]);
+        uint32_t insns = m4_icount_since(t0);
+        s.single_max = insns > s.single_max ? insns : s.single_max;
+        s.single_min = insns < s.single_min ? insns : s.single_min;
+    }
+    return s;
+}
+
+/* 输出 value / 10^decimals 的定点小数 */
+static void put_fixed(uint32_t value, uint32_t scale, int decimals) {
+    char buf[12];
+    m4_puts(m4_utoa(value / scale, buf));
+    m4_puts(".");
+    uint32_t frac = value % scale;
+    for (int d = decimals - 1; d >= 0; d--) {
+        uint32_t div = 1u;
+        for (int k = 0; k < d; k++) {
+            div *= 10u;
+        }
+        buf[0] = (char)('0' + (frac / div) % 10u);
+        buf[1] = '\0';
+        m4_puts(buf);
+    }
+}
+
+static int report(const char* name, run_fn_t run, void* fb, const sample_t* base) {
+    sample_t s = measure(run, fb);
+    uint32_t body_total = s.total > base->total ? s.total - base->total : 0u;
+    uint32_t avg_x10 = (uint32_t)(((uint64_t)body_total * 10u + ITERATIONS / 2u) / ITERATIONS);
+    uint32_t max = s.single_max > base->single_min ? s.single_max - base->single_min : 0u;
+    uint32_t est_cycles = max * PLCOPEN_M4_CPI_BOUND;
+    uint32_t est_ns = est_cycles * 1000u / 168u;
+    int over = est_cycles > BUDGET_CYCLES;
+
+    char buf[12];
+    m4_puts(name);
+    m4_puts(",");
+    m4_puts(m4_utoa(ITERATIONS, buf));
+    m4_puts(",");
+    put_fixed(avg_x10, 10u, 1);
+    m4_puts(",");
+    m4_puts(m4_utoa(max, buf));
+    m4_puts(",");
+    m4_puts(m4_utoa(est_cycles, buf));
+    m4_puts(",");
+    m4_puts(m4_utoa(BUDGET_CYCLES, buf));
+    m4_puts(",");
+    put_fixed(est_ns, 1000u, 3);
+    m4_puts(over ? ",OVER_BUDGET\n" : ",PASS\n");
+    return over;
+}
+
+/* ========== 初始化 ========== */
+
+static void init_blocks(void) {
+    static const FB_PID_Config_t pid_cfg = {
+        .kp = 1.0f, .ki = 0.1f, .kd = 0.05f, .sample_time = 0.01f,
+        .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+    };
+    static const FB_PT1_Config_t pt1_cfg = { .time_constant = 1.0f, .sample_time = 0.01f };
+    static const FB_RAMP_Config_t ramp_cfg = {
+        .rise_rate = 10.0f, .fall_rate = 10.0f, .sample_time = 0.01f
+    };
+    static const FB_LIMIT_Config_t limit_cfg = { .min_val = 20.0f, .max_val = 80.0f };
+    static const FB_DEADBAND_Config_t deadband_cfg = { .width = 5.0f, .center = 50.0f };
+    static const FB_INTEGRATOR_Config_t integrator_cfg = {
+        .sample_time = 0.01f, .out_min = -100.0f, .out_max = 100.0f, .enable_limit = true
+    };
+    static const FB_DERIVATIVE_Config_t derivative_cfg = {
+        .sample_time = 0.01f, .filter_time_constant = 0.05f
+    };
+
+    FB_PID_Init(&pid, &pid_cfg);
+    FB_PT1_Init(&pt1, &pt1_cfg);
+    FB_RAMP_Init(&ramp, &ramp_cfg);
+    FB_LIMIT_Init(&limit, &limit_cfg);
+    FB_DEADBAND_Init(&deadband, &deadband_cfg);
+    FB_INTEGRATOR_Init(&integrator, &integrator_cfg);
+    FB_DERIVATIVE_Init(&derivative, &derivative_cfg);
+
+    /* 0..100 三角波：覆盖限幅、死区内外与斜坡上下行 */
+    for (uint32_t i = 0; i < INPUTS; i++) {
+        uint32_t k = i < INPUTS / 2u ? i : INPUTS - 1u - i;
+        inputs[i] = (float)k * (100.0f / (float)(INPUTS / 2u - 1u));
+    }
+}
+
+int main(void) {
+    m4_systick_start();
+    if (m4_icount_calibrate() != 0) {
+        m4_eputs("SysTick 未计数：请以 -icount shift=0 运行 qemu-system-arm -M netduinoplus2\n");
+        return 2;
+    }
+    init_blocks();
+
+    sample_t base = measure(run_empty, NULL);
+
+    m4_puts("fb,calls,insns_avg,insns_max,est_cycles_max,budget_cycles,est_us_max,result\n");
+    int over = 0;
+    over |= report("FB_PID", run_pid, &pid, &base);
+    over |= report("FB_PT1", run_pt1, &pt1, &base);
+    over |= report("FB_RAMP", run_ramp, &ramp, &base);
+    over |= report("FB_LIMIT", run_limit, &limit, &base);
+    over |= report("FB_DEADBAND", run_deadband, &deadband, &base);
+    over |= report("FB_INTEGRATOR", run_integrator, &integrator, &base);
+    over |= report("FB_DERIVATIVE", run_derivative, &derivative, &base);
+    return over ? 1 : 0;
+}
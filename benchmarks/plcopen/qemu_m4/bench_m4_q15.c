@@ -0,0 +1,180 @@
+/**
+ * @file bench_m4_q15.c
+ * @brief Cortex-M4 Q15 bank 每实例指令数基准（QEMU netduinoplus2，-icount shift=0）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 对 PT1 / LIMIT / DEADBAND 比较三种实现处理 BANK_SIZE 个通道一个扫描周期的指令数：
+ *
+ * - dsp：FB_xxx_BankQ15_Execute（SMLAD / SSUB16 / SEL，每次处理一对实例）
+ * - ref：FB_xxx_BankQ15_ExecuteRef（可移植 C，逐实例）
+ * - float：BANK_SIZE 个 float32 功能块实例逐个调用 FB_xxx_Execute
+ *
+ * 每种实现执行 SCANS 次取平均，以空循环为基线扣除测量开销。
+ *
+ * 输出（stdout，CSV）：
+ *   fb,impl,instances,scans,insns_per_scan,insns_per_instance
+ */
+
+#include "m4_runtime.h"
+#include "plcopen/plcopen.h"
+
+#define BANK_SIZE 64u
+#define SCANS 64u
+
+typedef void (*scan_fn_t)(void);
+
+FB_PT1_BANKQ15_STORAGE(pt1, BANK_SIZE);
+FB_LIMIT_BANKQ15_STORAGE(lim, BANK_SIZE);
+FB_DEADBAND_BANKQ15_STORAGE(db, BANK_SIZE);
+
+static FB_PT1_t pt1_float[BANK_SIZE];
+static FB_LIMIT_t lim_float[BANK_SIZE];
+static FB_DEADBAND_t db_float[BANK_SIZE];
+
+static plc_q15_t input_q15[BANK_SIZE];
+static plc_q15_t output_q15[BANK_SIZE];
+static float input_float[BANK_SIZE];
+static float output_float[BANK_SIZE];
+
+/* ========== 扫描函数 ========== */
+
+static void __attribute__((noinline)) scan_empty(void) {
+    __asm__ volatile("" ::: "memory");
+}
+
+static void __attribute__((noinline)) scan_pt1_dsp(void) {
+    FB_PT1_BankQ15_Execute(&pt1_bank, input_q15, output_q15);
+}
+
+static void __attribute__((noinline)) scan_pt1_ref(void) {
+    FB_PT1_BankQ15_ExecuteRef(&pt1_bank, input_q15, output_q15);
+}
+
+static void __attribute__((noinline)) scan_pt1_float(void) {
+    for (uint32_t i = 0; i < BANK_SIZE; i++) {
+        output_float[i] = FB_PT1_Execute(&pt1_float[i], input_float[i]);
+    }
+}
+
+static void __attribute__((noinline)) scan_limit_dsp(void) {
+    FB_LIMIT_BankQ15_Execute(&lim_bank, input_q15, output_q15);
+}
+
+static void __attribute__((noinline)) scan_limit_ref(void) {
+    FB_LIMIT_BankQ15_ExecuteRef(&lim_bank, input_q15, output_q15);
+}
+
+static void __attribute__((noinline)) scan_limit_float(void) {
+    for (uint32_t i = 0; i < BANK_SIZE; i++) {
+        output_float[i] = FB_LIMIT_Execute(&lim_float[i], input_float[i]);
+    }
+}
+
+static void __attribute__((noinline)) scan_deadband_dsp(void) {
+    FB_DEADBAND_BankQ15_Execute(&db_bank, input_q15, output_q15);
+}
+
+static void __attribute__((noinline)) scan_deadband_ref(void) {
+    FB_DEADBAND_BankQ15_ExecuteRef(&db_bank, input_q15, output_q15);
+}
+
+static void __attribute__((noinline)) scan_deadband_float(void) {
+    for (uint32_t i = 0; i < BANK_SIZE; i++) {
+        output_float[i] = FB_DEADBAND_Execute(&db_float[i], input_float[i]);
+    }
+}
+
+/* ========== 测量 ========== */
+
+static uint32_t measure(scan_fn_t scan) {
+    uint32_t start = m4_systick_now();
+    for (uint32_t k = 0; k < SCANS; k++) {
+        scan();
+    }
+    return m4_icount_since(start);
+}
+
+/* 输出 value / 10 的一位小数 */
+static void put_tenths(uint32_t value_x10) {
+    char buf[12];
+    m4_puts(m4_utoa(value_x10 / 10u, buf));
+    m4_puts(".");
+    m4_puts(m4_utoa(value_x10 % 10u, buf));
+}
+
+static void report(const char* fb, const char* impl, scan_fn_t scan, uint32_t base) {
+    uint32_t total = measure(scan);
+    uint32_t body = total > base ? total - base : 0u;
+    uint32_t per_scan_x10 = (uint32_t)(((uint64_t)body * 10u + SCANS / 2u) / SCANS);
+    uint32_t per_instance_x10 = (per_scan_x10 + BANK_SIZE / 2u) / BANK_SIZE;
+
+    char buf[12];
+    m4_puts(fb);
+    m4_puts(",");
+    m4_puts(impl);
+    m4_puts(",");
+    m4_puts(m4_utoa(BANK_SIZE, buf));
+    m4_puts(",");
+    m4_puts(m4_utoa(SCANS, buf));
+    m4_puts(",");
+    put_tenths(per_scan_x10);
+    m4_puts(",");
+    put_tenths(per_instance_x10);
+    m4_puts("\n");
+}
+
+/* ========== 初始化 ========== */
+
+static void init_blocks(void) {
+    static const FB_PT1_Config_t pt1_cfg = { .time_constant = 0.1f, .sample_time = 0.001f };
+
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, pt1_cfg.sample_time);
+    FB_LIMIT_BankQ15_Init(&lim_bank, lim_min, lim_max, lim_status, BANK_SIZE);
+    FB_DEADBAND_BankQ15_Init(&db_bank, db_width, db_center, BANK_SIZE);
+
+    for (uint32_t i = 0; i < BANK_SIZE; i++) {
+        /* 三角波覆盖限幅上下沿与死区内外 */
+        uint32_t k = i < BANK_SIZE / 2u ? i : BANK_SIZE - 1u - i;
+        float u = -0.9f + 1.8f * (float)k / (float)(BANK_SIZE / 2u - 1u);
+        input_float[i] = u;
+        input_q15[i] = plc_q15_from_float(u);
+
+        FB_PT1_BankQ15_Configure(&pt1_bank, i, pt1_cfg.time_constant);
+        FB_LIMIT_BankQ15_Configure(&lim_bank, i, plc_q15_from_float(-0.5f), plc_q15_from_float(0.5f));
+        FB_DEADBAND_BankQ15_Configure(&db_bank, i, plc_q15_from_float(0.2f), 0);
+
+        const FB_LIMIT_Config_t lim_cfg = { .min_val = -0.5f, .max_val = 0.5f };
+        const FB_DEADBAND_Config_t db_cfg = { .width = 0.2f, .center = 0.0f };
+        FB_PT1_Init(&pt1_float[i], &pt1_cfg);
+        FB_LIMIT_Init(&lim_float[i], &lim_cfg);
+        FB_DEADBAND_Init(&db_float[i], &db_cfg);
+    }
+
+    /* 跳过首次运行分支 */
+    scan_pt1_dsp();
+    scan_pt1_float();
+}
+
+int main(void) {
+    m4_systick_start();
+    if (m4_icount_calibrate() != 0) {
+        m4_eputs("SysTick 未计数：请以 -icount shift=0 运行 qemu-system-arm -M netduinoplus2\n");
+        return 2;
+    }
+    init_blocks();
+
+    uint32_t base = measure(scan_empty);
+
+    m4_puts("fb,impl,instances,scans,insns_per_scan,insns_per_instance\n");
+    report("PT1", "dsp", scan_pt1_dsp, base);
+    report("PT1", "ref", scan_pt1_ref, base);
+    report("PT1", "float", scan_pt1_float, base);
+    report("LIMIT", "dsp", scan_limit_dsp, base);
+    report("LIMIT", "ref", scan_limit_ref, base);
+    report("LIMIT", "float", scan_limit_float, base);
+    report("DEADBAND", "dsp", scan_deadband_dsp, base);
+    report("DEADBAND", "ref", scan_deadband_ref, base);
+    report("DEADBAND", "float", scan_deadband_float, base);
+    return 0;
+}
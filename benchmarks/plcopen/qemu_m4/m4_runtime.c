@@ -0,0 +1,176 @@
+/**
+ * @file m4_runtime.c
+ * @brief QEMU Cortex-M4 裸机运行时实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#include "m4_runtime.h"
+
+/* ========== 半主机 ========== */
+
+#define SYS_OPEN          0x01
+#define SYS_WRITE         0x05
+#define SYS_EXIT_EXTENDED 0x20
+#define ADP_STOPPED_APPLICATION_EXIT 0x20026
+
+/* ":tt" 的打开模式：4..7 为 stdout，8..11 为 stderr */
+#define TT_MODE_STDOUT 4
+#define TT_MODE_STDERR 8
+
+static int semihost(int op, const void* arg) {
+    register int r0 __asm__("r0") = op;
+    register const void* r1 __asm__("r1") = arg;
+    __asm__ volatile("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+    return r0;
+}
+
+static size_t str_len(const char* s) {
+    size_t n = 0;
+    while (s[n] != '\0') {
+        n++;
+    }
+    return n;
+}
+
+static int open_tt(int mode) {
+    static const char name[] = ":tt";
+    uint32_t args[3] = { (uint32_t)(uintptr_t)name, (uint32_t)mode, 3u };
+    return semihost(SYS_OPEN, args);
+}
+
+static void write_handle(int* handle, int mode, const char* s) {
+    if (*handle < 0) {
+        *handle = open_tt(mode);
+    }
+    uint32_t args[3] = { (uint32_t)*handle, (uint32_t)(uintptr_t)s, (uint32_t)str_len(s) };
+    semihost(SYS_WRITE, args);
+}
+
+void m4_puts(const char* s) {
+    static int handle = -1;
+    write_handle(&handle, TT_MODE_STDOUT, s);
+}
+
+void m4_eputs(const char* s) {
+    static int handle = -1;
+    write_handle(&handle, TT_MODE_STDERR, s);
+}
+
+char* m4_utoa(uint32_t value, char* buf) {
+    char tmp[10];
+    int n = 0;
+    do {
+        tmp[n++] = (char)('0' + value % 10u);
+        value /= 10u;
+    } while (value != 0u);
+    for (int i = 0; i < n; i++) {
+        buf[i] = tmp[n - 1 - i];
+    }
+    buf[n] = '\0';
+    return buf;
+}
+
+void m4_exit(int code) {
+    uint32_t args[2] = { ADP_STOPPED_APPLICATION_EXIT, (uint32_t)code };
+    for (;;) {
+        semihost(SYS_EXIT_EXTENDED, args);
+    }
+}
+
+/* ========== SysTick 指令计数 ========== */
+
+#define SYST_CSR (*(volatile uint32_t*)0xE000E010u)
+#define SYST_RVR (*(volatile uint32_t*)0xE000E014u)
+#define SYST_CVR (*(volatile uint32_t*)0xE000E018u)
+
+#define SYST_CSR_ENABLE    0x1u
+#define SYST_CSR_CLKSOURCE 0x4u   /* 1=处理器时钟，0=外部参考时钟 */
+
+/* 标定循环：每次迭代 2 条指令（subs + bne） */
+#define CALIBRATION_LOOPS 1000000u
+
+/* 每个 SysTick 计数对应的指令数（Q16） */
+static uint32_t insns_per_tick_q16;
+
+void m4_systick_start(void) {
+    SYST_CSR = 0u;
+    SYST_RVR = M4_SYSTICK_MASK;
+    SYST_CVR = 0u;
+    SYST_CSR = SYST_CSR_ENABLE | SYST_CSR_CLKSOURCE;
+}
+
+static void __attribute__((noinline)) spin(uint32_t n) {
+    __asm__ volatile("1: subs %0, %0, #1\n\tbne 1b" : "+r"(n) : : "cc");
+}
+
+static uint32_t ticks_for(uint32_t loops) {
+    uint32_t start = m4_systick_now();
+    spin(loops);
+    return (start - m4_systick_now()) & M4_SYSTICK_MASK;
+}
+
+int m4_icount_calibrate(void) {
+    uint32_t delta = ticks_for(CALIBRATION_LOOPS + 1u) - ticks_for(1u);
+    if (delta == 0u) {
+        /* 部分板型未接处理器时钟，改用外部参考时钟再试一次 */
+        SYST_CSR = SYST_CSR_ENABLE;
+        delta = ticks_for(CALIBRATION_LOOPS + 1u) - ticks_for(1u);
+        if (delta == 0u) {
+            return -1;
+        }
+    }
+    insns_per_tick_q16 = (uint32_t)(((uint64_t)(2u * CALIBRATION_LOOPS) << 16) / delta);
+    return 0;
+}
+
+uint32_t m4_icount_since(uint32_t start) {
+    uint32_t ticks = (start - m4_systick_now()) & M4_SYSTICK_MASK;
+    return (uint32_t)(((uint64_t)ticks * insns_per_tick_q16 + 0x8000u) >> 16);
+}
+
+/* ========== 启动 ========== */
+
+extern uint32_t _sidata, _sdata, _edata, _sbss, _ebss, _estack;
+int main(void);
+
+#define SCB_CPACR (*(volatile uint32_t*)0xE000ED88u)
+
+void Reset_Handler(void) {
+    /* 使能 CP10/CP11（FPU），之后才能执行浮点指令 */
+    SCB_CPACR |= 0xFu << 20;
+    __asm__ volatile("dsb\n\tisb" ::: "memory");
+
+    uint32_t* src = &_sidata;
+    for (uint32_t* dst = &_sdata; dst < &_edata; dst++) {
+        *dst = *src++;
+    }
+    for (uint32_t* dst = &_sbss; dst < &_ebss; dst++) {
+        *dst = 0u;
+    }
+    m4_exit(main());
+}
+
+static void Fault_Handler(void) {
+    m4_eputs("意外异常（HardFault/总线错误等）\n");
+    m4_exit(3);
+}
+
+typedef void (*m4_vector_t)(void);
+
+__attribute__((section(".isr_vector"), used))
+static const m4_vector_t vectors[16] = {
+    (m4_vector_t)(uintptr_t)&_estack,
+    Reset_Handler,
+    Fault_Handler,  /* NMI */
+    Fault_Handler,  /* HardFault */
+    Fault_Handler,  /* MemManage */
+    Fault_Handler,  /* BusFault */
+    Fault_Handler,  /* UsageFault */
+    0, 0, 0, 0,
+    Fault_Handler,  /* SVCall */
+    Fault_Handler,  /* DebugMon */
+    0,
+    Fault_Handler,  /* PendSV */
+    Fault_Handler,  /* SysTick（未使能中断，不应进入） */
+};
@@ -0,0 +1,76 @@
+/**
+ * @file m4_runtime.h
+ * @brief QEMU Cortex-M4 裸机运行时：启动、半主机输出、SysTick 指令计数
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 供 qemu-system-arm -M netduinoplus2（STM32F405，Cortex-M4F）上运行的
+ * 基准与测试固件使用：
+ *
+ * - Reset_Handler 复制 .data、清零 .bss、使能 FPU 后调用 main，
+ *   main 的返回值经半主机 SYS_EXIT_EXTENDED 成为 QEMU 进程退出码
+ * - m4_puts / m4_eputs 经半主机写到宿主机 stdout / stderr
+ * - 以 -icount shift=0 运行时，QEMU 虚拟时钟每条指令前进 1 ns，
+ *   SysTick（处理器时钟）随之计数；m4_icount_calibrate 用已知指令数的
+ *   循环标定"每个 SysTick 计数对应的指令数"，之后 m4_icount_since
+ *   把 SysTick 差值换算为指令数，结果与宿主机负载无关、逐次运行完全一致
+ */
+
+#ifndef PLCOPEN_M4_RUNTIME_H
+#define PLCOPEN_M4_RUNTIME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** SysTick 为 24 位计数器：单次测量不得超过约 0.9 × 2^24 个计数 */
+#define M4_SYSTICK_MASK 0x00FFFFFFu
+
+/**
+ * @brief 写字符串到宿主机 stdout
+ */
+void m4_puts(const char* s);
+
+/**
+ * @brief 写字符串到宿主机 stderr
+ */
+void m4_eputs(const char* s);
+
+/**
+ * @brief 无符号整数转十进制字符串
+ *
+ * @param value 数值
+ * @param buf 输出缓冲区（至少 11 字节）
+ * @return char* buf
+ */
+char* m4_utoa(uint32_t value, char* buf);
+
+/**
+ * @brief 以退出码结束 QEMU（半主机 SYS_EXIT_EXTENDED）
+ */
+void m4_exit(int code) __attribute__((noreturn));
+
+/**
+ * @brief 启动 SysTick（处理器时钟，自由运行，重装值 2^24 - 1）
+ */
+void m4_systick_start(void);
+
+/**
+ * @brief 读取 SysTick 当前值（递减计数）
+ */
+static inline uint32_t m4_systick_now(void) {
+    return *(volatile uint32_t*)0xE000E018u;
+}
+
+/**
+ * @brief 标定 SysTick 计数与指令数的比例（需先 m4_systick_start）
+ *
+ * @return int 0=成功，-1=SysTick 未计数（未以 -icount 运行或板型不支持）
+ */
+int m4_icount_calibrate(void);
+
+/**
+ * @brief 自 start（m4_systick_now 的返回值）以来执行的指令数
+ */
+uint32_t m4_icount_since(uint32_t start);
+
+#endif /* PLCOPEN_M4_RUNTIME_H */
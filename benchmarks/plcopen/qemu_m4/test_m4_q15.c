@@ -0,0 +1,159 @@
+/**
+ * @file test_m4_q15.c
+ * @brief Cortex-M4 Q15 bank DSP 路径对照测试（QEMU netduinoplus2）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 在 ARMv7E-M 目标上 FB_xxx_BankQ15_Execute 使用 SMLAD / SSUB16 / SEL 等 DSP
+ * 扩展指令，FB_xxx_BankQ15_ExecuteRef 为可移植 C 实现。本固件以伪随机输入、
+ * 随机配置（约 1/8 取量程端点）对两条路径逐位比较，实例数取奇数以覆盖尾部。
+ * DEADBAND 另以宽度、中心、输入取量程端点的全部组合检查两条路径都等于
+ * |u - c| <= w 的精确判定（含 width = 32767）。
+ *
+ * 输出（stdout）：每个功能块一行 "fb,rounds,mismatches"；
+ * 任一不一致时退出码为 1。
+ */
+
+#include "m4_runtime.h"
+#include "plcopen/fb_bank_q15.h"
+
+#define BANK_SIZE 63u
+#define ROUNDS 2000u
+
+FB_PT1_BANKQ15_STORAGE(pt1, BANK_SIZE);
+FB_PT1_BANKQ15_STORAGE(pt1_ref, BANK_SIZE);
+FB_LIMIT_BANKQ15_STORAGE(lim, BANK_SIZE);
+FB_LIMIT_BANKQ15_STORAGE(lim_ref, BANK_SIZE);
+FB_DEADBAND_BANKQ15_STORAGE(db, BANK_SIZE);
+
+static plc_q15_t input[BANK_SIZE];
+static plc_q15_t output[BANK_SIZE];
+static plc_q15_t output_ref[BANK_SIZE];
+
+static uint32_t rng_state = 0x12345678u;
+
+static plc_q15_t random_q15(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    uint32_t r = rng_state >> 8;
+    if ((r & 7u) == 0u) {
+        return (r & 8u) ? PLC_Q15_MAX : PLC_Q15_MIN;
+    }
+    return (plc_q15_t)(r >> 4);
+}
+
+static uint32_t count_mismatch(const plc_q15_t* a, const plc_q15_t* b) {
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < BANK_SIZE; i++) {
+        n += a[i] != b[i];
+    }
+    return n;
+}
+
+static int report(const char* name, uint32_t mismatches) {
+    char buf[12];
+    m4_puts(name);
+    m4_puts(",");
+    m4_puts(m4_utoa(ROUNDS, buf));
+    m4_puts(",");
+    m4_puts(m4_utoa(mismatches, buf));
+    m4_puts("\n");
+    return mismatches != 0u;
+}
+
+static uint32_t check_pt1(void) {
+    uint32_t mismatches = 0;
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.001f);
+    FB_PT1_BankQ15_Init(&pt1_ref_bank, pt1_ref_output, pt1_ref_coef, BANK_SIZE, 0.001f);
+    for (uint32_t i = 0; i < BANK_SIZE; i++) {
+        float tau = (i % 4u == 0u) ? 1e-6f : 1e-4f * (float)(i * i);
+        FB_PT1_BankQ15_Configure(&pt1_bank, i, tau);
+        FB_PT1_BankQ15_Configure(&pt1_ref_bank, i, tau);
+    }
+
+    for (uint32_t k = 0; k < ROUNDS; k++) {
+        for (uint32_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = random_q15();
+        }
+        FB_PT1_BankQ15_Execute(&pt1_bank, input, output);
+        FB_PT1_BankQ15_ExecuteRef(&pt1_ref_bank, input, output_ref);
+        mismatches += count_mismatch(output, output_ref);
+    }
+    return mismatches;
+}
+
+static uint32_t check_limit(void) {
+    uint32_t mismatches = 0;
+    FB_LIMIT_BankQ15_Init(&lim_bank, lim_min, lim_max, lim_status, BANK_SIZE);
+    FB_LIMIT_BankQ15_Init(&lim_ref_bank, lim_ref_min, lim_ref_max, lim_ref_status, BANK_SIZE);
+
+    for (uint32_t k = 0; k < ROUNDS; k++) {
+        for (uint32_t i = 0; i < BANK_SIZE; i++) {
+            plc_q15_t a = random_q15();
+            plc_q15_t b = random_q15();
+            if (a != b) {
+                FB_LIMIT_BankQ15_Configure(&lim_bank, i, a < b ? a : b, a < b ? b : a);
+                FB_LIMIT_BankQ15_Configure(&lim_ref_bank, i, a < b ? a : b, a < b ? b : a);
+            }
+            input[i] = random_q15();
+        }
+        FB_LIMIT_BankQ15_Execute(&lim_bank, input, output);
+        FB_LIMIT_BankQ15_ExecuteRef(&lim_ref_bank, input, output_ref);
+        mismatches += count_mismatch(output, output_ref);
+        for (uint32_t i = 0; i < BANK_SIZE; i++) {
+            mismatches += lim_status[i] != lim_ref_status[i];
+        }
+    }
+    return mismatches;
+}
+
+static uint32_t check_deadband(void) {
+    uint32_t mismatches = 0;
+    FB_DEADBAND_BankQ15_Init(&db_bank, db_width, db_center, BANK_SIZE);
+
+    for (uint32_t k = 0; k < ROUNDS; k++) {
+        for (uint32_t i = 0; i < BANK_SIZE; i++) {
+            plc_q15_t w = random_q15();
+            FB_DEADBAND_BankQ15_Configure(&db_bank, i, (plc_q15_t)(w < 0 ? -(w + 1) : w), random_q15());
+            input[i] = random_q15();
+        }
+        FB_DEADBAND_BankQ15_Execute(&db_bank, input, output);
+        FB_DEADBAND_BankQ15_ExecuteRef(&db_bank, input, output_ref);
+        mismatches += count_mismatch(output, output_ref);
+    }
+
+    /* 端点组合：偏差可达 ±65535，不能因饱和误判为死区内 */
+    static const plc_q15_t widths[] = { 0, 1, 16384, PLC_Q15_MAX - 1, PLC_Q15_MAX };
+    static const plc_q15_t values[] = { PLC_Q15_MIN, PLC_Q15_MIN + 1, -1, 0, 1, PLC_Q15_MAX - 1, PLC_Q15_MAX };
+    const uint32_t nv = sizeof(values) / sizeof(values[0]);
+    for (uint32_t wi = 0; wi < sizeof(widths) / sizeof(widths[0]); wi++) {
+        for (uint32_t base = 0; base < nv * nv; base += BANK_SIZE) {
+            for (uint32_t i = 0; i < BANK_SIZE; i++) {
+                uint32_t k = (base + i) % (nv * nv);
+                FB_DEADBAND_BankQ15_Configure(&db_bank, i, widths[wi], values[k / nv]);
+                input[i] = values[k % nv];
+            }
+            FB_DEADBAND_BankQ15_Execute(&db_bank, input, output);
+            FB_DEADBAND_BankQ15_ExecuteRef(&db_bank, input, output_ref);
+            for (uint32_t i = 0; i < BANK_SIZE; i++) {
+                int32_t d = (int32_t)input[i] - db_center[i];
+                plc_q15_t expected = (d <= widths[wi] && -d <= widths[wi]) ? db_center[i] : input[i];
+                mismatches += (output[i] != expected) + (output_ref[i] != expected);
+            }
+        }
+    }
+    return mismatches;
+}
+
+int main(void) {
+#if !defined(__ARM_FEATURE_SIMD32)
+    m4_eputs("目标不支持 DSP 扩展：Execute 与 ExecuteRef 相同，本测试无意义\n");
+    return 2;
+#else
+    m4_puts("fb,rounds,mismatches\n");
+    int failed = 0;
+    failed |= report("FB_PT1_BankQ15", check_pt1());
+    failed |= report("FB_LIMIT_BankQ15", check_limit());
+    failed |= report("FB_DEADBAND_BankQ15", check_deadband());
+    return failed ? 1 : 0;
+#endif
+}
@@ -0,0 +1,164 @@
+/**
+ * @file arena.h
+ * @brief 功能块实例的缓存行对齐静态存储区（arena）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 多个任务（线程/核）各自执行不同回路时，如果实例以任意全局变量声明，
+ * 不同任务的实例可能落在同一缓存行中，任一任务写状态都会使其他核上
+ * 的该行失效（伪共享）。plcopen_arena 从一块静态存储中顺序分配实例：
+ *
+ * - 每个任务从父 arena 切出一个分组（plcopen_arena_split），分组的起止
+ *   地址都对齐到 PLCOPEN_CACHE_LINE，不同分组之间不共享缓存行
+ * - 分组内实例按自身对齐紧密排列（同一任务的实例共享缓存行没有代价），
+ *   也可以为单个实例指定更大的对齐
+ * - 只分配、不单独释放；plcopen_arena_reset 一次性回收（如重新下载组态）
+ *
+ * @code
+ * PLCOPEN_ARENA_STORAGE(fb_storage, 64 * 1024);
+ *
+ * plcopen_arena_t root, task_fast, task_slow;
+ * plcopen_arena_init(&root, fb_storage, sizeof(fb_storage));
+ * plcopen_arena_split(&root, &task_fast, 16 * 1024);
+ * plcopen_arena_split(&root, &task_slow, 48 * 1024);
+ *
+ * FB_PID_t* pid = PLCOPEN_ARENA_NEW(&task_fast, FB_PID_t);
+ * @endcode
+ *
+ * Linux 主机上可用 plcopen_arena_map 从匿名映射（可选大页）创建 arena，
+ * 减少百万级实例数组的 TLB 未命中。
+ *
+ * @note arena 本身不加锁：分配应在启动阶段单线程完成，
+ *       或每个分组只由其所属任务使用。
+ */
+
+#ifndef PLCOPEN_ARENA_H
+#define PLCOPEN_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+
+/**
+ * @brief 缓存行大小（字节，可在编译时覆盖）
+ *
+ * x86-64 / Cortex-A 为 64；Cortex-M7 为 32（更大的值同样正确，只浪费填充）。
+ */
+#ifndef PLCOPEN_CACHE_LINE
+#define PLCOPEN_CACHE_LINE 64
+#endif
+
+/**
+ * @brief 声明缓存行对齐的静态存储
+ *
+ * 大小向上取整到缓存行整数倍。
+ */
+#define PLCOPEN_ARENA_STORAGE(name, bytes)                                     \
+    static PLC_ALIGNAS(PLCOPEN_CACHE_LINE) uint8_t                             \
+        name[((bytes) + PLCOPEN_CACHE_LINE - 1) / PLCOPEN_CACHE_LINE * PLCOPEN_CACHE_LINE]
+
+/**
+ * @brief 从 arena 分配一个 type 类型的实例（按 type 的自然对齐）
+ */
+#define PLCOPEN_ARENA_NEW(arena, type) \
+    ((type*)plcopen_arena_alloc((arena), sizeof(type), PLC_ALIGNOF(type)))
+
+/**
+ * @brief 从 arena 分配一个独占缓存行的 type 类型实例
+ */
+#define PLCOPEN_ARENA_NEW_ISOLATED(arena, type) \
+    ((type*)plcopen_arena_alloc((arena), sizeof(type), PLCOPEN_CACHE_LINE))
+
+/* plcopen_arena_map 标志 */
+#define PLCOPEN_ARENA_HUGE_PAGES 0x1u  /**< 请求大页（失败时回退到普通页） */
+
+/**
+ * @brief arena 描述符
+ */
+typedef struct {
+    uint8_t* base;   /**< 存储起始地址 */
+    size_t size;     /**< 存储大小（字节） */
+    size_t used;     /**< 已分配字节数（含对齐填充） */
+    uint8_t mapped;  /**< 0：静态存储；1：普通页映射；2：大页映射（预留大页或已确认的透明大页）；
+                          3：已请求透明大页但未获得（按普通页使用） */
+} plcopen_arena_t;
+
+/**
+ * @brief 以用户提供的存储初始化 arena
+ *
+ * 起始地址不对齐时跳过开头的部分字节，使首个分配对齐到缓存行。
+ *
+ * @param arena arena 描述符
+ * @param storage 存储区（推荐 PLCOPEN_ARENA_STORAGE 声明）
+ * @param size 存储区大小（字节）
+ * @return int 0=成功，-1=参数错误
+ */
+int plcopen_arena_init(plcopen_arena_t* arena, void* storage, size_t size);
+
+/**
+ * @brief 分配一块内存
+ *
+ * @param arena arena 描述符
+ * @param size 字节数（> 0）
+ * @param align 对齐（2 的幂，0 表示按缓存行）
+ * @return void* 对齐后的地址；空间不足或参数错误时返回 NULL（arena 不变）
+ */
+void* plcopen_arena_alloc(plcopen_arena_t* arena, size_t size, size_t align);
+
+/**
+ * @brief 从父 arena 切出一个任务分组
+ *
+ * 子 arena 的起始地址与大小都对齐到缓存行，因此与父 arena 中的
+ * 其他分配、其他分组都不共享缓存行。
+ *
+ * @param parent 父 arena
+ * @param child 子 arena 描述符（输出）
+ * @param size 分组大小（字节，向上取整到缓存行）
+ * @return int 0=成功，-1=空间不足或参数错误
+ */
+int plcopen_arena_split(plcopen_arena_t* parent, plcopen_arena_t* child, size_t size);
+
+/**
+ * @brief 回收 arena 中的全部分配
+ *
+ * 存储区内容不清零；由其切出的子 arena 同时失效。
+ */
+void plcopen_arena_reset(plcopen_arena_t* arena);
+
+/**
+ * @brief 剩余可用字节数（不计后续分配的对齐填充）
+ */
+static inline size_t plcopen_arena_remaining(const plcopen_arena_t* arena) {
+    return arena->size - arena->used;
+}
+
+/**
+ * @brief 从匿名内存映射创建 arena（仅 Linux，其他平台返回 -1）
+ *
+ * 带 PLCOPEN_ARENA_HUGE_PAGES 时依次尝试 MAP_HUGETLB 预留大页和
+ * 透明大页（madvise MADV_HUGEPAGE），都不可用时使用普通页。
+ * madvise 成功不代表内核提供了大页（THP 为 never、内存碎片化），因此透明大页
+ * 在预取后按 /proc/self/smaps 的 AnonHugePages 确认：获得时 arena->mapped 为 2，
+ * 未获得时为 3。内存立即预取（MAP_POPULATE 或逐页触碰），避免实时任务首次访问时缺页。
+ *
+ * @param arena arena 描述符
+ * @param size 字节数（向上取整到页大小）
+ * @param flags PLCOPEN_ARENA_HUGE_PAGES 或 0
+ * @return int 0=成功，-1=映射失败或平台不支持
+ */
+int plcopen_arena_map(plcopen_arena_t* arena, size_t size, unsigned flags);
+
+/**
+ * @brief 释放 plcopen_arena_map 创建的映射
+ */
+void plcopen_arena_unmap(plcopen_arena_t* arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_ARENA_H */
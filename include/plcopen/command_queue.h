@@ -0,0 +1,172 @@
+/**
+ * @file command_queue.h
+ * @brief 无等待单生产者/单消费者命令队列（模式切换、设定值写入）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 操作员线程直接调用 FB_PID_SetManual / FB_PID_SetAuto 时，会与控制任务中的
+ * FB_PID_Execute 同时读写 manual_mode、integral、prev_output。命令队列把
+ * 这些操作变为"投递"与"执行"两步：
+ *
+ * - 操作员线程（唯一生产者）以 plcopen_cmdq_push_xxx 投递带类型的命令，
+ *   队列满时立即返回 -1，从不等待
+ * - 控制任务（唯一消费者）在扫描周期开始时调用 plcopen_cmdq_drain，
+ *   依次执行调用时刻已入队的全部命令，耗时 O(命令数)，从不等待生产者
+ *
+ * 所有功能块状态只在控制任务中被修改，Execute 本身不需要任何同步。
+ *
+ * @code
+ * static plcopen_cmdq_t task_cmds;          // 每个任务一个队列
+ * plcopen_cmdq_init(&task_cmds);
+ *
+ * // 操作员线程
+ * plcopen_cmdq_push_pid_set_manual(&task_cmds, &pid, 40.0f);
+ * plcopen_cmdq_push_write_setpoint(&task_cmds, &sp, 55.0f);
+ *
+ * // 控制任务，每个扫描周期开始时
+ * plcopen_cmdq_drain(&task_cmds);
+ * out = FB_PID_Execute(&pid, sp, pv);
+ * @endcode
+ *
+ * @note 多个操作员线程需各自使用一个队列，或在投递侧自行串行化。
+ * @note 命令中保存的实例/变量指针必须在命令执行前保持有效。
+ */
+
+#ifndef PLCOPEN_COMMAND_QUEUE_H
+#define PLCOPEN_COMMAND_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+#include "plcopen/arena.h"
+#include "plcopen/fb_pid.h"
+#include "plcopen/fb_integrator.h"
+
+/**
+ * @brief 队列容量（命令个数，必须是 2 的幂）
+ *
+ * 可在编译时覆盖，例如 -DPLCOPEN_CMDQ_CAPACITY=256。
+ */
+#ifndef PLCOPEN_CMDQ_CAPACITY
+#define PLCOPEN_CMDQ_CAPACITY 64
+#endif
+
+PLC_STATIC_ASSERT((PLCOPEN_CMDQ_CAPACITY & (PLCOPEN_CMDQ_CAPACITY - 1)) == 0 &&
+                  PLCOPEN_CMDQ_CAPACITY >= 2,
+                  "PLCOPEN_CMDQ_CAPACITY must be a power of two");
+
+/**
+ * @brief 命令类型
+ */
+typedef enum {
+    PLCOPEN_CMD_PID_SET_MANUAL = 0,     /**< FB_PID_SetManual(target.pid, value) */
+    PLCOPEN_CMD_PID_SET_AUTO,           /**< FB_PID_SetAuto(target.pid) */
+    PLCOPEN_CMD_PID_RESET_INTEGRAL,     /**< PID 积分值清零 */
+    PLCOPEN_CMD_INTEGRATOR_RESET,       /**< FB_INTEGRATOR_Reset(target.integrator) */
+    PLCOPEN_CMD_WRITE_SETPOINT          /**< *target.variable = value */
+} plcopen_cmd_type_t;
+
+/**
+ * @brief 命令
+ */
+typedef struct {
+    union {
+        FB_PID_t* pid;
+        FB_INTEGRATOR_t* integrator;
+        float* variable;
+    } target;                   /**< 作用对象 */
+    float value;                /**< 命令参数（手动输出、设定值） */
+    uint8_t type;               /**< plcopen_cmd_type_t */
+} plcopen_cmd_t;
+
+/**
+ * @brief 命令队列
+ *
+ * tail 只由生产者写，head 只由消费者写，二者位于不同的缓存行。
+ * 生产者缓存最近读到的 head，只有缓存显示队列已满时才读取消费者的缓存行；
+ * 消费者每次 drain 只读取一次 tail。
+ */
+typedef struct {
+    PLC_ALIGNAS(PLCOPEN_CACHE_LINE) atomic_size_t tail;  /**< 生产者：下一个写入位置 */
+    size_t head_cache;                                   /**< 生产者：最近读到的 head */
+    PLC_ALIGNAS(PLCOPEN_CACHE_LINE) atomic_size_t head;  /**< 消费者：下一个读取位置 */
+    PLC_ALIGNAS(PLCOPEN_CACHE_LINE) plcopen_cmd_t slots[PLCOPEN_CMDQ_CAPACITY];
+} plcopen_cmdq_t;
+
+/**
+ * @brief 初始化队列（空）
+ */
+void plcopen_cmdq_init(plcopen_cmdq_t* q);
+
+/**
+ * @brief 生产者：投递一条命令（无等待）
+ *
+ * @return int 0=成功，-1=队列满或参数无效
+ */
+int plcopen_cmdq_push(plcopen_cmdq_t* q, const plcopen_cmd_t* cmd);
+
+/**
+ * @brief 消费者：执行调用时刻已入队的全部命令
+ *
+ * 只读取一次 tail，执行期间新投递的命令留到下一周期，
+ * 因此单次调用最多执行 PLCOPEN_CMDQ_CAPACITY 条命令。
+ *
+ * @return size_t 执行的命令数
+ */
+size_t plcopen_cmdq_drain(plcopen_cmdq_t* q);
+
+/**
+ * @brief 当前排队的命令数（近似值，仅用于监视）
+ */
+size_t plcopen_cmdq_size(const plcopen_cmdq_t* q);
+
+/* ========== 类型化投递接口 ========== */
+
+static inline int plcopen_cmdq_push_pid_set_manual(plcopen_cmdq_t* q, FB_PID_t* pid,
+                                                   float manual_output) {
+    plcopen_cmd_t cmd = { .target.pid = pid, .value = manual_output,
+                          .type = PLCOPEN_CMD_PID_SET_MANUAL };
+    return pid != NULL ? plcopen_cmdq_push(q, &cmd) : -1;
+}
+
+static inline int plcopen_cmdq_push_pid_set_auto(plcopen_cmdq_t* q, FB_PID_t* pid) {
+    plcopen_cmd_t cmd = { .target.pid = pid, .value = 0.0f,
+                          .type = PLCOPEN_CMD_PID_SET_AUTO };
+    return pid != NULL ? plcopen_cmdq_push(q, &cmd) : -1;
+}
+
+static inline int plcopen_cmdq_push_pid_reset_integral(plcopen_cmdq_t* q, FB_PID_t* pid) {
+    plcopen_cmd_t cmd = { .target.pid = pid, .value = 0.0f,
+                          .type = PLCOPEN_CMD_PID_RESET_INTEGRAL };
+    return pid != NULL ? plcopen_cmdq_push(q, &cmd) : -1;
+}
+
+static inline int plcopen_cmdq_push_integrator_reset(plcopen_cmdq_t* q,
+                                                     FB_INTEGRATOR_t* integrator) {
+    plcopen_cmd_t cmd = { .target.integrator = integrator, .value = 0.0f,
+                          .type = PLCOPEN_CMD_INTEGRATOR_RESET };
+    return integrator != NULL ? plcopen_cmdq_push(q, &cmd) : -1;
+}
+
+/**
+ * @brief 投递设定值写入：drain 时执行 *variable = value
+ *
+ * variable 是控制任务传给 Execute 的设定值变量，只应由控制任务读写。
+ */
+static inline int plcopen_cmdq_push_write_setpoint(plcopen_cmdq_t* q, float* variable,
+                                                   float value) {
+    plcopen_cmd_t cmd = { .target.variable = variable, .value = value,
+                          .type = PLCOPEN_CMD_WRITE_SETPOINT };
+    return variable != NULL ? plcopen_cmdq_push(q, &cmd) : -1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_COMMAND_QUEUE_H */
@@ -20,6 +20,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <math.h>
@@ -31,6 +32,29 @@ extern "C" {
 /* 最大采样周期（秒） */
 #define MAX_SAMPLE_TIME 1000.0f
 
+/**
+ * @brief 编译期断言（C11 _Static_assert / C++11 static_assert）
+ *
+ * 用于功能块实例的尺寸预算检查，防止结构体无意增长
+ * 导致大规模实例数组的缓存占用上升。
+ */
+#ifdef __cplusplus
+    #define PLC_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
+#else
+    #define PLC_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#endif
+
+/**
+ * @brief 对齐声明与查询（C11 _Alignas/_Alignof / C++11 alignas/alignof）
+ */
+#ifdef __cplusplus
+    #define PLC_ALIGNAS(n) alignas(n)
+    #define PLC_ALIGNOF(type) alignof(type)
+#else
+    #define PLC_ALIGNAS(n) _Alignas(n)
+    #define PLC_ALIGNOF(type) _Alignof(type)
+#endif
+
 /**
  * @brief 功能块状态码枚举
  *
@@ -104,6 +128,58 @@ bool check_inf(float value);
  */
 bool check_nan_inf(float value);
 
+/**
+ * @brief 检查数组中的值是否全部为有限数
+ *
+ * 供块处理接口（FB_xxx_ExecuteBlock）在进入内循环前一次性校验整块输入。
+ * 逐元素累积比较结果、不提前退出，循环可被编译器向量化。
+ *
+ * @param values 待检查的数组（n 为 0 时可为 NULL）
+ * @param n 元素个数
+ * @return true 如果全部为有限数（n 为 0 时亦为 true）
+ * @return false 如果至少有一个 NaN 或 Inf
+ */
+bool check_block_finite(const float* values, size_t n);
+
+/**
+ * @brief 一阶递推的 n 步衰减因子 (1 - α)^n
+ *
+ * 供 FB_xxx_Advance 以闭式解跳过 n 个扫描周期。按 exp(n · log1p(-α)) 计算：
+ * α 很小时 log1p 保留 1 - α 的有效位，n 很大时结果平滑趋于 0。
+ *
+ * @param alpha 每步系数 α（0 < α <= 1）
+ * @param n 步数
+ * @return float (1 - α)^n；n 为 0 时为 1
+ */
+float decay_factor(float alpha, uint32_t n);
+
+/**
+ * @brief 快速 exp(x) - 1（误差有界）
+ *
+ * 供可变步长接口（FB_xxx_ExecuteDt）按精确离散化计算 α = 1 - exp(-dt/τ)，
+ * 每次调用只有十余次浮点乘加，不调用 libm。|x| < ln2/2 时直接用 expm1 的多项式
+ * （dt 远小于 τ 时保留 α 的相对精度），否则以 x = n·ln2 + r 做区间约简。
+ * 相对误差不超过 FAST_EXPM1F_MAX_REL_ERROR（约 4 ulp）。
+ *
+ * @param x 指数（x < -88 时返回 -1，x > 89 时返回 +Inf，NaN 原样返回）
+ * @return float exp(x) - 1 的近似值
+ */
+float fast_expm1f(float x);
+
+/** fast_expm1f 的相对误差上界 */
+#define FAST_EXPM1F_MAX_REL_ERROR 5e-7f
+
+/**
+ * @brief 检查实测的采样间隔
+ *
+ * 供可变步长接口（FB_xxx_ExecuteDt）在更新状态前校验 dt。
+ *
+ * @param dt 距上次执行的时间（秒）
+ * @return FB_Status_t dt 为 NaN 时 FB_STATUS_ERROR_NAN，为 Inf 时 FB_STATUS_ERROR_INF，
+ *         为负时 FB_STATUS_ERROR_CONFIG，否则 FB_STATUS_OK（dt 为 0 合法）
+ */
+FB_Status_t check_elapsed_time(float dt);
+
 /**
  * @brief 输出限幅函数
  *
@@ -0,0 +1,135 @@
+/**
+ * @file config_mailbox.h
+ * @brief 无锁在线参数更新（seqlock 双缓冲配置信箱）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * HMI / 整定线程直接写 fb->config 时，控制线程可能在 Execute 中读到
+ * 一半新一半旧的系数。配置信箱把"暂存"与"采用"分开：
+ *
+ * - 任意线程调用 FB_xxx_StageConfig：先按 FB_xxx_ValidateConfig 验证，
+ *   再以 seqlock 协议写入信箱的暂存区（多个写者之间以 CAS 串行化）
+ * - 控制线程在扫描周期边界调用 FB_xxx_AdoptConfig：无新版本时只有
+ *   一次 acquire 原子加载；有新版本时复制暂存区并校验序号，
+ *   读到撕裂的数据则放弃，下一周期重试，从不等待写者
+ *
+ * 控制线程始终独占 fb->config，Execute 本身不需要任何同步。
+ *
+ * @code
+ * static plcopen_config_mailbox_t pid_mb;   // 与 FB 实例一一对应
+ * plcopen_config_mailbox_init(&pid_mb);
+ *
+ * // HMI 线程
+ * FB_PID_StageConfig(&pid_mb, &new_cfg);
+ *
+ * // 控制线程，每个扫描周期开始时
+ * FB_PID_AdoptConfig(&pid, &pid_mb);
+ * out = FB_PID_Execute(&pid, sp, pv);
+ * @endcode
+ *
+ * @note 采用新配置只替换 fb->config，运行时状态（积分值、滤波输出等）保持不变。
+ */
+
+#ifndef PLCOPEN_CONFIG_MAILBOX_H
+#define PLCOPEN_CONFIG_MAILBOX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+#include "plcopen/fb_pid.h"
+#include "plcopen/fb_pt1.h"
+#include "plcopen/fb_ramp.h"
+#include "plcopen/fb_limit.h"
+#include "plcopen/fb_deadband.h"
+#include "plcopen/fb_integrator.h"
+#include "plcopen/fb_derivative.h"
+
+/**
+ * @brief 信箱可容纳的最大配置字数（32 位）
+ */
+#define PLCOPEN_CONFIG_MAX_WORDS 12
+
+PLC_STATIC_ASSERT(sizeof(FB_PID_Config_t) <= PLCOPEN_CONFIG_MAX_WORDS * sizeof(uint32_t),
+                  "FB_PID_Config_t does not fit the config mailbox");
+
+/**
+ * @brief 配置信箱
+ *
+ * 暂存区以 32 位原子字保存，seqlock 读者的并发读取在 C11 内存模型下无数据竞争。
+ */
+typedef struct {
+    atomic_uint_least32_t seq;                             /**< 偶数：稳定；奇数：写入中 */
+    atomic_uint_least32_t words[PLCOPEN_CONFIG_MAX_WORDS]; /**< 暂存的配置 */
+    uint32_t adopted_seq;                                  /**< 控制线程已采用的版本（仅控制线程访问） */
+} plcopen_config_mailbox_t;
+
+/**
+ * @brief 初始化信箱（无待采用的配置）
+ */
+void plcopen_config_mailbox_init(plcopen_config_mailbox_t* mb);
+
+/**
+ * @brief 暂存一份配置（任意线程）
+ *
+ * 调用方负责事先验证；推荐使用类型化的 FB_xxx_StageConfig。
+ *
+ * @param mb 信箱
+ * @param config 配置数据
+ * @param size 配置字节数（<= PLCOPEN_CONFIG_MAX_WORDS * 4）
+ * @return int 0=成功，-1=参数错误
+ */
+int plcopen_config_stage(plcopen_config_mailbox_t* mb, const void* config, size_t size);
+
+/**
+ * @brief 是否有待采用的新配置（控制线程热路径：一次 acquire 加载）
+ */
+static inline bool plcopen_config_pending(const plcopen_config_mailbox_t* mb) {
+    return atomic_load_explicit(&mb->seq, memory_order_acquire) != mb->adopted_seq;
+}
+
+/**
+ * @brief 尝试读取待采用的配置（控制线程慢路径）
+ *
+ * @param mb 信箱
+ * @param config 输出缓冲区
+ * @param size 配置字节数
+ * @return int 1=已复制新配置；0=无新配置；-1=写者正在写入，下一周期重试
+ */
+int plcopen_config_fetch(plcopen_config_mailbox_t* mb, void* config, size_t size);
+
+/* ========== 类型化接口 ========== */
+
+/*
+ * 每个功能块提供：
+ *   FB_Status_t FB_xxx_StageConfig(plcopen_config_mailbox_t* mb, const FB_xxx_Config_t* config);
+ *     验证并暂存，返回 FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG（无效配置不进入信箱）
+ *   bool FB_xxx_AdoptConfig(FB_xxx_t* fb, plcopen_config_mailbox_t* mb);
+ *     在周期边界采用新配置，返回是否发生了替换
+ */
+#define PLCOPEN_DECLARE_CONFIG_MAILBOX(FB)                                              \
+    FB_Status_t FB##_StageConfig(plcopen_config_mailbox_t* mb, const FB##_Config_t* config); \
+    static inline bool FB##_AdoptConfig(FB##_t* fb, plcopen_config_mailbox_t* mb) {     \
+        if (!plcopen_config_pending(mb)) {                                              \
+            return false;                                                               \
+        }                                                                               \
+        return plcopen_config_fetch(mb, &fb->config, sizeof(fb->config)) == 1;          \
+    }
+
+PLCOPEN_DECLARE_CONFIG_MAILBOX(FB_PID)
+PLCOPEN_DECLARE_CONFIG_MAILBOX(FB_PT1)
+PLCOPEN_DECLARE_CONFIG_MAILBOX(FB_RAMP)
+PLCOPEN_DECLARE_CONFIG_MAILBOX(FB_LIMIT)
+PLCOPEN_DECLARE_CONFIG_MAILBOX(FB_DEADBAND)
+PLCOPEN_DECLARE_CONFIG_MAILBOX(FB_INTEGRATOR)
+PLCOPEN_DECLARE_CONFIG_MAILBOX(FB_DERIVATIVE)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_CONFIG_MAILBOX_H */
@@ -0,0 +1,210 @@
+/**
+ * @file fb_bank_f16.h
+ * @brief PT1 / DERIVATIVE 功能块半精度（binary16）存储批量实例
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 面向数十万至百万级软测量实例的批量（bank）存储模式。
+ * 每个 bank 以结构数组（SoA）方式保存同类实例，缓慢变化的状态和
+ * 配置以 binary16 存储，运算在 float32 寄存器中完成：
+ *
+ * | 实例布局 | 每实例字节数 |
+ * |----------|--------------|
+ * | FB_PT1_t | 20（3×float + bool + 枚举） |
+ * | FB_PT1_Bank16 | 5（输出 + α 各 2 字节，状态码 1 字节） |
+ * | FB_DERIVATIVE_t | 24 |
+ * | FB_DERIVATIVE_Bank16 | 7（上次输入 + 滤波输出 + α 各 2 字节，状态码 1 字节） |
+ *
+ * 首次运行标志以状态中的 NaN 位模式编码，不占额外存储。
+ * 同一 bank 内所有实例共享采样周期（同一任务周期执行）。
+ *
+ * 误差界（相对 float32 的 FB_PT1 / FB_DERIVATIVE）：
+ * - 存储量化：每次写回的误差 <= 1 ULP（|y| 在 [64, 128) 时 ULP = 0.0625）
+ * - α 量化：α 相对误差 <= 2^-11，等效时间常数偏差 <= 0.05%
+ * - PT1 动态：写回误差经一阶环节累积，最坏情况 |Δy| <= ULP(|y|) / α；
+ *   典型正弦/阶跃输入下实测约为该界的 50%~80%
+ * - PT1 稳态：采用"收敛舍入"，当 α(u - y) 小于半个 ULP 时状态向输入
+ *   前进一个 ULP，因此稳态输出精确收敛到 half(u)，不会停滞在
+ *   |u - y| <= ULP / (2α) 的死区内
+ * - DERIVATIVE：上次输入按半精度保存，原始微分的绝对误差
+ *   <= ULP(|u|) / Ts，例如 |u| < 128、Ts = 10ms 时 <= 6.25 单位/秒，
+ *   滤波输出最坏情况再放大 1/α；适合 |u| 较小或 Ts 较大的慢变软测量
+ * - 取值范围：|u| <= 65504，超出部分钳位并置 LIMIT_HI / LIMIT_LO
+ * - 接近零（|y| < 2^-14）时进入非正规数区，绝对误差 <= 2^-25
+ *
+ * @note 单次 Execute 处理整个 bank；x86 启用 F16C 时每 8 个实例一组向量化
+ */
+
+#ifndef PLCOPEN_FB_BANK_F16_H
+#define PLCOPEN_FB_BANK_F16_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "plcopen/common.h"
+#include "plcopen/half.h"
+
+/**
+ * @brief PT1 半精度 bank
+ *
+ * 存储数组由用户静态分配，推荐使用 FB_PT1_BANK16_STORAGE 宏。
+ */
+typedef struct {
+    plc_half_t* output;  /**< 输出状态 y（NaN 表示首次运行） */
+    plc_half_t* alpha;   /**< 滤波系数 α = Ts / (τ + Ts) */
+    int8_t* status;      /**< 状态码（FB_Status_t 压缩为 1 字节） */
+    size_t count;        /**< 实例数 */
+    float sample_time;   /**< 采样周期（秒，bank 内共享） */
+} FB_PT1_Bank16_t;
+
+/**
+ * @brief DERIVATIVE 半精度 bank
+ */
+typedef struct {
+    plc_half_t* prev_input;       /**< 上次输入（NaN 表示首次运行） */
+    plc_half_t* filtered_output;  /**< 滤波后的导数值 */
+    plc_half_t* alpha;            /**< 滤波系数（无滤波时为 1） */
+    int8_t* status;               /**< 状态码 */
+    size_t count;                 /**< 实例数 */
+    float sample_time;            /**< 采样周期（秒，bank 内共享） */
+    float inv_sample_time;        /**< 1 / Ts（Init 时预计算） */
+} FB_DERIVATIVE_Bank16_t;
+
+/**
+ * @brief 声明 PT1 半精度 bank 的静态存储
+ *
+ * @code
+ * FB_PT1_BANK16_STORAGE(sensors, 100000);
+ * FB_PT1_Bank16_Init(&sensors_bank, sensors_output, sensors_alpha,
+ *                    sensors_status, 100000, 0.1f);
+ * @endcode
+ */
+#define FB_PT1_BANK16_STORAGE(name, n)          \
+    static FB_PT1_Bank16_t name##_bank;         \
+    static plc_half_t name##_output[(n)];       \
+    static plc_half_t name##_alpha[(n)];        \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 声明 DERIVATIVE 半精度 bank 的静态存储
+ */
+#define FB_DERIVATIVE_BANK16_STORAGE(name, n)   \
+    static FB_DERIVATIVE_Bank16_t name##_bank;  \
+    static plc_half_t name##_prev_input[(n)];   \
+    static plc_half_t name##_filtered[(n)];     \
+    static plc_half_t name##_alpha[(n)];        \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 初始化 PT1 半精度 bank
+ *
+ * 所有实例复位为首次运行状态，α 初始化为 1（直通），
+ * 需随后调用 FB_PT1_Bank16_Configure 设置各实例时间常数。
+ *
+ * @param bank bank 描述符
+ * @param output 输出状态数组（count 个元素）
+ * @param alpha 滤波系数数组（count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @param sample_time 采样周期（秒，> 0 且 < 1000）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_Bank16_Init(FB_PT1_Bank16_t* bank, plc_half_t* output,
+                               plc_half_t* alpha, int8_t* status,
+                               size_t count, float sample_time);
+
+/**
+ * @brief 设置单个 PT1 实例的时间常数
+ *
+ * @param bank bank 描述符
+ * @param index 实例索引
+ * @param time_constant 时间常数 τ（秒，>= 1e-6）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_Bank16_Configure(FB_PT1_Bank16_t* bank, size_t index,
+                                    float time_constant);
+
+/**
+ * @brief 执行整个 PT1 bank
+ *
+ * 对每个实例 i 执行与 FB_PT1_Execute 相同的算法：
+ * 首次运行输出等于输入；NaN/Inf 输入输出 0 并置错误状态，状态保持不变。
+ *
+ * @param bank bank 描述符
+ * @param input 输入数组（count 个元素）
+ * @param output 输出数组（count 个元素，可与 input 相同）
+ */
+void FB_PT1_Bank16_Execute(FB_PT1_Bank16_t* bank, const float* input, float* output);
+
+/**
+ * @brief 读取单个 PT1 实例的当前输出
+ */
+static inline float FB_PT1_Bank16_GetOutput(const FB_PT1_Bank16_t* bank, size_t index) {
+    plc_half_t h = bank->output[index];
+    return plc_half_is_nan(h) ? 0.0f : plc_half_to_float(h);
+}
+
+/**
+ * @brief 读取单个 PT1 实例的状态码
+ */
+static inline FB_Status_t FB_PT1_Bank16_GetStatus(const FB_PT1_Bank16_t* bank, size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+/**
+ * @brief 初始化 DERIVATIVE 半精度 bank
+ *
+ * 所有实例复位为首次运行状态、无滤波。
+ *
+ * @param bank bank 描述符
+ * @param prev_input 上次输入数组（count 个元素）
+ * @param filtered_output 滤波输出数组（count 个元素）
+ * @param alpha 滤波系数数组（count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @param sample_time 采样周期（秒，> 0 且 < 1000）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_DERIVATIVE_Bank16_Init(FB_DERIVATIVE_Bank16_t* bank,
+                                      plc_half_t* prev_input,
+                                      plc_half_t* filtered_output,
+                                      plc_half_t* alpha, int8_t* status,
+                                      size_t count, float sample_time);
+
+/**
+ * @brief 设置单个 DERIVATIVE 实例的滤波时间常数
+ *
+ * @param bank bank 描述符
+ * @param index 实例索引
+ * @param filter_time_constant 滤波时间常数（>= 0，0 表示无滤波）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_DERIVATIVE_Bank16_Configure(FB_DERIVATIVE_Bank16_t* bank, size_t index,
+                                           float filter_time_constant);
+
+/**
+ * @brief 执行整个 DERIVATIVE bank
+ *
+ * 对每个实例执行与 FB_DERIVATIVE_Execute 相同的算法。
+ *
+ * @param bank bank 描述符
+ * @param input 输入数组（count 个元素）
+ * @param output 输出数组（count 个元素，可与 input 相同）
+ */
+void FB_DERIVATIVE_Bank16_Execute(FB_DERIVATIVE_Bank16_t* bank, const float* input, float* output);
+
+/**
+ * @brief 读取单个 DERIVATIVE 实例的状态码
+ */
+static inline FB_Status_t FB_DERIVATIVE_Bank16_GetStatus(const FB_DERIVATIVE_Bank16_t* bank,
+                                                         size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_BANK_F16_H */
@@ -0,0 +1,332 @@
+/**
+ * @file fb_bank_f32.h
+ * @brief PID / PT1 / DERIVATIVE / LIMIT 功能块 float32 批量实例（AArch64 NEON）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 面向 Cortex-A53 / A72 Linux 边缘控制器上的大批量回路。每个 bank 以结构数组（SoA）
+ * 保存同类实例的配置与状态，AArch64 上 Execute 每 4 个实例一组以 NEON 指令执行：
+ *
+ * | 功能块 | 每实例 float 数 | 标志 | 状态码 |
+ * |--------|-----------------|------|--------|
+ * | FB_PID_Bank32 | 10（7 个配置 + 积分、上次测量、上次输出） | 1 字节 | 1 字节 |
+ * | FB_PT1_Bank32 | 2（输出、α） | 1 字节 | 1 字节 |
+ * | FB_DERIVATIVE_Bank32 | 3（上次输入、滤波输出、α） | 1 字节 | 1 字节 |
+ * | FB_LIMIT_Bank32 | 2（下限、上限） | - | 1 字节 |
+ *
+ * 与 float32 标准功能块逐位一致：每个实例执行与 FB_xxx_Execute 相同的运算序列
+ * （同样的运算顺序、除法不替换为乘倒数），向量路径以逐通道比较选择代替分支。
+ * 只有整组输入有限、且均不处于首次运行 / 手动模式时走向量路径，否则整组回退到
+ * 标量路径。逐位一致的前提是编译器不把乘加合并为 FMA（GCC 在 -std=c11 下默认
+ * -ffp-contract=off；templates/cmake/toolchain-aarch64-linux.cmake 显式指定）。
+ *
+ * 浮点存储由用户以 FB_xxx_BANK32_STORAGE 宏静态分配为一块连续数组，
+ * Init 按实例数划分为各字段的子数组。同一 bank 内所有实例共享采样周期。
+ *
+ * @note 单次 Execute 处理整个 bank；非 AArch64 平台编译为逐实例的标量实现
+ */
+
+#ifndef PLCOPEN_FB_BANK_F32_H
+#define PLCOPEN_FB_BANK_F32_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+#include "plcopen/fb_pid.h"
+
+/** 实例标志位 */
+#define FB_BANK32_FIRST_RUN 0x01u   /**< 首次运行 */
+#define FB_BANK32_MANUAL    0x02u   /**< PID 手动模式 */
+#define FB_BANK32_FILTER    0x04u   /**< DERIVATIVE 启用一阶滤波 */
+
+/* ========== PID ========== */
+
+/** PID bank 每实例的 float 数 */
+#define FB_PID_BANK32_FLOATS 10
+
+/**
+ * @brief PID float32 bank
+ */
+typedef struct {
+    float* kp;                /**< 比例增益 */
+    float* ki;                /**< 积分增益 */
+    float* kd;                /**< 微分增益 */
+    float* out_min;           /**< 输出下限 */
+    float* out_max;           /**< 输出上限 */
+    float* int_min;           /**< 积分下限 */
+    float* int_max;           /**< 积分上限 */
+    float* integral;          /**< 积分累加值 */
+    float* prev_measurement;  /**< 上次测量值 */
+    float* prev_output;       /**< 上次输出值 */
+    uint8_t* flags;           /**< 首次运行 / 手动模式标志 */
+    int8_t* status;           /**< 状态码 */
+    size_t count;             /**< 实例数 */
+    float sample_time;        /**< 采样周期（秒，bank 内共享） */
+} FB_PID_Bank32_t;
+
+/**
+ * @brief 声明 PID float32 bank 的静态存储
+ *
+ * @code
+ * FB_PID_BANK32_STORAGE(loops, 256);
+ * FB_PID_Bank32_Init(&loops_bank, loops_floats, loops_flags, loops_status, 256, 0.01f);
+ * FB_PID_Bank32_Configure(&loops_bank, 0, &config);
+ * @endcode
+ */
+#define FB_PID_BANK32_STORAGE(name, n)                          \
+    static FB_PID_Bank32_t name##_bank;                         \
+    static float name##_floats[FB_PID_BANK32_FLOATS * (n)];     \
+    static uint8_t name##_flags[(n)];                           \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 初始化 PID float32 bank
+ *
+ * 所有实例以默认配置（Kp = 1，Ki = Kd = 0，输出 / 积分限幅 [0, 100]）复位为首次运行状态，
+ * 需随后调用 FB_PID_Bank32_Configure 设置各实例参数。
+ *
+ * @param bank bank 描述符
+ * @param floats 浮点存储（FB_PID_BANK32_FLOATS × count 个元素）
+ * @param flags 标志数组（count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @param sample_time 采样周期（秒，> 0 且 < 1000）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PID_Bank32_Init(FB_PID_Bank32_t* bank, float* floats, uint8_t* flags,
+                               int8_t* status, size_t count, float sample_time);
+
+/**
+ * @brief 配置单个 PID 实例并复位其状态（等价于对该实例调用 FB_PID_Init）
+ *
+ * @param bank bank 描述符
+ * @param index 实例索引
+ * @param config 配置（经 FB_PID_ValidateConfig 验证，sample_time 须等于 bank 采样周期）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PID_Bank32_Configure(FB_PID_Bank32_t* bank, size_t index,
+                                    const FB_PID_Config_t* config);
+
+/**
+ * @brief 执行整个 PID bank（每个实例与 FB_PID_Execute 逐位一致）
+ *
+ * @param bank bank 描述符
+ * @param setpoint 设定值数组（count 个元素）
+ * @param measurement 测量值数组（count 个元素）
+ * @param output 输出数组（count 个元素，可与 setpoint 或 measurement 相同）
+ */
+void FB_PID_Bank32_Execute(FB_PID_Bank32_t* bank, const float* setpoint,
+                           const float* measurement, float* output);
+
+/**
+ * @brief 单个 PID 实例切换到手动模式（与 FB_PID_SetManual 相同的无扰切换）
+ */
+void FB_PID_Bank32_SetManual(FB_PID_Bank32_t* bank, size_t index, float manual_output);
+
+/**
+ * @brief 单个 PID 实例切换到自动模式
+ */
+void FB_PID_Bank32_SetAuto(FB_PID_Bank32_t* bank, size_t index);
+
+static inline float FB_PID_Bank32_GetOutput(const FB_PID_Bank32_t* bank, size_t index) {
+    return bank->prev_output[index];
+}
+
+static inline FB_Status_t FB_PID_Bank32_GetStatus(const FB_PID_Bank32_t* bank, size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+/* ========== PT1 ========== */
+
+/** PT1 bank 每实例的 float 数 */
+#define FB_PT1_BANK32_FLOATS 2
+
+/**
+ * @brief PT1 float32 bank
+ */
+typedef struct {
+    float* output;       /**< 输出状态 y */
+    float* alpha;        /**< 滤波系数 α = Ts / (τ + Ts) */
+    uint8_t* flags;      /**< 首次运行标志 */
+    int8_t* status;      /**< 状态码 */
+    size_t count;        /**< 实例数 */
+    float sample_time;   /**< 采样周期（秒，bank 内共享） */
+} FB_PT1_Bank32_t;
+
+/**
+ * @brief 声明 PT1 float32 bank 的静态存储
+ */
+#define FB_PT1_BANK32_STORAGE(name, n)                          \
+    static FB_PT1_Bank32_t name##_bank;                         \
+    static float name##_floats[FB_PT1_BANK32_FLOATS * (n)];     \
+    static uint8_t name##_flags[(n)];                           \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 初始化 PT1 float32 bank
+ *
+ * 所有实例复位为首次运行状态，α 初始化为 1（直通），
+ * 需随后调用 FB_PT1_Bank32_Configure 设置各实例时间常数。
+ *
+ * @param bank bank 描述符
+ * @param floats 浮点存储（FB_PT1_BANK32_FLOATS × count 个元素）
+ * @param flags 标志数组（count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @param sample_time 采样周期（秒，> 0 且 < 1000）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_Bank32_Init(FB_PT1_Bank32_t* bank, float* floats, uint8_t* flags,
+                               int8_t* status, size_t count, float sample_time);
+
+/**
+ * @brief 设置单个 PT1 实例的时间常数
+ *
+ * @param bank bank 描述符
+ * @param index 实例索引
+ * @param time_constant 时间常数 τ（秒，>= 1e-6）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_Bank32_Configure(FB_PT1_Bank32_t* bank, size_t index, float time_constant);
+
+/**
+ * @brief 执行整个 PT1 bank（每个实例与 FB_PT1_Execute 逐位一致）
+ *
+ * @param bank bank 描述符
+ * @param input 输入数组（count 个元素）
+ * @param output 输出数组（count 个元素，可与 input 相同）
+ */
+void FB_PT1_Bank32_Execute(FB_PT1_Bank32_t* bank, const float* input, float* output);
+
+static inline float FB_PT1_Bank32_GetOutput(const FB_PT1_Bank32_t* bank, size_t index) {
+    return bank->output[index];
+}
+
+static inline FB_Status_t FB_PT1_Bank32_GetStatus(const FB_PT1_Bank32_t* bank, size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+/* ========== DERIVATIVE ========== */
+
+/** DERIVATIVE bank 每实例的 float 数 */
+#define FB_DERIVATIVE_BANK32_FLOATS 3
+
+/**
+ * @brief DERIVATIVE float32 bank
+ */
+typedef struct {
+    float* prev_input;        /**< 上次输入 */
+    float* filtered_output;   /**< 滤波后的导数值 */
+    float* alpha;             /**< 滤波系数（FB_BANK32_FILTER 置位时使用） */
+    uint8_t* flags;           /**< 首次运行 / 滤波使能标志 */
+    int8_t* status;           /**< 状态码 */
+    size_t count;             /**< 实例数 */
+    float sample_time;        /**< 采样周期（秒，bank 内共享） */
+} FB_DERIVATIVE_Bank32_t;
+
+/**
+ * @brief 声明 DERIVATIVE float32 bank 的静态存储
+ */
+#define FB_DERIVATIVE_BANK32_STORAGE(name, n)                       \
+    static FB_DERIVATIVE_Bank32_t name##_bank;                      \
+    static float name##_floats[FB_DERIVATIVE_BANK32_FLOATS * (n)];  \
+    static uint8_t name##_flags[(n)];                               \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 初始化 DERIVATIVE float32 bank（所有实例复位为首次运行状态、无滤波）
+ *
+ * @param bank bank 描述符
+ * @param floats 浮点存储（FB_DERIVATIVE_BANK32_FLOATS × count 个元素）
+ * @param flags 标志数组（count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @param sample_time 采样周期（秒，> 0 且 < 1000）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_DERIVATIVE_Bank32_Init(FB_DERIVATIVE_Bank32_t* bank, float* floats,
+                                      uint8_t* flags, int8_t* status,
+                                      size_t count, float sample_time);
+
+/**
+ * @brief 设置单个 DERIVATIVE 实例的滤波时间常数
+ *
+ * @param bank bank 描述符
+ * @param index 实例索引
+ * @param filter_time_constant 滤波时间常数（>= 0，0 表示无滤波）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_DERIVATIVE_Bank32_Configure(FB_DERIVATIVE_Bank32_t* bank, size_t index,
+                                           float filter_time_constant);
+
+/**
+ * @brief 执行整个 DERIVATIVE bank（每个实例与 FB_DERIVATIVE_Execute 逐位一致）
+ */
+void FB_DERIVATIVE_Bank32_Execute(FB_DERIVATIVE_Bank32_t* bank, const float* input, float* output);
+
+static inline FB_Status_t FB_DERIVATIVE_Bank32_GetStatus(const FB_DERIVATIVE_Bank32_t* bank,
+                                                         size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+/* ========== LIMIT ========== */
+
+/** LIMIT bank 每实例的 float 数 */
+#define FB_LIMIT_BANK32_FLOATS 2
+
+/**
+ * @brief LIMIT float32 bank
+ */
+typedef struct {
+    float* min_val;      /**< 下限 */
+    float* max_val;      /**< 上限（> 下限） */
+    int8_t* status;      /**< 状态码 */
+    size_t count;        /**< 实例数 */
+} FB_LIMIT_Bank32_t;
+
+/**
+ * @brief 声明 LIMIT float32 bank 的静态存储
+ */
+#define FB_LIMIT_BANK32_STORAGE(name, n)                        \
+    static FB_LIMIT_Bank32_t name##_bank;                       \
+    static float name##_floats[FB_LIMIT_BANK32_FLOATS * (n)];   \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 初始化 LIMIT float32 bank（所有实例限幅范围为 [-FLT_MAX, FLT_MAX]，即直通）
+ *
+ * @param bank bank 描述符
+ * @param floats 浮点存储（FB_LIMIT_BANK32_FLOATS × count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_LIMIT_Bank32_Init(FB_LIMIT_Bank32_t* bank, float* floats, int8_t* status,
+                                 size_t count);
+
+/**
+ * @brief 设置单个 LIMIT 实例的限幅范围
+ *
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG（max_val <= min_val）
+ */
+FB_Status_t FB_LIMIT_Bank32_Configure(FB_LIMIT_Bank32_t* bank, size_t index,
+                                      float min_val, float max_val);
+
+/**
+ * @brief 执行整个 LIMIT bank（每个实例与 FB_LIMIT_Execute 逐位一致）
+ */
+void FB_LIMIT_Bank32_Execute(FB_LIMIT_Bank32_t* bank, const float* input, float* output);
+
+static inline FB_Status_t FB_LIMIT_Bank32_GetStatus(const FB_LIMIT_Bank32_t* bank, size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_BANK_F32_H */
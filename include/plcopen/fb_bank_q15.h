@@ -0,0 +1,252 @@
+/**
+ * @file fb_bank_q15.h
+ * @brief PT1 / LIMIT / DEADBAND 功能块 Q15 定点批量实例（Cortex-M4 DSP 扩展）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 面向直接处理 ADC 采样值的大批量通道。信号以 Q15 表示（int16，满量程 [-1, 1)，
+ * 工程量由用户按量程归一化），每个 bank 以结构数组（SoA）保存同类实例。
+ *
+ * 目标平台为 ARMv7E-M（__ARM_FEATURE_SIMD32）时，Execute 使用 DSP 扩展指令，
+ * 每对相邻实例打包在一个 32 位寄存器中处理：
+ *
+ * | 功能块 | 指令 | 每实例存储 |
+ * |--------|------|------------|
+ * | FB_PT1_BankQ15 | SMLAD（y·(1-α) + u·α 一条指令完成）、SSAT | 6 字节（状态 2 + 系数对 4） |
+ * | FB_LIMIT_BankQ15 | SSUB16 + SEL（两路比较选择） | 5 字节（上下限各 2 + 状态码 1） |
+ * | FB_DEADBAND_BankQ15 | QADD16 / QSUB16（饱和边界）、SSUB16 + SEL | 4 字节（宽度 + 中心各 2） |
+ *
+ * 其他平台编译为逐实例的可移植 C 实现。FB_xxx_BankQ15_ExecuteRef 始终是可移植
+ * 实现，与 DSP 路径逐位一致，用于对照测试。
+ *
+ * 与 float32 功能块的差异：
+ * - 整数输入不存在 NaN/Inf，PT1 / DEADBAND 不保存状态码
+ * - PT1 首次运行标志为 bank 级（整个 bank 同时启动），系数 α 量化为 Q15，
+ *   取值限制在 [2^-15, 1 - 2^-15]；每步舍入误差 <= 0.5 LSB，采用收敛舍入：
+ *   α(u - y) 舍入为 0 而 u != y 时状态向输入前进 1 LSB，稳态精确收敛到输入
+ * - DEADBAND 按 |u - center| <= width 精确判定，偏差超出 Q15 量程（如 width = 32767、
+ *   center 与 u 位于量程两端）时不会因饱和误判为死区内
+ *
+ * @note 单次 Execute 处理整个 bank；实例数为奇数时最后一个实例走标量路径
+ */
+
+#ifndef PLCOPEN_FB_BANK_Q15_H
+#define PLCOPEN_FB_BANK_Q15_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+
+/** Q15 定点数：value = q / 32768 */
+typedef int16_t plc_q15_t;
+
+#define PLC_Q15_MAX ((plc_q15_t)32767)
+#define PLC_Q15_MIN ((plc_q15_t)-32768)
+
+/**
+ * @brief float 转 Q15（就近舍入，饱和到 [-1, 1 - 2^-15]，NaN 转为 0）
+ */
+static inline plc_q15_t plc_q15_from_float(float value) {
+    if (!(value == value)) {
+        return 0;
+    }
+    float scaled = value * 32768.0f;
+    if (scaled >= 32767.0f) {
+        return PLC_Q15_MAX;
+    }
+    if (scaled <= -32768.0f) {
+        return PLC_Q15_MIN;
+    }
+    return (plc_q15_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+}
+
+/**
+ * @brief Q15 转 float
+ */
+static inline float plc_q15_to_float(plc_q15_t value) {
+    return (float)value * (1.0f / 32768.0f);
+}
+
+/* ========== PT1 ========== */
+
+/**
+ * @brief PT1 Q15 bank
+ *
+ * 系数按实例打包为 32 位：低半字 1-α，高半字 α（均为 Q15），
+ * 与打包的 (y, u) 一起作为 SMLAD 的两个操作数。
+ */
+typedef struct {
+    plc_q15_t* output;   /**< 输出状态 y */
+    uint32_t* coef;      /**< 系数对（低半字 1-α，高半字 α） */
+    size_t count;        /**< 实例数 */
+    float sample_time;   /**< 采样周期（秒，bank 内共享） */
+    bool first_run;      /**< 首次运行标志（bank 级） */
+} FB_PT1_BankQ15_t;
+
+/**
+ * @brief 声明 PT1 Q15 bank 的静态存储
+ *
+ * @code
+ * FB_PT1_BANKQ15_STORAGE(adc, 64);
+ * FB_PT1_BankQ15_Init(&adc_bank, adc_output, adc_coef, 64, 0.001f);
+ * @endcode
+ */
+#define FB_PT1_BANKQ15_STORAGE(name, n)         \
+    static FB_PT1_BankQ15_t name##_bank;        \
+    static plc_q15_t name##_output[(n)];        \
+    static uint32_t name##_coef[(n)]
+
+/**
+ * @brief 初始化 PT1 Q15 bank
+ *
+ * 所有实例系数初始化为直通（α 取最大值），需随后调用
+ * FB_PT1_BankQ15_Configure 设置各实例时间常数。
+ *
+ * @param bank bank 描述符
+ * @param output 输出状态数组（count 个元素）
+ * @param coef 系数数组（count 个元素）
+ * @param count 实例数
+ * @param sample_time 采样周期（秒，> 0 且 < 1000）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_BankQ15_Init(FB_PT1_BankQ15_t* bank, plc_q15_t* output,
+                                uint32_t* coef, size_t count, float sample_time);
+
+/**
+ * @brief 设置单个 PT1 实例的时间常数
+ *
+ * @param bank bank 描述符
+ * @param index 实例索引
+ * @param time_constant 时间常数 τ（秒，>= 1e-6）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_BankQ15_Configure(FB_PT1_BankQ15_t* bank, size_t index,
+                                     float time_constant);
+
+/**
+ * @brief 执行整个 PT1 bank
+ *
+ * y[k] = y[k-1] + α(u[k] - y[k-1])，以 (1-α)·y + α·u 形式计算。
+ * 首次执行时输出等于输入。
+ *
+ * @param bank bank 描述符
+ * @param input 输入数组（count 个元素）
+ * @param output 输出数组（count 个元素，可与 input 相同）
+ */
+void FB_PT1_BankQ15_Execute(FB_PT1_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output);
+
+/**
+ * @brief 执行整个 PT1 bank（可移植参考实现，结果与 Execute 逐位一致）
+ */
+void FB_PT1_BankQ15_ExecuteRef(FB_PT1_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output);
+
+/* ========== LIMIT ========== */
+
+/**
+ * @brief LIMIT Q15 bank
+ */
+typedef struct {
+    plc_q15_t* min_val;  /**< 下限 */
+    plc_q15_t* max_val;  /**< 上限（> 下限） */
+    int8_t* status;      /**< 状态码（OK / LIMIT_HI / LIMIT_LO） */
+    size_t count;        /**< 实例数 */
+} FB_LIMIT_BankQ15_t;
+
+/**
+ * @brief 声明 LIMIT Q15 bank 的静态存储
+ */
+#define FB_LIMIT_BANKQ15_STORAGE(name, n)       \
+    static FB_LIMIT_BankQ15_t name##_bank;      \
+    static plc_q15_t name##_min[(n)];           \
+    static plc_q15_t name##_max[(n)];           \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 初始化 LIMIT Q15 bank（所有实例限幅范围为整个 Q15 量程）
+ *
+ * @param bank bank 描述符
+ * @param min_val 下限数组（count 个元素）
+ * @param max_val 上限数组（count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_LIMIT_BankQ15_Init(FB_LIMIT_BankQ15_t* bank, plc_q15_t* min_val,
+                                  plc_q15_t* max_val, int8_t* status, size_t count);
+
+/**
+ * @brief 设置单个 LIMIT 实例的限幅范围
+ *
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG（max_val <= min_val）
+ */
+FB_Status_t FB_LIMIT_BankQ15_Configure(FB_LIMIT_BankQ15_t* bank, size_t index,
+                                       plc_q15_t min_val, plc_q15_t max_val);
+
+/**
+ * @brief 执行整个 LIMIT bank（超上限置 LIMIT_HI，低于下限置 LIMIT_LO）
+ */
+void FB_LIMIT_BankQ15_Execute(FB_LIMIT_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output);
+
+/**
+ * @brief 执行整个 LIMIT bank（可移植参考实现）
+ */
+void FB_LIMIT_BankQ15_ExecuteRef(FB_LIMIT_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output);
+
+static inline FB_Status_t FB_LIMIT_BankQ15_GetStatus(const FB_LIMIT_BankQ15_t* bank, size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+/* ========== DEADBAND ========== */
+
+/**
+ * @brief DEADBAND Q15 bank
+ */
+typedef struct {
+    plc_q15_t* width;    /**< 死区半宽（>= 0） */
+    plc_q15_t* center;   /**< 死区中心 */
+    size_t count;        /**< 实例数 */
+} FB_DEADBAND_BankQ15_t;
+
+/**
+ * @brief 声明 DEADBAND Q15 bank 的静态存储
+ */
+#define FB_DEADBAND_BANKQ15_STORAGE(name, n)    \
+    static FB_DEADBAND_BankQ15_t name##_bank;   \
+    static plc_q15_t name##_width[(n)];         \
+    static plc_q15_t name##_center[(n)]
+
+/**
+ * @brief 初始化 DEADBAND Q15 bank（所有实例宽度 0、中心 0，即直通）
+ */
+FB_Status_t FB_DEADBAND_BankQ15_Init(FB_DEADBAND_BankQ15_t* bank, plc_q15_t* width,
+                                     plc_q15_t* center, size_t count);
+
+/**
+ * @brief 设置单个 DEADBAND 实例
+ *
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG（width < 0）
+ */
+FB_Status_t FB_DEADBAND_BankQ15_Configure(FB_DEADBAND_BankQ15_t* bank, size_t index,
+                                          plc_q15_t width, plc_q15_t center);
+
+/**
+ * @brief 执行整个 DEADBAND bank（|u - center| <= width 时输出 center，否则输出 u）
+ */
+void FB_DEADBAND_BankQ15_Execute(FB_DEADBAND_BankQ15_t* bank, const plc_q15_t* input,
+                                 plc_q15_t* output);
+
+/**
+ * @brief 执行整个 DEADBAND bank（可移植参考实现）
+ */
+void FB_DEADBAND_BankQ15_ExecuteRef(FB_DEADBAND_BankQ15_t* bank, const plc_q15_t* input,
+                                    plc_q15_t* output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_BANK_Q15_H */
@@ -0,0 +1,209 @@
+/**
+ * @file fb_compact.h
+ * @brief 功能块紧凑实例布局（冷热数据分离）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 标准实例（FB_xxx_t）完整保存用户配置，并以独立的 bool 和 4 字节枚举
+ * 保存标志与状态码。紧凑实例只保存 Execute 需要的热数据：
+ * - 标志位与状态码压缩到 1 个字节（见 FB_FLAG_xxx）
+ * - 由配置派生的系数在 Init 时预计算（如 Ki·Ts、Kd/Ts、α），
+ *   Execute 中不再有除法
+ * - 原始配置（冷数据）不复制到实例中，由用户保存在别处（如 Flash 常量）
+ * - 字段按 Execute 的访问顺序排列，整个实例位于一个缓存行以内
+ *
+ * | 功能块 | 标准实例 | 紧凑实例 |
+ * |--------|----------|----------|
+ * | PID | 52 | 44 |
+ * | PT1 | 20 | 12 |
+ * | RAMP | 24 | 16 |
+ * | INTEGRATOR | 24 | 20 |
+ * | DERIVATIVE | 24 | 20 |
+ *
+ * LIMIT / DEADBAND 标准实例仅 12 字节（两个 float 配置 + 状态码），
+ * 压缩状态码后仍因对齐占 12 字节，因此不提供紧凑变体。
+ *
+ * 紧凑实例的算法与标准实例一致，因系数预计算，输出与标准实例
+ * 在浮点舍入误差范围内一致。
+ */
+
+#ifndef PLCOPEN_FB_COMPACT_H
+#define PLCOPEN_FB_COMPACT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "plcopen/common.h"
+#include "plcopen/fb_pid.h"
+#include "plcopen/fb_pt1.h"
+#include "plcopen/fb_ramp.h"
+#include "plcopen/fb_integrator.h"
+#include "plcopen/fb_derivative.h"
+
+/* ========== 单字节标志位 ========== */
+
+#define FB_FLAG_STATUS_MASK   0x07u  /**< 状态码（FB_Status_t + 4，取值 1..6） */
+#define FB_FLAG_FIRST_RUN     0x08u  /**< 首次运行 */
+#define FB_FLAG_MANUAL        0x10u  /**< 手动模式（PID） */
+#define FB_FLAG_LIMIT_ENABLE  0x20u  /**< 启用输出限幅（INTEGRATOR） */
+#define FB_FLAG_FILTER        0x40u  /**< 启用微分滤波（DERIVATIVE） */
+
+/* 状态码编码偏移：FB_STATUS_ERROR_CONFIG(-3) .. FB_STATUS_LIMIT_LO(2) → 1..6 */
+#define FB_FLAG_STATUS_BIAS 4
+
+/**
+ * @brief 从标志字节取出状态码
+ */
+static inline FB_Status_t fb_flags_get_status(uint8_t flags) {
+    return (FB_Status_t)((int)(flags & FB_FLAG_STATUS_MASK) - FB_FLAG_STATUS_BIAS);
+}
+
+/**
+ * @brief 将状态码写入标志字节（保留其他标志位）
+ */
+static inline uint8_t fb_flags_set_status(uint8_t flags, FB_Status_t status) {
+    return (uint8_t)((flags & ~FB_FLAG_STATUS_MASK) |
+                     ((unsigned)((int)status + FB_FLAG_STATUS_BIAS) & FB_FLAG_STATUS_MASK));
+}
+
+/* ========== PID ========== */
+
+/**
+ * @brief PID 紧凑实例（44 字节）
+ */
+typedef struct {
+    float integral;          /**< 积分累加值 */
+    float prev_measurement;  /**< 上次测量值 */
+    float kp;                /**< 比例增益 */
+    float kd_over_ts;        /**< Kd / Ts */
+    float ki_ts;             /**< Ki · Ts */
+    float int_min;           /**< 积分限幅下限 */
+    float int_max;           /**< 积分限幅上限 */
+    float out_min;           /**< 输出下限 */
+    float out_max;           /**< 输出上限 */
+    float prev_output;       /**< 上次输出值 */
+    uint8_t flags;           /**< 状态码 | FIRST_RUN | MANUAL */
+} FB_PID_Compact_t;
+
+PLC_STATIC_ASSERT(sizeof(FB_PID_Compact_t) <= 44, "FB_PID_Compact_t exceeds its size budget");
+
+/**
+ * @brief 初始化 PID 紧凑实例（验证规则同 FB_PID_Init）
+ */
+FB_Status_t FB_PID_Compact_Init(FB_PID_Compact_t* fb, const FB_PID_Config_t* config);
+
+/**
+ * @brief 执行 PID 控制算法（同 FB_PID_Execute）
+ */
+float FB_PID_Compact_Execute(FB_PID_Compact_t* fb, float setpoint, float measurement);
+
+/**
+ * @brief 切换到手动模式（同 FB_PID_SetManual）
+ */
+void FB_PID_Compact_SetManual(FB_PID_Compact_t* fb, float manual_output);
+
+/**
+ * @brief 切换到自动模式（同 FB_PID_SetAuto）
+ */
+void FB_PID_Compact_SetAuto(FB_PID_Compact_t* fb);
+
+static inline FB_Status_t FB_PID_Compact_GetStatus(const FB_PID_Compact_t* fb) {
+    return fb_flags_get_status(fb->flags);
+}
+
+static inline bool FB_PID_Compact_IsManual(const FB_PID_Compact_t* fb) {
+    return (fb->flags & FB_FLAG_MANUAL) != 0u;
+}
+
+/* ========== PT1 ========== */
+
+/**
+ * @brief PT1 紧凑实例（12 字节）
+ */
+typedef struct {
+    float output;   /**< 当前输出值 */
+    float alpha;    /**< α = Ts / (τ + Ts) */
+    uint8_t flags;  /**< 状态码 | FIRST_RUN */
+} FB_PT1_Compact_t;
+
+PLC_STATIC_ASSERT(sizeof(FB_PT1_Compact_t) <= 12, "FB_PT1_Compact_t exceeds its size budget");
+
+FB_Status_t FB_PT1_Compact_Init(FB_PT1_Compact_t* fb, const FB_PT1_Config_t* config);
+float FB_PT1_Compact_Execute(FB_PT1_Compact_t* fb, float input);
+
+static inline FB_Status_t FB_PT1_Compact_GetStatus(const FB_PT1_Compact_t* fb) {
+    return fb_flags_get_status(fb->flags);
+}
+
+/* ========== RAMP ========== */
+
+/**
+ * @brief RAMP 紧凑实例（16 字节）
+ */
+typedef struct {
+    float output;     /**< 当前输出值 */
+    float rise_step;  /**< 单周期最大上升量（rise_rate · Ts） */
+    float fall_step;  /**< 单周期最大下降量（fall_rate · Ts） */
+    uint8_t flags;    /**< 状态码 | FIRST_RUN */
+} FB_RAMP_Compact_t;
+
+PLC_STATIC_ASSERT(sizeof(FB_RAMP_Compact_t) <= 16, "FB_RAMP_Compact_t exceeds its size budget");
+
+FB_Status_t FB_RAMP_Compact_Init(FB_RAMP_Compact_t* fb, const FB_RAMP_Config_t* config);
+float FB_RAMP_Compact_Execute(FB_RAMP_Compact_t* fb, float target);
+
+static inline FB_Status_t FB_RAMP_Compact_GetStatus(const FB_RAMP_Compact_t* fb) {
+    return fb_flags_get_status(fb->flags);
+}
+
+/* ========== INTEGRATOR ========== */
+
+/**
+ * @brief INTEGRATOR 紧凑实例（20 字节）
+ */
+typedef struct {
+    float integral;     /**< 当前积分值 */
+    float sample_time;  /**< 采样周期 */
+    float out_min;      /**< 输出下限 */
+    float out_max;      /**< 输出上限 */
+    uint8_t flags;      /**< 状态码 | LIMIT_ENABLE */
+} FB_INTEGRATOR_Compact_t;
+
+PLC_STATIC_ASSERT(sizeof(FB_INTEGRATOR_Compact_t) <= 20, "FB_INTEGRATOR_Compact_t exceeds its size budget");
+
+FB_Status_t FB_INTEGRATOR_Compact_Init(FB_INTEGRATOR_Compact_t* fb, const FB_INTEGRATOR_Config_t* config);
+float FB_INTEGRATOR_Compact_Execute(FB_INTEGRATOR_Compact_t* fb, float input);
+void FB_INTEGRATOR_Compact_Reset(FB_INTEGRATOR_Compact_t* fb);
+
+static inline FB_Status_t FB_INTEGRATOR_Compact_GetStatus(const FB_INTEGRATOR_Compact_t* fb) {
+    return fb_flags_get_status(fb->flags);
+}
+
+/* ========== DERIVATIVE ========== */
+
+/**
+ * @brief DERIVATIVE 紧凑实例（20 字节）
+ */
+typedef struct {
+    float prev_input;       /**< 上次输入值 */
+    float filtered_output;  /**< 滤波后的导数值 */
+    float inv_sample_time;  /**< 1 / Ts */
+    float alpha;            /**< 滤波系数 Ts / (Tf + Ts) */
+    uint8_t flags;          /**< 状态码 | FIRST_RUN | FILTER */
+} FB_DERIVATIVE_Compact_t;
+
+PLC_STATIC_ASSERT(sizeof(FB_DERIVATIVE_Compact_t) <= 20, "FB_DERIVATIVE_Compact_t exceeds its size budget");
+
+FB_Status_t FB_DERIVATIVE_Compact_Init(FB_DERIVATIVE_Compact_t* fb, const FB_DERIVATIVE_Config_t* config);
+float FB_DERIVATIVE_Compact_Execute(FB_DERIVATIVE_Compact_t* fb, float input);
+
+static inline FB_Status_t FB_DERIVATIVE_Compact_GetStatus(const FB_DERIVATIVE_Compact_t* fb) {
+    return fb_flags_get_status(fb->flags);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_COMPACT_H */
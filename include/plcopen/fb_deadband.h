@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "plcopen/common.h"
+#include "plcopen/profile.h"
 
 typedef struct {
     float width;  /**< 死区宽度（半宽，>= 0） */
@@ -24,8 +25,20 @@ typedef struct {
 typedef struct {
     FB_DEADBAND_Config_t config; /**< 配置参数 */
     FB_DEADBAND_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD        /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
 } FB_DEADBAND_t;
 
+/* 尺寸预算（字节） */
+PLC_STATIC_ASSERT(sizeof(FB_DEADBAND_t) <= 12 + PLCOPEN_PROF_BUDGET, "FB_DEADBAND_t exceeds its size budget");
+
+/**
+ * @brief 验证 DEADBAND 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_DEADBAND_ValidateConfig(const FB_DEADBAND_Config_t* config);
+
 /**
  * @brief 初始化 DEADBAND 死区处理
  *
@@ -46,6 +59,19 @@ int FB_DEADBAND_Init(FB_DEADBAND_t* fb, const FB_DEADBAND_Config_t* config);
  */
 float FB_DEADBAND_Execute(FB_DEADBAND_t* fb, float input);
 
+/**
+ * @brief 块处理：对连续 n 个采样依次执行 DEADBAND 死区处理
+ *
+ * 结果与按顺序调用 n 次 FB_DEADBAND_Execute 相同（逐采样语义见 FB_PT1_ExecuteBlock）。
+ * 全部输入有限时内循环只有比较与选择（可被向量化）。
+ *
+ * @param fb DEADBAND 功能块实例指针
+ * @param input 输入采样数组（n 个元素）
+ * @param output 输出数组（n 个元素，可与 input 为同一数组）
+ * @param n 采样数（0 时不做任何操作）
+ */
+void FB_DEADBAND_ExecuteBlock(FB_DEADBAND_t* fb, const float* input, float* output, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "plcopen/common.h"
+#include "plcopen/profile.h"
 
 typedef struct {
     float sample_time;           /**< 采样周期（秒，> 0） */
@@ -27,8 +28,20 @@ typedef struct {
 typedef struct {
     FB_DERIVATIVE_Config_t config; /**< 配置参数 */
     FB_DERIVATIVE_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD        /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
 } FB_DERIVATIVE_t;
 
+/* 尺寸预算（字节） */
+PLC_STATIC_ASSERT(sizeof(FB_DERIVATIVE_t) <= 24 + PLCOPEN_PROF_BUDGET, "FB_DERIVATIVE_t exceeds its size budget");
+
+/**
+ * @brief 验证 DERIVATIVE 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_DERIVATIVE_ValidateConfig(const FB_DERIVATIVE_Config_t* config);
+
 /**
  * @brief 初始化 DERIVATIVE 微分器
  *
@@ -50,6 +63,46 @@ int FB_DERIVATIVE_Init(FB_DERIVATIVE_t* fb, const FB_DERIVATIVE_Config_t* config
  */
 float FB_DERIVATIVE_Execute(FB_DERIVATIVE_t* fb, float input);
 
+/**
+ * @brief 以实测的采样间隔执行 DERIVATIVE 微分（可变步长）
+ *
+ * 原始微分为 (u(k) - u(k-1)) / dt；滤波系数 alpha = 1 - exp(-dt / Tf)，
+ * 是输入在周期内线性变化时的精确离散化。dt 为 0 时状态不变、返回上次输出；
+ * 其余 dt 校验与返回值约定同 FB_PT1_ExecuteDt。
+ *
+ * @param fb DERIVATIVE 功能块实例指针
+ * @param input 当前输入值
+ * @param dt 距上次执行的时间（秒）
+ * @return float 微分输出值
+ */
+float FB_DERIVATIVE_ExecuteDt(FB_DERIVATIVE_t* fb, float input, float dt);
+
+/**
+ * @brief 块处理：对连续 n 个采样依次执行 DERIVATIVE 微分
+ *
+ * 结果与按顺序调用 n 次 FB_DERIVATIVE_Execute 相同（逐采样语义见 FB_PT1_ExecuteBlock）。
+ * 全部输入有限时滤波分支与 α 提到循环外，上次输入与滤波输出保存在寄存器中。
+ *
+ * @param fb DERIVATIVE 功能块实例指针
+ * @param input 输入采样数组（n 个元素）
+ * @param output 输出数组（n 个元素，可与 input 为同一数组）
+ * @param n 采样数（0 时不做任何操作）
+ */
+void FB_DERIVATIVE_ExecuteBlock(FB_DERIVATIVE_t* fb, const float* input, float* output, size_t n);
+
+/**
+ * @brief 输入保持不变，快进 k 个扫描周期
+ *
+ * O(1) 代替 k 次 FB_DERIVATIVE_Execute（约定同 FB_PT1_Advance）：
+ * 第一个周期计入输入跳变，之后原始微分为 0，滤波输出按 (1 - α)^(k-1) 衰减（无滤波时为 0）。
+ *
+ * @param fb DERIVATIVE 功能块实例指针
+ * @param input 输入值（k 个周期内保持不变）
+ * @param k 周期数（0 时不改变状态，返回当前输出）
+ * @return float k 个周期后的微分值
+ */
+float FB_DERIVATIVE_Advance(FB_DERIVATIVE_t* fb, float input, uint32_t k);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "plcopen/common.h"
+#include "plcopen/profile.h"
 
 typedef struct {
     float sample_time; /**< 采样周期（秒，> 0） */
@@ -27,8 +28,20 @@ typedef struct {
 typedef struct {
     FB_INTEGRATOR_Config_t config; /**< 配置参数 */
     FB_INTEGRATOR_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD        /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
 } FB_INTEGRATOR_t;
 
+/* 尺寸预算（字节） */
+PLC_STATIC_ASSERT(sizeof(FB_INTEGRATOR_t) <= 24 + PLCOPEN_PROF_BUDGET, "FB_INTEGRATOR_t exceeds its size budget");
+
+/**
+ * @brief 验证 INTEGRATOR 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_INTEGRATOR_ValidateConfig(const FB_INTEGRATOR_Config_t* config);
+
 /**
  * @brief 初始化 INTEGRATOR 积分器
  *
@@ -49,6 +62,46 @@ int FB_INTEGRATOR_Init(FB_INTEGRATOR_t* fb, const FB_INTEGRATOR_Config_t* config
  */
 float FB_INTEGRATOR_Execute(FB_INTEGRATOR_t* fb, float input);
 
+/**
+ * @brief 以实测的采样间隔执行 INTEGRATOR 积分（可变步长）
+ *
+ * 积分增量为 u(k) * dt，限幅同 FB_INTEGRATOR_Execute；dt 等于 sample_time 时
+ * 结果与 FB_INTEGRATOR_Execute 逐位相同。dt 校验约定同 FB_PT1_ExecuteDt，
+ * dt 无效时积分值不变并返回当前积分值。
+ *
+ * @param fb INTEGRATOR 功能块实例指针
+ * @param input 当前输入值
+ * @param dt 距上次执行的时间（秒）
+ * @return float 积分输出值
+ */
+float FB_INTEGRATOR_ExecuteDt(FB_INTEGRATOR_t* fb, float input, float dt);
+
+/**
+ * @brief 块处理：对连续 n 个采样依次执行 INTEGRATOR 积分
+ *
+ * 结果与按顺序调用 n 次 FB_INTEGRATOR_Execute 相同（逐采样语义见 FB_PT1_ExecuteBlock）。
+ * 全部输入有限时限幅分支提到循环外，积分值保存在寄存器中；状态码取最后一个采样的结果。
+ *
+ * @param fb INTEGRATOR 功能块实例指针
+ * @param input 输入采样数组（n 个元素）
+ * @param output 输出数组（n 个元素，可与 input 为同一数组）
+ * @param n 采样数（0 时不做任何操作）
+ */
+void FB_INTEGRATOR_ExecuteBlock(FB_INTEGRATOR_t* fb, const float* input, float* output, size_t n);
+
+/**
+ * @brief 输入保持不变，快进 k 个扫描周期
+ *
+ * O(1) 代替 k 次 FB_INTEGRATOR_Execute（约定同 FB_PT1_Advance）：
+ * I_k = clamp(I_1 + (k-1)·u·dt)：输入不变时积分值单调，终点限幅一次与逐周期限幅等价。
+ *
+ * @param fb INTEGRATOR 功能块实例指针
+ * @param input 输入值（k 个周期内保持不变）
+ * @param k 周期数（0 时不改变状态，返回当前输出）
+ * @return float k 个周期后的积分值
+ */
+float FB_INTEGRATOR_Advance(FB_INTEGRATOR_t* fb, float input, uint32_t k);
+
 /**
  * @brief 复位积分器
  *
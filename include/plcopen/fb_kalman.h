@@ -0,0 +1,170 @@
+/**
+ * @file fb_kalman.h
+ * @brief PLCopen 离散卡尔曼滤波功能块（编译期定维的小矩阵内核）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 线性时不变模型
+ *
+ *   x(k) = A·x(k-1) + B·u(k) + w，  z(k) = H·x(k) + v，  w ~ (0, Q)，v ~ (0, R)
+ *
+ * 每次 Execute 先以输入 u 预测，再以测量 z 校正，两种模式：
+ *
+ * - 完整模式：每周期更新协方差
+ *     P⁻ = A·P·Aᵀ + Q，S = H·P⁻·Hᵀ + R，K = P⁻·Hᵀ·S⁻¹（S 的 Cholesky 分解求解，不显式求逆）
+ *     x = x⁻ + K·(z − H·x⁻)
+ *     P = (I − K·H)·P⁻·(I − K·H)ᵀ + K·R·Kᵀ（Joseph 形式）
+ *   Joseph 形式比 P = (I − K·H)·P⁻ 多一次矩阵乘，但在单精度下保持 P 对称半正定；
+ *   简化形式的舍入会使 P 失去对称甚至出现负对角元，滤波随之发散。
+ *   P 只计算上三角再镜像，因此严格对称。
+ * - 稳态模式（steady_state）：模型时不变时 K 收敛到常数。Init 迭代 Riccati 递推直到 K 与 P 收敛，
+ *   预先算出 F = (I − K·H)·A 与 G = (I − K·H)·B，每周期只剩 x = F·x + G·u + K·z
+ *   一次矩阵-向量乘（n·(n + p + m) 次乘加），与 PID 同一量级。
+ *
+ * 状态维数上限、测量维数上限与输入维数上限在编译期确定，所有矩阵按上限静态分配在实例内，
+ * 不使用动态内存。内核按状态维数 n = 1 ~ FB_KALMAN_MAX_STATES 各特化一份，
+ * 最内层的点积循环次数为常量并完全展开，没有循环控制与下标计算开销。
+ *
+ * 矩阵在配置中按行存放，行跨度为对应上限（如 a[i][j] 为第 i 行第 j 列），
+ * 只使用左上角的有效部分，可直接用指定初始化器书写：
+ *
+ * @code
+ * FB_KALMAN_Config_t config = {
+ *     .states = 2, .outputs = 1, .inputs = 0,
+ *     .a = { { 1.0f, 0.01f }, { 0.0f, 1.0f } },       // 位置-速度模型，Ts = 10 ms
+ *     .h = { { 1.0f, 0.0f } },
+ *     .q = { { 1e-6f, 0.0f }, { 0.0f, 1e-4f } },
+ *     .r = { { 1e-2f } },
+ *     .p0 = { { 1.0f, 0.0f }, { 0.0f, 1.0f } },
+ *     .steady_state = true,
+ * };
+ * @endcode
+ *
+ * 典型应用：
+ * - 编码器/位置测量估计速度（无微分噪声放大）
+ * - 带噪声模拟量的状态估计、传感器融合
+ */
+
+#ifndef PLCOPEN_FB_KALMAN_H
+#define PLCOPEN_FB_KALMAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "plcopen/common.h"
+#include "plcopen/profile.h"
+
+/** 状态维数上限，决定实例内矩阵大小与特化内核的数量，可在编译时覆盖 */
+#ifndef FB_KALMAN_MAX_STATES
+#define FB_KALMAN_MAX_STATES 6
+#endif
+
+/** 测量维数上限，可在编译时覆盖 */
+#ifndef FB_KALMAN_MAX_OUTPUTS
+#define FB_KALMAN_MAX_OUTPUTS 2
+#endif
+
+/** 输入维数上限，可在编译时覆盖（配置中的 inputs 可以为 0） */
+#ifndef FB_KALMAN_MAX_INPUTS
+#define FB_KALMAN_MAX_INPUTS 2
+#endif
+
+/** 稳态模式 Init 中 Riccati 递推的最大迭代次数 */
+#define FB_KALMAN_RICCATI_ITERATIONS 10000
+
+PLC_STATIC_ASSERT(FB_KALMAN_MAX_STATES >= 1 && FB_KALMAN_MAX_STATES <= 6,
+                  "FB_KALMAN_MAX_STATES must be in [1, 6]");
+PLC_STATIC_ASSERT(FB_KALMAN_MAX_OUTPUTS >= 1 && FB_KALMAN_MAX_OUTPUTS <= 3,
+                  "FB_KALMAN_MAX_OUTPUTS must be in [1, 3]");
+PLC_STATIC_ASSERT(FB_KALMAN_MAX_INPUTS >= 1 && FB_KALMAN_MAX_INPUTS <= 6,
+                  "FB_KALMAN_MAX_INPUTS must be in [1, 6]");
+
+typedef struct {
+    uint8_t states;        /**< 状态维数 n（1 ~ FB_KALMAN_MAX_STATES） */
+    uint8_t outputs;       /**< 测量维数 m（1 ~ FB_KALMAN_MAX_OUTPUTS） */
+    uint8_t inputs;        /**< 输入维数 p（0 ~ FB_KALMAN_MAX_INPUTS） */
+    bool steady_state;     /**< true：Init 求稳态增益，每周期只做状态更新 */
+    float a[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_STATES];    /**< 状态转移矩阵 A（n × n） */
+    float b[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_INPUTS];    /**< 输入矩阵 B（n × p） */
+    float h[FB_KALMAN_MAX_OUTPUTS][FB_KALMAN_MAX_STATES];   /**< 测量矩阵 H（m × n） */
+    float q[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_STATES];    /**< 过程噪声协方差 Q（对称半正定） */
+    float r[FB_KALMAN_MAX_OUTPUTS][FB_KALMAN_MAX_OUTPUTS];  /**< 测量噪声协方差 R（对称正定） */
+    float x0[FB_KALMAN_MAX_STATES];                         /**< 初始状态估计 */
+    float p0[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_STATES];   /**< 初始协方差（对称半正定） */
+} FB_KALMAN_Config_t;
+
+typedef struct {
+    float x[FB_KALMAN_MAX_STATES];                          /**< 状态估计 */
+    float p[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_STATES];    /**< 估计协方差（稳态模式下为收敛值） */
+    float gain[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_OUTPUTS]; /**< 卡尔曼增益 K（n × m） */
+    float innovation[FB_KALMAN_MAX_OUTPUTS];                /**< 新息 z − H·x⁻（稳态模式不计算） */
+    float f[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_STATES];    /**< 稳态模式：(I − K·H)·A */
+    float g[FB_KALMAN_MAX_STATES][FB_KALMAN_MAX_INPUTS];    /**< 稳态模式：(I − K·H)·B */
+    FB_Status_t status;    /**< 状态码 */
+} FB_KALMAN_State_t;
+
+typedef struct {
+    FB_KALMAN_Config_t config; /**< 配置参数 */
+    FB_KALMAN_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD         /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
+} FB_KALMAN_t;
+
+/* 尺寸预算（字节）：配置与状态中的矩阵 + 固定部分 */
+#define FB_KALMAN_MATRIX_FLOATS                                                             \
+    (5 * FB_KALMAN_MAX_STATES * FB_KALMAN_MAX_STATES                                        \
+     + 2 * FB_KALMAN_MAX_STATES * FB_KALMAN_MAX_INPUTS                                      \
+     + 2 * FB_KALMAN_MAX_STATES * FB_KALMAN_MAX_OUTPUTS                                     \
+     + FB_KALMAN_MAX_OUTPUTS * FB_KALMAN_MAX_OUTPUTS + 2 * FB_KALMAN_MAX_STATES             \
+     + FB_KALMAN_MAX_OUTPUTS)
+PLC_STATIC_ASSERT(sizeof(FB_KALMAN_t) <= 4 * FB_KALMAN_MATRIX_FLOATS + 16 + PLCOPEN_PROF_BUDGET,
+                  "FB_KALMAN_t exceeds its size budget");
+
+/**
+ * @brief 验证 KALMAN 配置参数
+ *
+ * 维数在范围内；所用矩阵元素均为有限值；Q、P0 对称且对角元非负；R 对称正定。
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_KALMAN_ValidateConfig(const FB_KALMAN_Config_t* config);
+
+/**
+ * @brief 初始化 KALMAN 功能块
+ *
+ * 稳态模式下迭代 Riccati 递推求稳态增益，FB_KALMAN_RICCATI_ITERATIONS 次内
+ * 不收敛（如模型不可检测）时返回 -1。
+ *
+ * @param fb KALMAN 功能块实例指针
+ * @param config 配置参数指针
+ * @return int 返回码：0=成功，-1=配置错误
+ */
+int FB_KALMAN_Init(FB_KALMAN_t* fb, const FB_KALMAN_Config_t* config);
+
+/**
+ * @brief 执行 KALMAN：以输入预测，再以测量校正
+ *
+ * measurement 为 NULL 表示本周期无测量（多速率采样），只做预测。
+ * 测量含 NaN/Inf 时只做预测并设置状态码；输入含 NaN/Inf 时状态保持不变并设置状态码。
+ * 完整模式下 S 失去正定（协方差已被破坏）时跳过校正，返回 FB_STATUS_ERROR_CONFIG。
+ *
+ * @param fb KALMAN 功能块实例指针
+ * @param measurement 测量向量 z（outputs 个元素，可为 NULL）
+ * @param input 输入向量 u（inputs 个元素；inputs 为 0 时可为 NULL）
+ * @return FB_Status_t 状态码
+ */
+FB_Status_t FB_KALMAN_Execute(FB_KALMAN_t* fb, const float* measurement, const float* input);
+
+/**
+ * @brief 读取第 index 个状态估计
+ */
+static inline float FB_KALMAN_GetState(const FB_KALMAN_t* fb, unsigned index) {
+    return fb->state.x[index];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_KALMAN_H */
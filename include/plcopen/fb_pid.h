@@ -42,6 +42,7 @@ extern "C" {
 #endif
 
 #include "plcopen/common.h"
+#include "plcopen/profile.h"
 
 /**
  * @brief PID 控制器配置参数
@@ -81,8 +82,22 @@ typedef struct {
 typedef struct {
     FB_PID_Config_t config;   /**< 配置参数 */
     FB_PID_State_t state;     /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD        /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
 } FB_PID_t;
 
+/* 尺寸预算（字节） */
+PLC_STATIC_ASSERT(sizeof(FB_PID_t) <= 52 + PLCOPEN_PROF_BUDGET, "FB_PID_t exceeds its size budget");
+
+/**
+ * @brief 验证 PID 配置参数
+ *
+ * 与 FB_PID_Init 使用相同的验证规则，可用于在线修改参数前预先检查。
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PID_ValidateConfig(const FB_PID_Config_t* config);
+
 /**
  * @brief 初始化 PID 控制器
  *
@@ -140,6 +155,25 @@ FB_Status_t FB_PID_Init(FB_PID_t* fb, const FB_PID_Config_t* config);
  */
 float FB_PID_Execute(FB_PID_t* fb, float setpoint, float measurement);
 
+/**
+ * @brief 以实测的采样间隔执行 PID 控制算法（可变步长）
+ *
+ * 扫描周期有抖动时，以两次调用之间实测的 dt 代替 config.sample_time：
+ * 积分项 I += Ki * error * dt，微分项 D = -Kd * (PV[k] - PV[k-1]) / dt，
+ * 比例项、条件积分与限幅同 FB_PID_Execute；dt 等于 sample_time 时结果与 FB_PID_Execute 逐位相同。
+ *
+ * dt 为 0 时积分、上次测量值与输出均不变，返回上次输出；dt 为 NaN/Inf/负数时状态不变，输出 0，
+ * 状态码为 FB_STATUS_ERROR_NAN / FB_STATUS_ERROR_INF / FB_STATUS_ERROR_CONFIG（check_elapsed_time）。
+ * 首次运行、手动模式与输入 NaN/Inf 的处理同 FB_PID_Execute。
+ *
+ * @param fb PID 功能块实例指针
+ * @param setpoint 设定值（SP）
+ * @param measurement 测量值（PV）
+ * @param dt 距上次执行的时间（秒）
+ * @return float 控制输出（MV）
+ */
+float FB_PID_ExecuteDt(FB_PID_t* fb, float setpoint, float measurement, float dt);
+
 /**
  * @brief 切换到手动模式
  *
@@ -8,7 +8,7 @@
  * 用于信号平滑和高频噪声抑制。
  *
  * 传递函数：H(s) = 1 / (τs + 1)
- * 离散化：使用前向欧拉法
+ * 离散化：FB_PT1_Execute 使用前向欧拉法，FB_PT1_ExecuteDt 使用零阶保持精确离散化
  *
  * 典型应用：
  * - 传感器信号滤波
@@ -24,6 +24,7 @@ extern "C" {
 #endif
 
 #include "plcopen/common.h"
+#include "plcopen/profile.h"
 
 typedef struct {
     float time_constant;   /**< 时间常数 τ（秒，>= 1e-6） */
@@ -39,8 +40,20 @@ typedef struct {
 typedef struct {
     FB_PT1_Config_t config; /**< 配置参数 */
     FB_PT1_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD        /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
 } FB_PT1_t;
 
+/* 尺寸预算（字节） */
+PLC_STATIC_ASSERT(sizeof(FB_PT1_t) <= 20 + PLCOPEN_PROF_BUDGET, "FB_PT1_t exceeds its size budget");
+
+/**
+ * @brief 验证 PT1 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_ValidateConfig(const FB_PT1_Config_t* config);
+
 /**
  * @brief 初始化 PT1 滤波器
  *
@@ -62,6 +75,57 @@ FB_Status_t FB_PT1_Init(FB_PT1_t* fb, const FB_PT1_Config_t* config);
  */
 float FB_PT1_Execute(FB_PT1_t* fb, float input);
 
+/**
+ * @brief 以实测的采样间隔执行 PT1 滤波（可变步长）
+ *
+ * Linux 主机等扫描周期有抖动的平台上，以两次调用之间实测的 dt 代替 config.sample_time：
+ * y(k) = y(k-1) + alpha * (u(k) - y(k-1))，其中 alpha = 1 - exp(-dt / tau)。
+ * 这是输入在周期内保持不变时的精确离散化：输出只取决于经过的总时间，
+ * 与周期如何划分无关（FB_PT1_Execute 的前向欧拉 alpha 在 Ts 接近 tau 时偏慢）。
+ * exp 由 fast_expm1f 计算（相对误差 < FAST_EXPM1F_MAX_REL_ERROR），不调用 libm。
+ *
+ * dt 为 0 时输出不变；dt 为 NaN/Inf/负数时状态不变，输出 0，
+ * 状态码为 FB_STATUS_ERROR_NAN / FB_STATUS_ERROR_INF / FB_STATUS_ERROR_CONFIG。
+ * 首次运行与输入 NaN/Inf 的处理同 FB_PT1_Execute。
+ *
+ * @param fb PT1 功能块实例指针
+ * @param input 当前输入值
+ * @param dt 距上次执行的时间（秒）
+ * @return float 滤波后的输出值
+ */
+float FB_PT1_ExecuteDt(FB_PT1_t* fb, float input, float dt);
+
+/**
+ * @brief 块处理：对连续 n 个采样依次执行 PT1 滤波
+ *
+ * 用于一次处理 ADC DMA 半传输/全传输交付的过采样缓冲区。每个输出、执行后的状态
+ * 与状态码都与按顺序调用 n 次 FB_PT1_Execute 相同：整块输入先一次性校验，
+ * 全部有限时首次运行判断只做一次、α 只计算一次、输出状态保存在寄存器中；
+ * 块内含 NaN/Inf 时逐采样执行，异常处理与 FB_PT1_Execute 一致。
+ * 剖析计数与 USDT 探针按一次调用计（entry 为首个输入，exit 为最后一个输出）。
+ *
+ * @param fb PT1 功能块实例指针
+ * @param input 输入采样数组（n 个元素）
+ * @param output 输出数组（n 个元素，可与 input 为同一数组）
+ * @param n 采样数（0 时不做任何操作）
+ */
+void FB_PT1_ExecuteBlock(FB_PT1_t* fb, const float* input, float* output, size_t n);
+
+/**
+ * @brief 输入保持不变，快进 k 个扫描周期
+ *
+ * 任务超时或仿真暂停后追赶，或超实时仿真时，以 O(1) 代价代替 k 次 FB_PT1_Execute。
+ * 第一个周期按 Execute 执行（首次运行、NaN/Inf 处理不变），其余 k-1 个周期用闭式解：
+ * y_k = u + (y_1 - u)(1 - α)^(k-1)。
+ * 结果与 k 次 Execute 在浮点舍入范围内一致（逐步递推每步各有一次舍入）。
+ *
+ * @param fb PT1 功能块实例指针
+ * @param input 输入值（k 个周期内保持不变）
+ * @param k 周期数（0 时不改变状态，返回当前输出）
+ * @return float k 个周期后的输出值
+ */
+float FB_PT1_Advance(FB_PT1_t* fb, float input, uint32_t k);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "plcopen/common.h"
+#include "plcopen/profile.h"
 
 typedef struct {
     float rise_rate;       /**< 上升速率（单位/秒，> 0） */
@@ -27,8 +28,20 @@ typedef struct {
 typedef struct {
     FB_RAMP_Config_t config; /**< 配置参数 */
     FB_RAMP_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD        /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
 } FB_RAMP_t;
 
+/* 尺寸预算（字节） */
+PLC_STATIC_ASSERT(sizeof(FB_RAMP_t) <= 24 + PLCOPEN_PROF_BUDGET, "FB_RAMP_t exceeds its size budget");
+
+/**
+ * @brief 验证 RAMP 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_RAMP_ValidateConfig(const FB_RAMP_Config_t* config);
+
 /**
  * @brief 初始化 RAMP 斜坡发生器
  *
@@ -49,6 +62,45 @@ int FB_RAMP_Init(FB_RAMP_t* fb, const FB_RAMP_Config_t* config);
  */
 float FB_RAMP_Execute(FB_RAMP_t* fb, float target);
 
+/**
+ * @brief 以实测的采样间隔执行 RAMP 斜坡（可变步长）
+ *
+ * 本周期允许的最大变化量为 rate * dt；dt 等于 sample_time 时结果与 FB_RAMP_Execute
+ * 逐位相同。dt 校验约定同 FB_PT1_ExecuteDt，dt 无效时输出不变并返回当前输出。
+ *
+ * @param fb RAMP 功能块实例指针
+ * @param target 目标值
+ * @param dt 距上次执行的时间（秒）
+ * @return float 斜坡输出值
+ */
+float FB_RAMP_ExecuteDt(FB_RAMP_t* fb, float target, float dt);
+
+/**
+ * @brief 块处理：对连续 n 个采样依次执行 RAMP 斜坡
+ *
+ * 结果与按顺序调用 n 次 FB_RAMP_Execute 相同（逐采样语义见 FB_PT1_ExecuteBlock）。
+ * 全部目标值有限时每周期最大上升/下降量只计算一次，输出保存在寄存器中。
+ *
+ * @param fb RAMP 功能块实例指针
+ * @param target 目标值数组（n 个元素）
+ * @param output 输出数组（n 个元素，可与 target 为同一数组）
+ * @param n 采样数（0 时不做任何操作）
+ */
+void FB_RAMP_ExecuteBlock(FB_RAMP_t* fb, const float* target, float* output, size_t n);
+
+/**
+ * @brief 输入保持不变，快进 k 个扫描周期
+ *
+ * O(1) 代替 k 次 FB_RAMP_Execute（约定同 FB_PT1_Advance）：
+ * 以 (k-1)·rate·dt 的总变化量逼近目标，越过目标时停在目标值。
+ *
+ * @param fb RAMP 功能块实例指针
+ * @param target 目标值（k 个周期内保持不变）
+ * @param k 周期数（0 时不改变状态，返回当前输出）
+ * @return float k 个周期后的输出值
+ */
+float FB_RAMP_Advance(FB_RAMP_t* fb, float target, uint32_t k);
+
 #ifdef __cplusplus
 }
 #endif
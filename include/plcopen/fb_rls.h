@@ -0,0 +1,190 @@
+/**
+ * @file fb_rls.h
+ * @brief PLCopen 递推最小二乘在线辨识功能块（ARX 模型，UD 分解协方差）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 从正常运行数据在线辨识 ARX 模型，不需要停车做阶跃试验：
+ *
+ *   y(k) = −a1·y(k−1) − … − a_na·y(k−na) + b1·u(k−d−1) + … + b_nb·u(k−d−nb) + c + e(k)
+ *
+ * 参数向量 θ = [a1 … a_na, b1 … b_nb, c]，回归向量 φ 由输出、输入历史（和常数 1）组成。
+ * d 为已知的纯滞后采样数，c 为可选的常数偏置（工作点不在零点时需要）。
+ *
+ * 带遗忘因子 λ 的递推最小二乘：
+ *
+ *   e = y − φᵀ·θ，  K = P·φ / (λ + φᵀ·P·φ)，  θ = θ + K·e，  P = (P − K·φᵀ·P) / λ
+ *
+ * 协方差不以 P 本身存放，而以 Bierman UD 分解 P = U·D·Uᵀ 存放（U 为单位上三角，D 为对角）。
+ * 每次更新 O(n²) 次乘加、n 次除法，不开方；D 的更新只含正数的乘除，
+ * 因此 P 在单精度、λ < 1 的长期运行中始终保持对称正定。直接按上式更新 P 的标准形式
+ * 在相减中丢失精度，P 逐渐失去对称和正定，参数估计随之发散。
+ *
+ * 激励不足（稳态运行、手动、阀门卡死）时遗忘因子使 P 按 1/λ 指数增长（协方差饱胀），
+ * 激励恢复时参数估计剧烈跳动。D 的对角元被限制在 initial_covariance 以内以防止饱胀。
+ *
+ * 所有存储按编译期上限静态分配在实例内（U 按列压缩存放严格上三角部分），
+ * 单个实例约 300 字节，数千个回路可直接用 FB_RLS_t 数组在慢速任务中逐个执行。
+ *
+ * FOPDT 模型（一阶惯性加纯滞后）对应 na = 1 的 ARX 模型，
+ * FB_RLS_GetFOPDT 将参数换算为增益、时间常数和纯滞后，供 PID 整定规则使用。
+ *
+ * 使用示例：
+ * @code
+ * FB_RLS_t ident;
+ * FB_RLS_Config_t config = {
+ *     .sample_time = 1.0f, .forgetting = 0.995f, .initial_covariance = 100.0f,
+ *     .na = 1, .nb = 2, .delay = 5, .bias = true,
+ * };
+ * FB_RLS_Init(&ident, &config);
+ *
+ * // 周期执行（1s）：u 为本周期 PID 输出，y 为本周期测量值
+ * FB_RLS_Execute(&ident, u, y);
+ *
+ * FB_RLS_FOPDT_t model;
+ * if (FB_RLS_GetFOPDT(&ident, &model) == FB_STATUS_OK) {
+ *     // model.gain, model.time_constant, model.dead_time
+ * }
+ * @endcode
+ */
+
+#ifndef PLCOPEN_FB_RLS_H
+#define PLCOPEN_FB_RLS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "plcopen/common.h"
+#include "plcopen/profile.h"
+
+/** na、nb 的上限，可在编译时覆盖 */
+#ifndef FB_RLS_MAX_ORDER
+#define FB_RLS_MAX_ORDER 3
+#endif
+
+/** 纯滞后采样数上限，决定输入历史的长度，可在编译时覆盖 */
+#ifndef FB_RLS_MAX_DELAY
+#define FB_RLS_MAX_DELAY 32
+#endif
+
+PLC_STATIC_ASSERT(FB_RLS_MAX_ORDER >= 1 && FB_RLS_MAX_ORDER <= 8, "FB_RLS_MAX_ORDER must be in [1, 8]");
+PLC_STATIC_ASSERT(FB_RLS_MAX_DELAY >= 0 && FB_RLS_MAX_DELAY <= 200, "FB_RLS_MAX_DELAY must be in [0, 200]");
+
+/** 参数个数上限：na + nb + 偏置 */
+#define FB_RLS_MAX_PARAMS (2 * FB_RLS_MAX_ORDER + 1)
+
+/** U 的严格上三角元素个数 */
+#define FB_RLS_FACTOR_SIZE (FB_RLS_MAX_PARAMS * (FB_RLS_MAX_PARAMS - 1) / 2)
+
+/** 输入历史长度 */
+#define FB_RLS_HISTORY (FB_RLS_MAX_DELAY + FB_RLS_MAX_ORDER)
+
+typedef struct {
+    float sample_time;         /**< 采样周期（秒，> 0，仅用于换算 FOPDT 参数） */
+    float forgetting;          /**< 遗忘因子 λ（0.9 ~ 1，1 为不遗忘） */
+    float initial_covariance;  /**< 初始协方差 P = p0·I，同时为 D 对角元的上限（> 0） */
+    uint8_t na;                /**< 输出阶次（0 ~ FB_RLS_MAX_ORDER） */
+    uint8_t nb;                /**< 输入阶次（1 ~ FB_RLS_MAX_ORDER） */
+    uint8_t delay;             /**< 纯滞后 d（采样数，0 ~ FB_RLS_MAX_DELAY） */
+    bool bias;                 /**< 是否估计常数偏置 c */
+} FB_RLS_Config_t;
+
+typedef struct {
+    float theta[FB_RLS_MAX_PARAMS];      /**< 参数估计 [a1 … a_na, b1 … b_nb, c] */
+    float d[FB_RLS_MAX_PARAMS];          /**< UD 分解的对角元 */
+    float u[FB_RLS_FACTOR_SIZE];         /**< UD 分解的严格上三角，按列压缩：U[i][j] 位于 j·(j−1)/2 + i */
+    float u_history[FB_RLS_HISTORY];     /**< 输入历史（环形缓冲） */
+    float y_history[FB_RLS_MAX_ORDER];   /**< 输出历史，y_history[0] 为 y(k−1) */
+    float error;                         /**< 最近一次的先验预测误差 y − φᵀ·θ */
+    uint16_t samples;                    /**< 连续有效的历史采样数（达到所需长度后开始更新） */
+    uint8_t params;                      /**< 参数个数 n */
+    uint8_t u_head;                      /**< 输入历史中最新采样的位置 */
+    uint8_t u_length;                    /**< 输入历史长度 d + nb */
+    FB_Status_t status;                  /**< 状态码 */
+} FB_RLS_State_t;
+
+typedef struct {
+    FB_RLS_Config_t config;  /**< 配置参数 */
+    FB_RLS_State_t state;    /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD       /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
+} FB_RLS_t;
+
+/* 尺寸预算（字节）：参数、分解与历史 + 固定部分 */
+PLC_STATIC_ASSERT(sizeof(FB_RLS_t) <= 4 * (2 * FB_RLS_MAX_PARAMS + FB_RLS_FACTOR_SIZE + FB_RLS_HISTORY
+                                           + FB_RLS_MAX_ORDER) + 40 + PLCOPEN_PROF_BUDGET,
+                  "FB_RLS_t exceeds its size budget");
+
+/**
+ * @brief FOPDT 模型 K·e^(−θs) / (T·s + 1)
+ */
+typedef struct {
+    float gain;           /**< 静态增益 K */
+    float time_constant;  /**< 时间常数 T（秒） */
+    float dead_time;      /**< 纯滞后 θ（秒） */
+} FB_RLS_FOPDT_t;
+
+/**
+ * @brief 验证 RLS 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_RLS_ValidateConfig(const FB_RLS_Config_t* config);
+
+/**
+ * @brief 初始化 RLS 功能块：θ = 0，P = initial_covariance·I，历史清空
+ *
+ * @param fb RLS 功能块实例指针
+ * @param config 配置参数指针
+ * @return int 返回码：0=成功，-1=配置错误
+ */
+int FB_RLS_Init(FB_RLS_t* fb, const FB_RLS_Config_t* config);
+
+/**
+ * @brief 执行 RLS：以本周期的输入、输出更新参数估计
+ *
+ * 历史采样数达到 max(na, d + nb) 之前只记录历史，不更新参数。
+ * 输入或输出含 NaN/Inf 时参数保持不变、历史重新开始积累（回归向量不能跨越无效采样），
+ * 并设置状态码。
+ *
+ * @param fb RLS 功能块实例指针
+ * @param input 本周期的过程输入 u(k)（如 PID 输出）
+ * @param output 本周期的过程输出 y(k)（测量值）
+ * @return float 先验预测误差 y(k) − φᵀ·θ（未更新时为 0）
+ */
+float FB_RLS_Execute(FB_RLS_t* fb, float input, float output);
+
+/**
+ * @brief 协方差复位为 initial_covariance·I，保留参数估计
+ *
+ * 已知过程发生变化（换产、切换工况）时调用，使估计重新快速收敛。
+ *
+ * @param fb RLS 功能块实例指针
+ */
+void FB_RLS_ResetCovariance(FB_RLS_t* fb);
+
+/**
+ * @brief 将 na = 1 的 ARX 参数换算为 FOPDT 模型
+ *
+ * 极点 p = −a1 须在 (0, 1) 内：K = Σb / (1 − p)，T = −Ts / ln(p)，
+ * θ = (d + Σ(j−1)·b_j / Σb)·Ts（nb > 1 时以 b 的加权位置估计非整数滞后部分）。
+ *
+ * @param fb RLS 功能块实例指针
+ * @param model 输出的 FOPDT 模型
+ * @return FB_Status_t FB_STATUS_OK；na ≠ 1 或极点不在 (0, 1) 内时为 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_RLS_GetFOPDT(const FB_RLS_t* fb, FB_RLS_FOPDT_t* model);
+
+/**
+ * @brief 读取第 index 个参数估计
+ */
+static inline float FB_RLS_GetParameter(const FB_RLS_t* fb, unsigned index) {
+    return fb->state.theta[index];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_RLS_H */
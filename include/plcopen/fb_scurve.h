@@ -0,0 +1,129 @@
+/**
+ * @file fb_scurve.h
+ * @brief PLCopen S 曲线设定值发生器功能块（加加速度限制）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * FB_RAMP 只限制速率，斜坡两端加速度为无穷大，会激励机械负载的共振。
+ * FB_SCURVE 同时限制速度、加速度与加加速度（jerk），上升/下降方向各有一组上限，
+ * 输出为三阶多项式拼接的 S 曲线：位置、速度、加速度连续，加加速度有界。
+ *
+ * 段时间只在目标值变化时规划一次（从当前位置、速度、加速度出发，最多
+ * FB_SCURVE_MAX_SEGMENTS 个恒定加加速度段）；其余周期只在当前段上求一次三次多项式，
+ * 不做逐周期的限幅判断。
+ *
+ * 规划顺序：
+ * 1. 加速度不为 0 时先以加加速度上限把加速度降到 0
+ * 2. 正在远离目标，或以当前速度无法在目标前停下时，先减速到 0（越过目标后再返回）
+ * 3. 加速到峰值速度 → 匀速 → 减速停在目标值：速度上限可达时峰值为上限，
+ *    否则以固定次数的二分求出恰好能停在目标值的峰值速度
+ *
+ * 加速度或加加速度上限可以为 +Inf：仅加加速度为 +Inf 时为梯形速度曲线；
+ * 两个方向的加速度与加加速度上限都为 +Inf 时退化为 FB_RAMP，
+ * 输出与 rise_rate/fall_rate 相同的 FB_RAMP 逐位相同。
+ *
+ * 典型应用：
+ * - 伺服/变频轴的位置或速度设定值
+ * - 阀门、料位等大惯量执行机构的平滑设定值
+ */
+
+#ifndef PLCOPEN_FB_SCURVE_H
+#define PLCOPEN_FB_SCURVE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "plcopen/common.h"
+#include "plcopen/profile.h"
+
+/** 一次规划的最大段数：加速度归零 1 + 停止 3 + 加速/匀速/减速 7 */
+#define FB_SCURVE_MAX_SEGMENTS 11
+
+typedef struct {
+    float rise_rate;       /**< 上升方向速度上限（单位/秒，> 0，同 FB_RAMP） */
+    float fall_rate;       /**< 下降方向速度上限（单位/秒，> 0，同 FB_RAMP） */
+    float rise_accel;      /**< 上升方向加速度上限（单位/秒²，> 0，可为 +Inf） */
+    float fall_accel;      /**< 下降方向加速度上限（单位/秒²，> 0，可为 +Inf） */
+    float rise_jerk;       /**< 上升方向加加速度上限（单位/秒³，> 0，可为 +Inf） */
+    float fall_jerk;       /**< 下降方向加加速度上限（单位/秒³，> 0，可为 +Inf） */
+    float sample_time;     /**< 采样周期（秒） */
+} FB_SCURVE_Config_t;
+
+/**
+ * @brief 恒定加加速度段
+ *
+ * 段内 t 时刻：a = acc + jerk·t，v = vel + acc·t + jerk·t²/2，
+ * p = pos + vel·t + acc·t²/2 + jerk·t³/6。起点状态在规划时算好，
+ * 加速度上限为 +Inf 时段与段之间的加速度（及速度）可以跳变。
+ */
+typedef struct {
+    float duration;        /**< 段时长（秒，> 0） */
+    float jerk;            /**< 加加速度 */
+    float acc;             /**< 起点加速度 */
+    float vel;             /**< 起点速度 */
+    float pos;             /**< 起点位置 */
+} FB_SCURVE_Segment_t;
+
+typedef struct {
+    float output;          /**< 当前输出值（位置） */
+    float velocity;        /**< 当前速度 */
+    float acceleration;    /**< 当前加速度 */
+    float target;          /**< 已规划的目标值 */
+    float time_offset;     /**< 当前段起点到段内第 0 个采样的时间（秒） */
+    uint32_t cycles;       /**< 当前段内已执行的周期数 */
+    uint8_t segment;       /**< 当前段序号 */
+    uint8_t segment_count; /**< 已规划的段数（segment >= segment_count 时静止在目标值） */
+    bool first_run;        /**< 首次运行标志 */
+    FB_Status_t status;    /**< 状态码 */
+    FB_SCURVE_Segment_t segments[FB_SCURVE_MAX_SEGMENTS]; /**< 已规划的段 */
+} FB_SCURVE_State_t;
+
+typedef struct {
+    FB_SCURVE_Config_t config; /**< 配置参数 */
+    FB_SCURVE_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD          /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
+} FB_SCURVE_t;
+
+/* 尺寸预算（字节） */
+PLC_STATIC_ASSERT(sizeof(FB_SCURVE_t) <= 288 + PLCOPEN_PROF_BUDGET, "FB_SCURVE_t exceeds its size budget");
+
+/**
+ * @brief 验证 SCURVE 配置参数
+ *
+ * 速度上限必须为正的有限值；加速度与加加速度上限必须为正，可以为 +Inf。
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_SCURVE_ValidateConfig(const FB_SCURVE_Config_t* config);
+
+/**
+ * @brief 初始化 SCURVE 设定值发生器
+ *
+ * @param fb SCURVE 功能块实例指针
+ * @param config 配置参数指针
+ * @return int 返回码：0=成功，-1=配置错误
+ */
+int FB_SCURVE_Init(FB_SCURVE_t* fb, const FB_SCURVE_Config_t* config);
+
+/**
+ * @brief 执行 SCURVE 设定值发生器
+ *
+ * 首次运行时输出直接等于目标值（同 FB_RAMP）。目标值与已规划的目标不同时
+ * 从当前位置、速度、加速度重新规划；之后每个周期在当前段上求值，
+ * 最后一段结束时输出精确等于目标值。速度与加速度保存在 state 中，可用作前馈。
+ * 目标值为 NaN/Inf 时报告状态码，并继续沿已规划的曲线运动到上一个有效目标
+ * （不因无效目标产生速度跳变）。
+ *
+ * @param fb SCURVE 功能块实例指针
+ * @param target 目标值
+ * @return float 当前输出值
+ */
+float FB_SCURVE_Execute(FB_SCURVE_t* fb, float target);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_SCURVE_H */
@@ -0,0 +1,114 @@
+/**
+ * @file fb_sgderiv.h
+ * @brief PLCopen 滑动窗口最小二乘（Savitzky–Golay）微分器功能块
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * FB_DERIVATIVE 的单步差分 (u(k) - u(k-1)) / Ts 把量化噪声放大 1/Ts 倍，
+ * 加 PT1 滤波又引入滞后。FB_SGDERIV 输出最近 window 个采样的最小二乘直线斜率
+ * （一阶 Savitzky–Golay 微分）：
+ *
+ *   slope = Σ (j - c)·u(j) / (Ts · Σ (j - c)²)，j = 0..N-1（0 为最旧），c = (N - 1) / 2
+ *
+ * 白噪声下斜率方差为 σ² · 12 / (Ts² · N(N² - 1))，滞后为固定的 (N - 1)·Ts / 2，
+ * 对斜坡输入无稳态误差。
+ *
+ * 两个窗口和 Σu(j) 与 Σj·u(j) 随采样递推更新，每个采样只做常数次运算，与窗口长度无关。
+ * 为避免递推舍入累积，另有一组影子和从空开始累加新采样，满一个窗口后替换递推和，
+ * 因此任何时刻的和最多只含一个窗口的舍入，而最坏情况仍是 O(1)。
+ * 两组和都相对一个近期采样（参考值）计算，输入有大偏置时不损失斜率精度。
+ *
+ * 环形缓冲区按编译期上限 FB_SGDERIV_MAX_WINDOW 静态分配在实例内。
+ *
+ * 典型应用：
+ * - 编码器/位置采样求速度
+ * - 液位、温度等慢变量的变化率（带噪声的模拟量）
+ */
+
+#ifndef PLCOPEN_FB_SGDERIV_H
+#define PLCOPEN_FB_SGDERIV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "plcopen/common.h"
+#include "plcopen/profile.h"
+
+/** 最大窗口长度（采样数），决定每个实例的环形缓冲区大小，可在编译时覆盖 */
+#ifndef FB_SGDERIV_MAX_WINDOW
+#define FB_SGDERIV_MAX_WINDOW 32
+#endif
+
+PLC_STATIC_ASSERT(FB_SGDERIV_MAX_WINDOW >= 2 && FB_SGDERIV_MAX_WINDOW <= 4096,
+                  "FB_SGDERIV_MAX_WINDOW must be in [2, 4096]");
+
+typedef struct {
+    float sample_time;     /**< 采样周期（秒，> 0） */
+    uint16_t window;       /**< 窗口长度（采样数，2 ~ FB_SGDERIV_MAX_WINDOW） */
+} FB_SGDERIV_Config_t;
+
+typedef struct {
+    float history[FB_SGDERIV_MAX_WINDOW]; /**< 最近 window 个输入（环形缓冲区） */
+    float sum;             /**< Σ (u(j) - ref) */
+    float moment;          /**< Σ j·(u(j) - ref)，j = 0 为最旧采样 */
+    float ref;             /**< 递推和的参考值 */
+    float shadow_sum;      /**< 影子和：本轮新采样的 Σ (u - shadow_ref) */
+    float shadow_moment;   /**< 影子和：本轮新采样的 Σ k·(u - shadow_ref) */
+    float shadow_ref;      /**< 影子和的参考值（本轮第一个采样） */
+    float center;          /**< (window - 1) / 2 */
+    float gain;            /**< 12 / (Ts · N(N² - 1)) */
+    float output;          /**< 当前斜率 */
+    uint16_t head;         /**< 最旧采样的位置（下一个写入位置） */
+    uint16_t shadow_count; /**< 影子和已累加的采样数 */
+    bool first_run;        /**< 首次运行标志 */
+    FB_Status_t status;    /**< 状态码 */
+} FB_SGDERIV_State_t;
+
+typedef struct {
+    FB_SGDERIV_Config_t config; /**< 配置参数 */
+    FB_SGDERIV_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD          /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
+} FB_SGDERIV_t;
+
+/* 尺寸预算（字节）：环形缓冲区 + 固定部分 */
+PLC_STATIC_ASSERT(sizeof(FB_SGDERIV_t) <= 4 * FB_SGDERIV_MAX_WINDOW + 64 + PLCOPEN_PROF_BUDGET,
+                  "FB_SGDERIV_t exceeds its size budget");
+
+/**
+ * @brief 验证 SGDERIV 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_SGDERIV_ValidateConfig(const FB_SGDERIV_Config_t* config);
+
+/**
+ * @brief 初始化 SGDERIV 微分器
+ *
+ * 窗口长度与采样周期决定的系数在此预先算好；修改配置后须重新初始化。
+ *
+ * @param fb SGDERIV 功能块实例指针
+ * @param config 配置参数指针
+ * @return int 返回码：0=成功，-1=配置错误
+ */
+int FB_SGDERIV_Init(FB_SGDERIV_t* fb, const FB_SGDERIV_Config_t* config);
+
+/**
+ * @brief 执行 SGDERIV 微分器
+ *
+ * 首次运行时以当前输入填满窗口并返回 0（同 FB_DERIVATIVE），
+ * 之后 window - 1 个周期内斜率逐渐建立。
+ * 输入为 NaN/Inf 时返回 0 并设置状态码，窗口与递推和保持不变。
+ *
+ * @param fb SGDERIV 功能块实例指针
+ * @param input 输入值
+ * @return float 窗口内最小二乘直线的斜率（单位/秒）
+ */
+float FB_SGDERIV_Execute(FB_SGDERIV_t* fb, float input);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_SGDERIV_H */
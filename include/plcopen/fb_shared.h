@@ -0,0 +1,152 @@
+/**
+ * @file fb_shared.h
+ * @brief 共享配置（享元）PT1 / LIMIT 功能块
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 大量参数相同的回路（如同型号传感器的 PT1 滤波、同一量程的 LIMIT）
+ * 使用标准实例时，每个实例都会在 Init 中 memcpy 一份完整配置。
+ * 享元实例只保存自身状态，不保存配置，也不保存指向配置的指针：
+ *
+ * - 共享配置对象（FB_xxx_SharedConfig_t）由 FB_xxx_SharedConfig_Set 验证
+ *   并预计算系数（PT1 的 α），验证失败时保持原值不变
+ * - 实例（FB_xxx_Shared_t）Init 时检查共享配置已设置；Execute 由调用方传入
+ *   共享配置（同一组实例通常在同一个循环中执行），只读取共享配置，只写实例自身状态
+ * - 对共享配置再次调用 FB_xxx_SharedConfig_Set 即同时重新整定所有使用者，
+ *   实例状态（如 PT1 输出）保持连续
+ *
+ * | 实例类型 | 32 位 MCU（字节） | 64 位主机（字节） |
+ * |----------|-------------------|-------------------|
+ * | FB_PT1_t | 20 | 20 |
+ * | FB_PT1_Shared_t | 8 | 8 |
+ * | FB_LIMIT_t | 12 | 12 |
+ * | FB_LIMIT_Shared_t | 1 | 1 |
+ *
+ * 实例中没有指针，尺寸与目标字长无关。共享配置本身只占一条缓存行，N 个实例执行时始终命中 L1。
+ *
+ * @code
+ * static FB_LIMIT_SharedConfig_t valve_range;
+ * static FB_LIMIT_Shared_t valves[1000];
+ * for (int i = 0; i < 1000; i++) {
+ *     out[i] = FB_LIMIT_Shared_Execute(&valves[i], &valve_range, in[i]);
+ * }
+ * @endcode
+ *
+ * @warning FB_xxx_SharedConfig_Set 不是原子操作，必须与使用者的 Execute
+ *          在同一任务中顺序调用（例如在扫描周期之间），不可跨线程并发修改。
+ */
+
+#ifndef PLCOPEN_FB_SHARED_H
+#define PLCOPEN_FB_SHARED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "plcopen/common.h"
+#include "plcopen/fb_pt1.h"
+#include "plcopen/fb_limit.h"
+#include "plcopen/fb_compact.h"
+
+/* ========== PT1 ========== */
+
+/**
+ * @brief PT1 共享配置（已验证，含预计算系数）
+ */
+typedef struct {
+    float alpha;            /**< α = Ts / (τ + Ts)（热数据） */
+    FB_PT1_Config_t config; /**< 原始配置（冷数据，仅供读取） */
+} FB_PT1_SharedConfig_t;
+
+/**
+ * @brief PT1 享元实例
+ */
+typedef struct {
+    float output;   /**< 当前输出值 */
+    uint8_t flags;  /**< 状态码 | FIRST_RUN */
+} FB_PT1_Shared_t;
+
+/* 尺寸预算（字节）：float + 标志字节（与目标字长无关） */
+PLC_STATIC_ASSERT(sizeof(FB_PT1_Shared_t) <= 2 * sizeof(float),
+                  "FB_PT1_Shared_t exceeds its size budget");
+
+/**
+ * @brief 设置（或重新整定）PT1 共享配置
+ *
+ * 验证通过后预计算 α；验证失败时共享配置保持原值，使用者不受影响。
+ *
+ * @param shared 共享配置对象
+ * @param config 配置参数（验证规则同 FB_PT1_Init）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_SharedConfig_Set(FB_PT1_SharedConfig_t* shared, const FB_PT1_Config_t* config);
+
+/**
+ * @brief 初始化 PT1 享元实例
+ *
+ * @param fb 实例指针
+ * @param shared 将与该实例一起执行的共享配置（须已通过 FB_PT1_SharedConfig_Set 设置）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_PT1_Shared_Init(FB_PT1_Shared_t* fb, const FB_PT1_SharedConfig_t* shared);
+
+/**
+ * @brief 执行 PT1 享元实例（算法同 FB_PT1_Execute）
+ *
+ * @param fb 实例指针
+ * @param shared 共享配置（调用方保证与 Init 时相同或已重新整定）
+ * @param input 输入值
+ */
+float FB_PT1_Shared_Execute(FB_PT1_Shared_t* fb, const FB_PT1_SharedConfig_t* shared, float input);
+
+static inline FB_Status_t FB_PT1_Shared_GetStatus(const FB_PT1_Shared_t* fb) {
+    return fb_flags_get_status(fb->flags);
+}
+
+/* ========== LIMIT ========== */
+
+/**
+ * @brief LIMIT 共享配置（已验证）
+ */
+typedef struct {
+    FB_LIMIT_Config_t config; /**< 限幅范围 */
+} FB_LIMIT_SharedConfig_t;
+
+/**
+ * @brief LIMIT 享元实例
+ */
+typedef struct {
+    uint8_t flags;  /**< 状态码 */
+} FB_LIMIT_Shared_t;
+
+PLC_STATIC_ASSERT(sizeof(FB_LIMIT_Shared_t) == sizeof(uint8_t),
+                  "FB_LIMIT_Shared_t exceeds its size budget");
+
+/**
+ * @brief 设置（或重新整定）LIMIT 共享配置
+ *
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG（共享配置保持原值）
+ */
+FB_Status_t FB_LIMIT_SharedConfig_Set(FB_LIMIT_SharedConfig_t* shared, const FB_LIMIT_Config_t* config);
+
+/**
+ * @brief 初始化 LIMIT 享元实例（共享配置须已设置）
+ *
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_LIMIT_Shared_Init(FB_LIMIT_Shared_t* fb, const FB_LIMIT_SharedConfig_t* shared);
+
+/**
+ * @brief 执行 LIMIT 享元实例（算法同 FB_LIMIT_Execute）
+ */
+float FB_LIMIT_Shared_Execute(FB_LIMIT_Shared_t* fb, const FB_LIMIT_SharedConfig_t* shared, float input);
+
+static inline FB_Status_t FB_LIMIT_Shared_GetStatus(const FB_LIMIT_Shared_t* fb) {
+    return fb_flags_get_status(fb->flags);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_SHARED_H */
@@ -0,0 +1,236 @@
+/**
+ * @file fb_stats.h
+ * @brief PLCopen 流式统计功能块：累计均值/方差与滑动窗口最小/最大值
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 回路诊断与报警需要每个信号的运行均值、方差和最近一段时间内的极值。
+ * 每周期重新扫描历史数组的代价与窗口长度成正比；FB_STATS 每个采样只做常数次更新：
+ *
+ * - 均值/方差：Welford 递推（δ = x − mean；mean += δ / n；M2 += δ·(x − mean)），
+ *   自 Init 或 FB_STATS_Reset 起累计，不保存历史，数值稳定（不做 Σx² − (Σx)²/n 相减）。
+ *   递推在相对第一个有效采样（origin）的偏差上进行：单精度下 δ/n 小于均值的半个 ulp 时
+ *   均值不再更新，大偏置信号（如 10000 附近 ±0.1）若直接递推，几百个采样后均值就停滞
+ * - 最小/最大值：最近 window 个周期内的极值，各由一个单调双端队列维护。
+ *   新采样从队尾弹出所有不比它大（最小值队列为不比它小）的元素后入队，
+ *   队首超出窗口时出队，队首即为极值。每个采样最多入队、出队各一次，均摊 O(1)；
+ *   单个周期的最坏情况为 window 次弹出（前 window − 1 个采样单调递减后出现最大值）
+ *
+ * 最小值队列保存取反后的值，与最大值队列共用同一段代码（取反是精确运算）。
+ * 队列元素带 16 位周期戳，窗口按 Execute 调用次数计：NaN/Inf 采样不进入统计，
+ * 但窗口照常滑动，连续无效采样超过 window 个周期后极值保持最后的有效值。
+ *
+ * FB_STATS_Bank 以相同的更新处理成千上万个信号（同一 bank 共享窗口长度与周期戳），
+ * 每个实例的结果与 FB_STATS_Execute 逐位相同。
+ *
+ * 典型应用：
+ * - 回路性能监视（控制偏差均值/标准差）
+ * - 报警（最近 N 个周期的峰值/谷值）、传感器卡滞检测（窗口极差为 0）
+ */
+
+#ifndef PLCOPEN_FB_STATS_H
+#define PLCOPEN_FB_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+#include "plcopen/profile.h"
+
+/** 单实例最大窗口长度（周期数），决定实例内双端队列的大小，可在编译时覆盖 */
+#ifndef FB_STATS_MAX_WINDOW
+#define FB_STATS_MAX_WINDOW 64
+#endif
+
+/** 窗口长度上限：周期戳为 16 位，窗口内的周期差必须可区分 */
+#define FB_STATS_WINDOW_LIMIT 32768
+
+PLC_STATIC_ASSERT(FB_STATS_MAX_WINDOW >= 1 && FB_STATS_MAX_WINDOW <= FB_STATS_WINDOW_LIMIT,
+                  "FB_STATS_MAX_WINDOW must be in [1, FB_STATS_WINDOW_LIMIT]");
+
+typedef struct {
+    uint16_t window;       /**< 极值窗口长度（周期数，1 ~ FB_STATS_MAX_WINDOW） */
+} FB_STATS_Config_t;
+
+typedef struct {
+    float mean;            /**< 累计均值（origin + mean_offset） */
+    float origin;          /**< 递推参考值（复位后第一个有效采样） */
+    float mean_offset;     /**< 相对 origin 的累计均值 */
+    float m2;              /**< 累计偏差平方和 M2 */
+    float min;             /**< 窗口最小值 */
+    float max;             /**< 窗口最大值 */
+    uint32_t count;        /**< 累计的有效采样数 */
+    uint16_t tick;         /**< 周期戳（每次 Execute 加 1，回绕） */
+    uint16_t max_head;     /**< 最大值队列队首位置 */
+    uint16_t max_count;    /**< 最大值队列长度 */
+    uint16_t min_head;     /**< 最小值队列队首位置 */
+    uint16_t min_count;    /**< 最小值队列长度 */
+    FB_Status_t status;    /**< 状态码 */
+    float max_value[FB_STATS_MAX_WINDOW];     /**< 最大值队列：值（单调不增） */
+    float min_value[FB_STATS_MAX_WINDOW];     /**< 最小值队列：取反后的值（单调不增） */
+    uint16_t max_stamp[FB_STATS_MAX_WINDOW];  /**< 最大值队列：入队周期戳 */
+    uint16_t min_stamp[FB_STATS_MAX_WINDOW];  /**< 最小值队列：入队周期戳 */
+} FB_STATS_State_t;
+
+typedef struct {
+    FB_STATS_Config_t config; /**< 配置参数 */
+    FB_STATS_State_t state;   /**< 运行时状态 */
+    PLCOPEN_PROF_FIELD        /* 执行剖析计数器（仅 PLCOPEN_ENABLE_PROFILING） */
+} FB_STATS_t;
+
+/* 尺寸预算（字节）：两个双端队列 + 固定部分 */
+PLC_STATIC_ASSERT(sizeof(FB_STATS_t) <= 12 * FB_STATS_MAX_WINDOW + 56 + PLCOPEN_PROF_BUDGET,
+                  "FB_STATS_t exceeds its size budget");
+
+/**
+ * @brief 验证 STATS 配置参数
+ *
+ * @param config 配置参数指针
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_STATS_ValidateConfig(const FB_STATS_Config_t* config);
+
+/**
+ * @brief 初始化 STATS 功能块
+ *
+ * @param fb STATS 功能块实例指针
+ * @param config 配置参数指针
+ * @return int 返回码：0=成功，-1=配置错误
+ */
+int FB_STATS_Init(FB_STATS_t* fb, const FB_STATS_Config_t* config);
+
+/**
+ * @brief 执行 STATS：加入一个采样
+ *
+ * 更新累计均值/方差与窗口极值；结果在 state.mean / state.min / state.max 中，
+ * 方差由 FB_STATS_GetVariance 读取。输入为 NaN/Inf 时设置状态码，
+ * 采样不计入统计，窗口照常滑动。
+ *
+ * @param fb STATS 功能块实例指针
+ * @param input 输入值
+ * @return float 累计均值（尚无有效采样时为 0）
+ */
+float FB_STATS_Execute(FB_STATS_t* fb, float input);
+
+/**
+ * @brief 清零累计均值/方差，窗口极值不受影响（如每班次/每批次重新统计）
+ *
+ * @param fb STATS 功能块实例指针
+ */
+void FB_STATS_Reset(FB_STATS_t* fb);
+
+/**
+ * @brief 累计样本方差 M2 / (n − 1)（少于 2 个有效采样时为 0）
+ */
+static inline float FB_STATS_GetVariance(const FB_STATS_t* fb) {
+    return (fb->state.count > 1u) ? fb->state.m2 / (float)(fb->state.count - 1u) : 0.0f;
+}
+
+/* ========== 批量实例 ========== */
+
+/** bank 每实例的 float 数：均值、参考值、相对均值、M2、最小值、最大值 + 两个队列各 window 个值 */
+#define FB_STATS_BANK_FLOATS(window) (6 + 2 * (window))
+
+/** bank 每实例的 uint16_t 数：两个队列的队首与长度 + 两个队列各 window 个周期戳 */
+#define FB_STATS_BANK_WORDS(window) (4 + 2 * (window))
+
+/**
+ * @brief STATS bank
+ *
+ * 每个字段为 count 个实例的子数组；队列按实例连续存放（实例 i 的队列从 i × window 开始），
+ * 一个信号的全部队列元素位于相邻缓存行。
+ */
+typedef struct {
+    float* mean;           /**< 累计均值 */
+    float* origin;         /**< 递推参考值 */
+    float* mean_offset;    /**< 相对 origin 的累计均值 */
+    float* m2;             /**< 累计偏差平方和 M2 */
+    float* min;            /**< 窗口最小值 */
+    float* max;            /**< 窗口最大值 */
+    float* max_value;      /**< 最大值队列：值（count × window） */
+    float* min_value;      /**< 最小值队列：取反后的值（count × window） */
+    uint16_t* max_head;    /**< 最大值队列队首位置 */
+    uint16_t* max_count;   /**< 最大值队列长度 */
+    uint16_t* min_head;    /**< 最小值队列队首位置 */
+    uint16_t* min_count;   /**< 最小值队列长度 */
+    uint16_t* max_stamp;   /**< 最大值队列：入队周期戳（count × window） */
+    uint16_t* min_stamp;   /**< 最小值队列：入队周期戳（count × window） */
+    uint32_t* count;       /**< 累计的有效采样数 */
+    int8_t* status;        /**< 状态码 */
+    size_t instances;      /**< 实例数 */
+    uint16_t window;       /**< 极值窗口长度（bank 内共享） */
+    uint16_t tick;         /**< 周期戳（bank 内共享） */
+} FB_STATS_Bank_t;
+
+/**
+ * @brief 声明 STATS bank 的静态存储
+ *
+ * @code
+ * FB_STATS_BANK_STORAGE(diag, 4096, 100);
+ * FB_STATS_Bank_Init(&diag_bank, diag_floats, diag_words, diag_counts, diag_status, 4096, 100);
+ * FB_STATS_Bank_Execute(&diag_bank, deviations);
+ * @endcode
+ */
+#define FB_STATS_BANK_STORAGE(name, n, window)                          \
+    static FB_STATS_Bank_t name##_bank;                                 \
+    static float name##_floats[FB_STATS_BANK_FLOATS(window) * (n)];     \
+    static uint16_t name##_words[FB_STATS_BANK_WORDS(window) * (n)];    \
+    static uint32_t name##_counts[(n)];                                 \
+    static int8_t name##_status[(n)]
+
+/**
+ * @brief 初始化 STATS bank，所有实例复位（等价于对每个实例调用 FB_STATS_Init）
+ *
+ * @param bank bank 描述符
+ * @param floats 浮点存储（FB_STATS_BANK_FLOATS(window) × count 个元素）
+ * @param words 16 位存储（FB_STATS_BANK_WORDS(window) × count 个元素）
+ * @param counts 有效采样数数组（count 个元素）
+ * @param status 状态码数组（count 个元素）
+ * @param count 实例数
+ * @param window 极值窗口长度（1 ~ FB_STATS_WINDOW_LIMIT，不受 FB_STATS_MAX_WINDOW 限制）
+ * @return FB_Status_t FB_STATUS_OK 或 FB_STATUS_ERROR_CONFIG
+ */
+FB_Status_t FB_STATS_Bank_Init(FB_STATS_Bank_t* bank, float* floats, uint16_t* words,
+                               uint32_t* counts, int8_t* status, size_t count, uint16_t window);
+
+/**
+ * @brief 执行整个 STATS bank：每个实例加入一个采样（每个实例与 FB_STATS_Execute 逐位一致）
+ *
+ * @param bank bank 描述符
+ * @param input 输入数组（count 个元素）
+ */
+void FB_STATS_Bank_Execute(FB_STATS_Bank_t* bank, const float* input);
+
+/**
+ * @brief 清零单个实例的累计均值/方差（同 FB_STATS_Reset）
+ */
+void FB_STATS_Bank_Reset(FB_STATS_Bank_t* bank, size_t index);
+
+static inline float FB_STATS_Bank_GetMean(const FB_STATS_Bank_t* bank, size_t index) {
+    return bank->mean[index];
+}
+
+static inline float FB_STATS_Bank_GetVariance(const FB_STATS_Bank_t* bank, size_t index) {
+    return (bank->count[index] > 1u) ? bank->m2[index] / (float)(bank->count[index] - 1u) : 0.0f;
+}
+
+static inline float FB_STATS_Bank_GetMin(const FB_STATS_Bank_t* bank, size_t index) {
+    return bank->min[index];
+}
+
+static inline float FB_STATS_Bank_GetMax(const FB_STATS_Bank_t* bank, size_t index) {
+    return bank->max[index];
+}
+
+static inline FB_Status_t FB_STATS_Bank_GetStatus(const FB_STATS_Bank_t* bank, size_t index) {
+    return (FB_Status_t)bank->status[index];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_FB_STATS_H */
@@ -0,0 +1,143 @@
+/**
+ * @file half.h
+ * @brief IEEE 754 binary16（半精度）存储格式转换
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 半精度仅用作存储格式，所有运算均在 float32 寄存器中完成。
+ * 转换实现按平台选择：
+ * - x86：F16C 指令（VCVTPH2PS / VCVTPS2PH），需以 -mf16c 编译
+ *   （CMake 选项 PLCOPEN_ENABLE_F16C）
+ * - ARM：__fp16 类型，编译为 VCVTB.F32.F16 / FCVT 指令
+ *   （Cortex-M4 FPv4-SP 及 AArch64 均支持）；32 位 ARM 的 GCC 只在 -mfp16-format=ieee
+ *   （定义 __ARM_FP16_FORMAT_IEEE）时启用 __fp16，Cortex-M4 工具链文件已指定，
+ *   未指定时退回软件实现
+ * - 其他平台：可移植的软件实现（就近舍入到偶数）
+ *
+ * binary16 特性：11 位有效精度（相对舍入误差 <= 2^-11 ≈ 4.88e-4），
+ * 最大有限值 65504，最小正规数 2^-14 ≈ 6.10e-5。
+ */
+
+#ifndef PLCOPEN_HALF_H
+#define PLCOPEN_HALF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__F16C__)
+    #include <immintrin.h>
+    #define PLC_HALF_HAVE_F16C 1
+#elif defined(__ARM_FP16_FORMAT_IEEE) || defined(__aarch64__)
+    #define PLC_HALF_HAVE_ARM_FP16 1
+#endif
+
+/** binary16 存储类型（位模式） */
+typedef uint16_t plc_half_t;
+
+/* binary16 最大有限值 */
+#define PLC_HALF_MAX 65504.0f
+
+/* binary16 静默 NaN 位模式 */
+#define PLC_HALF_NAN ((plc_half_t)0x7E00u)
+
+/**
+ * @brief 判断 binary16 位模式是否为 NaN
+ */
+static inline bool plc_half_is_nan(plc_half_t h) {
+    return (h & 0x7FFFu) > 0x7C00u;
+}
+
+/**
+ * @brief binary16 → float32（精确转换）
+ */
+static inline float plc_half_to_float(plc_half_t h) {
+#if defined(PLC_HALF_HAVE_F16C)
+    return _cvtsh_ss(h);
+#elif defined(PLC_HALF_HAVE_ARM_FP16)
+    __fp16 v;
+    memcpy(&v, &h, sizeof(v));
+    return (float)v;
+#else
+    uint32_t sign = ((uint32_t)h & 0x8000u) << 16;
+    uint32_t exponent = ((uint32_t)h >> 10) & 0x1Fu;
+    uint32_t mantissa = (uint32_t)h & 0x3FFu;
+    uint32_t bits;
+
+    if (exponent == 0u) {
+        /* 零或非正规数：value = m * 2^-24 */
+        float value = (float)mantissa * 5.9604644775390625e-8f;
+        return sign ? -value : value;
+    } else if (exponent == 31u) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+#endif
+}
+
+/**
+ * @brief float32 → binary16（就近舍入到偶数，超出范围得到 Inf）
+ */
+static inline plc_half_t plc_float_to_half(float value) {
+#if defined(PLC_HALF_HAVE_F16C)
+    return (plc_half_t)_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT);
+#elif defined(PLC_HALF_HAVE_ARM_FP16)
+    __fp16 v = (__fp16)value;
+    plc_half_t h;
+    memcpy(&h, &v, sizeof(h));
+    return h;
+#else
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t abs_bits = bits & 0x7FFFFFFFu;
+
+    if (abs_bits >= 0x7F800000u) {
+        /* Inf 或 NaN */
+        return (plc_half_t)(sign | (abs_bits > 0x7F800000u ? 0x7E00u : 0x7C00u));
+    }
+    if (abs_bits >= 0x477FF000u) {
+        /* >= 65520 舍入后溢出为 Inf */
+        return (plc_half_t)(sign | 0x7C00u);
+    }
+    if (abs_bits < 0x38800000u) {
+        /* 结果为非正规数或零 */
+        if (abs_bits <= 0x33000000u) {
+            return (plc_half_t)sign;
+        }
+        uint32_t exponent = abs_bits >> 23;
+        uint32_t mantissa = (abs_bits & 0x7FFFFFu) | 0x800000u;
+        uint32_t shift = 126u - exponent;
+        uint32_t h = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (h & 1u))) {
+            h++;
+        }
+        return (plc_half_t)(sign | h);
+    }
+
+    /* 正规数：指数偏置 127 → 15，尾数截为 10 位后舍入（进位可传入指数） */
+    uint32_t h = (abs_bits - 0x38000000u) >> 13;
+    uint32_t remainder = abs_bits & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (h & 1u))) {
+        h++;
+    }
+    return (plc_half_t)(sign | h);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_HALF_H */
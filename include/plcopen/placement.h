@@ -0,0 +1,74 @@
+/**
+ * @file placement.h
+ * @brief 功能块状态与只读数据的链接段放置宏
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * STM32F4 等 Cortex-M4 器件除主 SRAM 外还有 64 KB CCM（Core Coupled Memory）：
+ * 只连接 CPU 的 D 总线，零等待，不与 DMA 争用 SRAM 总线矩阵。
+ * 功能块实例与 bank 数组每个扫描周期都被读写，放入 CCM 后执行时间不再随
+ * ADC/通信 DMA 流量抖动；组态参数、查表与系数只读，声明为 const 并放入 Flash，
+ * 不再由启动代码复制到 RAM（.data 既占 Flash 又占 RAM）。
+ *
+ * - PLCOPEN_FB_STATE：热状态，进入 .bss.plcopen_state（只能零初始化）
+ * - PLCOPEN_FB_CONST：只读配置/表/系数，进入 .rodata.plcopen_const（对象必须为 const）
+ *
+ * 段名沿用 .bss. / .rodata. 前缀：链接脚本包含 templates/linker/plcopen_sections.ld
+ * 时两段分别输出到 CCM 与 Flash（并导出 __plcopen_state_start__ / __plcopen_state_end__
+ * 供启动代码清零）；未包含时被通用规则 *(.bss*) / *(.rodata*) 收纳，行为与普通声明相同。
+ * 因此同一份源码可以不加修改地在主机与目标上构建。
+ *
+ * @code
+ * PLCOPEN_FB_CONST static const FB_PID_Config_t loop_config = { ... };
+ * PLCOPEN_FB_STATE static FB_PID_t loop;
+ *
+ * FB_PID_Init(&loop, &loop_config);
+ * @endcode
+ *
+ * @note CCM 不可被 DMA 访问：DMA 直接读写的缓冲区（ADC 采样、过程映像、通信帧）
+ *       不要使用 PLCOPEN_FB_STATE。
+ * @note 非 ELF 目标或非 GCC 兼容编译器上宏展开为空；定义 PLCOPEN_NO_PLACEMENT 可强制关闭。
+ */
+
+#ifndef PLCOPEN_PLACEMENT_H
+#define PLCOPEN_PLACEMENT_H
+
+/**
+ * @brief 热状态段名（可在编译时覆盖，如 Cortex-M7 放入 DTCM 时改用对应片段中的段名）
+ */
+#ifndef PLCOPEN_STATE_SECTION
+#define PLCOPEN_STATE_SECTION ".bss.plcopen_state"
+#endif
+
+/**
+ * @brief 只读数据段名（可在编译时覆盖）
+ */
+#ifndef PLCOPEN_CONST_SECTION
+#define PLCOPEN_CONST_SECTION ".rodata.plcopen_const"
+#endif
+
+/**
+ * @brief 把对象放入指定链接段
+ */
+#if !defined(PLCOPEN_NO_PLACEMENT) && defined(__GNUC__) && defined(__ELF__)
+    #define PLCOPEN_SECTION(name) __attribute__((section(name)))
+#else
+    #define PLCOPEN_SECTION(name)
+#endif
+
+/**
+ * @brief 功能块热状态（实例、bank 数组）
+ *
+ * 只能用于零初始化的静态存储期对象，非零初始值会被编译器拒绝；
+ * 实例由 FB_xxx_Init 在运行时初始化。
+ */
+#define PLCOPEN_FB_STATE PLCOPEN_SECTION(PLCOPEN_STATE_SECTION)
+
+/**
+ * @brief 功能块只读数据（配置、查表、系数）
+ *
+ * 对象必须声明为 const：可写对象放入 Flash 段后写操作会触发总线错误。
+ */
+#define PLCOPEN_FB_CONST PLCOPEN_SECTION(PLCOPEN_CONST_SECTION)
+
+#endif /* PLCOPEN_PLACEMENT_H */
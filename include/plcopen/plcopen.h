@@ -12,10 +12,35 @@
  * - FB_PID: PID 控制器（比例-积分-微分控制）
  * - FB_PT1: 一阶惯性滤波器（信号平滑）
  * - FB_RAMP: 斜坡发生器（平滑设定值变化）
+ * - FB_SCURVE: S 曲线设定值发生器（速度/加速度/加加速度限制）
  * - FB_LIMIT: 限幅器（输出信号限制）
  * - FB_DEADBAND: 死区处理（消除微小波动）
  * - FB_INTEGRATOR: 积分器（累计量计算）
  * - FB_DERIVATIVE: 微分器（变化率计算）
+ * - FB_SGDERIV: 滑动窗口最小二乘微分器（低噪声变化率计算）
+ * - FB_STATS: 流式统计（累计均值/方差、滑动窗口最小/最大值）
+ * - FB_KALMAN: 离散卡尔曼滤波（状态估计，可选稳态增益）
+ * - FB_RLS: 递推最小二乘在线辨识（ARX/FOPDT 模型，UD 分解协方差）
+ *
+ * 批量实例扩展：
+ * - FB_PT1_Bank16 / FB_DERIVATIVE_Bank16: 半精度存储的大规模实例 bank
+ * - FB_PID_Bank32 / FB_PT1_Bank32 / FB_DERIVATIVE_Bank32 / FB_LIMIT_Bank32: float32 bank（AArch64 NEON）
+ * - FB_PT1_BankQ15 / FB_LIMIT_BankQ15 / FB_DEADBAND_BankQ15: Q15 定点 bank（Cortex-M4 DSP 扩展）
+ * - FB_xxx_Compact: 冷热分离的紧凑实例（单字节标志，预计算系数）
+ * - FB_PT1_Shared / FB_LIMIT_Shared: 引用共享配置的享元实例
+ * - FB_STATS_Bank: 成千上万个信号的流式统计
+ *
+ * 实例存储与并发：
+ * - plcopen_arena: 缓存行对齐、按任务分组的静态实例存储区
+ * - PLCOPEN_FB_STATE / PLCOPEN_FB_CONST: 热状态放入 CCM、只读配置放入 Flash 的链接段放置宏
+ * - plcopen_config_mailbox: 无锁在线参数更新（FB_xxx_StageConfig / FB_xxx_AdoptConfig）
+ * - plcopen_cmdq: 每任务无等待 SPSC 命令队列（手动/自动切换、设定值写入、积分复位）
+ * - plcopen_pi: 三缓冲共享内存过程映像，I/O/控制/HMI 进程间无等待交换（仅 Linux）
+ *
+ * 诊断：
+ * - plcopen_prof: 按实例的 Execute 剖析计数器与前 N 名排行（PLCOPEN_ENABLE_PROFILING）
+ * - plcopen_trace: 每核无锁二进制追踪环（飞行记录仪），NaN/Inf 触发后台转储（转储线程仅 Linux）
+ * - USDT 静态探针：Execute 入口/出口、Init、SetManual/SetAuto（PLCOPEN_ENABLE_USDT，见 probes.h）
  *
  * 使用示例：
  * @code
@@ -37,7 +62,9 @@
  * float output = FB_PID_Execute(&my_pid, 50.0f, 45.0f);
  * @endcode
  *
- * @note 所有功能块都是线程不安全的，需要用户自行保证线程同步
+ * @note 所有功能块都是线程不安全的，需要用户自行保证线程同步；
+ *       其他线程修改配置时应通过配置信箱（config_mailbox.h），不要直接写 fb->config；
+ *       手动/自动切换、设定值写入等操作应通过命令队列（command_queue.h）投递
  * @note 所有功能块均不使用动态内存分配，适合实时系统
  */
 
@@ -55,10 +82,38 @@ extern "C" {
 #include "plcopen/fb_pid.h"
 #include "plcopen/fb_pt1.h"
 #include "plcopen/fb_ramp.h"
+#include "plcopen/fb_scurve.h"
 #include "plcopen/fb_limit.h"
 #include "plcopen/fb_deadband.h"
 #include "plcopen/fb_integrator.h"
 #include "plcopen/fb_derivative.h"
+#include "plcopen/fb_sgderiv.h"
+#include "plcopen/fb_stats.h"
+#include "plcopen/fb_kalman.h"
+#include "plcopen/fb_rls.h"
+
+/* 批量实例扩展 */
+#include "plcopen/fb_bank_f16.h"
+#include "plcopen/fb_bank_f32.h"
+#include "plcopen/fb_bank_q15.h"
+#include "plcopen/fb_compact.h"
+#include "plcopen/fb_shared.h"
+
+/* 实例存储与并发 */
+#include "plcopen/arena.h"
+#include "plcopen/placement.h"
+#include "plcopen/config_mailbox.h"
+#include "plcopen/command_queue.h"
+#ifdef __linux__
+#include "plcopen/process_image.h"
+#endif
+
+/* 诊断 */
+#include "plcopen/profile.h"
+#include "plcopen/trace.h"
+#ifdef __linux__
+#include "plcopen/trace_drainer.h"
+#endif
 
 /* 版本信息 */
 #define PLCOPEN_VERSION_MAJOR 1
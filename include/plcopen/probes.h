@@ -0,0 +1,71 @@
+/**
+ * @file probes.h
+ * @brief USDT（SystemTap SDT）静态探针：供 perf / bpftrace 在线分析扫描行为
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 以 -DPLCOPEN_ENABLE_USDT 构建（CMake 选项 PLCOPEN_ENABLE_USDT=ON，需要
+ * <sys/sdt.h>，Debian/Ubuntu 为 systemtap-sdt-dev 包）时，库在下列位置放置
+ * 提供者为 "plcopen" 的探针：
+ *
+ * | 探针 | 参数 |
+ * |------|------|
+ * | <fb>_entry | arg0=实例指针，arg1/arg2=输入（float 位模式，单输入功能块 arg2=0） |
+ * | <fb>_exit  | arg0=实例指针，arg1=输出（float 位模式），arg2=执行后状态（FB_Status_t） |
+ * | <fb>_init  | arg0=实例指针，arg1=配置指针（仅成功路径） |
+ * | pid_set_manual | arg0=实例指针，arg1=限幅后的手动输出（float 位模式） |
+ * | pid_set_auto   | arg0=实例指针 |
+ *
+ * <fb> 为 pid、pt1、ramp、scurve、limit、deadband、integrator、derivative、sgderiv、stats、kalman、rls。
+ * kalman 的 entry arg1/arg2 为首个测量与首个输入（无测量/无输入时为 0），exit 的 arg1 为第一个状态估计。
+ * rls 的 entry arg1/arg2 为过程输入与过程输出，exit 的 arg1 为先验预测误差。
+ * 块处理接口 FB_xxx_ExecuteBlock 每块触发一次 entry/exit：entry 的 arg1 为首个输入，
+ * exit 的 arg1 为最后一个输出（空块为 0）。
+ * float 以 32 位位模式传出，因为 bpftrace 没有浮点类型；需要数值时在用户态解码。
+ *
+ * 探针在未被附着时只是一条 NOP 指令，参数在寄存器中原样可见，不增加分支或内存访问；
+ * 附着后由内核把 NOP 换成断点。实例布局不变，库与应用无需以相同开关编译。
+ * 未定义 PLCOPEN_ENABLE_USDT 时所有宏为空。
+ *
+ * 示例 bpftrace 脚本见 scripts/trace 目录。
+ */
+
+#ifndef PLCOPEN_PROBES_H
+#define PLCOPEN_PROBES_H
+
+#ifdef PLCOPEN_ENABLE_USDT
+
+#include <stdint.h>
+#include <string.h>
+#include <sys/sdt.h>
+
+/** float 的 32 位位模式 */
+static inline uint32_t plcopen_probe_bits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+#define PLCOPEN_PROBE_ENTRY(fb_type, fb, in1, in2)                                  \
+    STAP_PROBE3(plcopen, fb_type##_entry, (fb), plcopen_probe_bits(in1),           \
+                plcopen_probe_bits(in2))
+#define PLCOPEN_PROBE_EXIT(fb_type, fb, out, status)                                \
+    STAP_PROBE3(plcopen, fb_type##_exit, (fb), plcopen_probe_bits(out), (int)(status))
+#define PLCOPEN_PROBE_INIT(fb_type, fb, config)                                     \
+    STAP_PROBE2(plcopen, fb_type##_init, (fb), (config))
+#define PLCOPEN_PROBE_SET_MANUAL(fb_type, fb, value)                                \
+    STAP_PROBE2(plcopen, fb_type##_set_manual, (fb), plcopen_probe_bits(value))
+#define PLCOPEN_PROBE_SET_AUTO(fb_type, fb)                                         \
+    STAP_PROBE1(plcopen, fb_type##_set_auto, (fb))
+
+#else /* !PLCOPEN_ENABLE_USDT */
+
+#define PLCOPEN_PROBE_ENTRY(fb_type, fb, in1, in2)   ((void)0)
+#define PLCOPEN_PROBE_EXIT(fb_type, fb, out, status) ((void)0)
+#define PLCOPEN_PROBE_INIT(fb_type, fb, config)      ((void)0)
+#define PLCOPEN_PROBE_SET_MANUAL(fb_type, fb, value) ((void)0)
+#define PLCOPEN_PROBE_SET_AUTO(fb_type, fb)          ((void)0)
+
+#endif /* PLCOPEN_ENABLE_USDT */
+
+#endif /* PLCOPEN_PROBES_H */
@@ -0,0 +1,158 @@
+/**
+ * @file process_image.h
+ * @brief 三缓冲共享内存过程映像（I/O、控制、HMI 进程间交换）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * I/O 线程直接写功能块输入所用的共享变量时，控制任务在一次扫描中
+ * 可能读到不同时刻的输入。过程映像把数据交换组织为若干"通道"：
+ *
+ * - 每个通道是一张 float 表，在共享内存（shm_open / mmap）中有 3 份缓冲区
+ * - 每个通道恰好一个生产者、一个消费者（如 I/O→控制的输入表、
+ *   控制→I/O 的输出表、控制→HMI 的监视表；HMI 需要单独的通道）
+ * - 生产者在后台缓冲区中就地写整张表，plcopen_pi_publish 以一次原子交换发布；
+ *   消费者 plcopen_pi_acquire 以一次原子加载（有新数据时再加一次交换）
+ *   取得最新的完整快照。两端都是无等待的（wait-free），不加锁、不复制
+ * - 每个缓冲区附带扫描计数和发布时间戳，消费者可据此判断数据新旧
+ *
+ * @code
+ * // 控制进程（创建者）
+ * const uint32_t sizes[] = { 256, 128 };  // 通道 0：输入；通道 1：输出
+ * plcopen_pi_t pi;
+ * plcopen_pi_create(&pi, "/plc_image", sizes, 2, 0);
+ *
+ * // 每个扫描周期
+ * uint64_t in_scan;
+ * const float* in = plcopen_pi_acquire(&pi, 0, &in_scan);   // 一致的输入快照
+ * float* out = plcopen_pi_write_begin(&pi, 1);
+ * out[0] = FB_PID_Execute(&pid, sp, in[0]);
+ * plcopen_pi_publish(&pi, 1, scan);
+ *
+ * // I/O 进程
+ * plcopen_pi_open(&pi, "/plc_image");
+ * @endcode
+ *
+ * @note 后台缓冲区的内容是两次发布之前的旧数据，生产者每次都应写整张表。
+ * @note 各通道生产者、消费者持有的缓冲区索引记录在共享区中，进程重启后以
+ *       plcopen_pi_open 重新连接即接续原来的角色，不会与对端持有同一个缓冲区。
+ * @note 仅在 Linux 主机（软 PLC）上编译。
+ */
+
+#ifndef PLCOPEN_PROCESS_IMAGE_H
+#define PLCOPEN_PROCESS_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+
+/** 最大通道数 */
+#define PLCOPEN_PI_MAX_CHANNELS 16
+
+/** 共享内存名最大长度（含结尾 '\0'） */
+#define PLCOPEN_PI_NAME_MAX 64
+
+/** plcopen_pi_create 标志：同名共享内存已存在时先删除再创建 */
+#define PLCOPEN_PI_FORCE 0x1u
+
+struct plcopen_pi_shared;
+
+/**
+ * @brief 过程映像句柄（进程本地）
+ *
+ * 同一块共享内存在不同进程中映射到不同地址，句柄只保存本进程的映射。
+ * 每个通道的生产者/消费者缓冲区索引以共享区中的记录为准，句柄中是本地副本
+ * （连接时读回）。一个通道同一时刻只能有一个生产者句柄和一个消费者句柄。
+ */
+typedef struct {
+    struct plcopen_pi_shared* shared;                /**< 共享内存映射 */
+    size_t map_size;                                 /**< 映射字节数 */
+    uint8_t write_index[PLCOPEN_PI_MAX_CHANNELS];    /**< 生产者持有的后台缓冲区（共享区记录的副本） */
+    uint8_t read_index[PLCOPEN_PI_MAX_CHANNELS];     /**< 消费者持有的前台缓冲区（共享区记录的副本） */
+    char name[PLCOPEN_PI_NAME_MAX];                  /**< 共享内存名 */
+} plcopen_pi_t;
+
+/**
+ * @brief 创建过程映像
+ *
+ * 同名共享内存已存在（其他进程可能正在使用）时默认失败，errno 为 EEXIST；
+ * 确认旧映像已无人使用（如系统启动时清理上次残留）时传 PLCOPEN_PI_FORCE
+ * 先删除再创建。已映射旧映像的进程不受影响，但与新映像不再相通。
+ *
+ * @param pi 句柄
+ * @param name 共享内存名（以 '/' 开头，如 "/plc_image"）
+ * @param channel_sizes 各通道的 float 个数（> 0）
+ * @param channel_count 通道数（1..PLCOPEN_PI_MAX_CHANNELS）
+ * @param flags 0 或 PLCOPEN_PI_FORCE
+ * @return int 0=成功，-1=失败（errno 指示原因）
+ */
+int plcopen_pi_create(plcopen_pi_t* pi, const char* name,
+                      const uint32_t* channel_sizes, uint32_t channel_count, uint32_t flags);
+
+/**
+ * @brief 连接到已创建的过程映像
+ *
+ * 从共享区读回各通道生产者、消费者当前持有的缓冲区索引，
+ * 因此重启的进程可以接续原来的角色，对端无需重新连接。
+ *
+ * @return int 0=成功，-1=不存在或格式不匹配
+ */
+int plcopen_pi_open(plcopen_pi_t* pi, const char* name);
+
+/**
+ * @brief 解除本进程的映射（不删除共享内存）
+ */
+void plcopen_pi_close(plcopen_pi_t* pi);
+
+/**
+ * @brief 删除共享内存名（已映射的进程不受影响）
+ */
+int plcopen_pi_unlink(const char* name);
+
+/**
+ * @brief 通道的 float 个数（通道号无效时返回 0）
+ */
+uint32_t plcopen_pi_channel_size(const plcopen_pi_t* pi, uint32_t channel);
+
+/**
+ * @brief 生产者：取得后台缓冲区，就地写入整张表
+ *
+ * @return float* 后台缓冲区；通道号无效时返回 NULL
+ */
+float* plcopen_pi_write_begin(plcopen_pi_t* pi, uint32_t channel);
+
+/**
+ * @brief 生产者：发布后台缓冲区（一次原子交换，无等待）
+ *
+ * @param pi 句柄
+ * @param channel 通道号
+ * @param scan 扫描计数（消费者可读回）
+ */
+void plcopen_pi_publish(plcopen_pi_t* pi, uint32_t channel, uint64_t scan);
+
+/**
+ * @brief 消费者：取得最新的完整快照（无等待）
+ *
+ * 没有新发布时返回上次取得的快照。返回的缓冲区在下次 acquire 之前
+ * 不会被生产者改写。
+ *
+ * @param pi 句柄
+ * @param channel 通道号
+ * @param scan 输出：快照的扫描计数（可为 NULL；从未发布过时为 0）
+ * @return const float* 前台缓冲区；通道号无效时返回 NULL
+ */
+const float* plcopen_pi_acquire(plcopen_pi_t* pi, uint32_t channel, uint64_t* scan);
+
+/**
+ * @brief 消费者：读取当前快照的发布时间（CLOCK_MONOTONIC，纳秒）
+ */
+uint64_t plcopen_pi_timestamp(const plcopen_pi_t* pi, uint32_t channel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_PROCESS_IMAGE_H */
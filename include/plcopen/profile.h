@@ -0,0 +1,222 @@
+/**
+ * @file profile.h
+ * @brief 按实例的执行剖析计数器（编译期开关，关闭时零开销）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 扫描周期超时时，需要知道是哪个功能块实例耗时最多。以
+ * -DPLCOPEN_ENABLE_PROFILING 构建（CMake 选项 PLCOPEN_ENABLE_PROFILING=ON）时：
+ *
+ * - PID、PT1、RAMP、LIMIT、DEADBAND、INTEGRATOR、DERIVATIVE 实例末尾
+ *   追加一个 plcopen_prof_t，Init 时登记到全局剖析表
+ * - 每次 Execute 记录调用次数、累计周期数、最大周期数和 log2 周期直方图
+ * - 周期计数来源：Cortex-M3/M4/M7 为 DWT->CYCCNT；x86 为 TSC；
+ *   AArch64 为 CNTVCT_EL0（通用定时器计数）；其他 POSIX 主机为 clock_gettime 纳秒
+ * - plcopen_prof_top / plcopen_prof_dump_top 按累计周期数列出开销最大的 N 个实例
+ *
+ * 未定义 PLCOPEN_ENABLE_PROFILING 时，实例中没有剖析字段，Execute 中没有任何
+ * 剖析代码，结构体尺寸与生成的指令与未引入本模块时完全相同；查询接口仍可调用，
+ * 返回 0 个实例，应用代码无需条件编译。
+ *
+ * @code
+ * plcopen_prof_init();                     // 启动时一次（Cortex-M 上使能 DWT）
+ * FB_PID_Init(&tic101, &cfg);
+ * PLCOPEN_PROF_NAME(&tic101, "TIC-101");   // 可选：实例标签
+ *
+ * // 扫描超时时
+ * plcopen_prof_dump_top(5, my_log_line, NULL);
+ * @endcode
+ *
+ * @note 宏开关会改变实例结构体的布局，库与应用必须以相同的定义编译。
+ * @note 登记表保存实例地址，剖析的实例应为静态存储期；栈上实例销毁前
+ *       需调用 PLCOPEN_PROF_UNREGISTER。
+ * @note Init（登记）不是线程安全的，应在启动阶段完成；计数器由执行该实例的
+ *       任务独占更新。
+ */
+
+#ifndef PLCOPEN_PROFILE_H
+#define PLCOPEN_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/common.h"
+
+/** log2 直方图桶数：桶 b 统计周期数落在 [2^b, 2^(b+1)) 的调用（桶 0 含 0 和 1） */
+#define PLCOPEN_PROF_HIST_BINS 32
+
+/** 剖析表最多登记的实例数，可在编译时覆盖 */
+#ifndef PLCOPEN_PROF_MAX_INSTANCES
+#define PLCOPEN_PROF_MAX_INSTANCES 256
+#endif
+
+/** plcopen_prof_dump_top 单次最多输出的实例数 */
+#define PLCOPEN_PROF_DUMP_MAX 32
+
+/**
+ * @brief 单个实例的剖析计数器
+ */
+typedef struct {
+    const char* type;                        /**< 功能块类型（"FB_PID" 等） */
+    const char* name;                        /**< 实例标签（可为 NULL） */
+    uint32_t calls;                          /**< Execute 调用次数 */
+    uint32_t max_cycles;                     /**< 单次最大周期数 */
+    uint64_t total_cycles;                   /**< 累计周期数 */
+    uint32_t hist[PLCOPEN_PROF_HIST_BINS];   /**< log2 周期直方图 */
+} plcopen_prof_t;
+
+/**
+ * @brief 排行依据
+ */
+typedef enum {
+    PLCOPEN_PROF_BY_TOTAL = 0,   /**< 累计周期数 */
+    PLCOPEN_PROF_BY_MAX          /**< 单次最大周期数 */
+} plcopen_prof_key_t;
+
+/**
+ * @brief 输出回调：每次传入一行不含换行符的 CSV 文本
+ */
+typedef void (*plcopen_prof_sink_t)(const char* line, void* ctx);
+
+/**
+ * @brief 初始化周期计数器（Cortex-M 上使能 DWT->CYCCNT，其他平台无操作）
+ */
+void plcopen_prof_init(void);
+
+/**
+ * @brief 已登记的实例数（未启用剖析时为 0）
+ */
+size_t plcopen_prof_count(void);
+
+/**
+ * @brief 登记表已满而未能登记的次数（未启用剖析时为 0）
+ *
+ * 超过 PLCOPEN_PROF_MAX_INSTANCES 的实例照常执行，但不出现在排行与输出中；
+ * 非零时应增大 PLCOPEN_PROF_MAX_INSTANCES。
+ */
+size_t plcopen_prof_dropped(void);
+
+/**
+ * @brief 清零所有已登记实例的计数器（保留登记）
+ */
+void plcopen_prof_reset(void);
+
+/**
+ * @brief 按 key 降序取得开销最大的 n 个实例
+ *
+ * @param out 输出数组（容量 >= n）
+ * @param n 最多取得的实例数
+ * @param key 排行依据
+ * @return size_t 实际取得的实例数
+ */
+size_t plcopen_prof_top(const plcopen_prof_t** out, size_t n, plcopen_prof_key_t key);
+
+/**
+ * @brief 以 CSV 行输出累计周期数最大的 n 个实例（n 最多 PLCOPEN_PROF_DUMP_MAX）
+ *
+ * 第一行为表头：rank,type,name,calls,total_cycles,avg_cycles,max_cycles,p99_cycles_le
+ * p99_cycles_le 为直方图估计的 99% 分位上界（2 的幂）。
+ * 有实例因登记表已满未能登记时，最后追加一行 "# dropped,<次数>"，提示排行不完整。
+ *
+ * @return size_t 输出的实例数
+ */
+size_t plcopen_prof_dump_top(size_t n, plcopen_prof_sink_t sink, void* ctx);
+
+/**
+ * @brief 由直方图估计分位数上界（周期数，2 的幂）
+ *
+ * @param prof 计数器
+ * @param quantile 分位（0..1）
+ */
+uint64_t plcopen_prof_quantile_le(const plcopen_prof_t* prof, float quantile);
+
+#ifdef PLCOPEN_ENABLE_PROFILING
+
+/* ========== 周期计数器 ========== */
+
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+    #define PLCOPEN_PROF_DWT_CYCCNT (*(volatile uint32_t*)0xE0001004u)
+    static inline uint32_t plcopen_prof_now(void) {
+        return PLCOPEN_PROF_DWT_CYCCNT;
+    }
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    static inline uint32_t plcopen_prof_now(void) {
+        return (uint32_t)__rdtsc();
+    }
+#elif defined(__aarch64__)
+    static inline uint32_t plcopen_prof_now(void) {
+        uint64_t value;
+        __asm__ volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return (uint32_t)value;
+    }
+#else
+    uint32_t plcopen_prof_clock_ns(void);
+    static inline uint32_t plcopen_prof_now(void) {
+        return plcopen_prof_clock_ns();
+    }
+#endif
+
+/**
+ * @brief 登记实例（Init 中调用；同一计数器重复登记时只清零）
+ */
+void plcopen_prof_register(plcopen_prof_t* prof, const char* type);
+
+/**
+ * @brief 注销实例
+ */
+void plcopen_prof_unregister(plcopen_prof_t* prof);
+
+/**
+ * @brief 记录一次执行（32 位差值，单次执行超过 2^32 个周期时回绕）
+ */
+static inline void plcopen_prof_record(plcopen_prof_t* prof, uint32_t start) {
+    uint32_t cycles = plcopen_prof_now() - start;
+    prof->calls++;
+    prof->total_cycles += cycles;
+    if (cycles > prof->max_cycles) {
+        prof->max_cycles = cycles;
+    }
+#if defined(__GNUC__)
+    unsigned bin = cycles > 1u ? 31u - (unsigned)__builtin_clz(cycles) : 0u;
+#else
+    unsigned bin = 0u;
+    for (uint32_t c = cycles; c > 1u; c >>= 1) {
+        bin++;
+    }
+#endif
+    prof->hist[bin]++;
+}
+
+/** 实例结构体末尾的剖析字段 */
+#define PLCOPEN_PROF_FIELD plcopen_prof_t prof;
+
+/** 尺寸预算的附加量（含对齐填充） */
+#define PLCOPEN_PROF_BUDGET (sizeof(plcopen_prof_t) + PLC_ALIGNOF(plcopen_prof_t))
+
+#define PLCOPEN_PROF_REGISTER(fb, type) plcopen_prof_register(&(fb)->prof, (type))
+#define PLCOPEN_PROF_UNREGISTER(fb)     plcopen_prof_unregister(&(fb)->prof)
+#define PLCOPEN_PROF_NAME(fb, label)    ((fb)->prof.name = (label))
+#define PLCOPEN_PROF_BEGIN()            uint32_t plcopen_prof_start_ = plcopen_prof_now()
+#define PLCOPEN_PROF_END(fb)            plcopen_prof_record(&(fb)->prof, plcopen_prof_start_)
+
+#else /* !PLCOPEN_ENABLE_PROFILING */
+
+#define PLCOPEN_PROF_FIELD
+#define PLCOPEN_PROF_BUDGET 0u
+#define PLCOPEN_PROF_REGISTER(fb, type) ((void)0)
+#define PLCOPEN_PROF_UNREGISTER(fb)     ((void)0)
+#define PLCOPEN_PROF_NAME(fb, label)    ((void)0)
+#define PLCOPEN_PROF_BEGIN()            ((void)0)
+#define PLCOPEN_PROF_END(fb)            ((void)0)
+
+#endif /* PLCOPEN_ENABLE_PROFILING */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_PROFILE_H */
@@ -0,0 +1,241 @@
+/**
+ * @file trace.h
+ * @brief 无锁二进制追踪环（飞行记录仪）：每次扫描记录 SP/PV/OUT/状态
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 诊断回路跳闸需要故障前若干秒内每个回路的设定值、测量值、输出和状态。
+ * 追踪环按核（或按周期任务线程）各建一个，只有一个写者：
+ *
+ * - 扫描执行器在 Execute 之后调用 plcopen_trace_pid / plcopen_trace_fb 追加
+ *   一条 20 字节的紧凑记录：5 次 32 位存储 + 1 次索引发布，没有分支等待
+ * - 环写满后覆盖最旧的记录，快照始终可取得最近 capacity - 1 条
+ * - 记录的状态属于触发集合（默认 FB_STATUS_ERROR_NAN / ERROR_INF）时，
+ *   写者在环上置触发标志；后台转储线程（trace_drainer.h，仅 Linux）
+ *   发现触发后把所有环的快照写入文件
+ * - 读者（转储线程）从不阻塞写者：复制后复核写索引，丢弃复制期间被覆盖的记录
+ *
+ * 每个扫描周期开始时调用 plcopen_trace_begin_scan 写入一条扫描标记，
+ * 其中带 64 位时间戳；其余记录只带 32 位扫描序号。
+ *
+ * @code
+ * PLCOPEN_TRACE_STORAGE(core0_storage, 65536);     // 65536 条 ≈ 1.3 MB
+ * static plcopen_trace_ring_t core0;
+ * plcopen_trace_init(&core0, 0, core0_storage, 65536);
+ *
+ * // 每个扫描周期
+ * plcopen_trace_begin_scan(&core0, now_ns());
+ * out = FB_PID_Execute(&tic101, sp, pv);
+ * plcopen_trace_pid(&core0, TIC101_ID, &tic101, sp, pv, out);
+ * @endcode
+ *
+ * 转储文件格式（主机字节序）：
+ *
+ *   文件头  : magic "PLCT"(u32 0x54434C50) | version(u16) | record_size(u16) | ring_count(u32)
+ *   每个环  : ring_id(u32) | record_count(u32) | first_index(u32) | trigger_index(u32)
+ *             record_count 条 plcopen_trace_record_t（按写入顺序，最旧在前）
+ */
+
+#ifndef PLCOPEN_TRACE_H
+#define PLCOPEN_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "plcopen/common.h"
+#include "plcopen/arena.h"
+#include "plcopen/fb_pid.h"
+
+/** 每条记录的 32 位字数 */
+#define PLCOPEN_TRACE_WORDS 5
+
+/** 无触发时的 trigger_index */
+#define PLCOPEN_TRACE_NO_TRIGGER 0xFFFFFFFFu
+
+/**
+ * @brief 记录类型
+ */
+typedef enum {
+    PLCOPEN_TRACE_SCAN = 0,      /**< 扫描标记：a/b 为 64 位时间戳低/高 32 位 */
+    PLCOPEN_TRACE_PID,           /**< a=SP，b=PV，out=OUT */
+    PLCOPEN_TRACE_PT1,
+    PLCOPEN_TRACE_RAMP,
+    PLCOPEN_TRACE_LIMIT,
+    PLCOPEN_TRACE_DEADBAND,
+    PLCOPEN_TRACE_INTEGRATOR,
+    PLCOPEN_TRACE_DERIVATIVE,    /**< 单输入功能块：a=输入，b=0 */
+    PLCOPEN_TRACE_USER = 16      /**< 应用自定义类型起点 */
+} plcopen_trace_type_t;
+
+/**
+ * @brief 追踪记录（20 字节）
+ */
+typedef struct {
+    uint32_t scan;      /**< 扫描序号 */
+    uint16_t id;        /**< 实例编号（应用分配） */
+    uint8_t type;       /**< plcopen_trace_type_t */
+    int8_t status;      /**< FB_Status_t */
+    float a;            /**< 输入 1（PID 为 SP） */
+    float b;            /**< 输入 2（PID 为 PV） */
+    float out;          /**< 输出 */
+} plcopen_trace_record_t;
+
+PLC_STATIC_ASSERT(sizeof(plcopen_trace_record_t) == PLCOPEN_TRACE_WORDS * sizeof(uint32_t),
+                  "plcopen_trace_record_t must be 20 bytes");
+
+/**
+ * @brief 环中的一个槽位（32 位原子字，读者并发复制时无数据竞争）
+ */
+typedef struct {
+    atomic_uint_least32_t w[PLCOPEN_TRACE_WORDS];
+} plcopen_trace_slot_t;
+
+/**
+ * @brief 追踪环
+ *
+ * head 为已写入的记录总数（32 位回绕），只由写者修改；
+ * trigger 为最近一次触发记录的序号 + 1（0 表示无），由写者置位、读者清除。
+ */
+typedef struct {
+    PLC_ALIGNAS(PLCOPEN_CACHE_LINE) atomic_uint_least32_t head;
+    atomic_uint_least32_t trigger;
+    uint32_t scan;                   /**< 当前扫描序号（写者本地） */
+    uint32_t mask;                   /**< capacity - 1 */
+    uint32_t trigger_mask;           /**< 触发集合：位 (status + 4) */
+    uint32_t ring_id;                /**< 环编号（如核号） */
+    plcopen_trace_slot_t* slots;     /**< 记录存储 */
+} plcopen_trace_ring_t;
+
+/**
+ * @brief 定义静态记录存储（缓存行对齐）
+ *
+ * @param name 存储数组名
+ * @param records 记录条数（2 的幂）
+ */
+#define PLCOPEN_TRACE_STORAGE(name, records) \
+    static PLC_ALIGNAS(PLCOPEN_CACHE_LINE) plcopen_trace_slot_t name[(records)]
+
+/** 触发集合中的一个状态 */
+#define PLCOPEN_TRACE_TRIGGER_ON(status) (1u << ((unsigned)((int)(status) + 4)))
+
+/**
+ * @brief 初始化追踪环
+ *
+ * @param ring 追踪环
+ * @param ring_id 环编号（写入转储文件）
+ * @param storage 记录存储
+ * @param capacity 记录条数（2 的幂，2..2^30）
+ * @return int 0=成功，-1=参数无效
+ */
+int plcopen_trace_init(plcopen_trace_ring_t* ring, uint32_t ring_id,
+                       plcopen_trace_slot_t* storage, uint32_t capacity);
+
+/**
+ * @brief 设置触发集合（默认 ERROR_NAN 与 ERROR_INF）
+ *
+ * @param mask PLCOPEN_TRACE_TRIGGER_ON(...) 的按位或；0 表示只能手动触发
+ */
+static inline void plcopen_trace_set_trigger_mask(plcopen_trace_ring_t* ring, uint32_t mask) {
+    ring->trigger_mask = mask;
+}
+
+/**
+ * @brief 写者：追加一条记录
+ */
+static inline void plcopen_trace_append(plcopen_trace_ring_t* ring, uint16_t id, uint8_t type,
+                                        FB_Status_t status, float a, float b, float out) {
+    uint32_t index = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    plcopen_trace_slot_t* slot = &ring->slots[index & ring->mask];
+    uint32_t fa, fb, fo;
+    memcpy(&fa, &a, sizeof(fa));
+    memcpy(&fb, &b, sizeof(fb));
+    memcpy(&fo, &out, sizeof(fo));
+
+    /* 读者在复制后复核 head：槽位改写必须排在上一次 head 发布之后 */
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&slot->w[0], ring->scan, memory_order_relaxed);
+    atomic_store_explicit(&slot->w[1],
+                          (uint32_t)id | ((uint32_t)type << 16) | ((uint32_t)(uint8_t)(int8_t)status << 24),
+                          memory_order_relaxed);
+    atomic_store_explicit(&slot->w[2], fa, memory_order_relaxed);
+    atomic_store_explicit(&slot->w[3], fb, memory_order_relaxed);
+    atomic_store_explicit(&slot->w[4], fo, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, index + 1u, memory_order_release);
+
+    if ((ring->trigger_mask >> ((unsigned)((int)status + 4) & 31u)) & 1u) {
+        atomic_store_explicit(&ring->trigger, index + 1u, memory_order_release);
+    }
+}
+
+/**
+ * @brief 写者：扫描周期开始，写入扫描标记
+ *
+ * @param ring 追踪环
+ * @param timestamp_ns 时间戳（任意单调时钟）
+ */
+static inline void plcopen_trace_begin_scan(plcopen_trace_ring_t* ring, uint64_t timestamp_ns) {
+    ring->scan++;
+    uint32_t lo = (uint32_t)timestamp_ns;
+    uint32_t hi = (uint32_t)(timestamp_ns >> 32);
+    float a, b;
+    memcpy(&a, &lo, sizeof(a));
+    memcpy(&b, &hi, sizeof(b));
+    plcopen_trace_append(ring, 0u, PLCOPEN_TRACE_SCAN, FB_STATUS_OK, a, b, 0.0f);
+}
+
+/**
+ * @brief 写者：记录一次 PID 执行
+ */
+static inline void plcopen_trace_pid(plcopen_trace_ring_t* ring, uint16_t id, const FB_PID_t* fb,
+                                     float setpoint, float measurement, float output) {
+    plcopen_trace_append(ring, id, PLCOPEN_TRACE_PID, fb->state.status,
+                         setpoint, measurement, output);
+}
+
+/**
+ * @brief 写者：记录一次单输入功能块执行
+ *
+ * @param type PLCOPEN_TRACE_PT1 等
+ * @param status 功能块执行后的状态（FB_xxx_GetStatus 或 fb->state.status）
+ */
+static inline void plcopen_trace_fb(plcopen_trace_ring_t* ring, uint16_t id, uint8_t type,
+                                    FB_Status_t status, float input, float output) {
+    plcopen_trace_append(ring, id, type, status, input, 0.0f, output);
+}
+
+/**
+ * @brief 手动触发（任意线程）
+ */
+void plcopen_trace_trigger(plcopen_trace_ring_t* ring);
+
+/**
+ * @brief 读者：取走触发标志
+ *
+ * @return uint32_t 触发记录的序号；无触发时返回 PLCOPEN_TRACE_NO_TRIGGER
+ */
+uint32_t plcopen_trace_take_trigger(plcopen_trace_ring_t* ring);
+
+/**
+ * @brief 读者：复制环中最近的记录（不阻塞写者）
+ *
+ * 写者随时可能开始改写最旧的槽位，因此环写满后最多返回 capacity - 1 条。
+ *
+ * @param ring 追踪环
+ * @param out 输出缓冲区（按写入顺序，最旧在前）
+ * @param max 输出缓冲区容量（条）
+ * @param first_index 输出：out[0] 的记录序号（可为 NULL）
+ * @return size_t 复制的有效记录数
+ */
+size_t plcopen_trace_snapshot(plcopen_trace_ring_t* ring, plcopen_trace_record_t* out,
+                              size_t max, uint32_t* first_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_TRACE_H */
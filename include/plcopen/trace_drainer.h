@@ -0,0 +1,110 @@
+/**
+ * @file trace_drainer.h
+ * @brief 追踪环后台转储线程（仅 Linux 主机）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 转储线程周期性轮询各追踪环的触发标志。发现触发后：
+ *
+ * 1. 再等待 post_trigger_ms，使快照同时包含故障之后的记录
+ * 2. 对所有环做快照（不阻塞写者），写入 "<path_prefix>-<序号>.plct"
+ * 3. 在 holdoff_ms 内忽略新的触发，避免持续 NaN 时反复转储
+ *
+ * 文件格式见 trace.h。转储线程只读环，控制任务无需任何配合。
+ *
+ * @code
+ * plcopen_trace_ring_t* rings[] = { &core0, &core1 };
+ * plcopen_trace_drainer_t drainer;
+ * plcopen_trace_drainer_config_t cfg = PLCOPEN_TRACE_DRAINER_DEFAULTS;
+ * plcopen_trace_drainer_start(&drainer, rings, 2, "/var/log/plc/trip", &cfg);
+ * ...
+ * plcopen_trace_drainer_stop(&drainer);
+ * @endcode
+ */
+
+#ifndef PLCOPEN_TRACE_DRAINER_H
+#define PLCOPEN_TRACE_DRAINER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "plcopen/trace.h"
+
+/** 转储线程最多管理的环数 */
+#define PLCOPEN_TRACE_MAX_RINGS 16
+
+/** 文件路径前缀最大长度（含结尾 '\0'） */
+#define PLCOPEN_TRACE_PATH_MAX 200
+
+/**
+ * @brief 转储线程参数
+ */
+typedef struct {
+    uint32_t poll_ms;          /**< 轮询触发标志的间隔 */
+    uint32_t post_trigger_ms;  /**< 触发后延迟多久再快照 */
+    uint32_t holdoff_ms;       /**< 两次转储的最小间隔 */
+} plcopen_trace_drainer_config_t;
+
+/** 默认参数：10 ms 轮询，触发后 100 ms 快照，1 s 内不重复转储 */
+#define PLCOPEN_TRACE_DRAINER_DEFAULTS { 10u, 100u, 1000u }
+
+/**
+ * @brief 转储线程
+ */
+typedef struct {
+    plcopen_trace_ring_t* rings[PLCOPEN_TRACE_MAX_RINGS];
+    size_t ring_count;
+    char path_prefix[PLCOPEN_TRACE_PATH_MAX];
+    plcopen_trace_drainer_config_t config;
+    plcopen_trace_record_t* scratch;   /**< 快照缓冲区（最大环容量） */
+    size_t scratch_records;
+    pthread_t thread;
+    atomic_int stop;
+    atomic_uint dumps;                 /**< 已写出的文件数 */
+} plcopen_trace_drainer_t;
+
+/**
+ * @brief 启动转储线程
+ *
+ * @param config 参数（NULL 时使用 PLCOPEN_TRACE_DRAINER_DEFAULTS）
+ * @return int 0=成功，-1=参数无效或资源不足
+ */
+int plcopen_trace_drainer_start(plcopen_trace_drainer_t* drainer,
+                                plcopen_trace_ring_t* const* rings, size_t ring_count,
+                                const char* path_prefix,
+                                const plcopen_trace_drainer_config_t* config);
+
+/**
+ * @brief 停止转储线程并释放快照缓冲区
+ */
+void plcopen_trace_drainer_stop(plcopen_trace_drainer_t* drainer);
+
+/**
+ * @brief 已写出的文件数
+ */
+static inline unsigned plcopen_trace_drainer_dumps(plcopen_trace_drainer_t* drainer) {
+    return atomic_load(&drainer->dumps);
+}
+
+/**
+ * @brief 立即把各环快照写入文件（同步；可在任意线程调用）
+ *
+ * @param rings 追踪环数组
+ * @param ring_count 环数
+ * @param path 文件路径
+ * @param trigger_index 各环的触发记录序号（可为 NULL，表示无触发）
+ * @return int 0=成功，-1=失败
+ */
+int plcopen_trace_dump_file(plcopen_trace_ring_t* const* rings, size_t ring_count,
+                            const char* path, const uint32_t* trigger_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCOPEN_TRACE_DRAINER_H */
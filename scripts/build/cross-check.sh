@@ -0,0 +1,238 @@
+#!/usr/bin/env bash
+#
+# 交叉目标构建与测试
+# 功能: 在具备交叉工具链的构建机上依次检查主机构建覆盖不到的目标路径:
+#       - m4-lib      以 cortex-m4 预设交叉编译 plcopen 库（arm-none-eabi-gcc）
+#       - blinky      交叉编译 templates/examples/blinky
+#       - placement   交叉编译 templates/examples/fb-placement，链接后检查段地址
+#       - m4-qemu     构建 qemu_m4 固件，在 qemu-system-arm 上运行 Q15 DSP 对照测试
+#                     （test_m4_q15）与指令计数基准（bench_m4_icount）
+#       - aarch64     以 aarch64 预设交叉编译库、测试与基准，经 qemu-aarch64 运行 ctest
+#                     （含 test_fb_bank_f32 的真实 NEON 路径）
+#       缺少工具链的阶段标记为 SKIP；任一阶段失败时退出码为 1，
+#       --strict 时 SKIP 也视为失败（CI 中用于确认交叉路径确实被执行）
+#
+# 使用方式:
+#   scripts/build/cross-check.sh [--strict] [--only STAGE]...
+#
+# 编码: UTF-8
+# 换行符: LF
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+# shellcheck source=../common.sh
+source "$SCRIPT_DIR/../common.sh"
+
+PROJECT_ROOT="$(get_project_root)"
+BUILD_ROOT="$PROJECT_ROOT/build"
+M4_TOOLCHAIN="$PROJECT_ROOT/templates/cmake/toolchain-arm-cortex-m4.cmake"
+JOBS="$(nproc 2>/dev/null || echo 2)"
+
+STRICT=0
+ONLY=()
+ALL_STAGES=(m4-lib blinky placement m4-qemu aarch64)
+RESULTS=()
+FAILED=0
+
+#######################################
+# 显示使用帮助
+#######################################
+show_help() {
+    cat << EOF
+用法: $(basename "$0") [选项]
+
+交叉编译 Cortex-M4 / AArch64 目标，并在 QEMU 上运行对照测试
+
+选项:
+    --strict       缺少工具链的阶段也视为失败
+    --only STAGE   只运行指定阶段（可重复）：${ALL_STAGES[*]}
+    --help         显示此帮助信息
+
+所需工具:
+    m4-lib / blinky / placement   arm-none-eabi-gcc
+    m4-qemu                       arm-none-eabi-gcc, qemu-system-arm
+    aarch64                       aarch64-linux-gnu-gcc, qemu-aarch64（qemu-user）
+
+EOF
+}
+
+#######################################
+# 记录阶段结果
+# 参数:
+#   $1 - 阶段名
+#   $2 - PASS / FAIL / SKIP
+#   $3 - 说明
+#######################################
+record() {
+    RESULTS+=("$1|$2|$3")
+    case "$2" in
+        PASS) log_success "$1: $3" ;;
+        SKIP) log_warn "$1: 跳过（$3）"
+              if [[ $STRICT -eq 1 ]]; then FAILED=1; fi ;;
+        *)    log_error "$1: $3"; FAILED=1 ;;
+    esac
+}
+
+#######################################
+# 检查阶段所需的命令，缺少时记录 SKIP
+# 参数:
+#   $1 - 阶段名
+#   $@ - 命令列表
+# 返回:
+#   0 - 全部存在，1 - 有缺失
+#######################################
+require_tools() {
+    local stage="$1"
+    shift
+    local missing=()
+    local tool
+    for tool in "$@"; do
+        command_exists "$tool" || missing+=("$tool")
+    done
+    if [[ ${#missing[@]} -gt 0 ]]; then
+        record "$stage" SKIP "未找到 ${missing[*]}"
+        return 1
+    fi
+    return 0
+}
+
+#######################################
+# 以 cmake 配置并构建独立工程（日志写入构建目录）
+# 参数:
+#   $1 - 源目录
+#   $2 - 构建目录
+#   $@ - 额外的配置参数
+#######################################
+build_project() {
+    local source="$1"
+    local binary="$2"
+    shift 2
+    mkdir -p "$binary"
+    cmake -S "$source" -B "$binary" -DCMAKE_TOOLCHAIN_FILE="$M4_TOOLCHAIN" "$@" \
+        > "$binary/configure.log" 2>&1 &&
+        cmake --build "$binary" -j"$JOBS" > "$binary/build.log" 2>&1
+}
+
+stage_m4_lib() {
+    require_tools m4-lib arm-none-eabi-gcc || return 0
+    local binary="$BUILD_ROOT/cortex-m4"
+    mkdir -p "$binary"
+    if cmake --preset cortex-m4 -S "$PROJECT_ROOT" > "$binary/configure.log" 2>&1 &&
+        cmake --build --preset cortex-m4 -j"$JOBS" > "$binary/build.log" 2>&1; then
+        record m4-lib PASS "$(arm-none-eabi-size -t "$binary/libplcopen.a" | tail -n 1 | awk '{ print "text " $1 " B, data " $2 " B, bss " $3 " B" }')"
+    else
+        record m4-lib FAIL "构建失败，见 $binary/build.log"
+    fi
+}
+
+stage_blinky() {
+    require_tools blinky arm-none-eabi-gcc || return 0
+    local binary="$BUILD_ROOT/blinky"
+    if build_project "$PROJECT_ROOT/templates/examples/blinky" "$binary"; then
+        record blinky PASS "blinky.elf 已链接"
+    else
+        record blinky FAIL "构建失败，见 $binary/build.log"
+    fi
+}
+
+stage_placement() {
+    require_tools placement arm-none-eabi-gcc || return 0
+    local binary="$BUILD_ROOT/fb-placement"
+    # 链接后的 check_placement.cmake 在段地址不符时使构建失败
+    if build_project "$PROJECT_ROOT/templates/examples/fb-placement" "$binary" \
+        -DPLCOPEN_ROOT="$PROJECT_ROOT"; then
+        record placement PASS "段地址检查通过（arm-none-eabi-ld）"
+    else
+        record placement FAIL "构建或段地址检查失败，见 $binary/build.log"
+    fi
+}
+
+#######################################
+# 在 qemu-system-arm 上运行固件，返回固件的退出码
+# 参数:
+#   $1 - ELF 路径
+#######################################
+run_m4_firmware() {
+    timeout 300 qemu-system-arm -M netduinoplus2 -nographic -monitor none -serial none \
+        -icount shift=0,align=off,sleep=off \
+        -semihosting-config enable=on,target=native -kernel "$1"
+}
+
+stage_m4_qemu() {
+    require_tools m4-qemu arm-none-eabi-gcc qemu-system-arm || return 0
+    local binary="$BUILD_ROOT/qemu-m4"
+    if ! build_project "$PROJECT_ROOT/benchmarks/plcopen/qemu_m4" "$binary" \
+        -DCMAKE_BUILD_TYPE=Release -DPLCOPEN_ROOT="$PROJECT_ROOT"; then
+        record m4-qemu FAIL "固件构建失败，见 $binary/build.log"
+        return 0
+    fi
+    if ! run_m4_firmware "$binary/test_m4_q15.elf" > "$binary/test_m4_q15.csv"; then
+        record m4-qemu FAIL "test_m4_q15 不一致，见 $binary/test_m4_q15.csv"
+        return 0
+    fi
+    if ! run_m4_firmware "$binary/bench_m4_icount.elf" > "$binary/bench_m4_icount.csv"; then
+        record m4-qemu FAIL "bench_m4_icount 运行失败"
+        return 0
+    fi
+    record m4-qemu PASS "Q15 DSP 路径与参考实现一致，指令计数见 $binary/bench_m4_icount.csv"
+}
+
+stage_aarch64() {
+    require_tools aarch64 aarch64-linux-gnu-gcc qemu-aarch64 || return 0
+    local binary="$BUILD_ROOT/aarch64"
+    mkdir -p "$binary"
+    if ! cmake --preset aarch64 -S "$PROJECT_ROOT" > "$binary/configure.log" 2>&1 ||
+        ! cmake --build --preset aarch64 -j"$JOBS" > "$binary/build.log" 2>&1; then
+        record aarch64 FAIL "构建失败，见 $binary/build.log"
+        return 0
+    fi
+    if ctest --preset aarch64 > "$binary/ctest.log" 2>&1; then
+        record aarch64 PASS "$(grep 'tests passed' "$binary/ctest.log")"
+    else
+        record aarch64 FAIL "ctest 失败，见 $binary/ctest.log"
+    fi
+}
+
+#######################################
+# 判断阶段是否被选中
+#######################################
+selected() {
+    [[ ${#ONLY[@]} -eq 0 ]] && return 0
+    local stage
+    for stage in "${ONLY[@]}"; do
+        [[ "$stage" == "$1" ]] && return 0
+    done
+    return 1
+}
+
+main() {
+    while [[ $# -gt 0 ]]; do
+        case "$1" in
+            --strict) STRICT=1; shift ;;
+            --only)   ONLY+=("$2"); shift 2 ;;
+            --help)   show_help; exit 0 ;;
+            *)        log_error "未知选项: $1"; show_help; exit 1 ;;
+        esac
+    done
+
+    check_required_commands cmake ctest
+    mkdir -p "$BUILD_ROOT"
+
+    selected m4-lib && stage_m4_lib
+    selected blinky && stage_blinky
+    selected placement && stage_placement
+    selected m4-qemu && stage_m4_qemu
+    selected aarch64 && stage_aarch64
+
+    echo
+    printf '%-10s %-5s %s\n' "stage" "result" "detail"
+    local line stage result detail
+    for line in "${RESULTS[@]}"; do
+        IFS='|' read -r stage result detail <<< "$line"
+        printf '%-10s %-5s %s\n' "$stage" "$result" "$detail"
+    done
+    exit "$FAILED"
+}
+
+main "$@"
@@ -0,0 +1,148 @@
+#!/usr/bin/env bash
+#
+# LTO/PGO 构建流水线
+# 功能: 依次构建 release、release-lto、pgo-generate、pgo-use 四个预设，
+#       以 bench_scan_workload（PID/PT1/RAMP 混合回路网络）作为训练和测量负载，
+#       输出每个功能块相对默认构建的性能提升
+#
+# 使用方式:
+#   scripts/build/pgo-pipeline.sh [--loops N] [--scans N] [--repeat N]
+#
+# 编码: UTF-8
+# 换行符: LF
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+# shellcheck source=../common.sh
+source "$SCRIPT_DIR/../common.sh"
+
+PROJECT_ROOT="$(get_project_root)"
+BUILD_ROOT="$PROJECT_ROOT/build"
+PROFILE_DIR="$BUILD_ROOT/pgo-profile"
+REPORT_DIR="$BUILD_ROOT/pgo-report"
+
+LOOPS=256
+SCANS=20000
+REPEAT=3
+
+#######################################
+# 显示使用帮助
+#######################################
+show_help() {
+    cat << EOF
+用法: $(basename "$0") [选项]
+
+构建默认/LTO/PGO 三种配置，并报告每个功能块的性能提升
+
+选项:
+    --loops N    负载回路数（默认 ${LOOPS}）
+    --scans N    每次运行的扫描周期数（默认 ${SCANS}）
+    --repeat N   每种配置的测量次数，取最小值（默认 ${REPEAT}）
+    --help       显示此帮助信息
+
+输出:
+    ${REPORT_DIR}/<preset>.csv   各配置的原始测量结果
+    ${REPORT_DIR}/report.md      汇总对比表
+
+EOF
+}
+
+#######################################
+# 配置并构建指定预设
+# 参数:
+#   $1 - 预设名
+#######################################
+build_preset() {
+    local preset="$1"
+    log_info "构建预设: ${preset}"
+    cmake --preset "$preset" -S "$PROJECT_ROOT" > /dev/null
+    cmake --build --preset "$preset" -j"$(nproc 2>/dev/null || echo 2)" > /dev/null
+}
+
+#######################################
+# 运行负载并记录每个功能块的最小 ns/call
+# 参数:
+#   $1 - 预设名
+#   $2 - 构建目录
+#######################################
+measure_preset() {
+    local preset="$1"
+    local binary="$2/benchmarks/plcopen/bench_scan_workload"
+    local raw="$REPORT_DIR/${preset}.raw"
+
+    : > "$raw"
+    for ((i = 0; i < REPEAT; i++)); do
+        "$binary" "$LOOPS" "$SCANS" 2>/dev/null | tail -n +2 >> "$raw"
+    done
+
+    echo "fb,ns_per_call" > "$REPORT_DIR/${preset}.csv"
+    awk -F, '{ if (!($1 in best) || $4 < best[$1]) best[$1] = $4 }
+             END { for (fb in best) printf "%s,%.3f\n", fb, best[fb] }' "$raw" \
+        | sort >> "$REPORT_DIR/${preset}.csv"
+    rm -f "$raw"
+}
+
+#######################################
+# 使用训练负载采集 PGO 剖析数据
+#######################################
+train_profile() {
+    log_info "运行训练负载采集剖析数据"
+    rm -rf "$PROFILE_DIR"
+    mkdir -p "$PROFILE_DIR"
+    "$BUILD_ROOT/pgo/benchmarks/plcopen/bench_scan_workload" "$LOOPS" "$SCANS" > /dev/null 2>&1
+
+    # Clang 生成 .profraw，需要合并为 default.profdata
+    if compgen -G "$PROFILE_DIR/*.profraw" > /dev/null; then
+        check_required_commands llvm-profdata
+        llvm-profdata merge -output="$PROFILE_DIR/default.profdata" "$PROFILE_DIR"/*.profraw
+    fi
+}
+
+#######################################
+# 生成对比报告（以 release 为基线）
+#######################################
+write_report() {
+    local report="$REPORT_DIR/report.md"
+    {
+        echo "| FB | release (ns/call) | release-lto (ns/call) | LTO 提升 | pgo-use (ns/call) | LTO+PGO 提升 |"
+        echo "|----|------|------|------|------|------|"
+        join -t, <(tail -n +2 "$REPORT_DIR/release.csv") <(tail -n +2 "$REPORT_DIR/release-lto.csv") \
+            | join -t, - <(tail -n +2 "$REPORT_DIR/pgo-use.csv") \
+            | awk -F, '{ printf "| %s | %.2f | %.2f | %+.1f%% | %.2f | %+.1f%% |\n",
+                         $1, $2, $3, ($2 - $3) / $2 * 100.0, $4, ($2 - $4) / $2 * 100.0 }'
+    } > "$report"
+    cat "$report"
+}
+
+main() {
+    while [[ $# -gt 0 ]]; do
+        case "$1" in
+            --loops)  LOOPS="$2"; shift 2 ;;
+            --scans)  SCANS="$2"; shift 2 ;;
+            --repeat) REPEAT="$2"; shift 2 ;;
+            --help)   show_help; exit 0 ;;
+            *)        log_error "未知选项: $1"; show_help; exit 1 ;;
+        esac
+    done
+
+    check_required_commands cmake awk join
+    mkdir -p "$REPORT_DIR"
+
+    build_preset release
+    measure_preset release "$BUILD_ROOT/release"
+
+    build_preset release-lto
+    measure_preset release-lto "$BUILD_ROOT/release-lto"
+
+    build_preset pgo-generate
+    train_profile
+
+    build_preset pgo-use
+    measure_preset pgo-use "$BUILD_ROOT/pgo"
+
+    log_success "LTO/PGO 对比结果（负载: ${LOOPS} 回路 × ${SCANS} 周期，取 ${REPEAT} 次最小值）"
+    write_report
+}
+
+main "$@"
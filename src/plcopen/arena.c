@@ -0,0 +1,212 @@
+/**
+ * @file arena.c
+ * @brief 功能块实例的缓存行对齐静态存储区实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#if defined(__linux__)
+/* mmap 的 MAP_ANONYMOUS / MAP_HUGETLB / madvise 在严格 C11 模式下需显式启用 */
+#define _GNU_SOURCE
+#endif
+
+#include "plcopen/arena.h"
+
+#if defined(__linux__)
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief 将 value 向上取整到 align（2 的幂）的整数倍
+ */
+static inline uintptr_t align_up(uintptr_t value, size_t align) {
+    return (value + (uintptr_t)align - 1u) & ~((uintptr_t)align - 1u);
+}
+
+static inline bool is_power_of_two(size_t value) {
+    return value != 0u && (value & (value - 1u)) == 0u;
+}
+
+int plcopen_arena_init(plcopen_arena_t* arena, void* storage, size_t size) {
+    if (arena == NULL || storage == NULL) {
+        return -1;
+    }
+
+    uintptr_t start = (uintptr_t)storage;
+    uintptr_t aligned = align_up(start, PLCOPEN_CACHE_LINE);
+    if (aligned - start >= size) {
+        return -1;
+    }
+
+    arena->base = (uint8_t*)aligned;
+    arena->size = size - (size_t)(aligned - start);
+    arena->used = 0;
+    arena->mapped = 0;
+    return 0;
+}
+
+void* plcopen_arena_alloc(plcopen_arena_t* arena, size_t size, size_t align) {
+    if (arena == NULL || size == 0u) {
+        return NULL;
+    }
+    if (align == 0u) {
+        align = PLCOPEN_CACHE_LINE;
+    }
+    if (!is_power_of_two(align)) {
+        return NULL;
+    }
+
+    uintptr_t base = (uintptr_t)arena->base;
+    uintptr_t addr = align_up(base + arena->used, align);
+    size_t offset = (size_t)(addr - base);
+    if (offset > arena->size || size > arena->size - offset) {
+        return NULL;
+    }
+
+    arena->used = offset + size;
+    return (void*)addr;
+}
+
+int plcopen_arena_split(plcopen_arena_t* parent, plcopen_arena_t* child, size_t size) {
+    if (child == NULL || size == 0u) {
+        return -1;
+    }
+
+    size_t rounded = (size_t)align_up(size, PLCOPEN_CACHE_LINE);
+    void* block = plcopen_arena_alloc(parent, rounded, PLCOPEN_CACHE_LINE);
+    if (block == NULL) {
+        return -1;
+    }
+
+    child->base = (uint8_t*)block;
+    child->size = rounded;
+    child->used = 0;
+    child->mapped = 0;
+    return 0;
+}
+
+void plcopen_arena_reset(plcopen_arena_t* arena) {
+    arena->used = 0;
+}
+
+#if defined(__linux__)
+
+/* 大页大小（x86-64 / AArch64 默认 2 MiB） */
+#define ARENA_HUGE_PAGE_SIZE (2u * 1024u * 1024u)
+
+#if defined(MADV_HUGEPAGE)
+/*
+ * madvise(MADV_HUGEPAGE) 成功只说明请求被接受：THP 设置为 never 或 khugepaged 无法提供大页时
+ * 仍返回 0。以 /proc/self/smaps 中包含 address 的映射的 AnonHugePages 确认是否实际获得了大页。
+ */
+static bool thp_in_use(const void* address) {
+    FILE* smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == NULL) {
+        return false;
+    }
+    uintptr_t target = (uintptr_t)address;
+    bool inside = false;
+    bool in_use = false;
+    char line[256];
+    while (fgets(line, sizeof(line), smaps) != NULL) {
+        unsigned long start, end, kb;
+        if (sscanf(line, "%lx-%lx ", &start, &end) == 2) {
+            if (inside) {
+                break;
+            }
+            inside = target >= start && target < end;
+        } else if (inside && sscanf(line, "AnonHugePages: %lu kB", &kb) == 1) {
+            in_use = kb > 0u;
+            break;
+        }
+    }
+    fclose(smaps);
+    return in_use;
+}
+#endif
+
+int plcopen_arena_map(plcopen_arena_t* arena, size_t size, unsigned flags) {
+    if (arena == NULL || size == 0u) {
+        return -1;
+    }
+
+    void* block = MAP_FAILED;
+    size_t length = size;
+    uint8_t mapped = 1;
+
+    if (flags & PLCOPEN_ARENA_HUGE_PAGES) {
+        /* 1. 预留大页（需 vm.nr_hugepages > 0） */
+        length = (size_t)align_up(size, ARENA_HUGE_PAGE_SIZE);
+        block = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+        if (block != MAP_FAILED) {
+            mapped = 2;
+        }
+    }
+
+    if (block == MAP_FAILED) {
+        long page = sysconf(_SC_PAGESIZE);
+        length = (size_t)align_up(size, page > 0 ? (size_t)page : 4096u);
+        int populate = MAP_POPULATE;
+
+#if defined(MADV_HUGEPAGE)
+        if (flags & PLCOPEN_ARENA_HUGE_PAGES) {
+            /* 2. 透明大页：先映射、标记后再触碰，避免 MAP_POPULATE 预先用普通页填充 */
+            length = (size_t)align_up(size, ARENA_HUGE_PAGE_SIZE);
+            populate = 0;
+        }
+#endif
+        block = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | populate, -1, 0);
+        if (block == MAP_FAILED) {
+            return -1;
+        }
+
+#if defined(MADV_HUGEPAGE)
+        if (populate == 0) {
+            bool requested = madvise(block, length, MADV_HUGEPAGE) == 0;
+            /* 预先触碰每一页，保证实时执行阶段没有缺页 */
+            volatile uint8_t* bytes = (volatile uint8_t*)block;
+            for (size_t i = 0; i < length; i += 4096u) {
+                bytes[i] = 0;
+            }
+            if (requested) {
+                mapped = thp_in_use(block) ? 2 : 3;
+            }
+        }
+#endif
+    }
+
+    arena->base = (uint8_t*)block;
+    arena->size = length;
+    arena->used = 0;
+    arena->mapped = mapped;
+    return 0;
+}
+
+void plcopen_arena_unmap(plcopen_arena_t* arena) {
+    if (arena != NULL && arena->mapped != 0u) {
+        munmap(arena->base, arena->size);
+        arena->base = NULL;
+        arena->size = 0;
+        arena->used = 0;
+        arena->mapped = 0;
+    }
+}
+
+#else /* !__linux__ */
+
+int plcopen_arena_map(plcopen_arena_t* arena, size_t size, unsigned flags) {
+    (void)arena;
+    (void)size;
+    (void)flags;
+    return -1;
+}
+
+void plcopen_arena_unmap(plcopen_arena_t* arena) {
+    (void)arena;
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,86 @@
+/**
+ * @file command_queue.c
+ * @brief 无等待单生产者/单消费者命令队列实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * head、tail 为单调递增的计数，槽位下标为 计数 & (容量 - 1)。
+ *
+ *   push：tail - head_cache == 容量时重新 acquire 加载 head；仍满则失败。
+ *         写入槽位后以 release 存储 tail + 1，槽位内容先于 tail 可见
+ *   drain：acquire 加载 tail 一次，执行 [head, tail) 内的命令，
+ *         再以 release 存储 head，生产者看到新 head 时槽位已不再被读取
+ *
+ * 两端都没有循环等待，单次操作的步数有界。
+ */
+
+#include "plcopen/command_queue.h"
+
+#define CMDQ_MASK ((size_t)PLCOPEN_CMDQ_CAPACITY - 1u)
+
+void plcopen_cmdq_init(plcopen_cmdq_t* q) {
+    atomic_init(&q->tail, 0u);
+    atomic_init(&q->head, 0u);
+    q->head_cache = 0u;
+}
+
+int plcopen_cmdq_push(plcopen_cmdq_t* q, const plcopen_cmd_t* cmd) {
+    if (q == NULL || cmd == NULL) {
+        return -1;
+    }
+
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    if (tail - q->head_cache == PLCOPEN_CMDQ_CAPACITY) {
+        q->head_cache = atomic_load_explicit(&q->head, memory_order_acquire);
+        if (tail - q->head_cache == PLCOPEN_CMDQ_CAPACITY) {
+            return -1;
+        }
+    }
+
+    q->slots[tail & CMDQ_MASK] = *cmd;
+    atomic_store_explicit(&q->tail, tail + 1u, memory_order_release);
+    return 0;
+}
+
+static void apply(const plcopen_cmd_t* cmd) {
+    switch ((plcopen_cmd_type_t)cmd->type) {
+    case PLCOPEN_CMD_PID_SET_MANUAL:
+        FB_PID_SetManual(cmd->target.pid, cmd->value);
+        break;
+    case PLCOPEN_CMD_PID_SET_AUTO:
+        FB_PID_SetAuto(cmd->target.pid);
+        break;
+    case PLCOPEN_CMD_PID_RESET_INTEGRAL:
+        cmd->target.pid->state.integral = 0.0f;
+        break;
+    case PLCOPEN_CMD_INTEGRATOR_RESET:
+        FB_INTEGRATOR_Reset(cmd->target.integrator);
+        break;
+    case PLCOPEN_CMD_WRITE_SETPOINT:
+        *cmd->target.variable = cmd->value;
+        break;
+    default:
+        /* 未知命令：忽略 */
+        break;
+    }
+}
+
+size_t plcopen_cmdq_drain(plcopen_cmdq_t* q) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t end = atomic_load_explicit(&q->tail, memory_order_acquire);
+    if (head == end) {
+        return 0;
+    }
+
+    for (size_t i = head; i != end; i++) {
+        apply(&q->slots[i & CMDQ_MASK]);
+    }
+    atomic_store_explicit(&q->head, end, memory_order_release);
+    return end - head;
+}
+
+size_t plcopen_cmdq_size(const plcopen_cmdq_t* q) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    return tail - head;
+}
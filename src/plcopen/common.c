@@ -55,6 +55,98 @@ bool check_nan_inf(float value) {
     return isnan(value) || isinf(value);
 }
 
+/**
+ * @brief 检查数组中的值是否全部为有限数
+ *
+ * 实现说明：|x| <= FLT_MAX 对 NaN 与 ±Inf 均为假，按位与累积后一次返回。
+ */
+bool check_block_finite(const float* values, size_t n) {
+    bool finite = true;
+    for (size_t i = 0; i < n; i++) {
+        finite &= fabsf(values[i]) <= FLT_MAX;
+    }
+    return finite;
+}
+
+/**
+ * @brief 一阶递推的 n 步衰减因子 (1 - α)^n
+ *
+ * 实现说明：α = 1 时 log1p(-1) 为 -Inf，n > 0 时结果为 0，与逐步递推一致。
+ */
+float decay_factor(float alpha, uint32_t n) {
+    if (n == 0u) {
+        return 1.0f;
+    }
+    return expf((float)n * log1pf(-alpha));
+}
+
+/*
+ * expm1 在 |x| <= ln2/2 上的 8 阶泰勒多项式，截断误差 < 3e-10（相对）。
+ * 按 Estrin 格式分组求值：依赖链约为 Horner 的一半，一次调用的延迟接近定步长路径。
+ */
+static inline float expm1_poly(float x) {
+    float x2 = x * x;
+    float x4 = x2 * x2;
+    float p01 = 1.0f + x * (1.0f / 2.0f);
+    float p23 = 1.0f / 6.0f + x * (1.0f / 24.0f);
+    float p45 = 1.0f / 120.0f + x * (1.0f / 720.0f);
+    float p67 = 1.0f / 5040.0f + x * (1.0f / 40320.0f);
+    return x * ((p01 + x2 * p23) + x4 * (p45 + x2 * p67));
+}
+
+/**
+ * @brief 快速 exp(x) - 1（误差有界）
+ *
+ * 实现说明：
+ * 1. |x| < ln2/2：直接求 expm1 多项式（dt 远小于 τ 时保留相对精度）
+ * 2. 否则 n = round(x / ln2)，r = x - n·ln2（ln2 拆为高低两部分，减法无舍入），
+ *    exp(x) = 2^n · (1 + expm1(r))；2^n 拆为两个因子由指数位直接构造，
+ *    n 接近上下界时也不溢出
+ */
+float fast_expm1f(float x) {
+    const float ln2_half = 0.34657359f;
+    if (x > -ln2_half && x < ln2_half) {
+        return expm1_poly(x);
+    }
+    if (!(x >= -88.0f)) {
+        /* exp(-88) < 2^-126，单精度下 exp(x) - 1 即为 -1；NaN 原样返回 */
+        return (x < 0.0f) ? -1.0f : x;
+    }
+    if (x > 89.0f) {
+        return HUGE_VALF;
+    }
+
+    const float log2e = 1.44269504f;
+    const float ln2_hi = 0.693359375f;  /* 355/512，|n| <= 128 时 n·ln2_hi 精确 */
+    const float ln2_lo = -2.12194440e-4f;
+    int32_t n = (int32_t)(x * log2e + ((x < 0.0f) ? -0.5f : 0.5f));
+    float r = (x - (float)n * ln2_hi) - (float)n * ln2_lo;
+    float p = expm1_poly(r);
+
+    int32_t n1 = n / 2;
+    int32_t n2 = n - n1;
+    union { uint32_t u; float f; } s1 = { (uint32_t)(n1 + 127) << 23 };
+    union { uint32_t u; float f; } s2 = { (uint32_t)(n2 + 127) << 23 };
+    return (1.0f + p) * s1.f * s2.f - 1.0f;
+}
+
+/**
+ * @brief 检查实测的采样间隔
+ */
+FB_Status_t check_elapsed_time(float dt) {
+    /* 常见情形只做一次区间比较（NaN 与 ±Inf 均不满足） */
+    if (dt >= 0.0f && dt <= FLT_MAX) {
+        return FB_STATUS_OK;
+    }
+    if (check_nan(dt)) {
+        return FB_STATUS_ERROR_NAN;
+    }
+    if (check_inf(dt)) {
+        return FB_STATUS_ERROR_INF;
+    }
+    return FB_STATUS_ERROR_CONFIG;
+}
+
 /**
  * @brief 输出限幅函数
  *
@@ -0,0 +1,112 @@
+/**
+ * @file config_mailbox.c
+ * @brief 无锁在线参数更新实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * seqlock 协议：
+ *
+ * 写者：
+ *   1. CAS 把 seq 从偶数 s 改为 s + 1（多个写者之间互斥）
+ *   2. release 栅栏后以 relaxed 存储写入暂存字
+ *   3. 以 release 存储把 seq 改为 s + 2
+ *
+ * 读者（控制线程）：
+ *   1. acquire 加载 seq 得 s1，奇数表示正在写入，放弃
+ *   2. relaxed 加载全部暂存字到局部缓冲区
+ *   3. acquire 栅栏后 relaxed 加载 seq 得 s2，s1 != s2 表示撕裂，放弃
+ *   4. 把局部缓冲区复制到目标配置，记录 adopted_seq = s1
+ *
+ * 读者失败时目标配置保持不变，因此撕裂读取不会泄漏到功能块中。
+ */
+
+#include "plcopen/config_mailbox.h"
+#include <string.h>
+
+void plcopen_config_mailbox_init(plcopen_config_mailbox_t* mb) {
+    atomic_init(&mb->seq, 0u);
+    for (size_t i = 0; i < PLCOPEN_CONFIG_MAX_WORDS; i++) {
+        atomic_init(&mb->words[i], 0u);
+    }
+    mb->adopted_seq = 0u;
+}
+
+static inline size_t words_for(size_t size) {
+    return (size + sizeof(uint32_t) - 1u) / sizeof(uint32_t);
+}
+
+int plcopen_config_stage(plcopen_config_mailbox_t* mb, const void* config, size_t size) {
+    if (mb == NULL || config == NULL || size == 0u ||
+        size > PLCOPEN_CONFIG_MAX_WORDS * sizeof(uint32_t)) {
+        return -1;
+    }
+
+    uint32_t buffer[PLCOPEN_CONFIG_MAX_WORDS] = { 0 };
+    memcpy(buffer, config, size);
+
+    /* 占用写入权：seq 偶数 → 奇数 */
+    uint_least32_t seq = atomic_load_explicit(&mb->seq, memory_order_relaxed);
+    for (;;) {
+        if ((seq & 1u) == 0u &&
+            atomic_compare_exchange_weak_explicit(&mb->seq, &seq, seq + 1u,
+                                                  memory_order_acquire,
+                                                  memory_order_relaxed)) {
+            break;
+        }
+        seq = atomic_load_explicit(&mb->seq, memory_order_relaxed);
+    }
+    atomic_thread_fence(memory_order_release);
+
+    size_t n = words_for(size);
+    for (size_t i = 0; i < n; i++) {
+        atomic_store_explicit(&mb->words[i], buffer[i], memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&mb->seq, seq + 2u, memory_order_release);
+    return 0;
+}
+
+int plcopen_config_fetch(plcopen_config_mailbox_t* mb, void* config, size_t size) {
+    uint_least32_t s1 = atomic_load_explicit(&mb->seq, memory_order_acquire);
+    if (s1 == mb->adopted_seq) {
+        return 0;
+    }
+    if ((s1 & 1u) != 0u || size > PLCOPEN_CONFIG_MAX_WORDS * sizeof(uint32_t)) {
+        return -1;
+    }
+
+    uint32_t buffer[PLCOPEN_CONFIG_MAX_WORDS];
+    size_t n = words_for(size);
+    for (size_t i = 0; i < n; i++) {
+        buffer[i] = (uint32_t)atomic_load_explicit(&mb->words[i], memory_order_relaxed);
+    }
+
+    atomic_thread_fence(memory_order_acquire);
+    uint_least32_t s2 = atomic_load_explicit(&mb->seq, memory_order_relaxed);
+    if (s1 != s2) {
+        return -1;
+    }
+
+    memcpy(config, buffer, size);
+    mb->adopted_seq = (uint32_t)s1;
+    return 1;
+}
+
+/* ========== 类型化接口 ========== */
+
+#define PLCOPEN_DEFINE_CONFIG_MAILBOX(FB)                                                   \
+    FB_Status_t FB##_StageConfig(plcopen_config_mailbox_t* mb, const FB##_Config_t* config) { \
+        if (FB##_ValidateConfig(config) != FB_STATUS_OK ||                                  \
+            plcopen_config_stage(mb, config, sizeof(*config)) != 0) {                       \
+            return FB_STATUS_ERROR_CONFIG;                                                  \
+        }                                                                                   \
+        return FB_STATUS_OK;                                                                \
+    }
+
+PLCOPEN_DEFINE_CONFIG_MAILBOX(FB_PID)
+PLCOPEN_DEFINE_CONFIG_MAILBOX(FB_PT1)
+PLCOPEN_DEFINE_CONFIG_MAILBOX(FB_RAMP)
+PLCOPEN_DEFINE_CONFIG_MAILBOX(FB_LIMIT)
+PLCOPEN_DEFINE_CONFIG_MAILBOX(FB_DEADBAND)
+PLCOPEN_DEFINE_CONFIG_MAILBOX(FB_INTEGRATOR)
+PLCOPEN_DEFINE_CONFIG_MAILBOX(FB_DERIVATIVE)
@@ -0,0 +1,381 @@
+/**
+ * @file fb_bank_f16.c
+ * @brief PT1 / DERIVATIVE 半精度存储批量实例实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 实现说明：
+ * 1. 标量路径逐实例执行，完整处理首次运行、NaN/Inf、范围钳位
+ * 2. x86 F16C 路径每 8 个实例一组：仅当整组输入有效且均非首次运行时
+ *    走向量路径，否则整组回退到标量路径，保证两条路径结果一致
+ * 3. 收敛舍入：写回值舍入后与原值相同、而目标值舍入后不同时，
+ *    状态向目标前进一个 ULP，避免小 α 时状态停滞
+ */
+
+#include "plcopen/fb_bank_f16.h"
+
+#if defined(__F16C__) && defined(__AVX__)
+    #include <immintrin.h>
+    #define BANK16_USE_F16C 1
+#endif
+
+/* binary16 的 1.0 位模式 */
+#define HALF_ONE ((plc_half_t)0x3C00u)
+
+/**
+ * @brief 收敛舍入：将 value 舍入为 binary16，必要时向 target 前进一个 ULP
+ *
+ * @param old_h 原状态（binary16）
+ * @param old_value 原状态（float32）
+ * @param value 新状态（float32）
+ * @param target 状态的收敛目标
+ */
+static inline plc_half_t half_converge(plc_half_t old_h, float old_value,
+                                       float value, float target) {
+    plc_half_t h = plc_float_to_half(value);
+    if (h == old_h && old_value != 0.0f && plc_float_to_half(target) != old_h) {
+        /* 符号-幅值编码：正数位模式递增即增大，负数相反 */
+        bool up = (target > old_value) != (old_value < 0.0f);
+        h = (plc_half_t)(up ? h + 1u : h - 1u);
+    }
+    return h;
+}
+
+/**
+ * @brief 钳位到 binary16 可表示范围
+ */
+static inline float half_range_clamp(float value, FB_Status_t* status) {
+    if (value > PLC_HALF_MAX) {
+        *status = FB_STATUS_LIMIT_HI;
+        return PLC_HALF_MAX;
+    } else if (value < -PLC_HALF_MAX) {
+        *status = FB_STATUS_LIMIT_LO;
+        return -PLC_HALF_MAX;
+    }
+    return value;
+}
+
+#if defined(BANK16_USE_F16C)
+/**
+ * @brief 8 路收敛舍入（与 half_converge 逐位一致）
+ */
+static inline __m128i half_converge8(__m128i old_h, __m256 old_value,
+                                     __m256 value, __m256 target) {
+    const __m256 zero = _mm256_setzero_ps();
+    __m128i h = _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+    __m128i target_h = _mm256_cvtps_ph(target, _MM_FROUND_TO_NEAREST_INT);
+
+    __m256 nonzero = _mm256_cmp_ps(old_value, zero, _CMP_NEQ_OQ);
+    __m256 up = _mm256_xor_ps(_mm256_cmp_ps(target, old_value, _CMP_GT_OQ),
+                              _mm256_cmp_ps(old_value, zero, _CMP_LT_OQ));
+    __m256i nonzero_i = _mm256_castps_si256(nonzero);
+    __m256i up_i = _mm256_castps_si256(up);
+    __m128i nonzero16 = _mm_packs_epi32(_mm256_castsi256_si128(nonzero_i),
+                                        _mm256_extractf128_si256(nonzero_i, 1));
+    __m128i up16 = _mm_packs_epi32(_mm256_castsi256_si128(up_i),
+                                   _mm256_extractf128_si256(up_i, 1));
+
+    __m128i stalled = _mm_and_si128(_mm_cmpeq_epi16(h, old_h),
+                                    _mm_andnot_si128(_mm_cmpeq_epi16(target_h, old_h),
+                                                     nonzero16));
+    /* up → +1，down → -1（全 1） */
+    __m128i step = _mm_or_si128(_mm_and_si128(up16, _mm_set1_epi16(1)),
+                                _mm_andnot_si128(up16, _mm_set1_epi16(-1)));
+    return _mm_add_epi16(h, _mm_and_si128(step, stalled));
+}
+
+/**
+ * @brief 判断 8 路输入是否均有限且在 binary16 范围内
+ */
+static inline int input_valid_mask8(__m256 u) {
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 in_range = _mm256_cmp_ps(_mm256_and_ps(u, abs_mask),
+                                    _mm256_set1_ps(PLC_HALF_MAX), _CMP_LE_OQ);
+    return _mm256_movemask_ps(in_range);
+}
+#endif
+
+/* ========== PT1 ========== */
+
+FB_Status_t FB_PT1_Bank16_Init(FB_PT1_Bank16_t* bank, plc_half_t* output,
+                               plc_half_t* alpha, int8_t* status,
+                               size_t count, float sample_time) {
+    if (bank == NULL || output == NULL || alpha == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (sample_time <= 0.0f || sample_time >= MAX_SAMPLE_TIME) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->output = output;
+    bank->alpha = alpha;
+    bank->status = status;
+    bank->count = count;
+    bank->sample_time = sample_time;
+
+    for (size_t i = 0; i < count; i++) {
+        output[i] = PLC_HALF_NAN;
+        alpha[i] = HALF_ONE;
+        status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_PT1_Bank16_Configure(FB_PT1_Bank16_t* bank, size_t index,
+                                    float time_constant) {
+    if (bank == NULL || index >= bank->count) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (time_constant < MIN_VALID_VALUE) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    /* 与 FB_PT1 相同的前向欧拉系数，量化为 binary16 */
+    float alpha = bank->sample_time / (time_constant + bank->sample_time);
+    bank->alpha[index] = plc_float_to_half(alpha);
+
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 PT1 实例（标量路径）
+ */
+static void pt1_bank16_execute_one(FB_PT1_Bank16_t* bank, size_t i, float input, float* output) {
+    if (check_nan(input)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_NAN;
+        *output = 0.0f;
+        return;
+    }
+
+    if (check_inf(input)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_INF;
+        *output = 0.0f;
+        return;
+    }
+
+    FB_Status_t status = FB_STATUS_OK;
+    input = half_range_clamp(input, &status);
+
+    plc_half_t old_h = bank->output[i];
+    plc_half_t new_h;
+
+    if (plc_half_is_nan(old_h)) {
+        /* 首次运行：输出 = 输入，无跳变启动 */
+        new_h = plc_float_to_half(input);
+    } else {
+        float y = plc_half_to_float(old_h);
+        float alpha = plc_half_to_float(bank->alpha[i]);
+        new_h = half_converge(old_h, y, y + alpha * (input - y), input);
+    }
+
+    bank->output[i] = new_h;
+    bank->status[i] = (int8_t)status;
+    *output = plc_half_to_float(new_h);
+}
+
+#if defined(BANK16_USE_F16C)
+/**
+ * @brief 执行 8 个 PT1 实例（F16C 向量路径）
+ * @return true 已处理；false 整组需回退到标量路径
+ */
+static bool pt1_bank16_execute8(FB_PT1_Bank16_t* bank, size_t i,
+                                const float* input, float* output) {
+    __m256 u = _mm256_loadu_ps(input);
+    __m128i old_h = _mm_loadu_si128((const __m128i*)(const void*)&bank->output[i]);
+    __m256 y = _mm256_cvtph_ps(old_h);
+
+    /* 首次运行（NaN 状态）或输入异常时回退 */
+    int valid = input_valid_mask8(u) & _mm256_movemask_ps(_mm256_cmp_ps(y, y, _CMP_ORD_Q));
+    if (valid != 0xFF) {
+        return false;
+    }
+
+    __m256 alpha = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(const void*)&bank->alpha[i]));
+    __m256 y_new = _mm256_add_ps(y, _mm256_mul_ps(alpha, _mm256_sub_ps(u, y)));
+    __m128i new_h = half_converge8(old_h, y, y_new, u);
+
+    _mm_storeu_si128((__m128i*)(void*)&bank->output[i], new_h);
+    _mm256_storeu_ps(output, _mm256_cvtph_ps(new_h));
+    memset(&bank->status[i], (int)FB_STATUS_OK, 8);
+    return true;
+}
+#endif
+
+void FB_PT1_Bank16_Execute(FB_PT1_Bank16_t* bank, const float* input, float* output) {
+    size_t i = 0;
+
+#if defined(BANK16_USE_F16C)
+    for (; i + 8 <= bank->count; i += 8) {
+        if (!pt1_bank16_execute8(bank, i, &input[i], &output[i])) {
+            for (size_t k = i; k < i + 8; k++) {
+                pt1_bank16_execute_one(bank, k, input[k], &output[k]);
+            }
+        }
+    }
+#endif
+
+    for (; i < bank->count; i++) {
+        pt1_bank16_execute_one(bank, i, input[i], &output[i]);
+    }
+}
+
+/* ========== DERIVATIVE ========== */
+
+FB_Status_t FB_DERIVATIVE_Bank16_Init(FB_DERIVATIVE_Bank16_t* bank,
+                                      plc_half_t* prev_input,
+                                      plc_half_t* filtered_output,
+                                      plc_half_t* alpha, int8_t* status,
+                                      size_t count, float sample_time) {
+    if (bank == NULL || prev_input == NULL || filtered_output == NULL ||
+        alpha == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (sample_time <= 0.0f || sample_time >= MAX_SAMPLE_TIME) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->prev_input = prev_input;
+    bank->filtered_output = filtered_output;
+    bank->alpha = alpha;
+    bank->status = status;
+    bank->count = count;
+    bank->sample_time = sample_time;
+    bank->inv_sample_time = 1.0f / sample_time;
+
+    for (size_t i = 0; i < count; i++) {
+        prev_input[i] = PLC_HALF_NAN;
+        filtered_output[i] = 0u;
+        alpha[i] = HALF_ONE;
+        status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_DERIVATIVE_Bank16_Configure(FB_DERIVATIVE_Bank16_t* bank, size_t index,
+                                           float filter_time_constant) {
+    if (bank == NULL || index >= bank->count) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (filter_time_constant < 0.0f) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    /* 无滤波时 α = 1，滤波输出即原始微分 */
+    float alpha = bank->sample_time / (filter_time_constant + bank->sample_time);
+    bank->alpha[index] = plc_float_to_half(alpha);
+
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 DERIVATIVE 实例（标量路径）
+ */
+static void derivative_bank16_execute_one(FB_DERIVATIVE_Bank16_t* bank, size_t i,
+                                          float input, float* output) {
+    if (check_nan(input)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_NAN;
+        *output = 0.0f;
+        return;
+    }
+
+    if (check_inf(input)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_INF;
+        *output = 0.0f;
+        return;
+    }
+
+    FB_Status_t status = FB_STATUS_OK;
+    input = half_range_clamp(input, &status);
+    plc_half_t input_h = plc_float_to_half(input);
+
+    if (plc_half_is_nan(bank->prev_input[i])) {
+        bank->prev_input[i] = input_h;
+        bank->filtered_output[i] = 0u;
+        bank->status[i] = (int8_t)status;
+        *output = 0.0f;
+        return;
+    }
+
+    float prev = plc_half_to_float(bank->prev_input[i]);
+    float raw_derivative = (input - prev) * bank->inv_sample_time;
+
+    plc_half_t old_h = bank->filtered_output[i];
+    float filtered = plc_half_to_float(old_h);
+    float alpha = plc_half_to_float(bank->alpha[i]);
+    float value = filtered + alpha * (raw_derivative - filtered);
+
+    value = half_range_clamp(value, &status);
+    raw_derivative = half_range_clamp(raw_derivative, &status);
+
+    plc_half_t new_h = half_converge(old_h, filtered, value, raw_derivative);
+    bank->filtered_output[i] = new_h;
+    bank->prev_input[i] = input_h;
+    bank->status[i] = (int8_t)status;
+    *output = plc_half_to_float(new_h);
+}
+
+#if defined(BANK16_USE_F16C)
+/**
+ * @brief 执行 8 个 DERIVATIVE 实例（F16C 向量路径）
+ * @return true 已处理；false 整组需回退到标量路径
+ */
+static bool derivative_bank16_execute8(FB_DERIVATIVE_Bank16_t* bank, size_t i,
+                                       const float* input, float* output) {
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const __m256 half_max = _mm256_set1_ps(PLC_HALF_MAX);
+
+    __m256 u = _mm256_loadu_ps(input);
+    __m256 prev = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(const void*)&bank->prev_input[i]));
+
+    int valid = input_valid_mask8(u) & _mm256_movemask_ps(_mm256_cmp_ps(prev, prev, _CMP_ORD_Q));
+    if (valid != 0xFF) {
+        return false;
+    }
+
+    __m128i old_h = _mm_loadu_si128((const __m128i*)(const void*)&bank->filtered_output[i]);
+    __m256 filtered = _mm256_cvtph_ps(old_h);
+    __m256 alpha = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(const void*)&bank->alpha[i]));
+    __m256 raw = _mm256_mul_ps(_mm256_sub_ps(u, prev), _mm256_set1_ps(bank->inv_sample_time));
+    __m256 value = _mm256_add_ps(filtered, _mm256_mul_ps(alpha, _mm256_sub_ps(raw, filtered)));
+
+    /* 微分值超出 binary16 范围时交由标量路径钳位并置状态 */
+    __m256 in_range = _mm256_and_ps(
+        _mm256_cmp_ps(_mm256_and_ps(raw, abs_mask), half_max, _CMP_LE_OQ),
+        _mm256_cmp_ps(_mm256_and_ps(value, abs_mask), half_max, _CMP_LE_OQ));
+    if (_mm256_movemask_ps(in_range) != 0xFF) {
+        return false;
+    }
+
+    __m128i new_h = half_converge8(old_h, filtered, value, raw);
+    _mm_storeu_si128((__m128i*)(void*)&bank->filtered_output[i], new_h);
+    _mm_storeu_si128((__m128i*)(void*)&bank->prev_input[i],
+                     _mm256_cvtps_ph(u, _MM_FROUND_TO_NEAREST_INT));
+    _mm256_storeu_ps(output, _mm256_cvtph_ps(new_h));
+    memset(&bank->status[i], (int)FB_STATUS_OK, 8);
+    return true;
+}
+#endif
+
+void FB_DERIVATIVE_Bank16_Execute(FB_DERIVATIVE_Bank16_t* bank, const float* input, float* output) {
+    size_t i = 0;
+
+#if defined(BANK16_USE_F16C)
+    for (; i + 8 <= bank->count; i += 8) {
+        if (!derivative_bank16_execute8(bank, i, &input[i], &output[i])) {
+            for (size_t k = i; k < i + 8; k++) {
+                derivative_bank16_execute_one(bank, k, input[k], &output[k]);
+            }
+        }
+    }
+#endif
+
+    for (; i < bank->count; i++) {
+        derivative_bank16_execute_one(bank, i, input[i], &output[i]);
+    }
+}
@@ -0,0 +1,680 @@
+/**
+ * @file fb_bank_f32.c
+ * @brief PID / PT1 / DERIVATIVE / LIMIT float32 批量实例实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 实现说明：
+ * 1. 标量路径逐实例执行，与 pid_execute / pt1_execute / derivative_execute /
+ *    limit_execute 的语句一一对应（首次运行、手动模式、NaN/Inf）
+ * 2. AArch64 NEON 路径每 4 个实例一组：仅当整组输入有限、且均不处于首次运行 /
+ *    手动模式时走向量路径，否则整组回退到标量路径；向量路径的每个 if 都改写为
+ *    逐通道比较 + BSL 选择，运算顺序与标量路径相同，因此两条路径逐位一致
+ * 3. 向量运算经 v4_xxx 包装函数访问；定义 PLCOPEN_BANK32_EMULATE_NEON 时以
+ *    4 元素 C 数组模拟这些函数，向量路径可在主机上编译并与标量功能块对照（仅用于测试）
+ */
+
+#include "plcopen/fb_bank_f32.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define BANK32_USE_NEON 1
+    #define BANK32_USE_VECTOR 1
+#elif defined(PLCOPEN_BANK32_EMULATE_NEON)
+    #define BANK32_USE_VECTOR 1
+#endif
+
+/* ========== 4 通道向量包装 ========== */
+
+#if defined(BANK32_USE_NEON)
+typedef float32x4_t v4f;
+typedef uint32x4_t v4m;
+
+static inline v4f v4_load(const float* p) { return vld1q_f32(p); }
+static inline void v4_store(float* p, v4f a) { vst1q_f32(p, a); }
+static inline v4f v4_dup(float x) { return vdupq_n_f32(x); }
+static inline v4f v4_add(v4f a, v4f b) { return vaddq_f32(a, b); }
+static inline v4f v4_sub(v4f a, v4f b) { return vsubq_f32(a, b); }
+static inline v4f v4_mul(v4f a, v4f b) { return vmulq_f32(a, b); }
+static inline v4f v4_div(v4f a, v4f b) { return vdivq_f32(a, b); }
+static inline v4f v4_neg(v4f a) { return vnegq_f32(a); }
+static inline v4m v4_lt(v4f a, v4f b) { return vcltq_f32(a, b); }
+static inline v4m v4_gt(v4f a, v4f b) { return vcgtq_f32(a, b); }
+static inline v4m v4_and(v4m a, v4m b) { return vandq_u32(a, b); }
+static inline v4m v4_or(v4m a, v4m b) { return vorrq_u32(a, b); }
+static inline v4m v4_andnot(v4m a, v4m b) { return vbicq_u32(a, b); }   /* a & ~b */
+static inline v4f v4_sel(v4m m, v4f a, v4f b) { return vbslq_f32(m, a, b); }
+
+/** 4 个通道均为有限值（NaN 比较为假） */
+static inline bool v4_all_finite(v4f a) {
+    return vminvq_u32(vcleq_f32(vabsq_f32(a), vdupq_n_f32(FLT_MAX))) != 0u;
+}
+
+/** 4 个相邻实例的标志字节中 bit 是否置位，展开为通道掩码 */
+static inline v4m v4_flag_mask(const uint8_t* flags, uint8_t bit) {
+    uint32_t word;
+    memcpy(&word, flags, sizeof(word));
+    uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32(word));
+    uint32x4_t lanes = vmovl_u16(vget_low_u16(vmovl_u8(bytes)));
+    return vtstq_u32(lanes, vdupq_n_u32(bit));
+}
+
+/** 按上 / 下限饱和掩码写 4 个状态码（OK=0，LIMIT_HI=1，LIMIT_LO=2） */
+static inline void v4_store_status(int8_t* status, v4m hi, v4m lo) {
+    uint32x4_t code = vorrq_u32(vandq_u32(hi, vdupq_n_u32((uint32_t)FB_STATUS_LIMIT_HI)),
+                                vandq_u32(lo, vdupq_n_u32((uint32_t)FB_STATUS_LIMIT_LO)));
+    uint16x4_t narrow = vmovn_u32(code);
+    uint8x8_t bytes = vmovn_u16(vcombine_u16(narrow, narrow));
+    uint32_t word = vget_lane_u32(vreinterpret_u32_u8(bytes), 0);
+    memcpy(status, &word, sizeof(word));
+}
+#elif defined(BANK32_USE_VECTOR)
+/* ---------- PLCOPEN_BANK32_EMULATE_NEON：与上面的 NEON 包装逐通道等价 ---------- */
+typedef struct { float f[4]; } v4f;
+typedef struct { uint32_t m[4]; } v4m;
+
+#define V4_MAP_F(expr) do { for (int k = 0; k < 4; k++) { r.f[k] = (expr); } } while (0)
+#define V4_MAP_M(expr) do { for (int k = 0; k < 4; k++) { r.m[k] = (expr); } } while (0)
+
+static inline v4f v4_load(const float* p) { v4f r; memcpy(r.f, p, sizeof(r.f)); return r; }
+static inline void v4_store(float* p, v4f a) { memcpy(p, a.f, sizeof(a.f)); }
+static inline v4f v4_dup(float x) { v4f r; V4_MAP_F(x); return r; }
+static inline v4f v4_add(v4f a, v4f b) { v4f r; V4_MAP_F(a.f[k] + b.f[k]); return r; }
+static inline v4f v4_sub(v4f a, v4f b) { v4f r; V4_MAP_F(a.f[k] - b.f[k]); return r; }
+static inline v4f v4_mul(v4f a, v4f b) { v4f r; V4_MAP_F(a.f[k] * b.f[k]); return r; }
+static inline v4f v4_div(v4f a, v4f b) { v4f r; V4_MAP_F(a.f[k] / b.f[k]); return r; }
+static inline v4f v4_neg(v4f a) { v4f r; V4_MAP_F(-a.f[k]); return r; }
+static inline v4m v4_lt(v4f a, v4f b) { v4m r; V4_MAP_M(a.f[k] < b.f[k] ? ~0u : 0u); return r; }
+static inline v4m v4_gt(v4f a, v4f b) { v4m r; V4_MAP_M(a.f[k] > b.f[k] ? ~0u : 0u); return r; }
+static inline v4m v4_and(v4m a, v4m b) { v4m r; V4_MAP_M(a.m[k] & b.m[k]); return r; }
+static inline v4m v4_or(v4m a, v4m b) { v4m r; V4_MAP_M(a.m[k] | b.m[k]); return r; }
+static inline v4m v4_andnot(v4m a, v4m b) { v4m r; V4_MAP_M(a.m[k] & ~b.m[k]); return r; }
+static inline v4f v4_sel(v4m m, v4f a, v4f b) { v4f r; V4_MAP_F(m.m[k] ? a.f[k] : b.f[k]); return r; }
+
+static inline bool v4_all_finite(v4f a) {
+    bool all = true;
+    for (int k = 0; k < 4; k++) {
+        all = all && (fabsf(a.f[k]) <= FLT_MAX);
+    }
+    return all;
+}
+
+static inline v4m v4_flag_mask(const uint8_t* flags, uint8_t bit) {
+    v4m r;
+    V4_MAP_M((flags[k] & bit) ? ~0u : 0u);
+    return r;
+}
+
+static inline void v4_store_status(int8_t* status, v4m hi, v4m lo) {
+    for (int k = 0; k < 4; k++) {
+        status[k] = (int8_t)(hi.m[k] ? FB_STATUS_LIMIT_HI : (lo.m[k] ? FB_STATUS_LIMIT_LO : FB_STATUS_OK));
+    }
+}
+#endif
+
+#if defined(BANK32_USE_VECTOR)
+/** 与 clamp_output 相同：先比下限，NaN 原样通过 */
+static inline v4f v4_clamp(v4f a, v4f lo, v4f hi) {
+    return v4_sel(v4_lt(a, lo), lo, v4_sel(v4_gt(a, hi), hi, a));
+}
+
+/** 4 个相邻实例的标志字节均不含 mask 中的任何位 */
+static inline bool flags_clear4(const uint8_t* flags, uint8_t mask) {
+    uint32_t word;
+    memcpy(&word, flags, sizeof(word));
+    return (word & (mask * 0x01010101u)) == 0u;
+}
+#endif
+
+/* ========== PID ========== */
+
+FB_Status_t FB_PID_Bank32_Init(FB_PID_Bank32_t* bank, float* floats, uint8_t* flags,
+                               int8_t* status, size_t count, float sample_time) {
+    if (bank == NULL || floats == NULL || flags == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (sample_time <= 0.0f || sample_time >= MAX_SAMPLE_TIME) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->kp = floats;
+    bank->ki = floats + count;
+    bank->kd = floats + 2 * count;
+    bank->out_min = floats + 3 * count;
+    bank->out_max = floats + 4 * count;
+    bank->int_min = floats + 5 * count;
+    bank->int_max = floats + 6 * count;
+    bank->integral = floats + 7 * count;
+    bank->prev_measurement = floats + 8 * count;
+    bank->prev_output = floats + 9 * count;
+    bank->flags = flags;
+    bank->status = status;
+    bank->count = count;
+    bank->sample_time = sample_time;
+
+    const FB_PID_Config_t defaults = {
+        .kp = 1.0f, .ki = 0.0f, .kd = 0.0f, .sample_time = sample_time,
+        .out_min = 0.0f, .out_max = 100.0f, .int_min = 0.0f, .int_max = 100.0f
+    };
+    for (size_t i = 0; i < count; i++) {
+        FB_PID_Bank32_Configure(bank, i, &defaults);
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_PID_Bank32_Configure(FB_PID_Bank32_t* bank, size_t index,
+                                    const FB_PID_Config_t* config) {
+    if (bank == NULL || index >= bank->count || FB_PID_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (config->sample_time != bank->sample_time) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->kp[index] = config->kp;
+    bank->ki[index] = config->ki;
+    bank->kd[index] = config->kd;
+    bank->out_min[index] = config->out_min;
+    bank->out_max[index] = config->out_max;
+    bank->int_min[index] = config->int_min;
+    bank->int_max[index] = config->int_max;
+    bank->integral[index] = 0.0f;
+    bank->prev_measurement[index] = 0.0f;
+    bank->prev_output[index] = 0.0f;
+    bank->flags[index] = FB_BANK32_FIRST_RUN;
+    bank->status[index] = (int8_t)FB_STATUS_OK;
+
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 PID 实例（标量路径，与 pid_execute 逐句对应）
+ */
+static float pid_bank32_execute_one(FB_PID_Bank32_t* bank, size_t i,
+                                    float setpoint, float measurement) {
+    if (check_nan(setpoint) || check_nan(measurement)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_NAN;
+        return 0.0f;
+    }
+
+    if (check_inf(setpoint) || check_inf(measurement)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_INF;
+        return 0.0f;
+    }
+
+    if (bank->flags[i] & FB_BANK32_MANUAL) {
+        return bank->prev_output[i];
+    }
+
+    if (bank->flags[i] & FB_BANK32_FIRST_RUN) {
+        bank->prev_measurement[i] = measurement;
+        bank->prev_output[i] = clamp_output(measurement, bank->out_min[i], bank->out_max[i]);
+        bank->integral[i] = 0.0f;
+        bank->flags[i] = (uint8_t)(bank->flags[i] & ~FB_BANK32_FIRST_RUN);
+        bank->status[i] = (int8_t)FB_STATUS_OK;
+        return bank->prev_output[i];
+    }
+
+    float error = setpoint - measurement;
+    float p_term = bank->kp[i] * error;
+
+    float d_term = 0.0f;
+    if (bank->kd[i] > 0.0f) {
+        float d_measurement = (measurement - bank->prev_measurement[i]) / bank->sample_time;
+        d_term = -bank->kd[i] * d_measurement;
+    }
+
+    float output_without_integral = p_term + d_term;
+    float integral = clamp_output(bank->integral[i], bank->int_min[i], bank->int_max[i]);
+    float desired_output = output_without_integral + integral;
+    float output = clamp_output(desired_output, bank->out_min[i], bank->out_max[i]);
+
+    bool output_saturated_hi = (desired_output > bank->out_max[i]);
+    bool output_saturated_lo = (desired_output < bank->out_min[i]);
+
+    bool should_integrate = true;
+    if (output_saturated_hi && error > 0.0f) {
+        should_integrate = false;
+    }
+    if (output_saturated_lo && error < 0.0f) {
+        should_integrate = false;
+    }
+
+    if (should_integrate && bank->ki[i] > 0.0f) {
+        integral += bank->ki[i] * error * bank->sample_time;
+        integral = clamp_output(integral, bank->int_min[i], bank->int_max[i]);
+    }
+    bank->integral[i] = integral;
+
+    if (output_saturated_hi) {
+        bank->status[i] = (int8_t)FB_STATUS_LIMIT_HI;
+    } else if (output_saturated_lo) {
+        bank->status[i] = (int8_t)FB_STATUS_LIMIT_LO;
+    } else {
+        bank->status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    bank->prev_measurement[i] = measurement;
+    bank->prev_output[i] = output;
+    return output;
+}
+
+#if defined(BANK32_USE_VECTOR)
+/**
+ * @brief 执行 4 个 PID 实例（向量路径）
+ * @return true 已处理；false 整组需回退到标量路径
+ */
+static bool pid_bank32_execute4(FB_PID_Bank32_t* bank, size_t i, const float* setpoint,
+                                const float* measurement, float* output) {
+    if (!flags_clear4(&bank->flags[i], FB_BANK32_FIRST_RUN | FB_BANK32_MANUAL)) {
+        return false;
+    }
+
+    v4f sp = v4_load(setpoint);
+    v4f pv = v4_load(measurement);
+    if (!v4_all_finite(sp) || !v4_all_finite(pv)) {
+        return false;
+    }
+
+    const v4f zero = v4_dup(0.0f);
+    v4f kp = v4_load(&bank->kp[i]);
+    v4f ki = v4_load(&bank->ki[i]);
+    v4f kd = v4_load(&bank->kd[i]);
+    v4f out_min = v4_load(&bank->out_min[i]);
+    v4f out_max = v4_load(&bank->out_max[i]);
+    v4f int_min = v4_load(&bank->int_min[i]);
+    v4f int_max = v4_load(&bank->int_max[i]);
+    v4f ts = v4_dup(bank->sample_time);
+
+    v4f error = v4_sub(sp, pv);
+    v4f p_term = v4_mul(kp, error);
+
+    /* Kd = 0 的通道微分项为 +0（不计算 -Kd·dPV，避免 0·Inf） */
+    v4f d_measurement = v4_div(v4_sub(pv, v4_load(&bank->prev_measurement[i])), ts);
+    v4f d_term = v4_sel(v4_gt(kd, zero), v4_mul(v4_neg(kd), d_measurement), zero);
+
+    v4f integral = v4_clamp(v4_load(&bank->integral[i]), int_min, int_max);
+    v4f desired = v4_add(v4_add(p_term, d_term), integral);
+    v4f out = v4_clamp(desired, out_min, out_max);
+
+    v4m hi = v4_gt(desired, out_max);
+    v4m lo = v4_lt(desired, out_min);
+    v4m stop = v4_or(v4_and(hi, v4_gt(error, zero)), v4_and(lo, v4_lt(error, zero)));
+    v4m integrate = v4_andnot(v4_gt(ki, zero), stop);
+
+    v4f integrated = v4_clamp(v4_add(integral, v4_mul(v4_mul(ki, error), ts)), int_min, int_max);
+    integral = v4_sel(integrate, integrated, integral);
+
+    v4_store(&bank->integral[i], integral);
+    v4_store(&bank->prev_measurement[i], pv);
+    v4_store(&bank->prev_output[i], out);
+    v4_store(output, out);
+    v4_store_status(&bank->status[i], hi, lo);
+    return true;
+}
+#endif
+
+void FB_PID_Bank32_Execute(FB_PID_Bank32_t* bank, const float* setpoint,
+                           const float* measurement, float* output) {
+    size_t i = 0;
+
+#if defined(BANK32_USE_VECTOR)
+    for (; i + 4 <= bank->count; i += 4) {
+        if (!pid_bank32_execute4(bank, i, &setpoint[i], &measurement[i], &output[i])) {
+            for (size_t k = i; k < i + 4; k++) {
+                output[k] = pid_bank32_execute_one(bank, k, setpoint[k], measurement[k]);
+            }
+        }
+    }
+#endif
+
+    for (; i < bank->count; i++) {
+        output[i] = pid_bank32_execute_one(bank, i, setpoint[i], measurement[i]);
+    }
+}
+
+void FB_PID_Bank32_SetManual(FB_PID_Bank32_t* bank, size_t index, float manual_output) {
+    manual_output = clamp_output(manual_output, bank->out_min[index], bank->out_max[index]);
+    bank->integral[index] = clamp_output(manual_output, bank->int_min[index], bank->int_max[index]);
+    bank->prev_output[index] = manual_output;
+    bank->flags[index] = (uint8_t)(bank->flags[index] | FB_BANK32_MANUAL);
+    bank->status[index] = (int8_t)FB_STATUS_OK;
+}
+
+void FB_PID_Bank32_SetAuto(FB_PID_Bank32_t* bank, size_t index) {
+    bank->flags[index] = (uint8_t)(bank->flags[index] & ~FB_BANK32_MANUAL);
+}
+
+/* ========== PT1 ========== */
+
+FB_Status_t FB_PT1_Bank32_Init(FB_PT1_Bank32_t* bank, float* floats, uint8_t* flags,
+                               int8_t* status, size_t count, float sample_time) {
+    if (bank == NULL || floats == NULL || flags == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (sample_time <= 0.0f || sample_time >= MAX_SAMPLE_TIME) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->output = floats;
+    bank->alpha = floats + count;
+    bank->flags = flags;
+    bank->status = status;
+    bank->count = count;
+    bank->sample_time = sample_time;
+
+    for (size_t i = 0; i < count; i++) {
+        bank->output[i] = 0.0f;
+        bank->alpha[i] = 1.0f;
+        flags[i] = FB_BANK32_FIRST_RUN;
+        status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_PT1_Bank32_Configure(FB_PT1_Bank32_t* bank, size_t index, float time_constant) {
+    if (bank == NULL || index >= bank->count) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (time_constant < MIN_VALID_VALUE) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    /* 与 pt1_execute 每次计算的 α 完全相同 */
+    bank->alpha[index] = bank->sample_time / (time_constant + bank->sample_time);
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 PT1 实例（标量路径，与 pt1_execute 逐句对应）
+ */
+static float pt1_bank32_execute_one(FB_PT1_Bank32_t* bank, size_t i, float input) {
+    if (check_nan(input)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_NAN;
+        return 0.0f;
+    }
+
+    if (check_inf(input)) {
+        bank->status[i] = (int8_t)FB_STATUS_ERROR_INF;
+        return 0.0f;
+    }
+
+    if (bank->flags[i] & FB_BANK32_FIRST_RUN) {
+        bank->output[i] = input;
+        bank->flags[i] = (uint8_t)(bank->flags[i] & ~FB_BANK32_FIRST_RUN);
+        bank->status[i] = (int8_t)FB_STATUS_OK;
+        return input;
+    }
+
+    bank->output[i] += bank->alpha[i] * (input - bank->output[i]);
+    bank->status[i] = (int8_t)FB_STATUS_OK;
+    return bank->output[i];
+}
+
+#if defined(BANK32_USE_VECTOR)
+/**
+ * @brief 执行 4 个 PT1 实例（向量路径）
+ * @return true 已处理；false 整组需回退到标量路径
+ */
+static bool pt1_bank32_execute4(FB_PT1_Bank32_t* bank, size_t i, const float* input, float* output) {
+    v4f u = v4_load(input);
+    if (!flags_clear4(&bank->flags[i], FB_BANK32_FIRST_RUN) || !v4_all_finite(u)) {
+        return false;
+    }
+
+    v4f y = v4_load(&bank->output[i]);
+    y = v4_add(y, v4_mul(v4_load(&bank->alpha[i]), v4_sub(u, y)));
+
+    v4_store(&bank->output[i], y);
+    v4_store(output, y);
+    memset(&bank->status[i], (int)FB_STATUS_OK, 4);
+    return true;
+}
+#endif
+
+void FB_PT1_Bank32_Execute(FB_PT1_Bank32_t* bank, const float* input, float* output) {
+    size_t i = 0;
+
+#if defined(BANK32_USE_VECTOR)
+    for (; i + 4 <= bank->count; i += 4) {
+        if (!pt1_bank32_execute4(bank, i, &input[i], &output[i])) {
+            for (size_t k = i; k < i + 4; k++) {
+                output[k] = pt1_bank32_execute_one(bank, k, input[k]);
+            }
+        }
+    }
+#endif
+
+    for (; i < bank->count; i++) {
+        output[i] = pt1_bank32_execute_one(bank, i, input[i]);
+    }
+}
+
+/* ========== DERIVATIVE ========== */
+
+FB_Status_t FB_DERIVATIVE_Bank32_Init(FB_DERIVATIVE_Bank32_t* bank, float* floats,
+                                      uint8_t* flags, int8_t* status,
+                                      size_t count, float sample_time) {
+    if (bank == NULL || floats == NULL || flags == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (sample_time <= 0.0f || sample_time >= MAX_SAMPLE_TIME) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->prev_input = floats;
+    bank->filtered_output = floats + count;
+    bank->alpha = floats + 2 * count;
+    bank->flags = flags;
+    bank->status = status;
+    bank->count = count;
+    bank->sample_time = sample_time;
+
+    for (size_t i = 0; i < count; i++) {
+        bank->prev_input[i] = 0.0f;
+        bank->filtered_output[i] = 0.0f;
+        bank->alpha[i] = 1.0f;
+        flags[i] = FB_BANK32_FIRST_RUN;
+        status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_DERIVATIVE_Bank32_Configure(FB_DERIVATIVE_Bank32_t* bank, size_t index,
+                                           float filter_time_constant) {
+    if (bank == NULL || index >= bank->count) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (filter_time_constant < 0.0f) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    /* 无滤波时直接输出原始微分（不经 α = 1 的更新式，与 derivative_execute 一致） */
+    bank->alpha[index] = bank->sample_time / (filter_time_constant + bank->sample_time);
+    if (filter_time_constant > 0.0f) {
+        bank->flags[index] = (uint8_t)(bank->flags[index] | FB_BANK32_FILTER);
+    } else {
+        bank->flags[index] = (uint8_t)(bank->flags[index] & ~FB_BANK32_FILTER);
+    }
+
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 DERIVATIVE 实例（标量路径，与 derivative_execute 逐句对应）
+ */
+static float derivative_bank32_execute_one(FB_DERIVATIVE_Bank32_t* bank, size_t i, float input) {
+    if (check_nan_inf(input)) {
+        bank->status[i] = (int8_t)(check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF);
+        return 0.0f;
+    }
+
+    if (bank->flags[i] & FB_BANK32_FIRST_RUN) {
+        bank->prev_input[i] = input;
+        bank->filtered_output[i] = 0.0f;
+        bank->flags[i] = (uint8_t)(bank->flags[i] & ~FB_BANK32_FIRST_RUN);
+        bank->status[i] = (int8_t)FB_STATUS_OK;
+        return 0.0f;
+    }
+
+    float raw_derivative = (input - bank->prev_input[i]) / bank->sample_time;
+
+    if (bank->flags[i] & FB_BANK32_FILTER) {
+        bank->filtered_output[i] += bank->alpha[i] * (raw_derivative - bank->filtered_output[i]);
+    } else {
+        bank->filtered_output[i] = raw_derivative;
+    }
+
+    bank->prev_input[i] = input;
+    bank->status[i] = (int8_t)FB_STATUS_OK;
+    return bank->filtered_output[i];
+}
+
+#if defined(BANK32_USE_VECTOR)
+/**
+ * @brief 执行 4 个 DERIVATIVE 实例（向量路径）
+ * @return true 已处理；false 整组需回退到标量路径
+ */
+static bool derivative_bank32_execute4(FB_DERIVATIVE_Bank32_t* bank, size_t i,
+                                       const float* input, float* output) {
+    v4f u = v4_load(input);
+    if (!flags_clear4(&bank->flags[i], FB_BANK32_FIRST_RUN) || !v4_all_finite(u)) {
+        return false;
+    }
+
+    v4f raw = v4_div(v4_sub(u, v4_load(&bank->prev_input[i])), v4_dup(bank->sample_time));
+    v4f filtered = v4_load(&bank->filtered_output[i]);
+    filtered = v4_add(filtered, v4_mul(v4_load(&bank->alpha[i]), v4_sub(raw, filtered)));
+    filtered = v4_sel(v4_flag_mask(&bank->flags[i], FB_BANK32_FILTER), filtered, raw);
+
+    v4_store(&bank->filtered_output[i], filtered);
+    v4_store(&bank->prev_input[i], u);
+    v4_store(output, filtered);
+    memset(&bank->status[i], (int)FB_STATUS_OK, 4);
+    return true;
+}
+#endif
+
+void FB_DERIVATIVE_Bank32_Execute(FB_DERIVATIVE_Bank32_t* bank, const float* input, float* output) {
+    size_t i = 0;
+
+#if defined(BANK32_USE_VECTOR)
+    for (; i + 4 <= bank->count; i += 4) {
+        if (!derivative_bank32_execute4(bank, i, &input[i], &output[i])) {
+            for (size_t k = i; k < i + 4; k++) {
+                output[k] = derivative_bank32_execute_one(bank, k, input[k]);
+            }
+        }
+    }
+#endif
+
+    for (; i < bank->count; i++) {
+        output[i] = derivative_bank32_execute_one(bank, i, input[i]);
+    }
+}
+
+/* ========== LIMIT ========== */
+
+FB_Status_t FB_LIMIT_Bank32_Init(FB_LIMIT_Bank32_t* bank, float* floats, int8_t* status,
+                                 size_t count) {
+    if (bank == NULL || floats == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->min_val = floats;
+    bank->max_val = floats + count;
+    bank->status = status;
+    bank->count = count;
+
+    for (size_t i = 0; i < count; i++) {
+        bank->min_val[i] = -FLT_MAX;
+        bank->max_val[i] = FLT_MAX;
+        status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_LIMIT_Bank32_Configure(FB_LIMIT_Bank32_t* bank, size_t index,
+                                      float min_val, float max_val) {
+    if (bank == NULL || index >= bank->count || max_val <= min_val) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->min_val[index] = min_val;
+    bank->max_val[index] = max_val;
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 LIMIT 实例（标量路径，与 limit_execute 逐句对应）
+ */
+static float limit_bank32_execute_one(FB_LIMIT_Bank32_t* bank, size_t i, float input) {
+    if (check_nan_inf(input)) {
+        bank->status[i] = (int8_t)(check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF);
+        return 0.0f;
+    }
+
+    if (input > bank->max_val[i]) {
+        bank->status[i] = (int8_t)FB_STATUS_LIMIT_HI;
+        return bank->max_val[i];
+    } else if (input < bank->min_val[i]) {
+        bank->status[i] = (int8_t)FB_STATUS_LIMIT_LO;
+        return bank->min_val[i];
+    }
+
+    bank->status[i] = (int8_t)FB_STATUS_OK;
+    return input;
+}
+
+#if defined(BANK32_USE_VECTOR)
+/**
+ * @brief 执行 4 个 LIMIT 实例（向量路径）
+ * @return true 已处理；false 整组需回退到标量路径
+ */
+static bool limit_bank32_execute4(FB_LIMIT_Bank32_t* bank, size_t i, const float* input, float* output) {
+    v4f u = v4_load(input);
+    if (!v4_all_finite(u)) {
+        return false;
+    }
+
+    v4f lo_val = v4_load(&bank->min_val[i]);
+    v4f hi_val = v4_load(&bank->max_val[i]);
+    v4m hi = v4_gt(u, hi_val);
+    v4m lo = v4_andnot(v4_lt(u, lo_val), hi);
+
+    v4_store(output, v4_sel(hi, hi_val, v4_sel(lo, lo_val, u)));
+    v4_store_status(&bank->status[i], hi, lo);
+    return true;
+}
+#endif
+
+void FB_LIMIT_Bank32_Execute(FB_LIMIT_Bank32_t* bank, const float* input, float* output) {
+    size_t i = 0;
+
+#if defined(BANK32_USE_VECTOR)
+    for (; i + 4 <= bank->count; i += 4) {
+        if (!limit_bank32_execute4(bank, i, &input[i], &output[i])) {
+            for (size_t k = i; k < i + 4; k++) {
+                output[k] = limit_bank32_execute_one(bank, k, input[k]);
+            }
+        }
+    }
+#endif
+
+    for (; i < bank->count; i++) {
+        output[i] = limit_bank32_execute_one(bank, i, input[i]);
+    }
+}
@@ -0,0 +1,394 @@
+/**
+ * @file fb_bank_q15.c
+ * @brief PT1 / LIMIT / DEADBAND Q15 定点批量实例实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 实现说明：
+ * 1. 参考实现逐实例执行，所有中间量在 int32 中计算，显式饱和
+ * 2. DSP 路径每对相邻实例一组（小端：低半字为偶数索引实例），与参考实现
+ *    使用相同的舍入和饱和规则，因此两条路径逐位一致
+ * 3. SSUB16 / SADD16 按每个半字的结果符号设置 APSR.GE，随后的 SEL 按 GE
+ *    逐半字选择，实现两路比较选择而不产生分支
+ * 4. 定义 PLCOPEN_Q15_EMULATE_DSP 时以 C 函数模拟上述指令，DSP 路径可在
+ *    主机上编译并与参考实现对照（仅用于测试）
+ */
+
+#include "plcopen/fb_bank_q15.h"
+#include <string.h>
+
+#if defined(__ARM_FEATURE_SIMD32) && defined(__ARM_FEATURE_SAT)
+    #include <arm_acle.h>
+    #define BANKQ15_USE_DSP 1
+    #define q15_smlad(x, y, acc) __smlad((int16x2_t)(x), (int16x2_t)(y), (acc))
+    #define q15_ssub16(a, b)     ((uint32_t)__ssub16((int16x2_t)(a), (int16x2_t)(b)))
+    #define q15_sadd16(a, b)     ((uint32_t)__sadd16((int16x2_t)(a), (int16x2_t)(b)))
+    #define q15_qadd16(a, b)     ((uint32_t)__qadd16((int16x2_t)(a), (int16x2_t)(b)))
+    #define q15_qsub16(a, b)     ((uint32_t)__qsub16((int16x2_t)(a), (int16x2_t)(b)))
+    #define q15_sel(a, b)        ((uint32_t)__sel((uint8x4_t)(a), (uint8x4_t)(b)))
+    #define q15_ssat16(x)        __ssat((x), 16)
+#elif defined(PLCOPEN_Q15_EMULATE_DSP)
+    #define BANKQ15_USE_DSP 1
+#endif
+
+/* Q15 乘积右移 15 位前的舍入常数 */
+#define Q15_HALF (1 << 14)
+
+static inline int32_t sat16(int32_t value) {
+    return value > PLC_Q15_MAX ? PLC_Q15_MAX : (value < PLC_Q15_MIN ? PLC_Q15_MIN : value);
+}
+
+#if defined(BANKQ15_USE_DSP) && !defined(__ARM_FEATURE_SIMD32)
+/* ========== DSP 指令模拟（PLCOPEN_Q15_EMULATE_DSP） ========== */
+
+/* APSR.GE：每个置位的半字对应 0xFFFF */
+static uint32_t emulated_ge;
+
+static inline int32_t lane(uint32_t packed, int k) {
+    return (int16_t)(uint16_t)(packed >> (16 * k));
+}
+
+static inline uint32_t pack(int32_t lo, int32_t hi) {
+    return (uint32_t)(uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+static inline int32_t q15_smlad(uint32_t x, uint32_t y, int32_t acc) {
+    int64_t sum = (int64_t)acc + (int64_t)lane(x, 0) * lane(y, 0) + (int64_t)lane(x, 1) * lane(y, 1);
+    return (int32_t)(uint32_t)sum;
+}
+
+static inline uint32_t set_ge(int32_t r0, int32_t r1) {
+    emulated_ge = (r0 >= 0 ? 0x0000FFFFu : 0u) | (r1 >= 0 ? 0xFFFF0000u : 0u);
+    return pack(r0, r1);
+}
+
+static inline uint32_t q15_ssub16(uint32_t a, uint32_t b) {
+    return set_ge(lane(a, 0) - lane(b, 0), lane(a, 1) - lane(b, 1));
+}
+
+static inline uint32_t q15_sadd16(uint32_t a, uint32_t b) {
+    return set_ge(lane(a, 0) + lane(b, 0), lane(a, 1) + lane(b, 1));
+}
+
+static inline uint32_t q15_qadd16(uint32_t a, uint32_t b) {
+    return pack(sat16(lane(a, 0) + lane(b, 0)), sat16(lane(a, 1) + lane(b, 1)));
+}
+
+static inline uint32_t q15_qsub16(uint32_t a, uint32_t b) {
+    return pack(sat16(lane(a, 0) - lane(b, 0)), sat16(lane(a, 1) - lane(b, 1)));
+}
+
+static inline uint32_t q15_sel(uint32_t a, uint32_t b) {
+    return (a & emulated_ge) | (b & ~emulated_ge);
+}
+
+static inline int32_t q15_ssat16(int32_t x) {
+    return sat16(x);
+}
+#endif
+
+#if defined(BANKQ15_USE_DSP)
+/* 成对访问相邻两个 Q15 元素（Cortex-M4 的 LDR/STR 允许非对齐访问） */
+static inline uint32_t load_pair(const plc_q15_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void store_pair(plc_q15_t* p, uint32_t v) {
+    memcpy(p, &v, sizeof(v));
+}
+#endif
+
+/* ========== PT1 ========== */
+
+FB_Status_t FB_PT1_BankQ15_Init(FB_PT1_BankQ15_t* bank, plc_q15_t* output,
+                                uint32_t* coef, size_t count, float sample_time) {
+    if (bank == NULL || output == NULL || coef == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (sample_time <= 0.0f || sample_time >= MAX_SAMPLE_TIME) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->output = output;
+    bank->coef = coef;
+    bank->count = count;
+    bank->sample_time = sample_time;
+    bank->first_run = true;
+
+    for (size_t i = 0; i < count; i++) {
+        output[i] = 0;
+        coef[i] = 1u | ((uint32_t)PLC_Q15_MAX << 16);
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_PT1_BankQ15_Configure(FB_PT1_BankQ15_t* bank, size_t index,
+                                     float time_constant) {
+    if (bank == NULL || index >= bank->count) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (time_constant < MIN_VALID_VALUE) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    /* 与 FB_PT1 相同的前向欧拉系数，量化为 Q15；1-α 与 α 之和恰为 1.0 */
+    float alpha = bank->sample_time / (time_constant + bank->sample_time);
+    int32_t alpha_q = (int32_t)(alpha * 32768.0f + 0.5f);
+    alpha_q = alpha_q < 1 ? 1 : (alpha_q > PLC_Q15_MAX ? PLC_Q15_MAX : alpha_q);
+    bank->coef[index] = (uint32_t)(32768 - alpha_q) | ((uint32_t)alpha_q << 16);
+
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 收敛舍入：舍入后状态未变而输入不同时，向输入前进 1 LSB
+ */
+static inline plc_q15_t pt1_q15_converge(int32_t next, int32_t y, int32_t u) {
+    if (next == y && u != y) {
+        next += (u > y) ? 1 : -1;
+    }
+    return (plc_q15_t)next;
+}
+
+/**
+ * @brief 执行单个 PT1 实例（参考实现）
+ */
+static inline plc_q15_t pt1_q15_one(plc_q15_t y, plc_q15_t u, uint32_t coef) {
+    int32_t beta = (int16_t)(uint16_t)(coef & 0xFFFFu);
+    int32_t alpha = (int16_t)(uint16_t)(coef >> 16);
+    int32_t acc = beta * y + alpha * u + Q15_HALF;
+    return pt1_q15_converge(sat16(acc >> 15), y, u);
+}
+
+/**
+ * @brief 首次运行：输出 = 输入，无跳变启动
+ */
+static void pt1_q15_first_run(FB_PT1_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output) {
+    for (size_t i = 0; i < bank->count; i++) {
+        bank->output[i] = input[i];
+        output[i] = input[i];
+    }
+    bank->first_run = false;
+}
+
+void FB_PT1_BankQ15_ExecuteRef(FB_PT1_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output) {
+    if (bank->first_run) {
+        pt1_q15_first_run(bank, input, output);
+        return;
+    }
+
+    for (size_t i = 0; i < bank->count; i++) {
+        plc_q15_t y = pt1_q15_one(bank->output[i], input[i], bank->coef[i]);
+        bank->output[i] = y;
+        output[i] = y;
+    }
+}
+
+void FB_PT1_BankQ15_Execute(FB_PT1_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output) {
+#if defined(BANKQ15_USE_DSP)
+    if (bank->first_run) {
+        pt1_q15_first_run(bank, input, output);
+        return;
+    }
+
+    size_t i = 0;
+    for (; i + 2 <= bank->count; i += 2) {
+        uint32_t y = load_pair(&bank->output[i]);
+        uint32_t u = load_pair(&input[i]);
+
+        /* 每个实例打包 (y, u)，SMLAD 一条指令完成 (1-α)·y + α·u */
+        uint32_t yu0 = (y & 0xFFFFu) | (u << 16);
+        uint32_t yu1 = (y >> 16) | (u & 0xFFFF0000u);
+        int32_t n0 = q15_ssat16(q15_smlad(yu0, bank->coef[i], Q15_HALF) >> 15);
+        int32_t n1 = q15_ssat16(q15_smlad(yu1, bank->coef[i + 1], Q15_HALF) >> 15);
+
+        plc_q15_t y0 = pt1_q15_converge(n0, (int16_t)(uint16_t)y, (int16_t)(uint16_t)u);
+        plc_q15_t y1 = pt1_q15_converge(n1, (int16_t)(uint16_t)(y >> 16),
+                                        (int16_t)(uint16_t)(u >> 16));
+        uint32_t packed = (uint32_t)(uint16_t)y0 | ((uint32_t)(uint16_t)y1 << 16);
+        store_pair(&bank->output[i], packed);
+        store_pair(&output[i], packed);
+    }
+
+    if (i < bank->count) {
+        plc_q15_t y = pt1_q15_one(bank->output[i], input[i], bank->coef[i]);
+        bank->output[i] = y;
+        output[i] = y;
+    }
+#else
+    FB_PT1_BankQ15_ExecuteRef(bank, input, output);
+#endif
+}
+
+/* ========== LIMIT ========== */
+
+FB_Status_t FB_LIMIT_BankQ15_Init(FB_LIMIT_BankQ15_t* bank, plc_q15_t* min_val,
+                                  plc_q15_t* max_val, int8_t* status, size_t count) {
+    if (bank == NULL || min_val == NULL || max_val == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->min_val = min_val;
+    bank->max_val = max_val;
+    bank->status = status;
+    bank->count = count;
+
+    for (size_t i = 0; i < count; i++) {
+        min_val[i] = PLC_Q15_MIN;
+        max_val[i] = PLC_Q15_MAX;
+        status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_LIMIT_BankQ15_Configure(FB_LIMIT_BankQ15_t* bank, size_t index,
+                                       plc_q15_t min_val, plc_q15_t max_val) {
+    if (bank == NULL || index >= bank->count || max_val <= min_val) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->min_val[index] = min_val;
+    bank->max_val[index] = max_val;
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 LIMIT 实例（参考实现）
+ */
+static inline plc_q15_t limit_q15_one(FB_LIMIT_BankQ15_t* bank, size_t i, plc_q15_t u) {
+    if (u > bank->max_val[i]) {
+        bank->status[i] = (int8_t)FB_STATUS_LIMIT_HI;
+        return bank->max_val[i];
+    } else if (u < bank->min_val[i]) {
+        bank->status[i] = (int8_t)FB_STATUS_LIMIT_LO;
+        return bank->min_val[i];
+    }
+    bank->status[i] = (int8_t)FB_STATUS_OK;
+    return u;
+}
+
+void FB_LIMIT_BankQ15_ExecuteRef(FB_LIMIT_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output) {
+    for (size_t i = 0; i < bank->count; i++) {
+        output[i] = limit_q15_one(bank, i, input[i]);
+    }
+}
+
+#if defined(BANKQ15_USE_DSP)
+static inline int8_t limit_q15_status(uint32_t over, uint32_t under) {
+    return (int8_t)(over != 0u ? FB_STATUS_LIMIT_HI
+                               : (under != 0u ? FB_STATUS_LIMIT_LO : FB_STATUS_OK));
+}
+#endif
+
+void FB_LIMIT_BankQ15_Execute(FB_LIMIT_BankQ15_t* bank, const plc_q15_t* input, plc_q15_t* output) {
+#if defined(BANKQ15_USE_DSP)
+    size_t i = 0;
+    for (; i + 2 <= bank->count; i += 2) {
+        uint32_t u = load_pair(&input[i]);
+        uint32_t lo = load_pair(&bank->min_val[i]);
+        uint32_t hi = load_pair(&bank->max_val[i]);
+
+        (void)q15_ssub16(hi, u);                      /* GE：u <= hi */
+        uint32_t t = q15_sel(u, hi);
+        uint32_t over = q15_sel(0u, 0xFFFFFFFFu);
+        (void)q15_ssub16(t, lo);                      /* GE：min(u, hi) >= lo */
+        uint32_t out = q15_sel(t, lo);
+        uint32_t under = q15_sel(0u, 0xFFFFFFFFu);
+
+        store_pair(&output[i], out);
+        bank->status[i] = limit_q15_status(over & 0xFFFFu, under & 0xFFFFu);
+        bank->status[i + 1] = limit_q15_status(over >> 16, under >> 16);
+    }
+
+    if (i < bank->count) {
+        output[i] = limit_q15_one(bank, i, input[i]);
+    }
+#else
+    FB_LIMIT_BankQ15_ExecuteRef(bank, input, output);
+#endif
+}
+
+/* ========== DEADBAND ========== */
+
+FB_Status_t FB_DEADBAND_BankQ15_Init(FB_DEADBAND_BankQ15_t* bank, plc_q15_t* width,
+                                     plc_q15_t* center, size_t count) {
+    if (bank == NULL || width == NULL || center == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->width = width;
+    bank->center = center;
+    bank->count = count;
+
+    for (size_t i = 0; i < count; i++) {
+        width[i] = 0;
+        center[i] = 0;
+    }
+
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_DEADBAND_BankQ15_Configure(FB_DEADBAND_BankQ15_t* bank, size_t index,
+                                          plc_q15_t width, plc_q15_t center) {
+    if (bank == NULL || index >= bank->count || width < 0) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    bank->width[index] = width;
+    bank->center[index] = center;
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 执行单个 DEADBAND 实例（参考实现，偏差在 int32 中精确计算）
+ */
+static inline plc_q15_t deadband_q15_one(const FB_DEADBAND_BankQ15_t* bank, size_t i, plc_q15_t u) {
+    int32_t d = (int32_t)u - bank->center[i];
+    int32_t w = bank->width[i];
+    return (d <= w && d + w >= 0) ? bank->center[i] : u;
+}
+
+void FB_DEADBAND_BankQ15_ExecuteRef(FB_DEADBAND_BankQ15_t* bank, const plc_q15_t* input,
+                                    plc_q15_t* output) {
+    for (size_t i = 0; i < bank->count; i++) {
+        output[i] = deadband_q15_one(bank, i, input[i]);
+    }
+}
+
+void FB_DEADBAND_BankQ15_Execute(FB_DEADBAND_BankQ15_t* bank, const plc_q15_t* input,
+                                 plc_q15_t* output) {
+#if defined(BANKQ15_USE_DSP)
+    size_t i = 0;
+    for (; i + 2 <= bank->count; i += 2) {
+        uint32_t u = load_pair(&input[i]);
+        uint32_t w = load_pair(&bank->width[i]);
+        uint32_t c = load_pair(&bank->center[i]);
+
+        /*
+         * 不饱和偏差 u - c（可达 ±65535，饱和后在 width = 32767 时会误判为死区内），
+         * 而把 u 与饱和的边界 c ± w 比较：边界越出量程时饱和到 Q15 端点，
+         * 任何 u 都满足该侧条件，与 |u - c| <= w 的精确判定一致
+         */
+        uint32_t lo = q15_qsub16(c, w);
+        uint32_t hi = q15_qadd16(c, w);
+        (void)q15_ssub16(hi, u);                      /* GE：u <= c + w */
+        uint32_t below = q15_sel(0xFFFFFFFFu, 0u);
+        (void)q15_ssub16(u, lo);                      /* GE：u >= c - w */
+        uint32_t inside = q15_sel(below, 0u);
+
+        store_pair(&output[i], (c & inside) | (u & ~inside));
+    }
+
+    if (i < bank->count) {
+        output[i] = deadband_q15_one(bank, i, input[i]);
+    }
+#else
+    FB_DEADBAND_BankQ15_ExecuteRef(bank, input, output);
+#endif
+}
@@ -0,0 +1,296 @@
+/**
+ * @file fb_compact.c
+ * @brief 功能块紧凑实例实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 算法与 fb_pid.c / fb_pt1.c / fb_ramp.c / fb_integrator.c / fb_derivative.c
+ * 逐行对应，差别仅在于：
+ * - 配置验证复用 FB_xxx_ValidateConfig
+ * - Init 时预计算派生系数，Execute 中以乘法代替除法
+ * - 标志与状态码读写通过单字节 flags
+ */
+
+#include "plcopen/fb_compact.h"
+#include <stddef.h>
+#include <math.h>
+
+/* ========== PID ========== */
+
+FB_Status_t FB_PID_Compact_Init(FB_PID_Compact_t* fb, const FB_PID_Config_t* config) {
+    if (fb == NULL || FB_PID_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    fb->integral = 0.0f;
+    fb->prev_measurement = 0.0f;
+    fb->kp = config->kp;
+    fb->kd_over_ts = config->kd / config->sample_time;
+    fb->ki_ts = config->ki * config->sample_time;
+    fb->int_min = config->int_min;
+    fb->int_max = config->int_max;
+    fb->out_min = config->out_min;
+    fb->out_max = config->out_max;
+    fb->prev_output = 0.0f;
+    fb->flags = fb_flags_set_status(FB_FLAG_FIRST_RUN, FB_STATUS_OK);
+
+    return FB_STATUS_OK;
+}
+
+float FB_PID_Compact_Execute(FB_PID_Compact_t* fb, float setpoint, float measurement) {
+    uint8_t flags = fb->flags;
+
+    if (check_nan(setpoint) || check_nan(measurement)) {
+        fb->flags = fb_flags_set_status(flags, FB_STATUS_ERROR_NAN);
+        return 0.0f;
+    }
+
+    if (check_inf(setpoint) || check_inf(measurement)) {
+        fb->flags = fb_flags_set_status(flags, FB_STATUS_ERROR_INF);
+        return 0.0f;
+    }
+
+    if (flags & FB_FLAG_MANUAL) {
+        return fb->prev_output;
+    }
+
+    if (flags & FB_FLAG_FIRST_RUN) {
+        fb->prev_measurement = measurement;
+        fb->prev_output = clamp_output(measurement, fb->out_min, fb->out_max);
+        fb->integral = 0.0f;
+        fb->flags = fb_flags_set_status((uint8_t)(flags & ~FB_FLAG_FIRST_RUN), FB_STATUS_OK);
+        return fb->prev_output;
+    }
+
+    float error = setpoint - measurement;
+    float p_term = fb->kp * error;
+
+    /* 微分项先行：Kd/Ts 已预计算 */
+    float d_term = 0.0f;
+    if (fb->kd_over_ts > 0.0f) {
+        d_term = -fb->kd_over_ts * (measurement - fb->prev_measurement);
+    }
+
+    float integral = clamp_output(fb->integral, fb->int_min, fb->int_max);
+    float desired_output = p_term + d_term + integral;
+    float output = clamp_output(desired_output, fb->out_min, fb->out_max);
+
+    bool output_saturated_hi = (desired_output > fb->out_max);
+    bool output_saturated_lo = (desired_output < fb->out_min);
+
+    /* 条件积分法（同 FB_PID_Execute） */
+    bool should_integrate = true;
+    if (output_saturated_hi && error > 0.0f) {
+        should_integrate = false;
+    }
+    if (output_saturated_lo && error < 0.0f) {
+        should_integrate = false;
+    }
+
+    if (should_integrate && fb->ki_ts > 0.0f) {
+        integral = clamp_output(integral + fb->ki_ts * error, fb->int_min, fb->int_max);
+    }
+    fb->integral = integral;
+
+    FB_Status_t status = FB_STATUS_OK;
+    if (output_saturated_hi) {
+        status = FB_STATUS_LIMIT_HI;
+    } else if (output_saturated_lo) {
+        status = FB_STATUS_LIMIT_LO;
+    }
+    fb->flags = fb_flags_set_status(flags, status);
+
+    fb->prev_measurement = measurement;
+    fb->prev_output = output;
+
+    return output;
+}
+
+void FB_PID_Compact_SetManual(FB_PID_Compact_t* fb, float manual_output) {
+    manual_output = clamp_output(manual_output, fb->out_min, fb->out_max);
+
+    /* 积分器跟踪手动输出，实现无扰切换 */
+    fb->integral = clamp_output(manual_output, fb->int_min, fb->int_max);
+    fb->prev_output = manual_output;
+    fb->flags = fb_flags_set_status((uint8_t)(fb->flags | FB_FLAG_MANUAL), FB_STATUS_OK);
+}
+
+void FB_PID_Compact_SetAuto(FB_PID_Compact_t* fb) {
+    fb->flags = (uint8_t)(fb->flags & ~FB_FLAG_MANUAL);
+}
+
+/* ========== PT1 ========== */
+
+FB_Status_t FB_PT1_Compact_Init(FB_PT1_Compact_t* fb, const FB_PT1_Config_t* config) {
+    if (fb == NULL || FB_PT1_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    fb->output = 0.0f;
+    fb->alpha = config->sample_time / (config->time_constant + config->sample_time);
+    fb->flags = fb_flags_set_status(FB_FLAG_FIRST_RUN, FB_STATUS_OK);
+
+    return FB_STATUS_OK;
+}
+
+float FB_PT1_Compact_Execute(FB_PT1_Compact_t* fb, float input) {
+    if (check_nan(input)) {
+        fb->flags = fb_flags_set_status(fb->flags, FB_STATUS_ERROR_NAN);
+        return 0.0f;
+    }
+
+    if (check_inf(input)) {
+        fb->flags = fb_flags_set_status(fb->flags, FB_STATUS_ERROR_INF);
+        return 0.0f;
+    }
+
+    if (fb->flags & FB_FLAG_FIRST_RUN) {
+        fb->output = input;
+    } else {
+        fb->output += fb->alpha * (input - fb->output);
+    }
+
+    fb->flags = fb_flags_set_status(0u, FB_STATUS_OK);
+    return fb->output;
+}
+
+/* ========== RAMP ========== */
+
+FB_Status_t FB_RAMP_Compact_Init(FB_RAMP_Compact_t* fb, const FB_RAMP_Config_t* config) {
+    if (fb == NULL || FB_RAMP_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    fb->output = 0.0f;
+    fb->rise_step = config->rise_rate * config->sample_time;
+    fb->fall_step = config->fall_rate * config->sample_time;
+    fb->flags = fb_flags_set_status(FB_FLAG_FIRST_RUN, FB_STATUS_OK);
+
+    return FB_STATUS_OK;
+}
+
+float FB_RAMP_Compact_Execute(FB_RAMP_Compact_t* fb, float target) {
+    if (check_nan_inf(target)) {
+        fb->flags = fb_flags_set_status(fb->flags, check_nan(target) ? FB_STATUS_ERROR_NAN
+                                                                     : FB_STATUS_ERROR_INF);
+        return fb->output;
+    }
+
+    if (fb->flags & FB_FLAG_FIRST_RUN) {
+        fb->output = target;
+    } else {
+        float error = target - fb->output;
+        float max_change = (error > 0.0f) ? fb->rise_step : fb->fall_step;
+
+        if (fabsf(error) <= max_change) {
+            fb->output = target;
+        } else {
+            fb->output += (error > 0.0f) ? max_change : -max_change;
+        }
+    }
+
+    fb->flags = fb_flags_set_status(0u, FB_STATUS_OK);
+    return fb->output;
+}
+
+/* ========== INTEGRATOR ========== */
+
+FB_Status_t FB_INTEGRATOR_Compact_Init(FB_INTEGRATOR_Compact_t* fb,
+                                       const FB_INTEGRATOR_Config_t* config) {
+    if (fb == NULL || FB_INTEGRATOR_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    fb->integral = 0.0f;
+    fb->sample_time = config->sample_time;
+    fb->out_min = config->out_min;
+    fb->out_max = config->out_max;
+    fb->flags = fb_flags_set_status(config->enable_limit ? FB_FLAG_LIMIT_ENABLE : 0u,
+                                    FB_STATUS_OK);
+
+    return FB_STATUS_OK;
+}
+
+float FB_INTEGRATOR_Compact_Execute(FB_INTEGRATOR_Compact_t* fb, float input) {
+    uint8_t flags = fb->flags;
+
+    if (check_nan_inf(input)) {
+        fb->flags = fb_flags_set_status(flags, check_nan(input) ? FB_STATUS_ERROR_NAN
+                                                                : FB_STATUS_ERROR_INF);
+        return fb->integral;
+    }
+
+    float integral = fb->integral + input * fb->sample_time;
+    FB_Status_t status = FB_STATUS_OK;
+
+    if (flags & FB_FLAG_LIMIT_ENABLE) {
+        if (integral > fb->out_max) {
+            integral = fb->out_max;
+            status = FB_STATUS_LIMIT_HI;
+        } else if (integral < fb->out_min) {
+            integral = fb->out_min;
+            status = FB_STATUS_LIMIT_LO;
+        }
+    }
+
+    fb->integral = integral;
+    fb->flags = fb_flags_set_status(flags, status);
+    return integral;
+}
+
+void FB_INTEGRATOR_Compact_Reset(FB_INTEGRATOR_Compact_t* fb) {
+    fb->integral = 0.0f;
+    fb->flags = fb_flags_set_status(fb->flags, FB_STATUS_OK);
+}
+
+/* ========== DERIVATIVE ========== */
+
+FB_Status_t FB_DERIVATIVE_Compact_Init(FB_DERIVATIVE_Compact_t* fb,
+                                       const FB_DERIVATIVE_Config_t* config) {
+    if (fb == NULL || FB_DERIVATIVE_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    uint8_t flags = FB_FLAG_FIRST_RUN;
+    fb->prev_input = 0.0f;
+    fb->filtered_output = 0.0f;
+    fb->inv_sample_time = 1.0f / config->sample_time;
+    fb->alpha = 1.0f;
+    if (config->filter_time_constant > 0.0f) {
+        fb->alpha = config->sample_time /
+                    (config->filter_time_constant + config->sample_time);
+        flags |= FB_FLAG_FILTER;
+    }
+    fb->flags = fb_flags_set_status(flags, FB_STATUS_OK);
+
+    return FB_STATUS_OK;
+}
+
+float FB_DERIVATIVE_Compact_Execute(FB_DERIVATIVE_Compact_t* fb, float input) {
+    uint8_t flags = fb->flags;
+
+    if (check_nan_inf(input)) {
+        fb->flags = fb_flags_set_status(flags, check_nan(input) ? FB_STATUS_ERROR_NAN
+                                                                : FB_STATUS_ERROR_INF);
+        return 0.0f;
+    }
+
+    if (flags & FB_FLAG_FIRST_RUN) {
+        fb->prev_input = input;
+        fb->filtered_output = 0.0f;
+        fb->flags = fb_flags_set_status((uint8_t)(flags & ~FB_FLAG_FIRST_RUN), FB_STATUS_OK);
+        return 0.0f;
+    }
+
+    float raw_derivative = (input - fb->prev_input) * fb->inv_sample_time;
+
+    if (flags & FB_FLAG_FILTER) {
+        fb->filtered_output += fb->alpha * (raw_derivative - fb->filtered_output);
+    } else {
+        fb->filtered_output = raw_derivative;
+    }
+
+    fb->prev_input = input;
+    fb->flags = fb_flags_set_status(flags, FB_STATUS_OK);
+    return fb->filtered_output;
+}
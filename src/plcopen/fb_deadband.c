@@ -4,19 +4,27 @@
  */
 
 #include "plcopen/fb_deadband.h"
+#include "plcopen/probes.h"
 #include <string.h>
 #include <math.h>
 
+FB_Status_t FB_DEADBAND_ValidateConfig(const FB_DEADBAND_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->width < 0.0f) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
 int FB_DEADBAND_Init(FB_DEADBAND_t* fb, const FB_DEADBAND_Config_t* config) {
-    if (fb == NULL || config == NULL) return -1;
-    if (config->width < 0.0f) return -1;
+    if (fb == NULL || FB_DEADBAND_ValidateConfig(config) != FB_STATUS_OK) return -1;
 
     memcpy(&fb->config, config, sizeof(FB_DEADBAND_Config_t));
     fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_DEADBAND");
+    PLCOPEN_PROBE_INIT(deadband, fb, config);
     return 0;
 }
 
-float FB_DEADBAND_Execute(FB_DEADBAND_t* fb, float input) {
+static inline float deadband_execute(FB_DEADBAND_t* fb, float input) {
     if (check_nan_inf(input)) {
         fb->state.status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
         return fb->config.center;
@@ -32,3 +40,42 @@ float FB_DEADBAND_Execute(FB_DEADBAND_t* fb, float input) {
     fb->state.status = FB_STATUS_OK;
     return input;
 }
+
+/* 块处理：整块输入有限时内循环只有比较与选择 */
+static void deadband_execute_block(FB_DEADBAND_t* fb, const float* input, float* output, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (!check_block_finite(input, n)) {
+        for (size_t i = 0; i < n; i++) {
+            output[i] = deadband_execute(fb, input[i]);
+        }
+        return;
+    }
+
+    float center = fb->config.center;
+    float width = fb->config.width;
+    for (size_t i = 0; i < n; i++) {
+        float x = input[i];
+        output[i] = (fabsf(x - center) <= width) ? center : x;
+    }
+
+    fb->state.status = FB_STATUS_OK;
+}
+
+float FB_DEADBAND_Execute(FB_DEADBAND_t* fb, float input) {
+    PLCOPEN_PROBE_ENTRY(deadband, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = deadband_execute(fb, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(deadband, fb, output, fb->state.status);
+    return output;
+}
+
+void FB_DEADBAND_ExecuteBlock(FB_DEADBAND_t* fb, const float* input, float* output, size_t n) {
+    PLCOPEN_PROBE_ENTRY(deadband, fb, (n > 0) ? input[0] : 0.0f, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    deadband_execute_block(fb, input, output, n);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(deadband, fb, (n > 0) ? output[n - 1] : 0.0f, fb->state.status);
+}
@@ -4,22 +4,30 @@
  */
 
 #include "plcopen/fb_derivative.h"
+#include "plcopen/probes.h"
 #include <string.h>
 
+FB_Status_t FB_DERIVATIVE_ValidateConfig(const FB_DERIVATIVE_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return FB_STATUS_ERROR_CONFIG;
+    if (config->filter_time_constant < 0.0f) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
 int FB_DERIVATIVE_Init(FB_DERIVATIVE_t* fb, const FB_DERIVATIVE_Config_t* config) {
-    if (fb == NULL || config == NULL) return -1;
-    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return -1;
-    if (config->filter_time_constant < 0.0f) return -1;
+    if (fb == NULL || FB_DERIVATIVE_ValidateConfig(config) != FB_STATUS_OK) return -1;
 
     memcpy(&fb->config, config, sizeof(FB_DERIVATIVE_Config_t));
     fb->state.prev_input = 0.0f;
     fb->state.filtered_output = 0.0f;
     fb->state.first_run = true;
     fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_DERIVATIVE");
+    PLCOPEN_PROBE_INIT(derivative, fb, config);
     return 0;
 }
 
-float FB_DERIVATIVE_Execute(FB_DERIVATIVE_t* fb, float input) {
+static inline float derivative_execute(FB_DERIVATIVE_t* fb, float input) {
     if (check_nan_inf(input)) {
         fb->state.status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
         return 0.0f;
@@ -47,3 +55,144 @@ float FB_DERIVATIVE_Execute(FB_DERIVATIVE_t* fb, float input) {
     fb->state.status = FB_STATUS_OK;
     return fb->state.filtered_output;
 }
+
+/* 可变步长：原始微分除以实测 dt，滤波按一阶保持精确离散化 α = 1 - exp(-dt/Tf) */
+static inline float derivative_execute_dt(FB_DERIVATIVE_t* fb, float input, float dt) {
+    if (check_nan_inf(input)) {
+        fb->state.status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+        return 0.0f;
+    }
+
+    FB_Status_t dt_status = check_elapsed_time(dt);
+    if (dt_status != FB_STATUS_OK) {
+        fb->state.status = dt_status;
+        return 0.0f;
+    }
+
+    if (fb->state.first_run) {
+        fb->state.prev_input = input;
+        fb->state.filtered_output = 0.0f;
+        fb->state.first_run = false;
+        fb->state.status = FB_STATUS_OK;
+        return 0.0f;
+    }
+
+    /* 时间未推进：无法求差商，保持上次的输入与输出 */
+    if (dt == 0.0f) {
+        fb->state.status = FB_STATUS_OK;
+        return fb->state.filtered_output;
+    }
+
+    float raw_derivative = (input - fb->state.prev_input) / dt;
+
+    if (fb->config.filter_time_constant > 0.0f) {
+        float alpha = -fast_expm1f(-dt / fb->config.filter_time_constant);
+        fb->state.filtered_output += alpha * (raw_derivative - fb->state.filtered_output);
+    } else {
+        fb->state.filtered_output = raw_derivative;
+    }
+
+    fb->state.prev_input = input;
+    fb->state.status = FB_STATUS_OK;
+    return fb->state.filtered_output;
+}
+
+/* 块处理：整块输入有限时滤波分支与 α 提到循环外，上次输入与输出保存在局部变量中 */
+static void derivative_execute_block(FB_DERIVATIVE_t* fb, const float* input, float* output, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (!check_block_finite(input, n)) {
+        for (size_t i = 0; i < n; i++) {
+            output[i] = derivative_execute(fb, input[i]);
+        }
+        return;
+    }
+
+    size_t i = 0;
+    if (fb->state.first_run) {
+        output[0] = derivative_execute(fb, input[0]);
+        i = 1;
+    }
+
+    float ts = fb->config.sample_time;
+    float prev = fb->state.prev_input;
+    float y = fb->state.filtered_output;
+    if (fb->config.filter_time_constant > 0.0f) {
+        float alpha = ts / (fb->config.filter_time_constant + ts);
+        for (; i < n; i++) {
+            float raw_derivative = (input[i] - prev) / ts;
+            y += alpha * (raw_derivative - y);
+            prev = input[i];
+            output[i] = y;
+        }
+    } else {
+        for (; i < n; i++) {
+            y = (input[i] - prev) / ts;
+            prev = input[i];
+            output[i] = y;
+        }
+    }
+
+    fb->state.prev_input = prev;
+    fb->state.filtered_output = y;
+    fb->state.status = FB_STATUS_OK;
+}
+
+/* 快进 k 个周期（输入保持不变）：第一个周期按 Execute 执行，其余周期用闭式解 */
+static float derivative_advance(FB_DERIVATIVE_t* fb, float input, uint32_t k) {
+    if (k == 0u) {
+        return fb->state.filtered_output;
+    }
+
+    /* 第一个周期按 Execute 执行：输入跳变产生的微分在这里计入 */
+    float output = derivative_execute(fb, input);
+    if (k == 1u || check_nan_inf(input)) {
+        return output;
+    }
+
+    /* 其余 k-1 个周期原始微分为 0：滤波输出按 (1 - α)^(k-1) 指数衰减，无滤波时直接为 0 */
+    if (fb->config.filter_time_constant > 0.0f) {
+        float alpha = fb->config.sample_time /
+                      (fb->config.filter_time_constant + fb->config.sample_time);
+        fb->state.filtered_output = output * decay_factor(alpha, k - 1u);
+    } else {
+        fb->state.filtered_output = 0.0f;
+    }
+    return fb->state.filtered_output;
+}
+
+float FB_DERIVATIVE_Execute(FB_DERIVATIVE_t* fb, float input) {
+    PLCOPEN_PROBE_ENTRY(derivative, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = derivative_execute(fb, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(derivative, fb, output, fb->state.status);
+    return output;
+}
+
+float FB_DERIVATIVE_ExecuteDt(FB_DERIVATIVE_t* fb, float input, float dt) {
+    PLCOPEN_PROBE_ENTRY(derivative, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = derivative_execute_dt(fb, input, dt);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(derivative, fb, output, fb->state.status);
+    return output;
+}
+
+void FB_DERIVATIVE_ExecuteBlock(FB_DERIVATIVE_t* fb, const float* input, float* output, size_t n) {
+    PLCOPEN_PROBE_ENTRY(derivative, fb, (n > 0) ? input[0] : 0.0f, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    derivative_execute_block(fb, input, output, n);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(derivative, fb, (n > 0) ? output[n - 1] : 0.0f, fb->state.status);
+}
+
+float FB_DERIVATIVE_Advance(FB_DERIVATIVE_t* fb, float input, uint32_t k) {
+    PLCOPEN_PROBE_ENTRY(derivative, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = derivative_advance(fb, input, k);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(derivative, fb, output, fb->state.status);
+    return output;
+}
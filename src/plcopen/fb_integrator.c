@@ -4,27 +4,29 @@
  */
 
 #include "plcopen/fb_integrator.h"
+#include "plcopen/probes.h"
 #include <string.h>
 
+FB_Status_t FB_INTEGRATOR_ValidateConfig(const FB_INTEGRATOR_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return FB_STATUS_ERROR_CONFIG;
+    if (config->enable_limit && config->out_max <= config->out_min) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
 int FB_INTEGRATOR_Init(FB_INTEGRATOR_t* fb, const FB_INTEGRATOR_Config_t* config) {
-    if (fb == NULL || config == NULL) return -1;
-    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return -1;
-    if (config->enable_limit && config->out_max <= config->out_min) return -1;
+    if (fb == NULL || FB_INTEGRATOR_ValidateConfig(config) != FB_STATUS_OK) return -1;
 
     memcpy(&fb->config, config, sizeof(FB_INTEGRATOR_Config_t));
     fb->state.integral = 0.0f;
     fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_INTEGRATOR");
+    PLCOPEN_PROBE_INIT(integrator, fb, config);
     return 0;
 }
 
-float FB_INTEGRATOR_Execute(FB_INTEGRATOR_t* fb, float input) {
-    if (check_nan_inf(input)) {
-        fb->state.status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
-        return fb->state.integral;
-    }
-
-    fb->state.integral += input * fb->config.sample_time;
-
+/* 积分值限幅并设置状态码 */
+static inline void integrator_apply_limit(FB_INTEGRATOR_t* fb) {
     if (fb->config.enable_limit) {
         if (fb->state.integral > fb->config.out_max) {
             fb->state.integral = fb->config.out_max;
@@ -38,10 +40,132 @@ float FB_INTEGRATOR_Execute(FB_INTEGRATOR_t* fb, float input) {
     } else {
         fb->state.status = FB_STATUS_OK;
     }
+}
 
+static inline float integrator_execute(FB_INTEGRATOR_t* fb, float input) {
+    if (check_nan_inf(input)) {
+        fb->state.status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+        return fb->state.integral;
+    }
+
+    fb->state.integral += input * fb->config.sample_time;
+    integrator_apply_limit(fb);
+    return fb->state.integral;
+}
+
+/* 可变步长：输入在周期内保持不变，积分增量为 u·dt */
+static inline float integrator_execute_dt(FB_INTEGRATOR_t* fb, float input, float dt) {
+    if (check_nan_inf(input)) {
+        fb->state.status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+        return fb->state.integral;
+    }
+
+    FB_Status_t dt_status = check_elapsed_time(dt);
+    if (dt_status != FB_STATUS_OK) {
+        fb->state.status = dt_status;
+        return fb->state.integral;
+    }
+
+    fb->state.integral += input * dt;
+    integrator_apply_limit(fb);
     return fb->state.integral;
 }
 
+/* 块处理：整块输入有限时限幅分支提到循环外，积分值保存在局部变量中 */
+static void integrator_execute_block(FB_INTEGRATOR_t* fb, const float* input, float* output, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (!check_block_finite(input, n)) {
+        for (size_t i = 0; i < n; i++) {
+            output[i] = integrator_execute(fb, input[i]);
+        }
+        return;
+    }
+
+    float ts = fb->config.sample_time;
+    float integral = fb->state.integral;
+    FB_Status_t status = FB_STATUS_OK;
+    if (fb->config.enable_limit) {
+        float out_min = fb->config.out_min;
+        float out_max = fb->config.out_max;
+        for (size_t i = 0; i < n; i++) {
+            integral += input[i] * ts;
+            if (integral > out_max) {
+                integral = out_max;
+                status = FB_STATUS_LIMIT_HI;
+            } else if (integral < out_min) {
+                integral = out_min;
+                status = FB_STATUS_LIMIT_LO;
+            } else {
+                status = FB_STATUS_OK;
+            }
+            output[i] = integral;
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            integral += input[i] * ts;
+            output[i] = integral;
+        }
+    }
+
+    fb->state.integral = integral;
+    fb->state.status = status;
+}
+
+/* 快进 k 个周期（输入保持不变）：第一个周期按 Execute 执行，其余周期用闭式解 */
+static float integrator_advance(FB_INTEGRATOR_t* fb, float input, uint32_t k) {
+    if (k == 0u) {
+        return fb->state.integral;
+    }
+
+    /* 第一个周期按 Execute 执行：积分值进入限幅区间（或报告 NaN/Inf） */
+    float output = integrator_execute(fb, input);
+    if (k == 1u || check_nan_inf(input)) {
+        return output;
+    }
+
+    /* 输入不变时积分值单调变化，其余 k-1 个周期只需在终点限幅一次 */
+    fb->state.integral = output + (float)(k - 1u) * (input * fb->config.sample_time);
+    integrator_apply_limit(fb);
+    return fb->state.integral;
+}
+
+float FB_INTEGRATOR_Execute(FB_INTEGRATOR_t* fb, float input) {
+    PLCOPEN_PROBE_ENTRY(integrator, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = integrator_execute(fb, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(integrator, fb, output, fb->state.status);
+    return output;
+}
+
+float FB_INTEGRATOR_ExecuteDt(FB_INTEGRATOR_t* fb, float input, float dt) {
+    PLCOPEN_PROBE_ENTRY(integrator, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = integrator_execute_dt(fb, input, dt);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(integrator, fb, output, fb->state.status);
+    return output;
+}
+
+void FB_INTEGRATOR_ExecuteBlock(FB_INTEGRATOR_t* fb, const float* input, float* output, size_t n) {
+    PLCOPEN_PROBE_ENTRY(integrator, fb, (n > 0) ? input[0] : 0.0f, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    integrator_execute_block(fb, input, output, n);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(integrator, fb, (n > 0) ? output[n - 1] : 0.0f, fb->state.status);
+}
+
+float FB_INTEGRATOR_Advance(FB_INTEGRATOR_t* fb, float input, uint32_t k) {
+    PLCOPEN_PROBE_ENTRY(integrator, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = integrator_advance(fb, input, k);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(integrator, fb, output, fb->state.status);
+    return output;
+}
+
 void FB_INTEGRATOR_Reset(FB_INTEGRATOR_t* fb) {
     fb->state.integral = 0.0f;
     fb->state.status = FB_STATUS_OK;
@@ -0,0 +1,532 @@
+/**
+ * @file fb_kalman.c
+ * @brief PLCopen 离散卡尔曼滤波功能块实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#include "plcopen/fb_kalman.h"
+#include "plcopen/probes.h"
+#include <math.h>
+#include <string.h>
+
+#define KN FB_KALMAN_MAX_STATES
+#define KM FB_KALMAN_MAX_OUTPUTS
+
+/*
+ * 内核以状态维数 n 为参数写成循环，强制内联到按 n 特化的调用点（kalman_full / kalman_steady
+ * 中的 switch）：n 为常量，最内层的 n 项点积按提示完全展开，外层循环保留。
+ * 外层也展开时 n = 6 的代码量约为 4 倍，主机上实测反而更慢，Cortex-M4 上也不值得占用 Flash。
+ * 测量维数与输入维数通常只有 1 ~ 2，保持运行时值。
+ */
+#if defined(__GNUC__)
+#define KALMAN_INLINE static inline __attribute__((always_inline))
+#define KALMAN_UNROLL _Pragma("GCC unroll 6")
+#else
+#define KALMAN_INLINE static inline
+#define KALMAN_UNROLL
+#endif
+
+/* ========== 小矩阵内核 ========== */
+
+/* x⁻ = A·x + B·u */
+KALMAN_INLINE void kalman_predict_state(const FB_KALMAN_Config_t* c, const float* x, const float* u,
+                                        float* xm, unsigned n) {
+    for (unsigned i = 0; i < n; i++) {
+        float sum = 0.0f;
+        KALMAN_UNROLL
+        for (unsigned j = 0; j < n; j++) {
+            sum += c->a[i][j] * x[j];
+        }
+        for (unsigned k = 0; k < c->inputs; k++) {
+            sum += c->b[i][k] * u[k];
+        }
+        xm[i] = sum;
+    }
+}
+
+/* P⁻ = A·P·Aᵀ + Q，只算上三角再镜像 */
+KALMAN_INLINE void kalman_predict_cov(const FB_KALMAN_Config_t* c, float p[KN][KN],
+                                      float pm[KN][KN], unsigned n) {
+    float t[KN][KN];
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            float sum = 0.0f;
+            KALMAN_UNROLL
+            for (unsigned l = 0; l < n; l++) {
+                sum += c->a[i][l] * p[l][j];
+            }
+            t[i][j] = sum;
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = i; j < n; j++) {
+            float sum = c->q[i][j];
+            KALMAN_UNROLL
+            for (unsigned l = 0; l < n; l++) {
+                sum += t[i][l] * c->a[j][l];
+            }
+            pm[i][j] = sum;
+            pm[j][i] = sum;
+        }
+    }
+}
+
+/* 对称正定矩阵的 Cholesky 分解 S = L·Lᵀ（原位，下三角），inv 为 L 对角元的倒数 */
+static inline bool kalman_cholesky(float l[KM][KM], float inv[KM], unsigned m) {
+    for (unsigned j = 0; j < m; j++) {
+        float d = l[j][j];
+        for (unsigned k = 0; k < j; k++) {
+            d -= l[j][k] * l[j][k];
+        }
+        if (!(d > 0.0f) || check_inf(d)) {
+            return false;
+        }
+        l[j][j] = sqrtf(d);
+        inv[j] = 1.0f / l[j][j];
+        for (unsigned i = j + 1; i < m; i++) {
+            float sum = l[i][j];
+            for (unsigned k = 0; k < j; k++) {
+                sum -= l[i][k] * l[j][k];
+            }
+            l[i][j] = sum * inv[j];
+        }
+    }
+    return true;
+}
+
+/* K = P⁻·Hᵀ·S⁻¹：K 的每一行解 S·kᵀ = (P⁻·Hᵀ 的该行)ᵀ，两次三角回代 */
+KALMAN_INLINE bool kalman_gain(const FB_KALMAN_Config_t* c, float pm[KN][KN], float k[KN][KM],
+                               unsigned n) {
+    const unsigned m = c->outputs;
+    float pht[KN][KM];
+    float l[KM][KM];
+    float inv[KM];
+
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned o = 0; o < m; o++) {
+            float sum = 0.0f;
+            KALMAN_UNROLL
+            for (unsigned j = 0; j < n; j++) {
+                sum += pm[i][j] * c->h[o][j];
+            }
+            pht[i][o] = sum;
+        }
+    }
+    for (unsigned o = 0; o < m; o++) {
+        for (unsigned o2 = 0; o2 <= o; o2++) {
+            float sum = c->r[o][o2];
+            KALMAN_UNROLL
+            for (unsigned j = 0; j < n; j++) {
+                sum += c->h[o][j] * pht[j][o2];
+            }
+            l[o][o2] = sum;
+        }
+    }
+    if (!kalman_cholesky(l, inv, m)) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < n; i++) {
+        float y[KM];
+        for (unsigned o = 0; o < m; o++) {
+            float sum = pht[i][o];
+            for (unsigned q = 0; q < o; q++) {
+                sum -= l[o][q] * y[q];
+            }
+            y[o] = sum * inv[o];
+        }
+        for (unsigned o = m; o-- > 0;) {
+            float sum = y[o];
+            for (unsigned q = o + 1; q < m; q++) {
+                sum -= l[q][o] * k[i][q];
+            }
+            k[i][o] = sum * inv[o];
+        }
+    }
+    return true;
+}
+
+/* x = x⁻ + K·(z − H·x⁻)，同时记录新息 */
+KALMAN_INLINE void kalman_correct_state(const FB_KALMAN_Config_t* c, FB_KALMAN_State_t* s,
+                                        const float* xm, const float* z, unsigned n) {
+    const unsigned m = c->outputs;
+    for (unsigned o = 0; o < m; o++) {
+        float sum = z[o];
+        KALMAN_UNROLL
+        for (unsigned j = 0; j < n; j++) {
+            sum -= c->h[o][j] * xm[j];
+        }
+        s->innovation[o] = sum;
+    }
+    for (unsigned i = 0; i < n; i++) {
+        float sum = xm[i];
+        for (unsigned o = 0; o < m; o++) {
+            sum += s->gain[i][o] * s->innovation[o];
+        }
+        s->x[i] = sum;
+    }
+}
+
+/* Joseph 形式：P = (I − K·H)·P⁻·(I − K·H)ᵀ + K·R·Kᵀ，只算上三角再镜像 */
+KALMAN_INLINE void kalman_joseph(const FB_KALMAN_Config_t* c, float pm[KN][KN],
+                                 float k[KN][KM], float p[KN][KN], unsigned n) {
+    const unsigned m = c->outputs;
+    float ikh[KN][KN];
+    float t[KN][KN];
+    float kr[KN][KM];
+
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            float sum = (i == j) ? 1.0f : 0.0f;
+            for (unsigned o = 0; o < m; o++) {
+                sum -= k[i][o] * c->h[o][j];
+            }
+            ikh[i][j] = sum;
+        }
+        for (unsigned o = 0; o < m; o++) {
+            float sum = 0.0f;
+            for (unsigned o2 = 0; o2 < m; o2++) {
+                sum += k[i][o2] * c->r[o2][o];
+            }
+            kr[i][o] = sum;
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            float sum = 0.0f;
+            KALMAN_UNROLL
+            for (unsigned l = 0; l < n; l++) {
+                sum += ikh[i][l] * pm[l][j];
+            }
+            t[i][j] = sum;
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = i; j < n; j++) {
+            float sum = 0.0f;
+            KALMAN_UNROLL
+            for (unsigned l = 0; l < n; l++) {
+                sum += t[i][l] * ikh[j][l];
+            }
+            for (unsigned o = 0; o < m; o++) {
+                sum += kr[i][o] * k[j][o];
+            }
+            p[i][j] = sum;
+            p[j][i] = sum;
+        }
+    }
+}
+
+KALMAN_INLINE void kalman_accept_prediction(FB_KALMAN_State_t* s, const float* xm,
+                                            float pm[KN][KN], unsigned n) {
+    for (unsigned i = 0; i < n; i++) {
+        s->x[i] = xm[i];
+        KALMAN_UNROLL
+        for (unsigned j = 0; j < n; j++) {
+            s->p[i][j] = pm[i][j];
+        }
+    }
+}
+
+/* ========== 两种模式的一个周期 ========== */
+
+/* 完整模式；z 为 NULL 时只预测 */
+KALMAN_INLINE FB_Status_t kalman_full_step(const FB_KALMAN_Config_t* c, FB_KALMAN_State_t* s,
+                                           const float* z, const float* u, unsigned n) {
+    float xm[KN];
+    float pm[KN][KN];
+    kalman_predict_state(c, s->x, u, xm, n);
+    kalman_predict_cov(c, s->p, pm, n);
+    if (z == NULL) {
+        kalman_accept_prediction(s, xm, pm, n);
+        return FB_STATUS_OK;
+    }
+    if (!kalman_gain(c, pm, s->gain, n)) {
+        kalman_accept_prediction(s, xm, pm, n);
+        return FB_STATUS_ERROR_CONFIG;
+    }
+    kalman_correct_state(c, s, xm, z, n);
+    kalman_joseph(c, pm, s->gain, s->p, n);
+    return FB_STATUS_OK;
+}
+
+/* 稳态模式：x = F·x + G·u + K·z；z 为 NULL 时 x = A·x + B·u */
+KALMAN_INLINE void kalman_steady_step(const FB_KALMAN_Config_t* c, FB_KALMAN_State_t* s,
+                                      const float* z, const float* u, unsigned n) {
+    float xn[KN];
+    if (z == NULL) {
+        kalman_predict_state(c, s->x, u, xn, n);
+    } else {
+        for (unsigned i = 0; i < n; i++) {
+            float sum = 0.0f;
+            KALMAN_UNROLL
+            for (unsigned j = 0; j < n; j++) {
+                sum += s->f[i][j] * s->x[j];
+            }
+            for (unsigned k = 0; k < c->inputs; k++) {
+                sum += s->g[i][k] * u[k];
+            }
+            for (unsigned o = 0; o < c->outputs; o++) {
+                sum += s->gain[i][o] * z[o];
+            }
+            xn[i] = sum;
+        }
+    }
+    KALMAN_UNROLL
+    for (unsigned i = 0; i < n; i++) {
+        s->x[i] = xn[i];
+    }
+}
+
+/* 按状态维数分派到特化内核 */
+static FB_Status_t kalman_full(const FB_KALMAN_Config_t* c, FB_KALMAN_State_t* s, const float* z,
+                               const float* u) {
+    switch (c->states) {
+    case 1: return kalman_full_step(c, s, z, u, 1u);
+#if KN >= 2
+    case 2: return kalman_full_step(c, s, z, u, 2u);
+#endif
+#if KN >= 3
+    case 3: return kalman_full_step(c, s, z, u, 3u);
+#endif
+#if KN >= 4
+    case 4: return kalman_full_step(c, s, z, u, 4u);
+#endif
+#if KN >= 5
+    case 5: return kalman_full_step(c, s, z, u, 5u);
+#endif
+#if KN >= 6
+    case 6: return kalman_full_step(c, s, z, u, 6u);
+#endif
+    default: return FB_STATUS_ERROR_CONFIG;
+    }
+}
+
+static void kalman_steady(const FB_KALMAN_Config_t* c, FB_KALMAN_State_t* s, const float* z,
+                          const float* u) {
+    switch (c->states) {
+    case 1: kalman_steady_step(c, s, z, u, 1u); break;
+#if KN >= 2
+    case 2: kalman_steady_step(c, s, z, u, 2u); break;
+#endif
+#if KN >= 3
+    case 3: kalman_steady_step(c, s, z, u, 3u); break;
+#endif
+#if KN >= 4
+    case 4: kalman_steady_step(c, s, z, u, 4u); break;
+#endif
+#if KN >= 5
+    case 5: kalman_steady_step(c, s, z, u, 5u); break;
+#endif
+#if KN >= 6
+    case 6: kalman_steady_step(c, s, z, u, 6u); break;
+#endif
+    default: break;
+    }
+}
+
+/* ========== 配置与初始化 ========== */
+
+static bool kalman_finite(const float* v, unsigned count) {
+    for (unsigned i = 0; i < count; i++) {
+        if (check_nan_inf(v[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 对称、有限、对角元非负（半正定的必要条件） */
+static bool kalman_symmetric(const float q[KN][KN], unsigned n) {
+    for (unsigned i = 0; i < n; i++) {
+        if (!kalman_finite(q[i], n) || q[i][i] < 0.0f) {
+            return false;
+        }
+        for (unsigned j = 0; j < i; j++) {
+            if (q[i][j] != q[j][i]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+FB_Status_t FB_KALMAN_ValidateConfig(const FB_KALMAN_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->states < 1 || config->states > FB_KALMAN_MAX_STATES) return FB_STATUS_ERROR_CONFIG;
+    if (config->outputs < 1 || config->outputs > FB_KALMAN_MAX_OUTPUTS) return FB_STATUS_ERROR_CONFIG;
+    if (config->inputs > FB_KALMAN_MAX_INPUTS) return FB_STATUS_ERROR_CONFIG;
+
+    const unsigned n = config->states;
+    const unsigned m = config->outputs;
+    for (unsigned i = 0; i < n; i++) {
+        if (!kalman_finite(config->a[i], n) || !kalman_finite(config->b[i], config->inputs)) {
+            return FB_STATUS_ERROR_CONFIG;
+        }
+    }
+    for (unsigned o = 0; o < m; o++) {
+        if (!kalman_finite(config->h[o], n)) return FB_STATUS_ERROR_CONFIG;
+    }
+    if (!kalman_finite(config->x0, n)) return FB_STATUS_ERROR_CONFIG;
+    if (!kalman_symmetric(config->q, n) || !kalman_symmetric(config->p0, n)) return FB_STATUS_ERROR_CONFIG;
+
+    float l[KM][KM];
+    float inv[KM];
+    for (unsigned o = 0; o < m; o++) {
+        for (unsigned o2 = 0; o2 < m; o2++) {
+            if (check_nan_inf(config->r[o][o2]) || config->r[o][o2] != config->r[o2][o]) {
+                return FB_STATUS_ERROR_CONFIG;
+            }
+            l[o][o2] = config->r[o][o2];
+        }
+    }
+    if (!kalman_cholesky(l, inv, m)) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
+/*
+ * 稳态增益：Riccati 递推与完整模式的协方差更新相同。对零状态、零输入、零测量执行完整模式，
+ * 状态保持为零，只有 P 与 K 在迭代，直到两者的相对变化都降到单精度舍入的量级。
+ * 只检查 K 不够：不可检测的不稳定模态使 P 无界增长而 K 保持不变。
+ */
+static float kalman_relative_change(const float* now, const float* before, unsigned count) {
+    float change = 0.0f;
+    float scale = 0.0f;
+    for (unsigned i = 0; i < count; i++) {
+        change = fmaxf(change, fabsf(now[i] - before[i]));
+        scale = fmaxf(scale, fabsf(now[i]));
+    }
+    return (change == 0.0f) ? 0.0f : change / scale;
+}
+
+static bool kalman_solve_steady(const FB_KALMAN_Config_t* c, FB_KALMAN_State_t* s) {
+    static const float zeros[6] = { 0.0f };  /* 不小于 n、m、p 的上限 */
+    const unsigned n = c->states;
+    const unsigned m = c->outputs;
+    float gain[KN][KM];
+    float p[KN][KN];
+    unsigned stable = 0u;
+
+    memset(s->x, 0, sizeof(s->x));
+    for (unsigned iter = 0; iter < FB_KALMAN_RICCATI_ITERATIONS && stable < 8u; iter++) {
+        memcpy(gain, s->gain, sizeof(gain));
+        memcpy(p, s->p, sizeof(p));
+        if (kalman_full(c, s, zeros, zeros) != FB_STATUS_OK) {
+            return false;
+        }
+        float change = 0.0f;
+        for (unsigned i = 0; i < n; i++) {
+            change = fmaxf(change, kalman_relative_change(s->gain[i], gain[i], m));
+            change = fmaxf(change, kalman_relative_change(s->p[i], p[i], n));
+        }
+        if (check_nan_inf(change)) {
+            return false;
+        }
+        /* 连续若干次变化都在舍入量级内才认为收敛，避免缓慢收敛时过早停止 */
+        stable = (change <= 1e-5f) ? stable + 1u : 0u;
+    }
+    if (stable < 8u) {
+        return false;
+    }
+
+    /* F = (I − K·H)·A，G = (I − K·H)·B */
+    for (unsigned i = 0; i < n; i++) {
+        float ikh[KN];
+        for (unsigned j = 0; j < n; j++) {
+            float sum = (i == j) ? 1.0f : 0.0f;
+            for (unsigned o = 0; o < m; o++) {
+                sum -= s->gain[i][o] * c->h[o][j];
+            }
+            ikh[j] = sum;
+        }
+        for (unsigned j = 0; j < n; j++) {
+            float sum = 0.0f;
+            for (unsigned l = 0; l < n; l++) {
+                sum += ikh[l] * c->a[l][j];
+            }
+            s->f[i][j] = sum;
+        }
+        for (unsigned k = 0; k < c->inputs; k++) {
+            float sum = 0.0f;
+            for (unsigned l = 0; l < n; l++) {
+                sum += ikh[l] * c->b[l][k];
+            }
+            s->g[i][k] = sum;
+        }
+    }
+    return true;
+}
+
+int FB_KALMAN_Init(FB_KALMAN_t* fb, const FB_KALMAN_Config_t* config) {
+    if (fb == NULL || FB_KALMAN_ValidateConfig(config) != FB_STATUS_OK) return -1;
+
+    memcpy(&fb->config, config, sizeof(FB_KALMAN_Config_t));
+    memset(&fb->state, 0, sizeof(FB_KALMAN_State_t));
+    memcpy(fb->state.p, config->p0, sizeof(fb->state.p));
+    if (config->steady_state && !kalman_solve_steady(&fb->config, &fb->state)) {
+        return -1;
+    }
+    memcpy(fb->state.x, config->x0, sizeof(fb->state.x));
+    fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_KALMAN");
+    PLCOPEN_PROBE_INIT(kalman, fb, config);
+    return 0;
+}
+
+/* ========== 执行 ========== */
+
+static FB_Status_t kalman_check_vector(const float* v, unsigned count) {
+    FB_Status_t status = FB_STATUS_OK;
+    for (unsigned i = 0; i < count; i++) {
+        if (check_nan(v[i])) {
+            return FB_STATUS_ERROR_NAN;
+        }
+        if (check_inf(v[i])) {
+            status = FB_STATUS_ERROR_INF;
+        }
+    }
+    return status;
+}
+
+static inline FB_Status_t kalman_execute(FB_KALMAN_t* fb, const float* measurement, const float* input) {
+    const FB_KALMAN_Config_t* c = &fb->config;
+    FB_KALMAN_State_t* s = &fb->state;
+
+    if (input == NULL && c->inputs != 0u) {
+        s->status = FB_STATUS_ERROR_CONFIG;
+        return s->status;
+    }
+    FB_Status_t status = kalman_check_vector(input, c->inputs);
+    if (status != FB_STATUS_OK) {
+        s->status = status;
+        return status;
+    }
+
+    const float* z = measurement;
+    if (z != NULL) {
+        status = kalman_check_vector(z, c->outputs);
+        if (status != FB_STATUS_OK) {
+            z = NULL;
+        }
+    }
+
+    if (c->steady_state) {
+        kalman_steady(c, s, z, input);
+    } else {
+        FB_Status_t step = kalman_full(c, s, z, input);
+        status = (status != FB_STATUS_OK) ? status : step;
+    }
+    s->status = status;
+    return status;
+}
+
+FB_Status_t FB_KALMAN_Execute(FB_KALMAN_t* fb, const float* measurement, const float* input) {
+    PLCOPEN_PROBE_ENTRY(kalman, fb, (measurement != NULL) ? measurement[0] : 0.0f,
+                        (input != NULL && fb->config.inputs != 0u) ? input[0] : 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    FB_Status_t status = kalman_execute(fb, measurement, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(kalman, fb, fb->state.x[0], status);
+    return status;
+}
@@ -4,18 +4,26 @@
  */
 
 #include "plcopen/fb_limit.h"
+#include "plcopen/probes.h"
 #include <string.h>
 
+FB_Status_t FB_LIMIT_ValidateConfig(const FB_LIMIT_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->max_val <= config->min_val) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
 int FB_LIMIT_Init(FB_LIMIT_t* fb, const FB_LIMIT_Config_t* config) {
-    if (fb == NULL || config == NULL) return -1;
-    if (config->max_val <= config->min_val) return -1;
+    if (fb == NULL || FB_LIMIT_ValidateConfig(config) != FB_STATUS_OK) return -1;
 
     memcpy(&fb->config, config, sizeof(FB_LIMIT_Config_t));
     fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_LIMIT");
+    PLCOPEN_PROBE_INIT(limit, fb, config);
     return 0;
 }
 
-float FB_LIMIT_Execute(FB_LIMIT_t* fb, float input) {
+static inline float limit_execute(FB_LIMIT_t* fb, float input) {
     if (check_nan_inf(input)) {
         fb->state.status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
         return 0.0f;
@@ -32,3 +40,49 @@ float FB_LIMIT_Execute(FB_LIMIT_t* fb, float input) {
     fb->state.status = FB_STATUS_OK;
     return input;
 }
+
+/* 块处理：整块输入有限时内循环只有比较与选择，状态码由最后一个采样决定 */
+static void limit_execute_block(FB_LIMIT_t* fb, const float* input, float* output, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (!check_block_finite(input, n)) {
+        for (size_t i = 0; i < n; i++) {
+            output[i] = limit_execute(fb, input[i]);
+        }
+        return;
+    }
+
+    float min_val = fb->config.min_val;
+    float max_val = fb->config.max_val;
+    float last = input[n - 1];
+    for (size_t i = 0; i < n; i++) {
+        float x = input[i];
+        output[i] = (x > max_val) ? max_val : ((x < min_val) ? min_val : x);
+    }
+
+    if (last > max_val) {
+        fb->state.status = FB_STATUS_LIMIT_HI;
+    } else if (last < min_val) {
+        fb->state.status = FB_STATUS_LIMIT_LO;
+    } else {
+        fb->state.status = FB_STATUS_OK;
+    }
+}
+
+float FB_LIMIT_Execute(FB_LIMIT_t* fb, float input) {
+    PLCOPEN_PROBE_ENTRY(limit, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = limit_execute(fb, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(limit, fb, output, fb->state.status);
+    return output;
+}
+
+void FB_LIMIT_ExecuteBlock(FB_LIMIT_t* fb, const float* input, float* output, size_t n) {
+    PLCOPEN_PROBE_ENTRY(limit, fb, (n > 0) ? input[0] : 0.0f, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    limit_execute_block(fb, input, output, n);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(limit, fb, (n > 0) ? output[n - 1] : 0.0f, fb->state.status);
+}
@@ -30,14 +30,14 @@
  */
 
 #include "plcopen/fb_pid.h"
+#include "plcopen/probes.h"
 #include <string.h>  // for memcpy
 
 /**
- * @brief 初始化 PID 控制器
+ * @brief 验证 PID 配置参数
  */
-FB_Status_t FB_PID_Init(FB_PID_t* fb, const FB_PID_Config_t* config) {
-    /* 参数验证 */
-    if (fb == NULL || config == NULL) {
+FB_Status_t FB_PID_ValidateConfig(const FB_PID_Config_t* config) {
+    if (config == NULL) {
         return FB_STATUS_ERROR_CONFIG;
     }
 
@@ -61,6 +61,18 @@ FB_Status_t FB_PID_Init(FB_PID_t* fb, const FB_PID_Config_t* config) {
         return FB_STATUS_ERROR_CONFIG;
     }
 
+    return FB_STATUS_OK;
+}
+
+/**
+ * @brief 初始化 PID 控制器
+ */
+FB_Status_t FB_PID_Init(FB_PID_t* fb, const FB_PID_Config_t* config) {
+    /* 参数验证 */
+    if (fb == NULL || FB_PID_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
     /* 复制配置 */
     memcpy(&fb->config, config, sizeof(FB_PID_Config_t));
 
@@ -72,41 +84,16 @@ FB_Status_t FB_PID_Init(FB_PID_t* fb, const FB_PID_Config_t* config) {
     fb->state.first_run = true;
     fb->state.status = FB_STATUS_OK;
 
+    PLCOPEN_PROF_REGISTER(fb, "FB_PID");
+    PLCOPEN_PROBE_INIT(pid, fb, config);
     return FB_STATUS_OK;
 }
 
-/**
- * @brief 执行 PID 控制算法
+/*
+ * 一个控制周期的 P/I/D 计算与条件积分，dt 为本周期的时间间隔（秒）：
+ * Execute 传入 config.sample_time，ExecuteDt 传入实测间隔，两者因此逐位一致
  */
-float FB_PID_Execute(FB_PID_t* fb, float setpoint, float measurement) {
-    /* 检测输入有效性 */
-    if (check_nan(setpoint) || check_nan(measurement)) {
-        fb->state.status = FB_STATUS_ERROR_NAN;
-        return 0.0f;
-    }
-
-    if (check_inf(setpoint) || check_inf(measurement)) {
-        fb->state.status = FB_STATUS_ERROR_INF;
-        return 0.0f;
-    }
-
-    /* 手动模式：返回上次输出 */
-    if (fb->state.manual_mode) {
-        return fb->state.prev_output;
-    }
-
-    /* 首次调用：使用测量值作为初始输出，避免启动冲击 */
-    if (fb->state.first_run) {
-        fb->state.prev_measurement = measurement;
-        fb->state.prev_output = clamp_output(measurement,
-                                              fb->config.out_min,
-                                              fb->config.out_max);
-        fb->state.integral = 0.0f;
-        fb->state.first_run = false;
-        fb->state.status = FB_STATUS_OK;
-        return fb->state.prev_output;
-    }
-
+static inline float pid_update(FB_PID_t* fb, float setpoint, float measurement, float dt) {
     /* 计算误差 */
     float error = setpoint - measurement;
 
@@ -116,7 +103,7 @@ float FB_PID_Execute(FB_PID_t* fb, float setpoint, float measurement) {
     /* 计算微分项（微分项先行：对测量值求微分，而不是误差） */
     float d_term = 0.0f;
     if (fb->config.kd > 0.0f) {
-        float d_measurement = (measurement - fb->state.prev_measurement) / fb->config.sample_time;
+        float d_measurement = (measurement - fb->state.prev_measurement) / dt;
         d_term = -fb->config.kd * d_measurement;
     }
 
@@ -152,7 +139,7 @@ float FB_PID_Execute(FB_PID_t* fb, float setpoint, float measurement) {
 
     /* 更新积分器 */
     if (should_integrate && fb->config.ki > 0.0f) {
-        fb->state.integral += fb->config.ki * error * fb->config.sample_time;
+        fb->state.integral += fb->config.ki * error * dt;
         /* 再次限幅，防止单次累加过大 */
         fb->state.integral = clamp_output(fb->state.integral,
                                            fb->config.int_min,
@@ -175,6 +162,96 @@ float FB_PID_Execute(FB_PID_t* fb, float setpoint, float measurement) {
     return output;
 }
 
+/**
+ * @brief 执行 PID 控制算法
+ */
+static inline float pid_execute(FB_PID_t* fb, float setpoint, float measurement) {
+    /* 检测输入有效性 */
+    if (check_nan(setpoint) || check_nan(measurement)) {
+        fb->state.status = FB_STATUS_ERROR_NAN;
+        return 0.0f;
+    }
+
+    if (check_inf(setpoint) || check_inf(measurement)) {
+        fb->state.status = FB_STATUS_ERROR_INF;
+        return 0.0f;
+    }
+
+    /* 手动模式：返回上次输出 */
+    if (fb->state.manual_mode) {
+        return fb->state.prev_output;
+    }
+
+    /* 首次调用：使用测量值作为初始输出，避免启动冲击 */
+    if (fb->state.first_run) {
+        fb->state.prev_measurement = measurement;
+        fb->state.prev_output = clamp_output(measurement,
+                                              fb->config.out_min,
+                                              fb->config.out_max);
+        fb->state.integral = 0.0f;
+        fb->state.first_run = false;
+        fb->state.status = FB_STATUS_OK;
+        return fb->state.prev_output;
+    }
+
+    return pid_update(fb, setpoint, measurement, fb->config.sample_time);
+}
+
+/* 可变步长：积分按 ki·e·dt 累加，测量值微分除以实测 dt */
+static inline float pid_execute_dt(FB_PID_t* fb, float setpoint, float measurement, float dt) {
+    if (check_nan(setpoint) || check_nan(measurement)) {
+        fb->state.status = FB_STATUS_ERROR_NAN;
+        return 0.0f;
+    }
+
+    if (check_inf(setpoint) || check_inf(measurement)) {
+        fb->state.status = FB_STATUS_ERROR_INF;
+        return 0.0f;
+    }
+
+    FB_Status_t dt_status = check_elapsed_time(dt);
+    if (dt_status != FB_STATUS_OK) {
+        fb->state.status = dt_status;
+        return 0.0f;
+    }
+
+    if (fb->state.manual_mode) {
+        return fb->state.prev_output;
+    }
+
+    if (fb->state.first_run) {
+        return pid_execute(fb, setpoint, measurement);
+    }
+
+    /* 时间未推进：无法求差商也没有积分量，保持上次的测量值、积分与输出（限幅状态码保留） */
+    if (dt == 0.0f) {
+        if (fb->state.status < 0) {
+            fb->state.status = FB_STATUS_OK;
+        }
+        return fb->state.prev_output;
+    }
+
+    return pid_update(fb, setpoint, measurement, dt);
+}
+
+float FB_PID_Execute(FB_PID_t* fb, float setpoint, float measurement) {
+    PLCOPEN_PROBE_ENTRY(pid, fb, setpoint, measurement);
+    PLCOPEN_PROF_BEGIN();
+    float output = pid_execute(fb, setpoint, measurement);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(pid, fb, output, fb->state.status);
+    return output;
+}
+
+float FB_PID_ExecuteDt(FB_PID_t* fb, float setpoint, float measurement, float dt) {
+    PLCOPEN_PROBE_ENTRY(pid, fb, setpoint, measurement);
+    PLCOPEN_PROF_BEGIN();
+    float output = pid_execute_dt(fb, setpoint, measurement, dt);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(pid, fb, output, fb->state.status);
+    return output;
+}
+
 /**
  * @brief 切换到手动模式
  */
@@ -190,6 +267,7 @@ void FB_PID_SetManual(FB_PID_t* fb, float manual_output) {
     fb->state.prev_output = manual_output;
     fb->state.manual_mode = true;
     fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROBE_SET_MANUAL(pid, fb, manual_output);
 }
 
 /**
@@ -197,6 +275,7 @@ void FB_PID_SetManual(FB_PID_t* fb, float manual_output) {
  */
 void FB_PID_SetAuto(FB_PID_t* fb) {
     fb->state.manual_mode = false;
+    PLCOPEN_PROBE_SET_AUTO(pid, fb);
     /* 积分器已在手动模式时跟踪输出，无需额外调整 */
     /* 切换时不会产生输出跳变 */
 }
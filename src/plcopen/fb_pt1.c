@@ -6,10 +6,11 @@
  */
 
 #include "plcopen/fb_pt1.h"
+#include "plcopen/probes.h"
 #include <string.h>
 
-FB_Status_t FB_PT1_Init(FB_PT1_t* fb, const FB_PT1_Config_t* config) {
-    if (fb == NULL || config == NULL) {
+FB_Status_t FB_PT1_ValidateConfig(const FB_PT1_Config_t* config) {
+    if (config == NULL) {
         return FB_STATUS_ERROR_CONFIG;
     }
 
@@ -21,16 +22,26 @@ FB_Status_t FB_PT1_Init(FB_PT1_t* fb, const FB_PT1_Config_t* config) {
         return FB_STATUS_ERROR_CONFIG;
     }
 
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_PT1_Init(FB_PT1_t* fb, const FB_PT1_Config_t* config) {
+    if (fb == NULL || FB_PT1_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
     memcpy(&fb->config, config, sizeof(FB_PT1_Config_t));
 
     fb->state.output = 0.0f;
     fb->state.first_run = true;
     fb->state.status = FB_STATUS_OK;
 
+    PLCOPEN_PROF_REGISTER(fb, "FB_PT1");
+    PLCOPEN_PROBE_INIT(pt1, fb, config);
     return FB_STATUS_OK;
 }
 
-float FB_PT1_Execute(FB_PT1_t* fb, float input) {
+static inline float pt1_execute(FB_PT1_t* fb, float input) {
     if (check_nan(input)) {
         fb->state.status = FB_STATUS_ERROR_NAN;
         return 0.0f;
@@ -59,3 +70,119 @@ float FB_PT1_Execute(FB_PT1_t* fb, float input) {
     fb->state.status = FB_STATUS_OK;
     return fb->state.output;
 }
+
+/* 可变步长：零阶保持精确离散化 α = 1 - exp(-dt/τ)，dt 为实测的间隔 */
+static inline float pt1_execute_dt(FB_PT1_t* fb, float input, float dt) {
+    if (check_nan(input)) {
+        fb->state.status = FB_STATUS_ERROR_NAN;
+        return 0.0f;
+    }
+
+    if (check_inf(input)) {
+        fb->state.status = FB_STATUS_ERROR_INF;
+        return 0.0f;
+    }
+
+    FB_Status_t dt_status = check_elapsed_time(dt);
+    if (dt_status != FB_STATUS_OK) {
+        fb->state.status = dt_status;
+        return 0.0f;
+    }
+
+    if (fb->state.first_run) {
+        fb->state.output = input;
+        fb->state.first_run = false;
+        fb->state.status = FB_STATUS_OK;
+        return input;
+    }
+
+    float alpha = -fast_expm1f(-dt / fb->config.time_constant);
+    fb->state.output += alpha * (input - fb->state.output);
+
+    fb->state.status = FB_STATUS_OK;
+    return fb->state.output;
+}
+
+/* 块处理：整块输入有限时 α 只计算一次，输出状态保存在局部变量中 */
+static void pt1_execute_block(FB_PT1_t* fb, const float* input, float* output, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (!check_block_finite(input, n)) {
+        for (size_t i = 0; i < n; i++) {
+            output[i] = pt1_execute(fb, input[i]);
+        }
+        return;
+    }
+
+    size_t i = 0;
+    if (fb->state.first_run) {
+        output[0] = pt1_execute(fb, input[0]);
+        i = 1;
+    }
+
+    float alpha = fb->config.sample_time /
+                  (fb->config.time_constant + fb->config.sample_time);
+    float y = fb->state.output;
+    for (; i < n; i++) {
+        y += alpha * (input[i] - y);
+        output[i] = y;
+    }
+
+    fb->state.output = y;
+    fb->state.status = FB_STATUS_OK;
+}
+
+/* 快进 k 个周期（输入保持不变）：第一个周期按 Execute 执行，其余周期用闭式解 */
+static float pt1_advance(FB_PT1_t* fb, float input, uint32_t k) {
+    if (k == 0u) {
+        return fb->state.output;
+    }
+
+    /* 第一个周期按 Execute 执行：首次运行与 NaN/Inf 的处理保持一致 */
+    float output = pt1_execute(fb, input);
+    if (k == 1u || check_nan_inf(input)) {
+        return output;
+    }
+
+    /* 其余 k-1 个周期输入不变：y = u + (y - u)(1 - α)^(k-1) */
+    float alpha = fb->config.sample_time /
+                  (fb->config.time_constant + fb->config.sample_time);
+    fb->state.output = input + (output - input) * decay_factor(alpha, k - 1u);
+    return fb->state.output;
+}
+
+float FB_PT1_Execute(FB_PT1_t* fb, float input) {
+    PLCOPEN_PROBE_ENTRY(pt1, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = pt1_execute(fb, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(pt1, fb, output, fb->state.status);
+    return output;
+}
+
+float FB_PT1_ExecuteDt(FB_PT1_t* fb, float input, float dt) {
+    PLCOPEN_PROBE_ENTRY(pt1, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = pt1_execute_dt(fb, input, dt);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(pt1, fb, output, fb->state.status);
+    return output;
+}
+
+void FB_PT1_ExecuteBlock(FB_PT1_t* fb, const float* input, float* output, size_t n) {
+    PLCOPEN_PROBE_ENTRY(pt1, fb, (n > 0) ? input[0] : 0.0f, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    pt1_execute_block(fb, input, output, n);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(pt1, fb, (n > 0) ? output[n - 1] : 0.0f, fb->state.status);
+}
+
+float FB_PT1_Advance(FB_PT1_t* fb, float input, uint32_t k) {
+    PLCOPEN_PROBE_ENTRY(pt1, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = pt1_advance(fb, input, k);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(pt1, fb, output, fb->state.status);
+    return output;
+}
@@ -4,22 +4,30 @@
  */
 
 #include "plcopen/fb_ramp.h"
+#include "plcopen/probes.h"
 #include <string.h>
 #include <math.h>
 
+FB_Status_t FB_RAMP_ValidateConfig(const FB_RAMP_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->rise_rate <= 0.0f || config->fall_rate <= 0.0f) return FB_STATUS_ERROR_CONFIG;
+    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
 int FB_RAMP_Init(FB_RAMP_t* fb, const FB_RAMP_Config_t* config) {
-    if (fb == NULL || config == NULL) return -1;
-    if (config->rise_rate <= 0.0f || config->fall_rate <= 0.0f) return -1;
-    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return -1;
+    if (fb == NULL || FB_RAMP_ValidateConfig(config) != FB_STATUS_OK) return -1;
 
     memcpy(&fb->config, config, sizeof(FB_RAMP_Config_t));
     fb->state.output = 0.0f;
     fb->state.first_run = true;
     fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_RAMP");
+    PLCOPEN_PROBE_INIT(ramp, fb, config);
     return 0;
 }
 
-float FB_RAMP_Execute(FB_RAMP_t* fb, float target) {
+static inline float ramp_execute(FB_RAMP_t* fb, float target) {
     if (check_nan_inf(target)) {
         fb->state.status = check_nan(target) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
         return fb->state.output;
@@ -45,3 +53,133 @@ float FB_RAMP_Execute(FB_RAMP_t* fb, float target) {
     fb->state.status = FB_STATUS_OK;
     return fb->state.output;
 }
+
+/* 可变步长：本周期允许的最大变化量为 rate·dt */
+static inline float ramp_execute_dt(FB_RAMP_t* fb, float target, float dt) {
+    if (check_nan_inf(target)) {
+        fb->state.status = check_nan(target) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+        return fb->state.output;
+    }
+
+    FB_Status_t dt_status = check_elapsed_time(dt);
+    if (dt_status != FB_STATUS_OK) {
+        fb->state.status = dt_status;
+        return fb->state.output;
+    }
+
+    if (fb->state.first_run) {
+        fb->state.output = target;
+        fb->state.first_run = false;
+        fb->state.status = FB_STATUS_OK;
+        return target;
+    }
+
+    float error = target - fb->state.output;
+    float rate = (error > 0.0f) ? fb->config.rise_rate : fb->config.fall_rate;
+    float max_change = rate * dt;
+
+    if (fabsf(error) <= max_change) {
+        fb->state.output = target;
+    } else {
+        fb->state.output += (error > 0.0f) ? max_change : -max_change;
+    }
+
+    fb->state.status = FB_STATUS_OK;
+    return fb->state.output;
+}
+
+/* 块处理：整块目标值有限时每周期最大变化量只计算一次，输出保存在局部变量中 */
+static void ramp_execute_block(FB_RAMP_t* fb, const float* target, float* output, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (!check_block_finite(target, n)) {
+        for (size_t i = 0; i < n; i++) {
+            output[i] = ramp_execute(fb, target[i]);
+        }
+        return;
+    }
+
+    size_t i = 0;
+    if (fb->state.first_run) {
+        output[0] = ramp_execute(fb, target[0]);
+        i = 1;
+    }
+
+    float max_rise = fb->config.rise_rate * fb->config.sample_time;
+    float max_fall = fb->config.fall_rate * fb->config.sample_time;
+    float y = fb->state.output;
+    for (; i < n; i++) {
+        float error = target[i] - y;
+        float max_change = (error > 0.0f) ? max_rise : max_fall;
+        if (fabsf(error) <= max_change) {
+            y = target[i];
+        } else {
+            y += (error > 0.0f) ? max_change : -max_change;
+        }
+        output[i] = y;
+    }
+
+    fb->state.output = y;
+    fb->state.status = FB_STATUS_OK;
+}
+
+/* 快进 k 个周期（目标保持不变）：第一个周期按 Execute 执行，其余周期用闭式解 */
+static float ramp_advance(FB_RAMP_t* fb, float target, uint32_t k) {
+    if (k == 0u) {
+        return fb->state.output;
+    }
+
+    /* 第一个周期按 Execute 执行：首次运行与 NaN/Inf 的处理保持一致 */
+    float output = ramp_execute(fb, target);
+    if (k == 1u || check_nan_inf(target)) {
+        return output;
+    }
+
+    /* 其余 k-1 个周期目标不变：以固定速率逼近，到达后停在目标值 */
+    float error = target - output;
+    float rate = (error > 0.0f) ? fb->config.rise_rate : fb->config.fall_rate;
+    float max_change = rate * fb->config.sample_time * (float)(k - 1u);
+
+    if (fabsf(error) <= max_change) {
+        fb->state.output = target;
+    } else {
+        fb->state.output += (error > 0.0f) ? max_change : -max_change;
+    }
+    return fb->state.output;
+}
+
+float FB_RAMP_Execute(FB_RAMP_t* fb, float target) {
+    PLCOPEN_PROBE_ENTRY(ramp, fb, target, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = ramp_execute(fb, target);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(ramp, fb, output, fb->state.status);
+    return output;
+}
+
+float FB_RAMP_ExecuteDt(FB_RAMP_t* fb, float target, float dt) {
+    PLCOPEN_PROBE_ENTRY(ramp, fb, target, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = ramp_execute_dt(fb, target, dt);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(ramp, fb, output, fb->state.status);
+    return output;
+}
+
+void FB_RAMP_ExecuteBlock(FB_RAMP_t* fb, const float* target, float* output, size_t n) {
+    PLCOPEN_PROBE_ENTRY(ramp, fb, (n > 0) ? target[0] : 0.0f, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    ramp_execute_block(fb, target, output, n);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(ramp, fb, (n > 0) ? output[n - 1] : 0.0f, fb->state.status);
+}
+
+float FB_RAMP_Advance(FB_RAMP_t* fb, float target, uint32_t k) {
+    PLCOPEN_PROBE_ENTRY(ramp, fb, target, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = ramp_advance(fb, target, k);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(ramp, fb, output, fb->state.status);
+    return output;
+}
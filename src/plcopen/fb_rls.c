@@ -0,0 +1,242 @@
+/**
+ * @file fb_rls.c
+ * @brief PLCopen 递推最小二乘在线辨识功能块实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#include "plcopen/fb_rls.h"
+#include "plcopen/probes.h"
+#include <math.h>
+#include <string.h>
+
+#define RP FB_RLS_MAX_PARAMS
+
+/*
+ * 更新内核强制内联到 rls_execute 中按参数个数的分支：FOPDT 辨识常用的 2 ~ 5 个参数
+ * （na = 1 ~ 2，nb = 1 ~ 2，有无偏置）各得到一份循环次数为常量的副本，其余个数走通用路径。
+ */
+#if defined(__GNUC__)
+#define RLS_INLINE static inline __attribute__((always_inline))
+#else
+#define RLS_INLINE static inline
+#endif
+
+/* 开始更新前需要的历史长度 max(na, d + nb) */
+static inline unsigned rls_required(const FB_RLS_Config_t* c, const FB_RLS_State_t* s) {
+    return (c->na > s->u_length) ? c->na : s->u_length;
+}
+
+/* φ = [−y(k−1) … −y(k−na), u(k−d−1) … u(k−d−nb), 1] */
+static inline void rls_regressor(const FB_RLS_Config_t* c, const FB_RLS_State_t* s, float* phi) {
+    unsigned na = c->na;
+    for (unsigned i = 0; i < na; i++) {
+        phi[i] = -s->y_history[i];
+    }
+    /* u_head 处为 u(k−1)，向前回退 d 个位置得到 u(k−d−1) */
+    unsigned length = s->u_length;
+    unsigned index = s->u_head + length - c->delay;
+    if (index >= length) index -= length;
+    for (unsigned j = 0; j < c->nb; j++) {
+        phi[na + j] = s->u_history[index];
+        index = (index == 0u) ? length - 1u : index - 1u;
+    }
+    if (c->bias) {
+        phi[s->params - 1u] = 1.0f;
+    }
+}
+
+/*
+ * Bierman 测量更新（测量方差取 λ），再将 D 除以 λ 完成遗忘：
+ *   f = Uᵀ·φ，v = D·f，α₀ = λ
+ *   对 j = 0 … n−1：α_j = α_{j−1} + v_j·f_j，d_j ← d_j·α_{j−1} / (α_j·λ)，
+ *                  U[i][j] ← U[i][j] − f_j / α_{j−1}·k_i，k_i ← k_i + U[i][j]（旧值）·v_j（i < j），k_j = v_j
+ *   θ ← θ + k·e / α_{n−1}
+ * 每列一次除法：q = 1 / (α_j·λ) 同时给出 d_j 的缩放与下一列所需的 1 / α_j = λ·q。
+ * α 只累加非负项且不小于 λ，d_j 只被正数乘除，因此 D 始终为正。
+ */
+RLS_INLINE FB_Status_t rls_update(FB_RLS_State_t* s, const float* phi, unsigned n, float error,
+                                     float lambda, float limit) {
+    float f[RP], v[RP], k[RP];
+    float alpha_total = lambda;
+    const float* column = s->u;
+    for (unsigned j = 0; j < n; j++) {
+        float sum = phi[j];
+        for (unsigned i = 0; i < j; i++) {
+            sum += column[i] * phi[i];
+        }
+        column += j;
+        f[j] = sum;
+        v[j] = s->d[j] * sum;
+        alpha_total += v[j] * sum;
+    }
+    /* 回归向量量级过大使 φᵀ·P·φ 溢出时不更新，避免破坏分解 */
+    if (check_nan_inf(alpha_total) || check_nan_inf(error)) {
+        return FB_STATUS_ERROR_INF;
+    }
+
+    float alpha = lambda;
+    float inv_alpha = 0.0f;
+    float* u = s->u;
+    for (unsigned j = 0; j < n; j++) {
+        float previous = alpha;
+        alpha += v[j] * f[j];
+        float scale = -f[j] * inv_alpha;
+        for (unsigned i = 0; i < j; i++) {
+            float uij = u[i];
+            u[i] = uij + k[i] * scale;
+            k[i] += uij * v[j];
+        }
+        u += j;
+        k[j] = v[j];
+
+        float q = 1.0f / (alpha * lambda);
+        float dj = s->d[j] * previous * q;
+        s->d[j] = (dj < limit) ? dj : limit;
+        inv_alpha = lambda * q;
+    }
+
+    float step = error * inv_alpha;
+    for (unsigned j = 0; j < n; j++) {
+        s->theta[j] += k[j] * step;
+    }
+    return FB_STATUS_OK;
+}
+
+/* 记录本周期的 y(k) 与 u(k)，成为下一周期的 y(k−1) 与 u(k−1) */
+static inline void rls_push(const FB_RLS_Config_t* c, FB_RLS_State_t* s, float input, float output) {
+    if (c->na != 0u) {
+        for (unsigned i = c->na - 1u; i > 0u && i < FB_RLS_MAX_ORDER; i--) {
+            s->y_history[i] = s->y_history[i - 1u];
+        }
+        s->y_history[0] = output;
+    }
+    unsigned head = s->u_head + 1u;
+    if (head >= s->u_length) head = 0u;
+    s->u_history[head] = input;
+    s->u_head = (uint8_t)head;
+    if (s->samples < rls_required(c, s)) {
+        s->samples++;
+    }
+}
+
+FB_Status_t FB_RLS_ValidateConfig(const FB_RLS_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (check_nan_inf(config->sample_time) || config->sample_time <= 0.0f) return FB_STATUS_ERROR_CONFIG;
+    if (check_nan_inf(config->forgetting) || config->forgetting < 0.9f || config->forgetting > 1.0f) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+    if (check_nan_inf(config->initial_covariance) || config->initial_covariance <= 0.0f) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+    if (config->na > FB_RLS_MAX_ORDER) return FB_STATUS_ERROR_CONFIG;
+    if (config->nb < 1 || config->nb > FB_RLS_MAX_ORDER) return FB_STATUS_ERROR_CONFIG;
+    if (config->delay > FB_RLS_MAX_DELAY) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
+int FB_RLS_Init(FB_RLS_t* fb, const FB_RLS_Config_t* config) {
+    if (fb == NULL || FB_RLS_ValidateConfig(config) != FB_STATUS_OK) return -1;
+
+    memcpy(&fb->config, config, sizeof(FB_RLS_Config_t));
+    memset(&fb->state, 0, sizeof(FB_RLS_State_t));
+    fb->state.params = (uint8_t)(config->na + config->nb + (config->bias ? 1u : 0u));
+    fb->state.u_length = (uint8_t)(config->delay + config->nb);
+    FB_RLS_ResetCovariance(fb);
+    fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_RLS");
+    PLCOPEN_PROBE_INIT(rls, fb, config);
+    return 0;
+}
+
+void FB_RLS_ResetCovariance(FB_RLS_t* fb) {
+    if (fb == NULL) {
+        return;
+    }
+    memset(fb->state.u, 0, sizeof(fb->state.u));
+    for (unsigned j = 0; j < fb->state.params; j++) {
+        fb->state.d[j] = fb->config.initial_covariance;
+    }
+}
+
+static inline float rls_execute(FB_RLS_t* fb, float input, float output) {
+    const FB_RLS_Config_t* c = &fb->config;
+    FB_RLS_State_t* s = &fb->state;
+
+    if (check_nan_inf(input) || check_nan_inf(output)) {
+        s->status = (check_nan(input) || check_nan(output)) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+        s->samples = 0u;
+        s->error = 0.0f;
+        return 0.0f;
+    }
+
+    FB_Status_t status = FB_STATUS_OK;
+    float error = 0.0f;
+    if (s->samples >= rls_required(c, s)) {
+        float phi[RP];
+        rls_regressor(c, s, phi);
+        unsigned n = s->params;
+        float prediction = 0.0f;
+        for (unsigned j = 0; j < n; j++) {
+            prediction += phi[j] * s->theta[j];
+        }
+        error = output - prediction;
+        float lambda = c->forgetting;
+        float limit = c->initial_covariance;
+        switch (n) {
+        case 2: status = rls_update(s, phi, 2, error, lambda, limit); break;
+        case 3: status = rls_update(s, phi, 3, error, lambda, limit); break;
+#if RP >= 4
+        case 4: status = rls_update(s, phi, 4, error, lambda, limit); break;
+#endif
+#if RP >= 5
+        case 5: status = rls_update(s, phi, 5, error, lambda, limit); break;
+#endif
+        default: status = rls_update(s, phi, n, error, lambda, limit); break;
+        }
+        if (status != FB_STATUS_OK) {
+            error = 0.0f;
+        }
+    }
+    rls_push(c, s, input, output);
+    s->error = error;
+    s->status = status;
+    return error;
+}
+
+float FB_RLS_Execute(FB_RLS_t* fb, float input, float output) {
+    PLCOPEN_PROBE_ENTRY(rls, fb, input, output);
+    PLCOPEN_PROF_BEGIN();
+    float error = rls_execute(fb, input, output);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(rls, fb, error, fb->state.status);
+    return error;
+}
+
+FB_Status_t FB_RLS_GetFOPDT(const FB_RLS_t* fb, FB_RLS_FOPDT_t* model) {
+    if (fb == NULL || model == NULL || fb->config.na != 1u) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+    const float* theta = fb->state.theta;
+    float pole = -theta[0];
+    if (!(pole > 0.0f && pole < 1.0f)) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    float sum = 0.0f;
+    float moment = 0.0f;
+    for (unsigned j = 0; j < fb->config.nb; j++) {
+        sum += theta[1u + j];
+        moment += (float)j * theta[1u + j];
+    }
+    /* b 的加权位置给出非整数滞后部分，噪声使其越界时截断到 [0, nb − 1] */
+    float fraction = (sum != 0.0f) ? moment / sum : 0.0f;
+    float span = (float)(fb->config.nb - 1u);
+    fraction = (fraction < 0.0f) ? 0.0f : ((fraction > span) ? span : fraction);
+
+    float ts = fb->config.sample_time;
+    model->gain = sum / (1.0f - pole);
+    model->time_constant = -ts / logf(pole);
+    model->dead_time = ((float)fb->config.delay + fraction) * ts;
+    return FB_STATUS_OK;
+}
@@ -0,0 +1,304 @@
+/**
+ * @file fb_scurve.c
+ * @brief PLCopen S 曲线设定值发生器实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#include "plcopen/fb_scurve.h"
+#include "plcopen/probes.h"
+#include <string.h>
+#include <math.h>
+
+/* 峰值速度二分次数：区间缩小到 2^-24，与单精度尾数相当 */
+#define SCURVE_BISECT_STEPS 24
+
+/* 一个方向的运动上限 */
+typedef struct {
+    float rate;
+    float accel;
+    float jerk;
+} scurve_limits_t;
+
+/* 规划过程中的运动状态，以及已写入的段数 */
+typedef struct {
+    FB_SCURVE_Segment_t* segments;
+    uint8_t count;
+    float pos;
+    float vel;
+    float acc;
+} scurve_plan_t;
+
+static bool positive_or_inf(float value) {
+    return value > 0.0f && !check_nan(value);
+}
+
+static bool positive_finite(float value) {
+    return value > 0.0f && !check_nan_inf(value);
+}
+
+FB_Status_t FB_SCURVE_ValidateConfig(const FB_SCURVE_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (!positive_finite(config->rise_rate) || !positive_finite(config->fall_rate)) return FB_STATUS_ERROR_CONFIG;
+    if (!positive_or_inf(config->rise_accel) || !positive_or_inf(config->fall_accel)) return FB_STATUS_ERROR_CONFIG;
+    if (!positive_or_inf(config->rise_jerk) || !positive_or_inf(config->fall_jerk)) return FB_STATUS_ERROR_CONFIG;
+    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
+int FB_SCURVE_Init(FB_SCURVE_t* fb, const FB_SCURVE_Config_t* config) {
+    if (fb == NULL || FB_SCURVE_ValidateConfig(config) != FB_STATUS_OK) return -1;
+
+    memcpy(&fb->config, config, sizeof(FB_SCURVE_Config_t));
+    memset(&fb->state, 0, sizeof(FB_SCURVE_State_t));
+    fb->state.first_run = true;
+    fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_SCURVE");
+    PLCOPEN_PROBE_INIT(scurve, fb, config);
+    return 0;
+}
+
+static scurve_limits_t scurve_limits(const FB_SCURVE_Config_t* config, float direction) {
+    scurve_limits_t limits;
+    if (direction > 0.0f) {
+        limits.rate = config->rise_rate;
+        limits.accel = config->rise_accel;
+        limits.jerk = config->rise_jerk;
+    } else {
+        limits.rate = config->fall_rate;
+        limits.accel = config->fall_accel;
+        limits.jerk = config->fall_jerk;
+    }
+    return limits;
+}
+
+/*
+ * 在 a = 0 的两个状态之间改变速度 dv（>= 0）：加加速度段 tj、恒加速度段 ta、加加速度段 tj。
+ * 加速度上限不可达时 ta = 0；加加速度为 +Inf 时 tj = 0（梯形）；两者都为 +Inf 时速度跳变。
+ */
+static void velocity_change_times(float dv, const scurve_limits_t* limits, float* tj, float* ta) {
+    if (check_inf(limits->jerk)) {
+        *tj = 0.0f;
+        *ta = check_inf(limits->accel) ? 0.0f : dv / limits->accel;
+    } else if (dv * limits->jerk < limits->accel * limits->accel) {
+        *tj = sqrtf(dv / limits->jerk);
+        *ta = 0.0f;
+    } else {
+        *tj = limits->accel / limits->jerk;
+        *ta = dv / limits->accel - *tj;
+    }
+}
+
+/* 速度从 v0 变到 v1（同号或为 0）经过的距离：加速度曲线对称，平均速度为 (v0 + v1) / 2 */
+static float velocity_change_distance(float v0, float v1, const scurve_limits_t* limits) {
+    float tj;
+    float ta;
+    velocity_change_times(fabsf(v1 - v0), limits, &tj, &ta);
+    return 0.5f * (v0 + v1) * (2.0f * tj + ta);
+}
+
+/* 追加一段并把规划状态推进到段终点；时长为 0 的段不写入 */
+static void plan_push(scurve_plan_t* plan, float duration, float jerk) {
+    if (!(duration > 0.0f)) {
+        return;
+    }
+    FB_SCURVE_Segment_t* seg = &plan->segments[plan->count++];
+    seg->duration = duration;
+    seg->jerk = jerk;
+    seg->acc = plan->acc;
+    seg->vel = plan->vel;
+    seg->pos = plan->pos;
+
+    float t = duration;
+    plan->pos += t * (plan->vel + t * (0.5f * plan->acc + t * (jerk / 6.0f)));
+    plan->vel += t * (plan->acc + t * (0.5f * jerk));
+    plan->acc += t * jerk;
+}
+
+/* 从当前速度（a = 0）改变到 v1，方向 sign(v1 - vel) 的加速度用 limits */
+static void plan_velocity_change(scurve_plan_t* plan, float v1, const scurve_limits_t* limits) {
+    float dv = v1 - plan->vel;
+    float sign = (dv > 0.0f) ? 1.0f : -1.0f;
+    float tj;
+    float ta;
+    velocity_change_times(fabsf(dv), limits, &tj, &ta);
+
+    if (tj > 0.0f) {
+        plan_push(plan, tj, sign * limits->jerk);
+    } else {
+        plan->acc = sign * limits->accel;  /* 加加速度为 +Inf：加速度跳变 */
+    }
+    plan_push(plan, ta, 0.0f);
+    plan_push(plan, tj, -sign * limits->jerk);
+
+    /* 消除推进中的舍入：段终点的速度与加速度精确等于规划值 */
+    plan->vel = v1;
+    plan->acc = 0.0f;
+}
+
+static void scurve_plan(FB_SCURVE_t* fb, float target) {
+    const FB_SCURVE_Config_t* config = &fb->config;
+    scurve_plan_t plan = {
+        fb->state.segments, 0, fb->state.output, fb->state.velocity, fb->state.acceleration
+    };
+
+    /* 1. 加速度归零：按运动方向的加加速度上限 */
+    if (plan.acc != 0.0f) {
+        scurve_limits_t limits = scurve_limits(config, (plan.vel != 0.0f) ? plan.vel : plan.acc);
+        if (check_inf(limits.jerk)) {
+            plan.acc = 0.0f;
+        } else {
+            float sign = (plan.acc > 0.0f) ? 1.0f : -1.0f;
+            plan_push(&plan, fabsf(plan.acc) / limits.jerk, -sign * limits.jerk);
+            plan.acc = 0.0f;
+        }
+    }
+
+    /* 2. 远离目标，或无法在目标前停下：先停止 */
+    float direction = (target >= plan.pos) ? 1.0f : -1.0f;
+    scurve_limits_t limits = scurve_limits(config, direction);
+    float speed = direction * plan.vel;
+    bool stop = false;
+    if (speed < 0.0f) {
+        limits = scurve_limits(config, -direction);
+        stop = true;
+    } else if (speed > 0.0f) {
+        stop = velocity_change_distance(speed, 0.0f, &limits) > direction * (target - plan.pos);
+    }
+    if (stop) {
+        plan_velocity_change(&plan, 0.0f, &limits);
+        direction = (target >= plan.pos) ? 1.0f : -1.0f;
+        limits = scurve_limits(config, direction);
+    }
+    speed = direction * plan.vel;
+    float distance = direction * (target - plan.pos);
+
+    /* 3. 峰值速度：上限可达时取上限，否则二分求能恰好停在目标值的最大峰值 */
+    float peak = fmaxf(limits.rate, speed);
+    if (velocity_change_distance(speed, peak, &limits) + velocity_change_distance(peak, 0.0f, &limits) >
+        distance) {
+        float lo = speed;
+        float hi = peak;
+        for (int i = 0; i < SCURVE_BISECT_STEPS; i++) {
+            float mid = 0.5f * (lo + hi);
+            if (velocity_change_distance(speed, mid, &limits) + velocity_change_distance(mid, 0.0f, &limits) <=
+                distance) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        peak = lo;
+    }
+
+    if (peak > 0.0f) {
+        plan_velocity_change(&plan, direction * peak, &limits);
+        float braking = velocity_change_distance(peak, 0.0f, &limits);
+        float cruise = direction * (target - plan.pos) - braking;
+        plan_push(&plan, cruise / peak, 0.0f);
+        plan_velocity_change(&plan, 0.0f, &limits);
+    }
+
+    fb->state.target = target;
+    fb->state.segment = 0;
+    fb->state.segment_count = plan.count;
+    fb->state.time_offset = 0.0f;
+    fb->state.cycles = 0;
+}
+
+/* 加速度与加加速度上限全为 +Inf：与 FB_RAMP 相同的逐周期速率限制 */
+static inline float scurve_rate_limit(FB_SCURVE_t* fb, float target) {
+    float error = target - fb->state.output;
+    float rate = (error > 0.0f) ? fb->config.rise_rate : fb->config.fall_rate;
+    float max_change = rate * fb->config.sample_time;
+
+    float previous = fb->state.output;
+    if (fabsf(error) <= max_change) {
+        fb->state.output = target;
+    } else {
+        fb->state.output += (error > 0.0f) ? max_change : -max_change;
+    }
+    fb->state.velocity = (fb->state.output - previous) / fb->config.sample_time;
+    fb->state.acceleration = 0.0f;
+    fb->state.target = target;
+    return fb->state.output;
+}
+
+static inline bool scurve_is_ramp(const FB_SCURVE_Config_t* config) {
+    return check_inf(config->rise_accel) && check_inf(config->fall_accel) &&
+           check_inf(config->rise_jerk) && check_inf(config->fall_jerk);
+}
+
+/* 沿已规划的段前进一个周期并在当前段上求值 */
+static inline float scurve_follow(FB_SCURVE_t* fb) {
+    FB_SCURVE_State_t* s = &fb->state;
+    if (s->segment >= s->segment_count) {
+        s->output = s->target;
+        s->velocity = 0.0f;
+        s->acceleration = 0.0f;
+        return s->output;
+    }
+
+    s->cycles++;
+    float t = s->time_offset + (float)s->cycles * fb->config.sample_time;
+    while (t >= s->segments[s->segment].duration) {
+        t -= s->segments[s->segment].duration;
+        s->time_offset = t;
+        s->cycles = 0;
+        if (++s->segment >= s->segment_count) {
+            /* 最后一段结束：精确停在目标值 */
+            s->output = s->target;
+            s->velocity = 0.0f;
+            s->acceleration = 0.0f;
+            return s->output;
+        }
+    }
+
+    const FB_SCURVE_Segment_t* seg = &s->segments[s->segment];
+    s->acceleration = seg->acc + t * seg->jerk;
+    s->velocity = seg->vel + t * (seg->acc + t * (0.5f * seg->jerk));
+    s->output = seg->pos + t * (seg->vel + t * (0.5f * seg->acc + t * (seg->jerk / 6.0f)));
+    return s->output;
+}
+
+static inline float scurve_execute(FB_SCURVE_t* fb, float target) {
+    bool ramp = scurve_is_ramp(&fb->config);
+
+    if (check_nan_inf(target)) {
+        fb->state.status = check_nan(target) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+        /* S 曲线模式继续走完已规划的段；速率限制模式同 FB_RAMP 保持输出 */
+        if (!ramp && !fb->state.first_run) {
+            scurve_follow(fb);
+        }
+        return fb->state.output;
+    }
+
+    if (fb->state.first_run) {
+        fb->state.output = target;
+        fb->state.velocity = 0.0f;
+        fb->state.acceleration = 0.0f;
+        fb->state.target = target;
+        fb->state.segment_count = 0;
+        fb->state.first_run = false;
+        fb->state.status = FB_STATUS_OK;
+        return target;
+    }
+
+    fb->state.status = FB_STATUS_OK;
+    if (ramp) {
+        return scurve_rate_limit(fb, target);
+    }
+    if (target != fb->state.target) {
+        scurve_plan(fb, target);
+    }
+    return scurve_follow(fb);
+}
+
+float FB_SCURVE_Execute(FB_SCURVE_t* fb, float target) {
+    PLCOPEN_PROBE_ENTRY(scurve, fb, target, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = scurve_execute(fb, target);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(scurve, fb, output, fb->state.status);
+    return output;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file fb_sgderiv.c
+ * @brief PLCopen 滑动窗口最小二乘（Savitzky–Golay）微分器实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#include "plcopen/fb_sgderiv.h"
+#include "plcopen/probes.h"
+#include <string.h>
+
+FB_Status_t FB_SGDERIV_ValidateConfig(const FB_SGDERIV_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->sample_time <= 0.0f || config->sample_time >= MAX_SAMPLE_TIME) return FB_STATUS_ERROR_CONFIG;
+    if (config->window < 2 || config->window > FB_SGDERIV_MAX_WINDOW) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
+int FB_SGDERIV_Init(FB_SGDERIV_t* fb, const FB_SGDERIV_Config_t* config) {
+    if (fb == NULL || FB_SGDERIV_ValidateConfig(config) != FB_STATUS_OK) return -1;
+
+    memcpy(&fb->config, config, sizeof(FB_SGDERIV_Config_t));
+    memset(&fb->state, 0, sizeof(FB_SGDERIV_State_t));
+
+    /* Σ (j - c)² = N(N² - 1) / 12，以 double 计算避免大窗口时的整数溢出 */
+    double n = (double)config->window;
+    fb->state.center = 0.5f * (float)(config->window - 1);
+    fb->state.gain = (float)(12.0 / ((double)config->sample_time * n * (n * n - 1.0)));
+    fb->state.first_run = true;
+    fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_SGDERIV");
+    PLCOPEN_PROBE_INIT(sgderiv, fb, config);
+    return 0;
+}
+
+/* 以 input 填满窗口：和相对 input 为 0，影子和从下一个采样开始 */
+static void sgderiv_fill(FB_SGDERIV_t* fb, float input) {
+    FB_SGDERIV_State_t* s = &fb->state;
+    for (uint16_t i = 0; i < fb->config.window; i++) {
+        s->history[i] = input;
+    }
+    s->sum = 0.0f;
+    s->moment = 0.0f;
+    s->ref = input;
+    s->shadow_sum = 0.0f;
+    s->shadow_moment = 0.0f;
+    s->shadow_count = 0;
+    s->head = 0;
+    s->output = 0.0f;
+}
+
+static inline float sgderiv_execute(FB_SGDERIV_t* fb, float input) {
+    FB_SGDERIV_State_t* s = &fb->state;
+    if (check_nan_inf(input)) {
+        s->status = check_nan(input) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+        return 0.0f;
+    }
+
+    if (s->first_run) {
+        sgderiv_fill(fb, input);
+        s->first_run = false;
+        s->status = FB_STATUS_OK;
+        return 0.0f;
+    }
+
+    uint16_t window = fb->config.window;
+    float newest = (float)(window - 1);
+
+    /* 窗口滑动一格：最旧采样移出，其余采样下标减 1，新采样下标为 N - 1 */
+    float dropped = s->history[s->head] - s->ref;
+    float added = input - s->ref;
+    s->moment += newest * added - (s->sum - dropped);
+    s->sum += added - dropped;
+    s->history[s->head] = input;
+    s->head = (uint16_t)((s->head + 1u == window) ? 0u : s->head + 1u);
+
+    /* 影子和：满一个窗口时恰好覆盖当前窗口，替换递推和以清除累积的舍入 */
+    if (s->shadow_count == 0) {
+        s->shadow_ref = input;
+    }
+    float fresh = input - s->shadow_ref;
+    s->shadow_moment += (float)s->shadow_count * fresh;
+    s->shadow_sum += fresh;
+    if (++s->shadow_count == window) {
+        s->sum = s->shadow_sum;
+        s->moment = s->shadow_moment;
+        s->ref = s->shadow_ref;
+        s->shadow_sum = 0.0f;
+        s->shadow_moment = 0.0f;
+        s->shadow_count = 0;
+    }
+
+    s->output = (s->moment - s->center * s->sum) * s->gain;
+    s->status = FB_STATUS_OK;
+    return s->output;
+}
+
+float FB_SGDERIV_Execute(FB_SGDERIV_t* fb, float input) {
+    PLCOPEN_PROBE_ENTRY(sgderiv, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = sgderiv_execute(fb, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(sgderiv, fb, output, fb->state.status);
+    return output;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file fb_shared.c
+ * @brief 共享配置（享元）PT1 / LIMIT 功能块实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#include "plcopen/fb_shared.h"
+#include <stddef.h>
+
+/* ========== PT1 ========== */
+
+FB_Status_t FB_PT1_SharedConfig_Set(FB_PT1_SharedConfig_t* shared, const FB_PT1_Config_t* config) {
+    if (shared == NULL || FB_PT1_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    shared->config = *config;
+    shared->alpha = config->sample_time / (config->time_constant + config->sample_time);
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_PT1_Shared_Init(FB_PT1_Shared_t* fb, const FB_PT1_SharedConfig_t* shared) {
+    /* 未经 SharedConfig_Set 的对象（如零初始化）不能通过验证 */
+    if (fb == NULL || shared == NULL ||
+        FB_PT1_ValidateConfig(&shared->config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    fb->output = 0.0f;
+    fb->flags = fb_flags_set_status(FB_FLAG_FIRST_RUN, FB_STATUS_OK);
+    return FB_STATUS_OK;
+}
+
+float FB_PT1_Shared_Execute(FB_PT1_Shared_t* fb, const FB_PT1_SharedConfig_t* shared, float input) {
+    if (check_nan(input)) {
+        fb->flags = fb_flags_set_status(fb->flags, FB_STATUS_ERROR_NAN);
+        return 0.0f;
+    }
+
+    if (check_inf(input)) {
+        fb->flags = fb_flags_set_status(fb->flags, FB_STATUS_ERROR_INF);
+        return 0.0f;
+    }
+
+    if (fb->flags & FB_FLAG_FIRST_RUN) {
+        fb->output = input;
+    } else {
+        fb->output += shared->alpha * (input - fb->output);
+    }
+
+    fb->flags = fb_flags_set_status(0u, FB_STATUS_OK);
+    return fb->output;
+}
+
+/* ========== LIMIT ========== */
+
+FB_Status_t FB_LIMIT_SharedConfig_Set(FB_LIMIT_SharedConfig_t* shared, const FB_LIMIT_Config_t* config) {
+    if (shared == NULL || FB_LIMIT_ValidateConfig(config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    shared->config = *config;
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_LIMIT_Shared_Init(FB_LIMIT_Shared_t* fb, const FB_LIMIT_SharedConfig_t* shared) {
+    if (fb == NULL || shared == NULL ||
+        FB_LIMIT_ValidateConfig(&shared->config) != FB_STATUS_OK) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    fb->flags = fb_flags_set_status(0u, FB_STATUS_OK);
+    return FB_STATUS_OK;
+}
+
+float FB_LIMIT_Shared_Execute(FB_LIMIT_Shared_t* fb, const FB_LIMIT_SharedConfig_t* shared, float input) {
+    if (check_nan_inf(input)) {
+        fb->flags = fb_flags_set_status(0u, check_nan(input) ? FB_STATUS_ERROR_NAN
+                                                             : FB_STATUS_ERROR_INF);
+        return 0.0f;
+    }
+
+    const FB_LIMIT_Config_t* config = &shared->config;
+    FB_Status_t status = FB_STATUS_OK;
+    float output = input;
+
+    if (input > config->max_val) {
+        status = FB_STATUS_LIMIT_HI;
+        output = config->max_val;
+    } else if (input < config->min_val) {
+        status = FB_STATUS_LIMIT_LO;
+        output = config->min_val;
+    }
+
+    fb->flags = fb_flags_set_status(0u, status);
+    return output;
+}
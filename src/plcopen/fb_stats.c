@@ -0,0 +1,203 @@
+/**
+ * @file fb_stats.c
+ * @brief PLCopen 流式统计功能块实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+#include "plcopen/fb_stats.h"
+#include "plcopen/probes.h"
+#include <string.h>
+
+/* 单调双端队列：value 从队首到队尾单调不增，队首为窗口最大值 */
+typedef struct {
+    float* value;
+    uint16_t* stamp;
+    uint16_t* head;
+    uint16_t* count;
+} stats_deque_t;
+
+/* 队首超出窗口时出队；周期戳互不相同，每个周期最多一个元素到期 */
+static inline void stats_deque_expire(const stats_deque_t* q, uint16_t window, uint16_t now) {
+    if (*q->count != 0u && (uint16_t)(now - q->stamp[*q->head]) >= window) {
+        *q->head = (uint16_t)((*q->head + 1u == window) ? 0u : *q->head + 1u);
+        (*q->count)--;
+    }
+}
+
+/* 弹出队尾所有不大于 x 的元素后入队，返回队首（窗口最大值） */
+static inline float stats_deque_push(const stats_deque_t* q, uint16_t window, uint16_t now, float x) {
+    unsigned head = *q->head;
+    unsigned count = *q->count;
+    while (count != 0u) {
+        unsigned back = head + count - 1u;
+        if (back >= window) back -= window;
+        if (q->value[back] > x) break;
+        count--;
+    }
+    unsigned tail = head + count;
+    if (tail >= window) tail -= window;
+    q->value[tail] = x;
+    q->stamp[tail] = now;
+    *q->count = (uint16_t)(count + 1u);
+    return q->value[head];
+}
+
+/* 累计矩：均值、参考值、相对均值、M2 与有效采样数 */
+typedef struct {
+    float* mean;
+    float* origin;
+    float* mean_offset;
+    float* m2;
+    uint32_t* count;
+} stats_moments_t;
+
+/* Welford 递推，在相对 origin 的偏差上进行 */
+static inline void stats_accumulate(const stats_moments_t* m, float x) {
+    uint32_t n = *m->count + 1u;
+    if (n == 1u) {
+        *m->origin = x;
+    }
+    float offset = x - *m->origin;
+    float delta = offset - *m->mean_offset;
+    *m->mean_offset += delta / (float)n;
+    *m->m2 += delta * (offset - *m->mean_offset);
+    *m->mean = *m->origin + *m->mean_offset;
+    *m->count = n;
+}
+
+/* 单个实例的一个周期：单实例与 bank 共用，保证逐位一致 */
+static inline FB_Status_t stats_step(float x, uint16_t now, uint16_t window,
+                                     const stats_moments_t* moments, float* min, float* max,
+                                     const stats_deque_t* max_q, const stats_deque_t* min_q) {
+    stats_deque_expire(max_q, window, now);
+    stats_deque_expire(min_q, window, now);
+
+    if (check_nan_inf(x)) {
+        return check_nan(x) ? FB_STATUS_ERROR_NAN : FB_STATUS_ERROR_INF;
+    }
+
+    stats_accumulate(moments, x);
+    *max = stats_deque_push(max_q, window, now, x);
+    *min = -stats_deque_push(min_q, window, now, -x);
+    return FB_STATUS_OK;
+}
+
+FB_Status_t FB_STATS_ValidateConfig(const FB_STATS_Config_t* config) {
+    if (config == NULL) return FB_STATUS_ERROR_CONFIG;
+    if (config->window < 1 || config->window > FB_STATS_MAX_WINDOW) return FB_STATUS_ERROR_CONFIG;
+    return FB_STATUS_OK;
+}
+
+int FB_STATS_Init(FB_STATS_t* fb, const FB_STATS_Config_t* config) {
+    if (fb == NULL || FB_STATS_ValidateConfig(config) != FB_STATUS_OK) return -1;
+
+    memcpy(&fb->config, config, sizeof(FB_STATS_Config_t));
+    memset(&fb->state, 0, sizeof(FB_STATS_State_t));
+    fb->state.status = FB_STATUS_OK;
+    PLCOPEN_PROF_REGISTER(fb, "FB_STATS");
+    PLCOPEN_PROBE_INIT(stats, fb, config);
+    return 0;
+}
+
+void FB_STATS_Reset(FB_STATS_t* fb) {
+    if (fb == NULL) {
+        return;
+    }
+    fb->state.mean = 0.0f;
+    fb->state.origin = 0.0f;
+    fb->state.mean_offset = 0.0f;
+    fb->state.m2 = 0.0f;
+    fb->state.count = 0u;
+}
+
+static inline float stats_execute(FB_STATS_t* fb, float input) {
+    FB_STATS_State_t* s = &fb->state;
+    stats_deque_t max_q = { s->max_value, s->max_stamp, &s->max_head, &s->max_count };
+    stats_deque_t min_q = { s->min_value, s->min_stamp, &s->min_head, &s->min_count };
+    stats_moments_t moments = { &s->mean, &s->origin, &s->mean_offset, &s->m2, &s->count };
+
+    s->tick++;
+    s->status = stats_step(input, s->tick, fb->config.window, &moments, &s->min, &s->max, &max_q, &min_q);
+    return s->mean;
+}
+
+float FB_STATS_Execute(FB_STATS_t* fb, float input) {
+    PLCOPEN_PROBE_ENTRY(stats, fb, input, 0.0f);
+    PLCOPEN_PROF_BEGIN();
+    float output = stats_execute(fb, input);
+    PLCOPEN_PROF_END(fb);
+    PLCOPEN_PROBE_EXIT(stats, fb, output, fb->state.status);
+    return output;
+}
+
+/* ========== 批量实例 ========== */
+
+FB_Status_t FB_STATS_Bank_Init(FB_STATS_Bank_t* bank, float* floats, uint16_t* words,
+                               uint32_t* counts, int8_t* status, size_t count, uint16_t window) {
+    if (bank == NULL || floats == NULL || words == NULL || counts == NULL || status == NULL) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    if (window < 1u || window > FB_STATS_WINDOW_LIMIT) {
+        return FB_STATUS_ERROR_CONFIG;
+    }
+
+    size_t queue = count * window;
+    bank->mean = floats;
+    bank->origin = floats + count;
+    bank->mean_offset = floats + 2 * count;
+    bank->m2 = floats + 3 * count;
+    bank->min = floats + 4 * count;
+    bank->max = floats + 5 * count;
+    bank->max_value = floats + 6 * count;
+    bank->min_value = bank->max_value + queue;
+    bank->max_head = words;
+    bank->max_count = words + count;
+    bank->min_head = words + 2 * count;
+    bank->min_count = words + 3 * count;
+    bank->max_stamp = words + 4 * count;
+    bank->min_stamp = bank->max_stamp + queue;
+    bank->count = counts;
+    bank->status = status;
+    bank->instances = count;
+    bank->window = window;
+    bank->tick = 0u;
+
+    /* 队列内容在入队前不会被读取，只需清零统计量与队列长度 */
+    memset(floats, 0, 6 * count * sizeof(float));
+    memset(words, 0, 4 * count * sizeof(uint16_t));
+    for (size_t i = 0; i < count; i++) {
+        counts[i] = 0u;
+        status[i] = (int8_t)FB_STATUS_OK;
+    }
+
+    return FB_STATUS_OK;
+}
+
+void FB_STATS_Bank_Execute(FB_STATS_Bank_t* bank, const float* input) {
+    /* 描述符字段先读入局部变量：状态码为 int8_t（字符类型），写入后编译器须假定描述符可能被改写 */
+    const FB_STATS_Bank_t b = *bank;
+    uint16_t now = (uint16_t)(b.tick + 1u);
+    bank->tick = now;
+
+    for (size_t i = 0; i < b.instances; i++) {
+        size_t offset = i * b.window;
+        stats_deque_t max_q = { b.max_value + offset, b.max_stamp + offset, &b.max_head[i], &b.max_count[i] };
+        stats_deque_t min_q = { b.min_value + offset, b.min_stamp + offset, &b.min_head[i], &b.min_count[i] };
+        stats_moments_t moments = { &b.mean[i], &b.origin[i], &b.mean_offset[i], &b.m2[i], &b.count[i] };
+        b.status[i] = (int8_t)stats_step(input[i], now, b.window, &moments, &b.min[i], &b.max[i],
+                                         &max_q, &min_q);
+    }
+}
+
+void FB_STATS_Bank_Reset(FB_STATS_Bank_t* bank, size_t index) {
+    if (bank == NULL || index >= bank->instances) {
+        return;
+    }
+    bank->mean[index] = 0.0f;
+    bank->origin[index] = 0.0f;
+    bank->mean_offset[index] = 0.0f;
+    bank->m2[index] = 0.0f;
+    bank->count[index] = 0u;
+}
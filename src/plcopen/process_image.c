@@ -0,0 +1,298 @@
+/**
+ * @file process_image.c
+ * @brief 三缓冲共享内存过程映像实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 每个通道的三个缓冲区在任一时刻分别由生产者（后台）、共享槽（中间）、
+ * 消费者（前台）持有。中间槽索引与"有新数据"标志打包在一个原子字中：
+ *
+ *   publish：middle = exchange(middle, back | FRESH)；back = 旧 middle 的索引
+ *   acquire：若 middle 带 FRESH，front = exchange(middle, front) 的索引
+ *
+ * 两个操作都是常数步完成的单次原子交换，没有重试循环，因此无等待。
+ * 生产者与消费者永远不会同时持有同一个缓冲区。
+ *
+ * back 与 front 除句柄中的本地副本外还记录在通道描述中（各自只由持有方写），
+ * open 读回记录，重启的进程接续原来的缓冲区。持有方在交换之后、记录之前退出时，
+ * 记录与 middle 相同，此时由另外两个索引推出正确值（三个索引恰为 0、1、2 的排列）。
+ */
+
+/* shm_open / ftruncate / clock_gettime 在严格 C11 模式下需显式启用 */
+#define _POSIX_C_SOURCE 200809L
+
+#include "plcopen/process_image.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#if ATOMIC_INT_LOCK_FREE != 2
+#error "process image requires lock-free 32-bit atomics (address-free across processes)"
+#endif
+
+#define PI_MAGIC    0x504C4349u  /* "PLCI" */
+#define PI_VERSION  2u
+#define PI_ALIGN    64u
+#define PI_FRESH    0x4u
+#define PI_INDEX    0x3u
+
+/**
+ * @brief 缓冲区头（每个缓冲区一条缓存行）
+ */
+typedef struct {
+    uint64_t scan;          /**< 扫描计数 */
+    uint64_t timestamp_ns;  /**< 发布时间 */
+    uint8_t pad[PI_ALIGN - 2 * sizeof(uint64_t)];
+} pi_buffer_header_t;
+
+/**
+ * @brief 通道描述（独占一条缓存行，避免通道之间伪共享）
+ */
+typedef struct {
+    atomic_uint middle;     /**< 中间槽索引 | PI_FRESH */
+    atomic_uint back;       /**< 生产者持有的缓冲区索引（只由生产者写） */
+    atomic_uint front;      /**< 消费者持有的缓冲区索引（只由消费者写） */
+    uint32_t size;          /**< float 个数 */
+    uint32_t offset;        /**< 缓冲区 0 相对共享区起始的字节偏移 */
+    uint32_t stride;        /**< 相邻缓冲区间距（字节） */
+    uint8_t pad[PI_ALIGN - 3 * sizeof(atomic_uint) - 3 * sizeof(uint32_t)];
+} pi_channel_t;
+
+struct plcopen_pi_shared {
+    atomic_uint magic;      /**< 初始化完成标志：create 最后以 release 写入，open 以 acquire 读取 */
+    uint32_t version;
+    uint32_t channel_count;
+    uint32_t total_size;
+    uint8_t pad[PI_ALIGN - sizeof(atomic_uint) - 3 * sizeof(uint32_t)];
+    pi_channel_t channels[PLCOPEN_PI_MAX_CHANNELS];
+};
+
+static inline size_t round_up(size_t value, size_t align) {
+    return (value + align - 1u) / align * align;
+}
+
+static inline pi_buffer_header_t* buffer_at(const plcopen_pi_t* pi, uint32_t channel,
+                                            unsigned index) {
+    const pi_channel_t* ch = &pi->shared->channels[channel];
+    return (pi_buffer_header_t*)((uint8_t*)pi->shared + ch->offset + (size_t)index * ch->stride);
+}
+
+static inline bool channel_valid(const plcopen_pi_t* pi, uint32_t channel) {
+    return pi != NULL && pi->shared != NULL && channel < pi->shared->channel_count;
+}
+
+static void load_indices(plcopen_pi_t* pi) {
+    memset(pi->write_index, 0, sizeof(pi->write_index));
+    memset(pi->read_index, 0, sizeof(pi->read_index));
+    for (uint32_t i = 0; i < pi->shared->channel_count; i++) {
+        pi_channel_t* ch = &pi->shared->channels[i];
+        unsigned middle = atomic_load_explicit(&ch->middle, memory_order_acquire) & PI_INDEX;
+        unsigned back = atomic_load_explicit(&ch->back, memory_order_relaxed);
+        unsigned front = atomic_load_explicit(&ch->front, memory_order_relaxed);
+        /* 持有方在交换与记录之间停止：记录仍是已交出的旧索引。
+         * 对端若正处于同一窗口中，推出的值与它随后写入的值相同 */
+        if (front == middle) {
+            front = 3u - back - middle;
+            atomic_store_explicit(&ch->front, front, memory_order_relaxed);
+        } else if (back == middle) {
+            back = 3u - front - middle;
+            atomic_store_explicit(&ch->back, back, memory_order_relaxed);
+        }
+        pi->write_index[i] = (uint8_t)back;
+        pi->read_index[i] = (uint8_t)front;
+    }
+}
+
+static int copy_name(plcopen_pi_t* pi, const char* name) {
+    if (name == NULL || name[0] != '/' || strlen(name) >= PLCOPEN_PI_NAME_MAX) {
+        errno = EINVAL;
+        return -1;
+    }
+    strcpy(pi->name, name);
+    return 0;
+}
+
+int plcopen_pi_create(plcopen_pi_t* pi, const char* name,
+                      const uint32_t* channel_sizes, uint32_t channel_count, uint32_t flags) {
+    if (pi == NULL || channel_sizes == NULL || channel_count == 0u ||
+        channel_count > PLCOPEN_PI_MAX_CHANNELS || (flags & ~PLCOPEN_PI_FORCE) != 0u ||
+        copy_name(pi, name) != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    /* 布局：共享头 | 通道 0 的 3 个缓冲区 | 通道 1 的 3 个缓冲区 | ... */
+    size_t total = sizeof(struct plcopen_pi_shared);
+    for (uint32_t i = 0; i < channel_count; i++) {
+        if (channel_sizes[i] == 0u) {
+            errno = EINVAL;
+            return -1;
+        }
+        total += 3u * round_up(sizeof(pi_buffer_header_t) + channel_sizes[i] * sizeof(float), PI_ALIGN);
+    }
+    if (total > UINT32_MAX) {
+        errno = EFBIG;
+        return -1;
+    }
+
+    /* 默认不删除已存在的映像：其他进程可能正在使用，O_EXCL 使其以 EEXIST 失败 */
+    if (flags & PLCOPEN_PI_FORCE) {
+        shm_unlink(name);
+    }
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (fd < 0) {
+        return -1;
+    }
+    if (ftruncate(fd, (off_t)total) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return -1;
+    }
+    void* map = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        shm_unlink(name);
+        return -1;
+    }
+
+    struct plcopen_pi_shared* shared = map;
+    memset(shared, 0, total);
+    shared->channel_count = channel_count;
+    shared->total_size = (uint32_t)total;
+
+    size_t offset = sizeof(struct plcopen_pi_shared);
+    for (uint32_t i = 0; i < channel_count; i++) {
+        pi_channel_t* ch = &shared->channels[i];
+        ch->size = channel_sizes[i];
+        ch->offset = (uint32_t)offset;
+        ch->stride = (uint32_t)round_up(sizeof(pi_buffer_header_t) + channel_sizes[i] * sizeof(float), PI_ALIGN);
+        /* 初始分配：生产者持有 0，中间槽为 1，消费者持有 2 */
+        atomic_init(&ch->back, 0u);
+        atomic_init(&ch->middle, 1u);
+        atomic_init(&ch->front, 2u);
+        offset += 3u * ch->stride;
+    }
+
+    shared->version = PI_VERSION;
+    /* magic 最后以 release 写入：open 方 acquire 读到 magic 即看到完整的初始化结果 */
+    atomic_store_explicit(&shared->magic, PI_MAGIC, memory_order_release);
+
+    pi->shared = shared;
+    pi->map_size = total;
+    load_indices(pi);
+    return 0;
+}
+
+int plcopen_pi_open(plcopen_pi_t* pi, const char* name) {
+    if (pi == NULL || copy_name(pi, name) != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(struct plcopen_pi_shared)) {
+        close(fd);
+        errno = EINVAL;
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    void* map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return -1;
+    }
+
+    struct plcopen_pi_shared* shared = map;
+    /* 先以 acquire 读取 magic，其后读到的 version / total_size / 通道描述均为初始化完成后的值 */
+    if (atomic_load_explicit(&shared->magic, memory_order_acquire) != PI_MAGIC ||
+        shared->version != PI_VERSION ||
+        shared->total_size != size) {
+        munmap(map, size);
+        errno = EINVAL;
+        return -1;
+    }
+
+    pi->shared = shared;
+    pi->map_size = size;
+    load_indices(pi);
+    return 0;
+}
+
+void plcopen_pi_close(plcopen_pi_t* pi) {
+    if (pi != NULL && pi->shared != NULL) {
+        munmap(pi->shared, pi->map_size);
+        pi->shared = NULL;
+        pi->map_size = 0;
+    }
+}
+
+int plcopen_pi_unlink(const char* name) {
+    return shm_unlink(name);
+}
+
+uint32_t plcopen_pi_channel_size(const plcopen_pi_t* pi, uint32_t channel) {
+    return channel_valid(pi, channel) ? pi->shared->channels[channel].size : 0u;
+}
+
+float* plcopen_pi_write_begin(plcopen_pi_t* pi, uint32_t channel) {
+    if (!channel_valid(pi, channel)) {
+        return NULL;
+    }
+    return (float*)(buffer_at(pi, channel, pi->write_index[channel]) + 1);
+}
+
+void plcopen_pi_publish(plcopen_pi_t* pi, uint32_t channel, uint64_t scan) {
+    if (!channel_valid(pi, channel)) {
+        return;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    unsigned back = pi->write_index[channel];
+    pi_buffer_header_t* header = buffer_at(pi, channel, back);
+    header->scan = scan;
+    header->timestamp_ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+
+    /* release：缓冲区内容先于索引可见；acquire：取得的旧中间槽不再被消费者使用 */
+    pi_channel_t* ch = &pi->shared->channels[channel];
+    unsigned old = atomic_exchange_explicit(&ch->middle, back | PI_FRESH, memory_order_acq_rel);
+    pi->write_index[channel] = (uint8_t)(old & PI_INDEX);
+    atomic_store_explicit(&ch->back, old & PI_INDEX, memory_order_relaxed);
+}
+
+const float* plcopen_pi_acquire(plcopen_pi_t* pi, uint32_t channel, uint64_t* scan) {
+    if (!channel_valid(pi, channel)) {
+        return NULL;
+    }
+
+    pi_channel_t* ch = &pi->shared->channels[channel];
+    if (atomic_load_explicit(&ch->middle, memory_order_relaxed) & PI_FRESH) {
+        unsigned old = atomic_exchange_explicit(&ch->middle, pi->read_index[channel],
+                                                memory_order_acq_rel);
+        pi->read_index[channel] = (uint8_t)(old & PI_INDEX);
+        atomic_store_explicit(&ch->front, old & PI_INDEX, memory_order_relaxed);
+    }
+
+    const pi_buffer_header_t* header = buffer_at(pi, channel, pi->read_index[channel]);
+    if (scan != NULL) {
+        *scan = header->scan;
+    }
+    return (const float*)(header + 1);
+}
+
+uint64_t plcopen_pi_timestamp(const plcopen_pi_t* pi, uint32_t channel) {
+    if (!channel_valid(pi, channel)) {
+        return 0;
+    }
+    return buffer_at(pi, channel, pi->read_index[channel])->timestamp_ns;
+}
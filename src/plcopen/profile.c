@@ -0,0 +1,199 @@
+/**
+ * @file profile.c
+ * @brief 按实例的执行剖析：登记表与排行输出
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 未定义 PLCOPEN_ENABLE_PROFILING 时登记表为空，查询接口返回 0 个实例。
+ */
+
+#if defined(PLCOPEN_ENABLE_PROFILING) && defined(__unix__) && !defined(_POSIX_C_SOURCE)
+/* clock_gettime 在严格 C11 模式下需显式启用 */
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "plcopen/profile.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef PLCOPEN_ENABLE_PROFILING
+
+#if !defined(__ARM_ARCH_7EM__) && !defined(__ARM_ARCH_7M__) && \
+    !defined(__x86_64__) && !defined(__i386__) && !defined(__aarch64__)
+#include <time.h>
+
+uint32_t plcopen_prof_clock_ns(void) {
+    struct timespec ts;
+#if defined(__unix__)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+    timespec_get(&ts, TIME_UTC);
+#endif
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+#endif
+
+static plcopen_prof_t* registry[PLCOPEN_PROF_MAX_INSTANCES];
+static size_t registry_count;
+static size_t registry_dropped;
+
+void plcopen_prof_init(void) {
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+    /* CoreDebug->DEMCR.TRCENA = 1；DWT->CYCCNT = 0；DWT->CTRL.CYCCNTENA = 1 */
+    *(volatile uint32_t*)0xE000EDFCu |= 1u << 24;
+    PLCOPEN_PROF_DWT_CYCCNT = 0u;
+    *(volatile uint32_t*)0xE0001000u |= 1u;
+#endif
+}
+
+void plcopen_prof_register(plcopen_prof_t* prof, const char* type) {
+    memset(prof->hist, 0, sizeof(prof->hist));
+    prof->calls = 0u;
+    prof->max_cycles = 0u;
+    prof->total_cycles = 0u;
+    prof->type = type;
+
+    for (size_t i = 0; i < registry_count; i++) {
+        if (registry[i] == prof) {
+            return;
+        }
+    }
+    /* 新登记的实例清除标签；重复 Init 保留已设置的标签 */
+    prof->name = NULL;
+    if (registry_count < PLCOPEN_PROF_MAX_INSTANCES) {
+        registry[registry_count++] = prof;
+    } else {
+        registry_dropped++;
+    }
+}
+
+void plcopen_prof_unregister(plcopen_prof_t* prof) {
+    for (size_t i = 0; i < registry_count; i++) {
+        if (registry[i] == prof) {
+            registry[i] = registry[--registry_count];
+            return;
+        }
+    }
+}
+
+size_t plcopen_prof_count(void) {
+    return registry_count;
+}
+
+size_t plcopen_prof_dropped(void) {
+    return registry_dropped;
+}
+
+void plcopen_prof_reset(void) {
+    for (size_t i = 0; i < registry_count; i++) {
+        plcopen_prof_t* prof = registry[i];
+        memset(prof->hist, 0, sizeof(prof->hist));
+        prof->calls = 0u;
+        prof->max_cycles = 0u;
+        prof->total_cycles = 0u;
+    }
+}
+
+static uint64_t key_of(const plcopen_prof_t* prof, plcopen_prof_key_t key) {
+    return key == PLCOPEN_PROF_BY_MAX ? prof->max_cycles : prof->total_cycles;
+}
+
+size_t plcopen_prof_top(const plcopen_prof_t** out, size_t n, plcopen_prof_key_t key) {
+    if (out == NULL) {
+        return 0;
+    }
+    if (n > registry_count) {
+        n = registry_count;
+    }
+
+    /* 插入到有序的前 n 名中：O(实例数 × n)，不需要额外存储 */
+    size_t filled = 0;
+    for (size_t i = 0; i < registry_count; i++) {
+        const plcopen_prof_t* prof = registry[i];
+        uint64_t value = key_of(prof, key);
+        size_t pos = filled;
+        while (pos > 0 && key_of(out[pos - 1], key) < value) {
+            pos--;
+        }
+        if (pos >= n) {
+            continue;
+        }
+        size_t last = filled < n ? filled : n - 1u;
+        for (size_t j = last; j > pos; j--) {
+            out[j] = out[j - 1];
+        }
+        out[pos] = prof;
+        if (filled < n) {
+            filled++;
+        }
+    }
+    return filled;
+}
+
+#else /* !PLCOPEN_ENABLE_PROFILING */
+
+void plcopen_prof_init(void) {}
+
+size_t plcopen_prof_count(void) {
+    return 0;
+}
+
+size_t plcopen_prof_dropped(void) {
+    return 0;
+}
+
+void plcopen_prof_reset(void) {}
+
+size_t plcopen_prof_top(const plcopen_prof_t** out, size_t n, plcopen_prof_key_t key) {
+    (void)out;
+    (void)n;
+    (void)key;
+    return 0;
+}
+
+#endif /* PLCOPEN_ENABLE_PROFILING */
+
+uint64_t plcopen_prof_quantile_le(const plcopen_prof_t* prof, float quantile) {
+    if (prof == NULL || prof->calls == 0u) {
+        return 0;
+    }
+    /* 取最接近 quantile × calls 的名次，避免 0.99f 的舍入误差多跨一个桶 */
+    uint64_t threshold = (uint64_t)((double)quantile * (double)prof->calls + 0.5);
+    uint64_t seen = 0;
+    for (unsigned b = 0; b < PLCOPEN_PROF_HIST_BINS; b++) {
+        seen += prof->hist[b];
+        if (seen >= threshold && seen > 0u) {
+            return (uint64_t)1u << (b + 1u);
+        }
+    }
+    return (uint64_t)1u << PLCOPEN_PROF_HIST_BINS;
+}
+
+size_t plcopen_prof_dump_top(size_t n, plcopen_prof_sink_t sink, void* ctx) {
+    if (sink == NULL) {
+        return 0;
+    }
+    char line[160];
+    sink("rank,type,name,calls,total_cycles,avg_cycles,max_cycles,p99_cycles_le", ctx);
+
+    const plcopen_prof_t* top[PLCOPEN_PROF_DUMP_MAX];
+    size_t got = plcopen_prof_top(top, n < PLCOPEN_PROF_DUMP_MAX ? n : PLCOPEN_PROF_DUMP_MAX,
+                                  PLCOPEN_PROF_BY_TOTAL);
+    for (size_t i = 0; i < got; i++) {
+        const plcopen_prof_t* p = top[i];
+        snprintf(line, sizeof(line), "%zu,%s,%s,%lu,%llu,%llu,%lu,%llu", i + 1u,
+                 p->type != NULL ? p->type : "",
+                 p->name != NULL ? p->name : "",
+                 (unsigned long)p->calls,
+                 (unsigned long long)p->total_cycles,
+                 (unsigned long long)(p->calls > 0u ? p->total_cycles / p->calls : 0u),
+                 (unsigned long)p->max_cycles,
+                 (unsigned long long)plcopen_prof_quantile_le(p, 0.99f));
+        sink(line, ctx);
+    }
+    if (plcopen_prof_dropped() != 0u) {
+        snprintf(line, sizeof(line), "# dropped,%zu", plcopen_prof_dropped());
+        sink(line, ctx);
+    }
+    return got;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file trace.c
+ * @brief 无锁二进制追踪环实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 读者协议（写者见 plcopen_trace_append）：
+ *
+ *   1. acquire 加载 head 得 h1，复制序号 [h1 - n, h1) 的槽位到输出缓冲区
+ *   2. acquire 栅栏后再加载 head 得 h2
+ *   3. 写者在发布 h2 之前可能已开始改写序号 h2 - capacity 的槽位，
+ *      因此只有序号 > h2 - capacity 的记录保证完整，其余丢弃
+ *
+ * 写者每次改写槽位前都有 release 栅栏，读者在复制后的 acquire 栅栏
+ * 保证：只要复制时看到了新写入的字，h2 就一定包含对应的 head 发布。
+ */
+
+#include "plcopen/trace.h"
+
+int plcopen_trace_init(plcopen_trace_ring_t* ring, uint32_t ring_id,
+                       plcopen_trace_slot_t* storage, uint32_t capacity) {
+    if (ring == NULL || storage == NULL || capacity < 2u || capacity > (1u << 30) ||
+        (capacity & (capacity - 1u)) != 0u) {
+        return -1;
+    }
+
+    atomic_init(&ring->head, 0u);
+    atomic_init(&ring->trigger, 0u);
+    ring->scan = 0u;
+    ring->mask = capacity - 1u;
+    ring->trigger_mask = PLCOPEN_TRACE_TRIGGER_ON(FB_STATUS_ERROR_NAN) |
+                         PLCOPEN_TRACE_TRIGGER_ON(FB_STATUS_ERROR_INF);
+    ring->ring_id = ring_id;
+    ring->slots = storage;
+    for (uint32_t i = 0; i < capacity; i++) {
+        for (int w = 0; w < PLCOPEN_TRACE_WORDS; w++) {
+            atomic_init(&storage[i].w[w], 0u);
+        }
+    }
+    return 0;
+}
+
+void plcopen_trace_trigger(plcopen_trace_ring_t* ring) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    /* head 为 0 时没有记录可指向，仍以 1 表示"有触发" */
+    atomic_store_explicit(&ring->trigger, head > 0u ? head : 1u, memory_order_release);
+}
+
+uint32_t plcopen_trace_take_trigger(plcopen_trace_ring_t* ring) {
+    uint32_t value = atomic_exchange_explicit(&ring->trigger, 0u, memory_order_acq_rel);
+    return value == 0u ? PLCOPEN_TRACE_NO_TRIGGER : value - 1u;
+}
+
+size_t plcopen_trace_snapshot(plcopen_trace_ring_t* ring, plcopen_trace_record_t* out,
+                              size_t max, uint32_t* first_index) {
+    uint32_t capacity = ring->mask + 1u;
+    uint32_t h1 = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t n = h1 < capacity ? h1 : capacity;
+    if (n > max) {
+        n = (uint32_t)max;
+    }
+    uint32_t start = h1 - n;
+
+    for (uint32_t i = 0; i < n; i++) {
+        const plcopen_trace_slot_t* slot = &ring->slots[(start + i) & ring->mask];
+        uint32_t words[PLCOPEN_TRACE_WORDS];
+        for (int w = 0; w < PLCOPEN_TRACE_WORDS; w++) {
+            words[w] = (uint32_t)atomic_load_explicit(&slot->w[w], memory_order_relaxed);
+        }
+        memcpy(&out[i], words, sizeof(words));
+    }
+
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t h2 = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    /* 序号 <= h2 - capacity 的槽位可能已被改写（32 位回绕下按差值比较） */
+    uint32_t overwritten = 0;
+    if (h2 - start >= capacity) {
+        overwritten = h2 - start - capacity + 1u;
+        if (overwritten > n) {
+            overwritten = n;
+        }
+        memmove(out, out + overwritten, (size_t)(n - overwritten) * sizeof(*out));
+    }
+
+    if (first_index != NULL) {
+        *first_index = start + overwritten;
+    }
+    return n - overwritten;
+}
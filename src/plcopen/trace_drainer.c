@@ -0,0 +1,165 @@
+/**
+ * @file trace_drainer.c
+ * @brief 追踪环后台转储线程实现
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ */
+
+/* nanosleep / clock_gettime 在严格 C11 模式下需显式启用 */
+#define _POSIX_C_SOURCE 200809L
+
+#include "plcopen/trace_drainer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TRACE_FILE_MAGIC   0x54434C50u  /* "PLCT" */
+#define TRACE_FILE_VERSION 1u
+
+static uint64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+static void sleep_ms(uint32_t ms) {
+    struct timespec ts = { .tv_sec = (time_t)(ms / 1000u),
+                           .tv_nsec = (long)(ms % 1000u) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+static int write_u32(FILE* f, uint32_t value) {
+    return fwrite(&value, sizeof(value), 1, f) == 1 ? 0 : -1;
+}
+
+static int dump_rings(plcopen_trace_ring_t* const* rings, size_t ring_count, const char* path,
+                      const uint32_t* trigger_index, plcopen_trace_record_t* scratch,
+                      size_t scratch_records) {
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+
+    uint16_t version = TRACE_FILE_VERSION;
+    uint16_t record_size = (uint16_t)sizeof(plcopen_trace_record_t);
+    int rc = write_u32(f, TRACE_FILE_MAGIC);
+    rc |= fwrite(&version, sizeof(version), 1, f) == 1 ? 0 : -1;
+    rc |= fwrite(&record_size, sizeof(record_size), 1, f) == 1 ? 0 : -1;
+    rc |= write_u32(f, (uint32_t)ring_count);
+
+    for (size_t r = 0; r < ring_count && rc == 0; r++) {
+        uint32_t first = 0;
+        size_t n = plcopen_trace_snapshot(rings[r], scratch, scratch_records, &first);
+        rc |= write_u32(f, rings[r]->ring_id);
+        rc |= write_u32(f, (uint32_t)n);
+        rc |= write_u32(f, first);
+        rc |= write_u32(f, trigger_index != NULL ? trigger_index[r] : PLCOPEN_TRACE_NO_TRIGGER);
+        if (n > 0u && fwrite(scratch, sizeof(*scratch), n, f) != n) {
+            rc = -1;
+        }
+    }
+
+    if (fclose(f) != 0) {
+        rc = -1;
+    }
+    return rc;
+}
+
+static size_t max_capacity(plcopen_trace_ring_t* const* rings, size_t ring_count) {
+    size_t max = 0;
+    for (size_t r = 0; r < ring_count; r++) {
+        size_t capacity = (size_t)rings[r]->mask + 1u;
+        max = capacity > max ? capacity : max;
+    }
+    return max;
+}
+
+int plcopen_trace_dump_file(plcopen_trace_ring_t* const* rings, size_t ring_count,
+                            const char* path, const uint32_t* trigger_index) {
+    if (rings == NULL || path == NULL) {
+        return -1;
+    }
+    size_t records = max_capacity(rings, ring_count);
+    plcopen_trace_record_t* scratch = malloc((records > 0u ? records : 1u) * sizeof(*scratch));
+    if (scratch == NULL) {
+        return -1;
+    }
+    int rc = dump_rings(rings, ring_count, path, trigger_index, scratch, records);
+    free(scratch);
+    return rc;
+}
+
+static void* drainer_main(void* arg) {
+    plcopen_trace_drainer_t* d = arg;
+    uint64_t last_dump = 0;
+    bool dumped_once = false;
+
+    while (!atomic_load(&d->stop)) {
+        uint32_t triggers[PLCOPEN_TRACE_MAX_RINGS];
+        bool triggered = false;
+        for (size_t r = 0; r < d->ring_count; r++) {
+            triggers[r] = plcopen_trace_take_trigger(d->rings[r]);
+            triggered = triggered || triggers[r] != PLCOPEN_TRACE_NO_TRIGGER;
+        }
+
+        if (triggered && (!dumped_once || now_ms() - last_dump >= d->config.holdoff_ms)) {
+            sleep_ms(d->config.post_trigger_ms);
+            char path[PLCOPEN_TRACE_PATH_MAX + 16];
+            unsigned seq = atomic_load(&d->dumps);
+            snprintf(path, sizeof(path), "%s-%u.plct", d->path_prefix, seq);
+            if (dump_rings(d->rings, d->ring_count, path, triggers, d->scratch,
+                           d->scratch_records) == 0) {
+                atomic_fetch_add(&d->dumps, 1u);
+            }
+            last_dump = now_ms();
+            dumped_once = true;
+        }
+        sleep_ms(d->config.poll_ms);
+    }
+    return NULL;
+}
+
+int plcopen_trace_drainer_start(plcopen_trace_drainer_t* drainer,
+                                plcopen_trace_ring_t* const* rings, size_t ring_count,
+                                const char* path_prefix,
+                                const plcopen_trace_drainer_config_t* config) {
+    static const plcopen_trace_drainer_config_t defaults = PLCOPEN_TRACE_DRAINER_DEFAULTS;
+    if (drainer == NULL || rings == NULL || ring_count == 0u ||
+        ring_count > PLCOPEN_TRACE_MAX_RINGS || path_prefix == NULL ||
+        strlen(path_prefix) >= PLCOPEN_TRACE_PATH_MAX) {
+        return -1;
+    }
+
+    memset(drainer, 0, sizeof(*drainer));
+    for (size_t r = 0; r < ring_count; r++) {
+        drainer->rings[r] = rings[r];
+    }
+    drainer->ring_count = ring_count;
+    strcpy(drainer->path_prefix, path_prefix);
+    drainer->config = config != NULL ? *config : defaults;
+    drainer->scratch_records = max_capacity(rings, ring_count);
+    drainer->scratch = malloc(drainer->scratch_records * sizeof(plcopen_trace_record_t));
+    if (drainer->scratch == NULL) {
+        return -1;
+    }
+    atomic_init(&drainer->stop, 0);
+    atomic_init(&drainer->dumps, 0u);
+
+    if (pthread_create(&drainer->thread, NULL, drainer_main, drainer) != 0) {
+        free(drainer->scratch);
+        drainer->scratch = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+void plcopen_trace_drainer_stop(plcopen_trace_drainer_t* drainer) {
+    if (drainer == NULL || drainer->scratch == NULL) {
+        return;
+    }
+    atomic_store(&drainer->stop, 1);
+    pthread_join(drainer->thread, NULL);
+    free(drainer->scratch);
+    drainer->scratch = NULL;
+}
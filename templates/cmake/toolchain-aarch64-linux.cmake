@@ -0,0 +1,101 @@
+# CMake Toolchain File for AArch64 Linux (Cortex-A53 / Cortex-A72 边缘控制器)
+# 用于交叉编译 AArch64 Linux 目标平台的工具链配置
+#
+# 使用方式:
+#   cmake -B build-aarch64 -DCMAKE_TOOLCHAIN_FILE=templates/cmake/toolchain-aarch64-linux.cmake
+#   cmake --build build-aarch64
+#   ctest --test-dir build-aarch64        # 找到 qemu-aarch64 时经用户态模拟运行测试与基准
+#
+# 需要 aarch64-linux-gnu-gcc（Debian/Ubuntu: gcc-aarch64-linux-gnu）；
+# 在 x86 构建机上运行测试另需 qemu-aarch64（qemu-user）。
+#
+# 编码: UTF-8
+# 换行符: LF
+
+# 设置系统信息
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+# 查找工具链路径
+if(DEFINED ENV{AARCH64_TOOLCHAIN_PATH})
+    set(TOOLCHAIN_PREFIX "$ENV{AARCH64_TOOLCHAIN_PATH}/bin/aarch64-linux-gnu-")
+    message(STATUS "使用环境变量中的工具链: $ENV{AARCH64_TOOLCHAIN_PATH}")
+else()
+    # 假设工具链在系统 PATH 中
+    set(TOOLCHAIN_PREFIX "aarch64-linux-gnu-")
+    message(STATUS "使用系统 PATH 中的工具链")
+endif()
+
+# 目标根文件系统（glibc 与头文件），发行版交叉工具链默认安装在 /usr/aarch64-linux-gnu
+if(DEFINED ENV{AARCH64_SYSROOT})
+    set(AARCH64_SYSROOT "$ENV{AARCH64_SYSROOT}")
+else()
+    set(AARCH64_SYSROOT "/usr/aarch64-linux-gnu")
+endif()
+
+# 设置编译器
+set(CMAKE_C_COMPILER ${TOOLCHAIN_PREFIX}gcc)
+set(CMAKE_CXX_COMPILER ${TOOLCHAIN_PREFIX}g++)
+
+# 设置工具
+set(CMAKE_AR ${TOOLCHAIN_PREFIX}ar)
+set(CMAKE_RANLIB ${TOOLCHAIN_PREFIX}ranlib)
+set(CMAKE_OBJCOPY ${TOOLCHAIN_PREFIX}objcopy)
+set(CMAKE_OBJDUMP ${TOOLCHAIN_PREFIX}objdump)
+set(CMAKE_SIZE ${TOOLCHAIN_PREFIX}size)
+
+# C11 标准
+set(CMAKE_C_STANDARD 11)
+set(CMAKE_C_STANDARD_REQUIRED ON)
+set(CMAKE_C_EXTENSIONS OFF)
+
+# Cortex-A53 为 A53 / A72 共同基线（ARMv8-A，NEON 为必备特性）
+set(CPU_FLAGS "-mcpu=cortex-a53")
+
+# 通用编译标志：禁止乘加合并为 FMA，float32 bank 的 NEON 路径与标量功能块逐位一致
+set(COMMON_FLAGS "${CPU_FLAGS} -ffp-contract=off -fdata-sections -ffunction-sections")
+
+# 警告标志
+set(WARNING_FLAGS "-Wall -Wextra -Wpedantic -Wshadow")
+
+# C 编译标志
+set(CMAKE_C_FLAGS_INIT "${COMMON_FLAGS} ${WARNING_FLAGS} -std=c11")
+set(CMAKE_C_FLAGS_DEBUG "-O0 -g3" CACHE STRING "C Debug flags")
+set(CMAKE_C_FLAGS_RELEASE "-O2 -g0 -DNDEBUG" CACHE STRING "C Release flags")
+set(CMAKE_C_FLAGS_MINSIZEREL "-Os -g0 -DNDEBUG" CACHE STRING "C MinSizeRel flags")
+
+# C++ 编译标志（如果需要）
+set(CMAKE_CXX_FLAGS_INIT "${COMMON_FLAGS} ${WARNING_FLAGS} -std=c++11")
+set(CMAKE_CXX_FLAGS_DEBUG "-O0 -g3" CACHE STRING "C++ Debug flags")
+set(CMAKE_CXX_FLAGS_RELEASE "-O2 -g0 -DNDEBUG" CACHE STRING "C++ Release flags")
+set(CMAKE_CXX_FLAGS_MINSIZEREL "-Os -g0 -DNDEBUG" CACHE STRING "C++ MinSizeRel flags")
+
+# 链接器标志
+set(CMAKE_EXE_LINKER_FLAGS_INIT "-Wl,--gc-sections")
+
+# 设置查找根路径（仅在交叉编译的根目录中查找）
+set(CMAKE_FIND_ROOT_PATH ${AARCH64_SYSROOT})
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_PACKAGE ONLY)
+
+# 用户态模拟器：add_test 注册的可执行文件经 qemu-aarch64 运行（-L 指向目标动态链接器与 glibc）
+find_program(AARCH64_QEMU qemu-aarch64)
+if(AARCH64_QEMU)
+    set(CMAKE_CROSSCOMPILING_EMULATOR ${AARCH64_QEMU} -L ${AARCH64_SYSROOT})
+endif()
+
+# 生成编译数据库（用于 IDE 支持）
+set(CMAKE_EXPORT_COMPILE_COMMANDS ON)
+
+message(STATUS "======================================")
+message(STATUS "AArch64 Linux 工具链配置")
+message(STATUS "======================================")
+message(STATUS "系统名称: ${CMAKE_SYSTEM_NAME}")
+message(STATUS "处理器: ${CMAKE_SYSTEM_PROCESSOR}")
+message(STATUS "C 编译器: ${CMAKE_C_COMPILER}")
+message(STATUS "C 标准: C${CMAKE_C_STANDARD}")
+message(STATUS "CPU 标志: ${CPU_FLAGS}")
+message(STATUS "模拟器: ${AARCH64_QEMU}")
+message(STATUS "======================================")
@@ -52,7 +52,9 @@ set(CMAKE_C_EXTENSIONS OFF)
 set(CPU_FLAGS "-mcpu=cortex-m4 -mthumb -mfloat-abi=hard -mfpu=fpv4-sp-d16")
 
 # 通用编译标志
-set(COMMON_FLAGS "${CPU_FLAGS} -fdata-sections -ffunction-sections")
+# -mfp16-format=ieee：定义 __ARM_FP16_FORMAT_IEEE，使 half.h 的 __fp16 转换编译为 VCVTB.F32.F16 / VCVTB.F16.F32
+# （FPv4-SP 支持）；未指定时 arm-none-eabi-gcc 不启用 __fp16，半精度 bank 退回软件转换
+set(COMMON_FLAGS "${CPU_FLAGS} -mfp16-format=ieee -fdata-sections -ffunction-sections")
 
 # 警告标志
 set(WARNING_FLAGS "-Wall -Wextra -Wpedantic -Wshadow")
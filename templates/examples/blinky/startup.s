@@ -1,5 +1,5 @@
 /* startup.s - STM32F407 启动文件（ARM Cortex-M4）
- * 功能：初始化栈、复制数据段、清零 BSS、调用 main
+ * 功能：初始化栈、复制数据段、清零 BSS 与 CCM 功能块状态段、调用 main
  *
  * 编码: UTF-8
  * 换行符: LF
@@ -101,6 +101,20 @@ LoopFillZerobss:
     cmp r2, r4
     bcc FillZerobss         /* 如果未到结束地址，继续清零 */
 
+    /* 2b. 清零 CCM 中的功能块状态段（NOLOAD，不在 BSS 范围内） */
+    ldr r2, =__plcopen_state_start__
+    ldr r4, =__plcopen_state_end__
+    movs r3, #0
+    b LoopFillZeroState
+
+FillZeroState:
+    str r3, [r2]
+    adds r2, r2, #4
+
+LoopFillZeroState:
+    cmp r2, r4
+    bcc FillZeroState
+
     /* 3. 调用 main 函数 */
     bl main
 
@@ -0,0 +1,39 @@
+# check_placement.cmake - 检查链接映射文件中功能块段的放置
+#
+# 用法: cmake -DMAP_FILE=<xxx.map> -P check_placement.cmake
+#
+# 在映射文件中查找 .plcopen_state 与 .plcopen_const 输出段，要求：
+#   .plcopen_state 非空且位于 CCM   (0x10000000 - 0x1000FFFF)
+#   .plcopen_const 非空且位于 Flash (0x08000000 - 0x080FFFFF)
+#
+# 编码: UTF-8
+# 换行符: LF
+
+if(NOT MAP_FILE OR NOT EXISTS "${MAP_FILE}")
+    message(FATAL_ERROR "未找到映射文件: ${MAP_FILE}")
+endif()
+
+file(READ "${MAP_FILE}" map_text)
+
+# 输出段行格式：段名、地址、大小；段名过长时 ld 会把地址换到下一行
+function(check_section name region_prefix region_name)
+    string(REPLACE "." "\\." pattern "${name}")
+    string(REGEX MATCH "\n${pattern}[ \t\r\n]+0x([0-9a-fA-F]+)[ \t]+0x([0-9a-fA-F]+)" hit "${map_text}")
+    if(NOT hit)
+        message(FATAL_ERROR "映射文件中没有 ${name} 段（链接脚本未包含 plcopen_sections.ld？）")
+    endif()
+    set(address "${CMAKE_MATCH_1}")
+    set(size "${CMAKE_MATCH_2}")
+    string(REGEX REPLACE "^0+" "" address_trimmed "${address}")
+    string(REGEX REPLACE "^0+" "" size_trimmed "${size}")
+    if(size_trimmed STREQUAL "")
+        message(FATAL_ERROR "${name} 段为空：没有对象使用对应的放置宏")
+    endif()
+    if(NOT address_trimmed MATCHES "^${region_prefix}")
+        message(FATAL_ERROR "${name} 位于 0x${address_trimmed}，不在 ${region_name} 中")
+    endif()
+    message(STATUS "${name}: 0x${address_trimmed}，0x${size_trimmed} 字节（${region_name}）")
+endfunction()
+
+check_section(".plcopen_state" "1000[0-9a-fA-F][0-9a-fA-F][0-9a-fA-F][0-9a-fA-F]$" "CCM")
+check_section(".plcopen_const" "80[0-9a-fA-F][0-9a-fA-F][0-9a-fA-F][0-9a-fA-F][0-9a-fA-F]$" "Flash")
@@ -0,0 +1,112 @@
+// fb-placement - 功能块状态放入 CCM、组态参数放入 Flash 的示例（STM32F407）
+// 演示 plcopen/placement.h（经 plcopen.h 包含）与 templates/linker/plcopen_sections.ld 的配合
+//
+// 构建后 fb-placement.map 中：
+//   .plcopen_const 位于 0x0800xxxx（Flash）：PID 组态、设定值表、滤波时间常数
+//   .plcopen_state 位于 0x1000xxxx（CCM）  ：PID 实例、PT1 bank 数组
+//   adc_dma        位于 0x2000xxxx（SRAM） ：DMA 目标缓冲区（CCM 不可被 DMA 访问）
+// 链接后由 check_placement.cmake 检查上述段地址。
+//
+// 编码: UTF-8
+
+#include <stdint.h>
+#include "plcopen/plcopen.h"
+
+//===========================================
+// 规模
+//===========================================
+
+#define LOOP_COUNT      8   // PID 回路数
+#define SENSOR_COUNT    32  // 模拟量输入通道数（每回路 4 路，取第一路作测量值）
+
+//===========================================
+// 只读数据（Flash）
+//===========================================
+
+#define LOOP_CONFIG(kp_, ki_)                                           \
+    { .kp = (kp_), .ki = (ki_), .kd = 0.0f, .sample_time = 0.01f,       \
+      .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f }
+
+PLCOPEN_FB_CONST static const FB_PID_Config_t loop_config[LOOP_COUNT] = {
+    LOOP_CONFIG(1.2f, 0.20f), LOOP_CONFIG(0.8f, 0.10f),
+    LOOP_CONFIG(2.0f, 0.50f), LOOP_CONFIG(1.0f, 0.05f),
+    LOOP_CONFIG(1.5f, 0.30f), LOOP_CONFIG(0.6f, 0.08f),
+    LOOP_CONFIG(1.1f, 0.15f), LOOP_CONFIG(3.0f, 0.90f),
+};
+
+PLCOPEN_FB_CONST static const float loop_setpoint[LOOP_COUNT] = {
+    50.0f, 42.5f, 60.0f, 35.0f, 55.0f, 48.0f, 70.0f, 20.0f,
+};
+
+// 每回路 4 路输入共用一个滤波时间常数（秒）
+PLCOPEN_FB_CONST static const float sensor_tau[LOOP_COUNT] = {
+    0.05f, 0.10f, 0.05f, 0.20f, 0.10f, 0.05f, 0.50f, 0.02f,
+};
+
+// 12 位 ADC 码值到工程量（0..100 %）的换算系数
+PLCOPEN_FB_CONST static const float adc_scale = 100.0f / 4095.0f;
+
+//===========================================
+// 热状态（CCM）
+//===========================================
+
+PLCOPEN_FB_STATE static FB_PID_t loops[LOOP_COUNT];
+
+PLCOPEN_FB_STATE static FB_PT1_Bank32_t sensor_bank;
+PLCOPEN_FB_STATE static float sensor_floats[FB_PT1_BANK32_FLOATS * SENSOR_COUNT];
+PLCOPEN_FB_STATE static uint8_t sensor_flags[SENSOR_COUNT];
+PLCOPEN_FB_STATE static int8_t sensor_status[SENSOR_COUNT];
+
+PLCOPEN_FB_STATE static float sensor_value[SENSOR_COUNT];
+PLCOPEN_FB_STATE static float sensor_filtered[SENSOR_COUNT];
+
+//===========================================
+// DMA 缓冲区与输出（SRAM）
+//===========================================
+
+// ADC 扫描模式 + 循环 DMA 写入的目标，必须位于 DMA 可访问的 SRAM
+static volatile uint16_t adc_dma[SENSOR_COUNT];
+
+// 执行器输出（由定时器 PWM 或 DAC 读取）
+static volatile float actuator[LOOP_COUNT];
+
+//===========================================
+// 控制任务
+//===========================================
+
+static void control_init(void) {
+    FB_PT1_Bank32_Init(&sensor_bank, sensor_floats, sensor_flags, sensor_status,
+                       SENSOR_COUNT, 0.01f);
+    for (uint32_t i = 0; i < SENSOR_COUNT; i++) {
+        FB_PT1_Bank32_Configure(&sensor_bank, i, sensor_tau[i / 4]);
+    }
+    for (uint32_t i = 0; i < LOOP_COUNT; i++) {
+        FB_PID_Init(&loops[i], &loop_config[i]);
+    }
+}
+
+static void control_scan(void) {
+    for (uint32_t i = 0; i < SENSOR_COUNT; i++) {
+        sensor_value[i] = (float)adc_dma[i] * adc_scale;
+    }
+    FB_PT1_Bank32_Execute(&sensor_bank, sensor_value, sensor_filtered);
+    for (uint32_t i = 0; i < LOOP_COUNT; i++) {
+        actuator[i] = FB_PID_Execute(&loops[i], loop_setpoint[i], sensor_filtered[i * 4]);
+    }
+}
+
+//===========================================
+// 主函数
+//===========================================
+
+int main(void) {
+    control_init();
+
+    // 实际项目中由 10 ms 定时器中断触发；示例中连续扫描
+    while (1) {
+        control_scan();
+    }
+
+    return 0;
+}
+
@@ -0,0 +1,71 @@
+/**
+ * @file block_sequence.h
+ * @brief 块处理对照测试的公共驱动（FB_xxx_ExecuteBlock 与逐采样 FB_xxx_Execute 逐位比较）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 各功能块测试以 DEFINE_BLOCK_SEQUENCE_CHECK 生成同一套块序列驱动，
+ * 只提供输入波形与执行后状态的断言：
+ *
+ * @code
+ * static float block_sample(unsigned k) { return ...; }
+ * static void assert_block_state(const FB_PT1_t* reference, const FB_PT1_t* actual) { ... }
+ * DEFINE_BLOCK_SEQUENCE_CHECK(check_block_sequence, FB_PT1, block_sample, assert_block_state)
+ *
+ * check_block_sequence(&pt1, &reference);
+ * @endcode
+ */
+
+#ifndef PLCOPEN_TEST_BLOCK_SEQUENCE_H
+#define PLCOPEN_TEST_BLOCK_SEQUENCE_H
+
+#include "unity.h"
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+/** 最长块的采样数 */
+#define BLOCK_SEQUENCE_MAX 64
+
+/**
+ * 生成 static void name(PREFIX##_t* fb, PREFIX##_t* reference)：
+ * fb 执行块处理、reference 逐采样执行，逐位比较每个输出，每块之后调用 assert_state(reference, fb)。
+ *
+ * 块长度序列：单采样、奇数长度、DMA 半传输长度、空块；第 5 块含 NaN/Inf，最后一块原地处理。
+ * sample(k) 给出第 k 个采样（跨块连续编号）。
+ */
+#define DEFINE_BLOCK_SEQUENCE_CHECK(name, PREFIX, sample, assert_state)                   \
+    static void name(PREFIX##_t* fb, PREFIX##_t* reference) {                             \
+        static const size_t sizes[] = { 1, 7, BLOCK_SEQUENCE_MAX, 0, 33, BLOCK_SEQUENCE_MAX }; \
+        const size_t num_blocks = sizeof(sizes) / sizeof(sizes[0]);                       \
+        float input[BLOCK_SEQUENCE_MAX];                                                  \
+        float output[BLOCK_SEQUENCE_MAX];                                                 \
+        unsigned k = 0;                                                                   \
+                                                                                          \
+        for (size_t b = 0; b < num_blocks; b++) {                                         \
+            size_t n = sizes[b];                                                          \
+            for (size_t i = 0; i < n; i++) {                                              \
+                input[i] = sample(k + (unsigned)i);                                       \
+            }                                                                             \
+            if (b == 4) {                                                                 \
+                input[3] = NAN;                                                           \
+                input[9] = INFINITY;                                                      \
+            }                                                                             \
+                                                                                          \
+            if (b == num_blocks - 1) {                                                    \
+                memcpy(output, input, n * sizeof(float));                                 \
+                PREFIX##_ExecuteBlock(fb, output, output, n);                             \
+            } else {                                                                      \
+                PREFIX##_ExecuteBlock(fb, input, output, n);                              \
+            }                                                                             \
+                                                                                          \
+            for (size_t i = 0; i < n; i++) {                                              \
+                float expected = PREFIX##_Execute(reference, input[i]);                   \
+                TEST_ASSERT_TRUE(memcmp(&expected, &output[i], sizeof(float)) == 0);      \
+            }                                                                             \
+            assert_state(reference, fb);                                                  \
+            k += (unsigned)n;                                                             \
+        }                                                                                 \
+    }
+
+#endif /* PLCOPEN_TEST_BLOCK_SEQUENCE_H */
@@ -0,0 +1,199 @@
+/**
+ * @file test_arena.c
+ * @brief 实例存储区（plcopen_arena）单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 分配对齐（自然对齐、缓存行对齐、非 2 的幂对齐拒绝）
+ * - 空间耗尽返回 NULL 且 arena 不变
+ * - 任务分组之间不共享缓存行
+ * - 复位回收
+ * - 匿名映射（可选大页）及回退
+ */
+
+#include "unity.h"
+#include "plcopen/arena.h"
+#include "plcopen/fb_pid.h"
+#include "plcopen/fb_pt1.h"
+#include <stdio.h>
+#include <string.h>
+
+#define STORAGE_SIZE 4096
+
+PLCOPEN_ARENA_STORAGE(storage, STORAGE_SIZE);
+
+static plcopen_arena_t root;
+
+void setUp(void) {
+    TEST_ASSERT_EQUAL_INT(0, plcopen_arena_init(&root, storage, sizeof(storage)));
+}
+
+void tearDown(void) {}
+
+static uintptr_t line_of(const void* p) {
+    return (uintptr_t)p / PLCOPEN_CACHE_LINE;
+}
+
+/* ========== 初始化与分配 ========== */
+
+void test_arena_init_aligns_base(void) {
+    TEST_ASSERT_EQUAL_INT(0, (int)((uintptr_t)root.base % PLCOPEN_CACHE_LINE));
+    TEST_ASSERT_EQUAL_size_t(sizeof(storage), root.size);
+
+    /* 未对齐的存储：跳过开头若干字节 */
+    plcopen_arena_t arena;
+    TEST_ASSERT_EQUAL_INT(0, plcopen_arena_init(&arena, storage + 3, 1000));
+    TEST_ASSERT_EQUAL_INT(0, (int)((uintptr_t)arena.base % PLCOPEN_CACHE_LINE));
+    TEST_ASSERT_EQUAL_size_t(1000 - (PLCOPEN_CACHE_LINE - 3), arena.size);
+
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_arena_init(&arena, storage + 1, 10));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_arena_init(&arena, NULL, 100));
+}
+
+void test_arena_natural_alignment_packs_densely(void) {
+    FB_PT1_t* a = PLCOPEN_ARENA_NEW(&root, FB_PT1_t);
+    FB_PT1_t* b = PLCOPEN_ARENA_NEW(&root, FB_PT1_t);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL_INT(sizeof(FB_PT1_t), (int)((uint8_t*)b - (uint8_t*)a));
+    TEST_ASSERT_EQUAL_size_t(2 * sizeof(FB_PT1_t), root.used);
+}
+
+void test_arena_isolated_instance_owns_line(void) {
+    uint8_t* filler = plcopen_arena_alloc(&root, 5, 1);
+    FB_PID_t* pid = PLCOPEN_ARENA_NEW_ISOLATED(&root, FB_PID_t);
+    TEST_ASSERT_NOT_NULL(pid);
+    TEST_ASSERT_EQUAL_INT(0, (int)((uintptr_t)pid % PLCOPEN_CACHE_LINE));
+    TEST_ASSERT_TRUE(line_of(filler) != line_of(pid));
+}
+
+void test_arena_invalid_alignment_rejected(void) {
+    TEST_ASSERT_NULL(plcopen_arena_alloc(&root, 8, 3));
+    TEST_ASSERT_NULL(plcopen_arena_alloc(&root, 0, 4));
+    TEST_ASSERT_EQUAL_size_t(0, root.used);
+}
+
+void test_arena_exhaustion_returns_null(void) {
+    TEST_ASSERT_NOT_NULL(plcopen_arena_alloc(&root, STORAGE_SIZE - 8, 4));
+    size_t used = root.used;
+    TEST_ASSERT_NULL(plcopen_arena_alloc(&root, 16, 4));
+    /* 对齐填充导致越界也视为耗尽 */
+    TEST_ASSERT_NULL(plcopen_arena_alloc(&root, 4, 0));
+    TEST_ASSERT_EQUAL_size_t(used, root.used);
+    TEST_ASSERT_NOT_NULL(plcopen_arena_alloc(&root, 8, 4));
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_arena_remaining(&root));
+}
+
+/* ========== 任务分组 ========== */
+
+void test_arena_split_groups_do_not_share_lines(void) {
+    plcopen_arena_t task_a, task_b;
+    /* 分组容量按实例尺寸计算（剖析开关会改变 FB_PT1_t 的大小），且不是缓存行的整数倍 */
+    const size_t group = 3u * sizeof(FB_PT1_t) + 1u;
+    const size_t rounded = (group + PLCOPEN_CACHE_LINE - 1u) / PLCOPEN_CACHE_LINE * PLCOPEN_CACHE_LINE;
+
+    /* 父 arena 中先有一个非对齐分配 */
+    TEST_ASSERT_NOT_NULL(plcopen_arena_alloc(&root, 7, 1));
+    TEST_ASSERT_EQUAL_INT(0, plcopen_arena_split(&root, &task_a, group));
+    TEST_ASSERT_EQUAL_INT(0, plcopen_arena_split(&root, &task_b, group));
+
+    TEST_ASSERT_EQUAL_size_t(rounded, task_a.size);
+    TEST_ASSERT_EQUAL_INT(0, (int)((uintptr_t)task_a.base % PLCOPEN_CACHE_LINE));
+    TEST_ASSERT_EQUAL_INT(0, (int)((uintptr_t)task_b.base % PLCOPEN_CACHE_LINE));
+
+    /* 各分组填满后，最后一个实例与下一分组的第一个实例不在同一行 */
+    FB_PT1_t* last_a = NULL;
+    FB_PT1_t* p;
+    while ((p = PLCOPEN_ARENA_NEW(&task_a, FB_PT1_t)) != NULL) {
+        last_a = p;
+    }
+    FB_PT1_t* first_b = PLCOPEN_ARENA_NEW(&task_b, FB_PT1_t);
+    TEST_ASSERT_NOT_NULL(last_a);
+    TEST_ASSERT_NOT_NULL(first_b);
+    TEST_ASSERT_TRUE(line_of((uint8_t*)last_a + sizeof(FB_PT1_t) - 1) < line_of(first_b));
+}
+
+void test_arena_split_insufficient_space(void) {
+    plcopen_arena_t child;
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_arena_split(&root, &child, STORAGE_SIZE + 1));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_arena_split(&root, &child, 0));
+    TEST_ASSERT_EQUAL_size_t(0, root.used);
+}
+
+void test_arena_reset(void) {
+    void* first = plcopen_arena_alloc(&root, 100, 0);
+    plcopen_arena_alloc(&root, 200, 0);
+    plcopen_arena_reset(&root);
+    TEST_ASSERT_EQUAL_size_t(0, root.used);
+    TEST_ASSERT_EQUAL_PTR(first, plcopen_arena_alloc(&root, 100, 0));
+}
+
+/* ========== 匿名映射 ========== */
+
+#if defined(__linux__)
+/* 读取文件第一行（文件不存在时为空串） */
+static void read_first_line(const char* path, char* line, size_t size) {
+    line[0] = '\0';
+    FILE* file = fopen(path, "r");
+    if (file != NULL) {
+        if (fgets(line, (int)size, file) == NULL) {
+            line[0] = '\0';
+        }
+        fclose(file);
+    }
+}
+#endif
+
+void test_arena_map_with_fallback(void) {
+#if defined(__linux__)
+    plcopen_arena_t mapped;
+    TEST_ASSERT_EQUAL_INT(0, plcopen_arena_map(&mapped, 3 * 1024 * 1024, PLCOPEN_ARENA_HUGE_PAGES));
+    /* 大页不可用时回退普通页，两者都可用 */
+    TEST_ASSERT_TRUE(mapped.mapped >= 1 && mapped.mapped <= 3);
+    /* 没有预留大页且 THP 为 never 时 madvise 仍成功，但不能报告为大页 */
+    char reserved[32];
+    char thp[128];
+    read_first_line("/proc/sys/vm/nr_hugepages", reserved, sizeof(reserved));
+    read_first_line("/sys/kernel/mm/transparent_hugepage/enabled", thp, sizeof(thp));
+    if (strcmp(reserved, "0\n") == 0 && strstr(thp, "[never]") != NULL) {
+        TEST_ASSERT_TRUE(mapped.mapped != 2);
+    }
+    TEST_ASSERT_TRUE(mapped.size >= 3u * 1024u * 1024u);
+
+    FB_PT1_t* fb = PLCOPEN_ARENA_NEW(&mapped, FB_PT1_t);
+    TEST_ASSERT_NOT_NULL(fb);
+    fb->state.output = 1.0f;
+
+    plcopen_arena_unmap(&mapped);
+    TEST_ASSERT_EQUAL_INT(0, mapped.mapped);
+    TEST_ASSERT_NULL(mapped.base);
+
+    TEST_ASSERT_EQUAL_INT(0, plcopen_arena_map(&mapped, 100, 0));
+    TEST_ASSERT_EQUAL_INT(1, mapped.mapped);
+    plcopen_arena_unmap(&mapped);
+#else
+    plcopen_arena_t mapped;
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_arena_map(&mapped, 100, 0));
+#endif
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_arena(void) {
+    RUN_TEST(test_arena_init_aligns_base);
+    RUN_TEST(test_arena_natural_alignment_packs_densely);
+    RUN_TEST(test_arena_isolated_instance_owns_line);
+    RUN_TEST(test_arena_invalid_alignment_rejected);
+    RUN_TEST(test_arena_exhaustion_returns_null);
+    RUN_TEST(test_arena_split_groups_do_not_share_lines);
+    RUN_TEST(test_arena_split_insufficient_space);
+    RUN_TEST(test_arena_reset);
+    RUN_TEST(test_arena_map_with_fallback);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_arena();
+    return UNITY_END();
+}
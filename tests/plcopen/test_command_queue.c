@@ -0,0 +1,185 @@
+/**
+ * @file test_command_queue.c
+ * @brief 单生产者/单消费者命令队列单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 各类命令的执行效果与执行顺序
+ * - 队列满时投递失败、环绕后继续可用
+ * - drain 只执行调用时刻已入队的命令
+ * - 并发测试：操作员线程持续投递，控制线程每周期 drain 并执行 PID，
+ *   所有命令按投递顺序执行且一条不丢
+ */
+
+#include "unity.h"
+#include "plcopen/command_queue.h"
+#include <pthread.h>
+#include <sched.h>
+
+#define STRESS_COMMANDS 200000
+
+static plcopen_cmdq_t q;
+static FB_PID_t pid;
+
+static const FB_PID_Config_t pid_config = {
+    .kp = 1.0f, .ki = 0.1f, .kd = 0.0f, .sample_time = 0.01f,
+    .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+};
+
+void setUp(void) {
+    plcopen_cmdq_init(&q);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Init(&pid, &pid_config));
+}
+
+void tearDown(void) {}
+
+/* ========== 命令执行 ========== */
+
+void test_cmdq_empty_drain(void) {
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_cmdq_size(&q));
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_cmdq_drain(&q));
+}
+
+void test_cmdq_commands_take_effect_only_on_drain(void) {
+    float setpoint = 10.0f;
+    TEST_ASSERT_EQUAL_INT(0, plcopen_cmdq_push_pid_set_manual(&q, &pid, 40.0f));
+    TEST_ASSERT_EQUAL_INT(0, plcopen_cmdq_push_write_setpoint(&q, &setpoint, 55.0f));
+    TEST_ASSERT_EQUAL_size_t(2, plcopen_cmdq_size(&q));
+
+    /* 投递不修改任何状态 */
+    TEST_ASSERT_FALSE(FB_PID_IsManual(&pid));
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, setpoint);
+
+    TEST_ASSERT_EQUAL_size_t(2, plcopen_cmdq_drain(&q));
+    TEST_ASSERT_TRUE(FB_PID_IsManual(&pid));
+    TEST_ASSERT_EQUAL_FLOAT(40.0f, FB_PID_Execute(&pid, setpoint, 0.0f));
+    TEST_ASSERT_EQUAL_FLOAT(55.0f, setpoint);
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_cmdq_size(&q));
+}
+
+void test_cmdq_mode_switch_and_resets(void) {
+    FB_INTEGRATOR_t integrator;
+    FB_INTEGRATOR_Config_t icfg = { .sample_time = 0.1f, .out_min = -100.0f, .out_max = 100.0f };
+    TEST_ASSERT_EQUAL_INT(0, FB_INTEGRATOR_Init(&integrator, &icfg));
+    FB_INTEGRATOR_Execute(&integrator, 5.0f);
+    FB_PID_Execute(&pid, 50.0f, 40.0f);
+
+    plcopen_cmdq_push_pid_set_manual(&q, &pid, 30.0f);
+    plcopen_cmdq_push_pid_set_auto(&q, &pid);
+    plcopen_cmdq_push_integrator_reset(&q, &integrator);
+    plcopen_cmdq_drain(&q);
+
+    /* 按顺序执行：先手动（积分跟踪 30）再自动 */
+    TEST_ASSERT_FALSE(FB_PID_IsManual(&pid));
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, pid.state.integral);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, integrator.state.integral);
+
+    plcopen_cmdq_push_pid_reset_integral(&q, &pid);
+    plcopen_cmdq_drain(&q);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, pid.state.integral);
+}
+
+void test_cmdq_rejects_null_targets(void) {
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_cmdq_push_pid_set_auto(&q, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_cmdq_push_write_setpoint(&q, NULL, 1.0f));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_cmdq_push(&q, NULL));
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_cmdq_size(&q));
+}
+
+/* ========== 容量与环绕 ========== */
+
+void test_cmdq_full_then_wraps(void) {
+    float variable = 0.0f;
+    for (int i = 0; i < PLCOPEN_CMDQ_CAPACITY; i++) {
+        TEST_ASSERT_EQUAL_INT(0, plcopen_cmdq_push_write_setpoint(&q, &variable, (float)i));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_cmdq_push_write_setpoint(&q, &variable, -1.0f));
+    TEST_ASSERT_EQUAL_size_t(PLCOPEN_CMDQ_CAPACITY, plcopen_cmdq_drain(&q));
+    TEST_ASSERT_EQUAL_FLOAT((float)(PLCOPEN_CMDQ_CAPACITY - 1), variable);
+
+    /* 多次环绕后仍保持顺序 */
+    for (int round = 0; round < 5; round++) {
+        for (int i = 0; i < PLCOPEN_CMDQ_CAPACITY / 2 + 3; i++) {
+            TEST_ASSERT_EQUAL_INT(0, plcopen_cmdq_push_write_setpoint(&q, &variable,
+                                                                     (float)(round * 100 + i)));
+        }
+        plcopen_cmdq_drain(&q);
+        TEST_ASSERT_EQUAL_FLOAT((float)(round * 100 + PLCOPEN_CMDQ_CAPACITY / 2 + 2), variable);
+    }
+}
+
+/* ========== 并发测试 ========== */
+
+static float stress_setpoint;
+static atomic_int producer_done;
+
+static void* producer_main(void* arg) {
+    (void)arg;
+    for (int i = 1; i <= STRESS_COMMANDS; i++) {
+        /* 队列满时让出 CPU 后重试；生产者自身的等待不影响控制线程 */
+        while (plcopen_cmdq_push_write_setpoint(&q, &stress_setpoint, (float)i) != 0) {
+            sched_yield();
+        }
+        if ((i & 1023) == 0) {
+            while (plcopen_cmdq_push_pid_set_manual(&q, &pid, 20.0f) != 0) {
+                sched_yield();
+            }
+            while (plcopen_cmdq_push_pid_set_auto(&q, &pid) != 0) {
+                sched_yield();
+            }
+        }
+    }
+    atomic_store(&producer_done, 1);
+    return NULL;
+}
+
+void test_cmdq_concurrent_operator_thread(void) {
+    stress_setpoint = 0.0f;
+    atomic_store(&producer_done, 0);
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, producer_main, NULL);
+
+    bool ordered = true;
+    long cycles = 0;
+    size_t max_drained = 0;
+    for (;;) {
+        bool done = atomic_load(&producer_done);
+        float before = stress_setpoint;
+        size_t n = plcopen_cmdq_drain(&q);
+        max_drained = n > max_drained ? n : max_drained;
+        ordered = ordered && stress_setpoint >= before;
+        FB_PID_Execute(&pid, stress_setpoint * 1e-4f, 5.0f);
+        cycles++;
+        if (done && plcopen_cmdq_size(&q) == 0u) {
+            break;
+        }
+        if ((cycles & 7) == 0) {
+            sched_yield();
+        }
+    }
+    pthread_join(producer, NULL);
+
+    TEST_ASSERT_TRUE_MESSAGE(ordered, "setpoint writes applied out of order");
+    TEST_ASSERT_EQUAL_FLOAT((float)STRESS_COMMANDS, stress_setpoint);
+    TEST_ASSERT_FALSE(FB_PID_IsManual(&pid));
+    TEST_ASSERT_TRUE(max_drained <= PLCOPEN_CMDQ_CAPACITY);
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_command_queue(void) {
+    RUN_TEST(test_cmdq_empty_drain);
+    RUN_TEST(test_cmdq_commands_take_effect_only_on_drain);
+    RUN_TEST(test_cmdq_mode_switch_and_resets);
+    RUN_TEST(test_cmdq_rejects_null_targets);
+    RUN_TEST(test_cmdq_full_then_wraps);
+    RUN_TEST(test_cmdq_concurrent_operator_thread);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_command_queue();
+    return UNITY_END();
+}
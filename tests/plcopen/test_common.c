@@ -155,6 +155,83 @@ void test_check_nan_inf_function(void) {
     TEST_ASSERT_FALSE(check_nan_inf(FLT_MAX));
 }
 
+/**
+ * @brief 测试整块有限数检测函数
+ */
+void test_check_block_finite_function(void) {
+    float values[17];
+    for (int i = 0; i < 17; i++) {
+        values[i] = (float)(i - 8) * 1000.0f;
+    }
+    values[16] = -FLT_MAX;
+
+    // 全部有限、空块
+    TEST_ASSERT_TRUE(check_block_finite(values, 17));
+    TEST_ASSERT_TRUE(check_block_finite(NULL, 0));
+
+    // 任意位置的 NaN / Inf 都应被检测到（包括首尾元素）
+    float saved = values[0];
+    values[0] = 0.0f / 0.0f;
+    TEST_ASSERT_FALSE(check_block_finite(values, 17));
+    values[0] = saved;
+    values[16] = -1.0f / 0.0f;
+    TEST_ASSERT_FALSE(check_block_finite(values, 17));
+    TEST_ASSERT_TRUE(check_block_finite(values, 16));
+}
+
+/**
+ * @brief 测试 n 步衰减因子 (1 - α)^n
+ */
+void test_decay_factor_function(void) {
+    // n = 0 为 1，α = 1 时一步衰减到 0
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, decay_factor(0.3f, 0));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, decay_factor(1.0f, 5));
+
+    // 与逐步相乘一致
+    float product = 1.0f;
+    for (uint32_t n = 1; n <= 200; n++) {
+        product *= 1.0f - 0.01f;
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, product, decay_factor(0.01f, n));
+    }
+
+    // 极小 α：log1p 保留有效位（1 - 1e-7 在单精度中舍入为 1）
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, expf(-1.0f), decay_factor(1e-7f, 10000000u));
+
+    // 极大 n 平滑趋于 0
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, decay_factor(0.5f, 4000000000u));
+}
+
+void test_fast_expm1f_function(void) {
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fast_expm1f(0.0f));
+
+    // 全量程相对误差不超过标称上界（以双精度 expm1 为参考）
+    for (float x = -87.5f; x < 88.5f; x += 0.0137f) {
+        double reference = expm1((double)x);
+        double error = fabs(((double)fast_expm1f(x) - reference) / reference);
+        TEST_ASSERT_TRUE(error <= FAST_EXPM1F_MAX_REL_ERROR);
+    }
+
+    // dt 远小于 τ：α = -expm1(-dt/τ) 保留相对精度
+    for (float x = 1e-9f; x < 0.5f; x *= 1.7f) {
+        double reference = expm1(-(double)x);
+        TEST_ASSERT_TRUE(fabs((double)fast_expm1f(-x) - reference) <= FAST_EXPM1F_MAX_REL_ERROR * fabs(reference));
+    }
+
+    // 下溢、上溢与 NaN
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, fast_expm1f(-100.0f));
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, fast_expm1f(-INFINITY));
+    TEST_ASSERT_TRUE(isinf(fast_expm1f(100.0f)));
+    TEST_ASSERT_TRUE(isnan(fast_expm1f(NAN)));
+}
+
+void test_check_elapsed_time_function(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, check_elapsed_time(0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, check_elapsed_time(0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, check_elapsed_time(-0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, check_elapsed_time(NAN));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_INF, check_elapsed_time(INFINITY));
+}
+
 /* ========== 限幅函数测试 ========== */
 
 /**
@@ -217,6 +294,10 @@ int main(void) {
 
     /* NaN/Inf 组合检测测试 */
     RUN_TEST(test_check_nan_inf_function);
+    RUN_TEST(test_check_block_finite_function);
+    RUN_TEST(test_decay_factor_function);
+    RUN_TEST(test_fast_expm1f_function);
+    RUN_TEST(test_check_elapsed_time_function);
 
     /* 限幅函数测试 */
     RUN_TEST(test_clamp_output_within_range);
@@ -254,6 +335,10 @@ void run_test_common(void) {
 
     /* NaN/Inf 组合检测测试 */
     RUN_TEST(test_check_nan_inf_function);
+    RUN_TEST(test_check_block_finite_function);
+    RUN_TEST(test_decay_factor_function);
+    RUN_TEST(test_fast_expm1f_function);
+    RUN_TEST(test_check_elapsed_time_function);
 
     /* 限幅函数测试 */
     RUN_TEST(test_clamp_output_within_range);
@@ -0,0 +1,217 @@
+/**
+ * @file test_config_mailbox.c
+ * @brief 无锁在线参数更新（配置信箱）单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 暂存前验证，无效配置不进入信箱
+ * - 采用语义（周期边界替换配置、保留运行时状态、无新版本时不替换）
+ * - 压力测试：多个写者高频整定，控制线程持续采用并执行，
+ *   每次采用的配置都必须是某个写者完整写入的一份
+ */
+
+#include "unity.h"
+#include "plcopen/config_mailbox.h"
+#include <pthread.h>
+#include <sched.h>
+
+/* 压力测试参数 */
+#define STRESS_WRITERS 3
+#define STRESS_UPDATES_PER_WRITER 100000
+
+static plcopen_config_mailbox_t mb;
+static FB_PID_t pid;
+
+static const FB_PID_Config_t base_config = {
+    .kp = 1.0f, .ki = 0.1f, .kd = 0.0f, .sample_time = 0.01f,
+    .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+};
+
+void setUp(void) {
+    plcopen_config_mailbox_init(&mb);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Init(&pid, &base_config));
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief 由单个整数生成各字段互相关联的配置，用于检测撕裂
+ */
+static FB_PID_Config_t tagged_config(uint32_t tag) {
+    float k = (float)tag;
+    FB_PID_Config_t config = {
+        .kp = k, .ki = k, .kd = k, .sample_time = 0.01f,
+        .out_min = -k - 1.0f, .out_max = k + 1.0f,
+        .int_min = -k - 2.0f, .int_max = k + 2.0f
+    };
+    return config;
+}
+
+static bool config_is_consistent(const FB_PID_Config_t* c) {
+    float k = c->kp;
+    return c->ki == k && c->kd == k && c->sample_time == 0.01f &&
+           c->out_min == -k - 1.0f && c->out_max == k + 1.0f &&
+           c->int_min == -k - 2.0f && c->int_max == k + 2.0f;
+}
+
+/* ========== 基本语义 ========== */
+
+void test_mailbox_nothing_pending_after_init(void) {
+    TEST_ASSERT_FALSE(plcopen_config_pending(&mb));
+    TEST_ASSERT_FALSE(FB_PID_AdoptConfig(&pid, &mb));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, pid.config.kp);
+}
+
+void test_mailbox_invalid_config_not_staged(void) {
+    FB_PID_Config_t bad = base_config;
+    bad.out_max = bad.out_min;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PID_StageConfig(&mb, &bad));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PID_StageConfig(&mb, NULL));
+    TEST_ASSERT_FALSE(plcopen_config_pending(&mb));
+
+    uint8_t oversized[PLCOPEN_CONFIG_MAX_WORDS * 4 + 1] = { 0 };
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_config_stage(&mb, oversized, sizeof(oversized)));
+}
+
+void test_mailbox_adopt_at_cycle_boundary(void) {
+    FB_PID_Execute(&pid, 50.0f, 40.0f);
+    FB_PID_Execute(&pid, 50.0f, 40.0f);
+    float integral = pid.state.integral;
+
+    FB_PID_Config_t retuned = base_config;
+    retuned.kp = 3.0f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_StageConfig(&mb, &retuned));
+
+    /* 暂存不影响正在使用的配置 */
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, pid.config.kp);
+    TEST_ASSERT_TRUE(plcopen_config_pending(&mb));
+
+    TEST_ASSERT_TRUE(FB_PID_AdoptConfig(&pid, &mb));
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, pid.config.kp);
+    /* 运行时状态保持 */
+    TEST_ASSERT_EQUAL_FLOAT(integral, pid.state.integral);
+    TEST_ASSERT_FALSE(pid.state.first_run);
+
+    /* 同一版本只采用一次 */
+    TEST_ASSERT_FALSE(FB_PID_AdoptConfig(&pid, &mb));
+}
+
+void test_mailbox_latest_stage_wins(void) {
+    FB_PT1_t pt1;
+    FB_PT1_Config_t cfg = { .time_constant = 1.0f, .sample_time = 0.01f };
+    FB_PT1_Init(&pt1, &cfg);
+
+    for (int i = 1; i <= 5; i++) {
+        cfg.time_constant = (float)i;
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_StageConfig(&mb, &cfg));
+    }
+    TEST_ASSERT_TRUE(FB_PT1_AdoptConfig(&pt1, &mb));
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, pt1.config.time_constant);
+}
+
+void test_mailbox_fetch_rejects_write_in_progress(void) {
+    FB_PID_Config_t retuned = base_config;
+    retuned.kp = 7.0f;
+    FB_PID_StageConfig(&mb, &retuned);
+
+    /* 模拟写者停在写入中途：seq 为奇数 */
+    atomic_fetch_add(&mb.seq, 1u);
+    FB_PID_Config_t out = base_config;
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_config_fetch(&mb, &out, sizeof(out)));
+    TEST_ASSERT_FALSE(FB_PID_AdoptConfig(&pid, &mb));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, pid.config.kp);
+
+    /* 写者完成后下一周期采用 */
+    atomic_fetch_add(&mb.seq, 1u);
+    TEST_ASSERT_TRUE(FB_PID_AdoptConfig(&pid, &mb));
+    TEST_ASSERT_EQUAL_FLOAT(7.0f, pid.config.kp);
+}
+
+/* ========== 压力测试 ========== */
+
+typedef struct {
+    uint32_t first_tag;
+} writer_arg_t;
+
+static void* writer_main(void* arg) {
+    const writer_arg_t* w = arg;
+    for (uint32_t i = 0; i < STRESS_UPDATES_PER_WRITER; i++) {
+        FB_PID_Config_t cfg = tagged_config(w->first_tag + i);
+        FB_PID_StageConfig(&mb, &cfg);
+        /* 单核主机上主动让出 CPU，增加写者与控制线程的交错 */
+        if ((i & 15u) == 0u) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static atomic_int writers_done;
+
+static void* writers_main(void* arg) {
+    (void)arg;
+    pthread_t tids[STRESS_WRITERS];
+    writer_arg_t args[STRESS_WRITERS];
+    for (int i = 0; i < STRESS_WRITERS; i++) {
+        args[i].first_tag = 1u + (uint32_t)i * STRESS_UPDATES_PER_WRITER;
+        pthread_create(&tids[i], NULL, writer_main, &args[i]);
+    }
+    for (int i = 0; i < STRESS_WRITERS; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    atomic_store(&writers_done, 1);
+    return NULL;
+}
+
+void test_mailbox_concurrent_retuning_stress(void) {
+    FB_PID_Config_t initial = tagged_config(0);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Init(&pid, &initial));
+    atomic_store(&writers_done, 0);
+
+    pthread_t writers;
+    pthread_create(&writers, NULL, writers_main, NULL);
+
+    long cycles = 0;
+    long adopted = 0;
+    bool consistent = true;
+    while (!atomic_load(&writers_done)) {
+        if (FB_PID_AdoptConfig(&pid, &mb)) {
+            adopted++;
+            consistent = consistent && config_is_consistent(&pid.config);
+        }
+        FB_PID_Execute(&pid, 10.0f, 5.0f);
+        if ((++cycles & 7) == 0) {
+            sched_yield();
+        }
+    }
+    pthread_join(writers, NULL);
+
+    /* 写者全部结束后，下一周期必然采用最后一份配置 */
+    if (FB_PID_AdoptConfig(&pid, &mb)) {
+        adopted++;
+    }
+    consistent = consistent && config_is_consistent(&pid.config);
+
+    TEST_ASSERT_TRUE_MESSAGE(consistent, "adopted a torn configuration");
+    TEST_ASSERT_GREATER_THAN(0, adopted);
+    TEST_ASSERT_FALSE(plcopen_config_pending(&mb));
+    TEST_ASSERT_GREATER_THAN(0, cycles);
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_config_mailbox(void) {
+    RUN_TEST(test_mailbox_nothing_pending_after_init);
+    RUN_TEST(test_mailbox_invalid_config_not_staged);
+    RUN_TEST(test_mailbox_adopt_at_cycle_boundary);
+    RUN_TEST(test_mailbox_latest_stage_wins);
+    RUN_TEST(test_mailbox_fetch_rejects_write_in_progress);
+    RUN_TEST(test_mailbox_concurrent_retuning_stress);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_config_mailbox();
+    return UNITY_END();
+}
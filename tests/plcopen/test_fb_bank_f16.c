@@ -0,0 +1,303 @@
+/**
+ * @file test_fb_bank_f16.c
+ * @brief 半精度存储 PT1 / DERIVATIVE bank 单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - binary16 转换（精确往返、就近舍入到偶数、溢出、非正规数）
+ * - 配置验证
+ * - 与 float32 功能块（FB_PT1 / FB_DERIVATIVE）的误差界
+ * - 收敛舍入（小 α 时稳态精确收敛）
+ * - 数值保护（NaN/Inf、范围钳位）
+ * - 向量路径整组回退（实例数非 8 的倍数、组内含异常输入）
+ * - 头文件尺寸表与实际实例尺寸一致
+ */
+
+#include "unity.h"
+#include "plcopen/fb_pt1.h"
+#include "plcopen/fb_derivative.h"
+#include "plcopen/fb_bank_f16.h"
+#include <math.h>
+#include <string.h>
+
+/* 实例数取非 8 的倍数，覆盖向量路径与标量尾部 */
+#define BANK_SIZE 37
+
+FB_PT1_BANK16_STORAGE(pt1, BANK_SIZE);
+FB_DERIVATIVE_BANK16_STORAGE(der, BANK_SIZE);
+
+static float input[BANK_SIZE];
+static float output[BANK_SIZE];
+
+void setUp(void) {
+    memset(input, 0, sizeof(input));
+    memset(output, 0, sizeof(output));
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief binary16 在 |x| 处的 ULP
+ */
+static float half_ulp(float x) {
+    int exponent;
+    frexpf(fabsf(x) < 6.103515625e-5f ? 6.103515625e-5f : x, &exponent);
+    return ldexpf(1.0f, exponent - 11);
+}
+
+/* ========== binary16 转换测试 ========== */
+
+void test_half_exact_values(void) {
+    TEST_ASSERT_EQUAL_INT(0x0000, plc_float_to_half(0.0f));
+    TEST_ASSERT_EQUAL_INT(0x3C00, plc_float_to_half(1.0f));
+    TEST_ASSERT_EQUAL_INT(0xC100, plc_float_to_half(-2.5f));
+    TEST_ASSERT_EQUAL_INT(0x7BFF, plc_float_to_half(65504.0f));
+    TEST_ASSERT_EQUAL_INT(0x0400, plc_float_to_half(6.103515625e-5f));   /* 2^-14 */
+    TEST_ASSERT_EQUAL_INT(0x0001, plc_float_to_half(5.9604644775390625e-8f)); /* 2^-24 */
+
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, plc_half_to_float(0x3C00));
+    TEST_ASSERT_EQUAL_FLOAT(-2.5f, plc_half_to_float(0xC100));
+    TEST_ASSERT_EQUAL_FLOAT(65504.0f, plc_half_to_float(0x7BFF));
+}
+
+void test_half_round_to_nearest_even(void) {
+    /* 1 + 2^-11 恰为中点，舍入到偶数 1.0 */
+    TEST_ASSERT_EQUAL_INT(0x3C00, plc_float_to_half(1.0f + 0x1p-11f));
+    /* 1 + 3*2^-11 恰为中点，舍入到偶数 1 + 2^-9 */
+    TEST_ASSERT_EQUAL_INT(0x3C02, plc_float_to_half(1.0f + 0x3p-11f));
+    /* 略高于中点向上舍入 */
+    TEST_ASSERT_EQUAL_INT(0x3C01, plc_float_to_half(1.0f + 0x1p-11f + 0x1p-20f));
+}
+
+void test_half_overflow_and_special(void) {
+    TEST_ASSERT_EQUAL_INT(0x7BFF, plc_float_to_half(65519.0f));
+    TEST_ASSERT_EQUAL_INT(0x7C00, plc_float_to_half(65520.0f));
+    TEST_ASSERT_EQUAL_INT(0xFC00, plc_float_to_half(-1e9f));
+    TEST_ASSERT_EQUAL_INT(0x7C00, plc_float_to_half(INFINITY));
+    TEST_ASSERT_TRUE(plc_half_is_nan(plc_float_to_half(NAN)));
+    TEST_ASSERT_FALSE(plc_half_is_nan(0x7C00));
+}
+
+void test_half_exhaustive_round_trip(void) {
+    for (uint32_t h = 0; h <= 0xFFFFu; h++) {
+        if (plc_half_is_nan((plc_half_t)h)) {
+            continue;
+        }
+        float value = plc_half_to_float((plc_half_t)h);
+        TEST_ASSERT_EQUAL_INT(h, plc_float_to_half(value));
+    }
+}
+
+/* ========== PT1 bank 测试 ========== */
+
+void test_pt1_bank16_init_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_PT1_Bank16_Init(&pt1_bank, pt1_output, pt1_alpha, pt1_status,
+                                         BANK_SIZE, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_PT1_Bank16_Init(&pt1_bank, NULL, pt1_alpha, pt1_status,
+                                         BANK_SIZE, 0.01f));
+
+    TEST_ASSERT_EQUAL(FB_STATUS_OK,
+                      FB_PT1_Bank16_Init(&pt1_bank, pt1_output, pt1_alpha, pt1_status,
+                                         BANK_SIZE, 0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PT1_Bank16_Configure(&pt1_bank, 0, 1e-7f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PT1_Bank16_Configure(&pt1_bank, BANK_SIZE, 1.0f));
+}
+
+void test_pt1_bank16_first_call_no_jump(void) {
+    FB_PT1_Bank16_Init(&pt1_bank, pt1_output, pt1_alpha, pt1_status, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_Bank16_Configure(&pt1_bank, i, 1.0f);
+        input[i] = 10.0f + (float)i;
+    }
+
+    FB_PT1_Bank16_Execute(&pt1_bank, input, output);
+
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(input[i], output[i]);
+        TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_PT1_Bank16_GetStatus(&pt1_bank, i));
+    }
+}
+
+void test_pt1_bank16_matches_float32_within_bound(void) {
+    FB_PT1_t reference[BANK_SIZE];
+    FB_PT1_Bank16_Init(&pt1_bank, pt1_output, pt1_alpha, pt1_status, BANK_SIZE, 0.01f);
+
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_Config_t config = { .time_constant = 0.05f + 0.05f * (float)i, .sample_time = 0.01f };
+        FB_PT1_Init(&reference[i], &config);
+        FB_PT1_Bank16_Configure(&pt1_bank, i, config.time_constant);
+    }
+
+    float max_error_ratio = 0.0f;
+    for (int k = 0; k < 2000; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = (k < 1000 ? 80.0f : -20.0f) + 5.0f * sinf(0.01f * (float)(k + (int)i));
+        }
+        FB_PT1_Bank16_Execute(&pt1_bank, input, output);
+
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            float expected = FB_PT1_Execute(&reference[i], input[i]);
+            float alpha = plc_half_to_float(pt1_alpha[i]);
+            /* 文档误差界：ULP(|y|) / α（每步写回误差 <= 1 ULP，经一阶环节累积） */
+            float bound = half_ulp(85.0f) / alpha;
+            float ratio = fabsf(output[i] - expected) / bound;
+            if (ratio > max_error_ratio) {
+                max_error_ratio = ratio;
+            }
+        }
+    }
+
+    TEST_ASSERT_TRUE(max_error_ratio <= 1.0f);
+}
+
+void test_pt1_bank16_converges_exactly_with_small_alpha(void) {
+    FB_PT1_Bank16_Init(&pt1_bank, pt1_output, pt1_alpha, pt1_status, 1, 0.01f);
+    FB_PT1_Bank16_Configure(&pt1_bank, 0, 100.0f);  /* α ≈ 1e-4 */
+
+    float u = 0.0f;
+    FB_PT1_Bank16_Execute(&pt1_bank, &u, output);
+    u = 50.0f;
+    for (int k = 0; k < 200000; k++) {
+        FB_PT1_Bank16_Execute(&pt1_bank, &u, output);
+    }
+
+    /* 普通舍入会停滞在 |u - y| ≈ ULP/(2α) ≈ 156 的死区内 */
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, output[0]);
+}
+
+void test_pt1_bank16_nan_inf_input(void) {
+    FB_PT1_Bank16_Init(&pt1_bank, pt1_output, pt1_alpha, pt1_status, 16, 0.01f);
+    for (size_t i = 0; i < 16; i++) {
+        FB_PT1_Bank16_Configure(&pt1_bank, i, 1.0f);
+        input[i] = 25.0f;
+    }
+    FB_PT1_Bank16_Execute(&pt1_bank, input, output);
+
+    input[3] = NAN;
+    input[12] = INFINITY;
+    FB_PT1_Bank16_Execute(&pt1_bank, input, output);
+
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, FB_PT1_Bank16_GetStatus(&pt1_bank, 3));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_INF, FB_PT1_Bank16_GetStatus(&pt1_bank, 12));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, output[3]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, output[12]);
+    /* 异常实例状态保持不变，同组其他实例正常更新 */
+    TEST_ASSERT_EQUAL_FLOAT(25.0f, FB_PT1_Bank16_GetOutput(&pt1_bank, 3));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_PT1_Bank16_GetStatus(&pt1_bank, 4));
+    TEST_ASSERT_EQUAL_FLOAT(25.0f, output[4]);
+}
+
+void test_pt1_bank16_out_of_range_clamped(void) {
+    FB_PT1_Bank16_Init(&pt1_bank, pt1_output, pt1_alpha, pt1_status, 2, 0.01f);
+    input[0] = 1e6f;
+    input[1] = -1e6f;
+    FB_PT1_Bank16_Execute(&pt1_bank, input, output);
+
+    TEST_ASSERT_EQUAL(FB_STATUS_LIMIT_HI, FB_PT1_Bank16_GetStatus(&pt1_bank, 0));
+    TEST_ASSERT_EQUAL(FB_STATUS_LIMIT_LO, FB_PT1_Bank16_GetStatus(&pt1_bank, 1));
+    TEST_ASSERT_EQUAL_FLOAT(PLC_HALF_MAX, output[0]);
+    TEST_ASSERT_EQUAL_FLOAT(-PLC_HALF_MAX, output[1]);
+}
+
+/* ========== DERIVATIVE bank 测试 ========== */
+
+void test_derivative_bank16_init_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_DERIVATIVE_Bank16_Init(&der_bank, der_prev_input, der_filtered,
+                                                der_alpha, der_status, BANK_SIZE, -1.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK,
+                      FB_DERIVATIVE_Bank16_Init(&der_bank, der_prev_input, der_filtered,
+                                                der_alpha, der_status, BANK_SIZE, 0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_DERIVATIVE_Bank16_Configure(&der_bank, 0, -0.1f));
+}
+
+void test_derivative_bank16_first_call_zero(void) {
+    FB_DERIVATIVE_Bank16_Init(&der_bank, der_prev_input, der_filtered,
+                              der_alpha, der_status, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        input[i] = 100.0f;
+    }
+    FB_DERIVATIVE_Bank16_Execute(&der_bank, input, output);
+
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, output[i]);
+    }
+}
+
+void test_derivative_bank16_matches_float32_within_bound(void) {
+    FB_DERIVATIVE_t reference[BANK_SIZE];
+    const float ts = 0.01f;
+    FB_DERIVATIVE_Bank16_Init(&der_bank, der_prev_input, der_filtered,
+                              der_alpha, der_status, BANK_SIZE, ts);
+
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_DERIVATIVE_Config_t config = {
+            .sample_time = ts,
+            .filter_time_constant = (i % 2 == 0) ? 0.0f : 0.1f
+        };
+        FB_DERIVATIVE_Init(&reference[i], &config);
+        FB_DERIVATIVE_Bank16_Configure(&der_bank, i, config.filter_time_constant);
+    }
+
+    for (int k = 0; k < 1000; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            /* 斜率 2/s 的斜坡叠加慢正弦 */
+            input[i] = 10.0f + 2.0f * ts * (float)k + sinf(0.005f * (float)k);
+        }
+        FB_DERIVATIVE_Bank16_Execute(&der_bank, input, output);
+
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            float expected = FB_DERIVATIVE_Execute(&reference[i], input[i]);
+            float alpha = plc_half_to_float(der_alpha[i]);
+            /* 原始微分误差 ULP(|u|)/Ts（本次与上次输入各半个 ULP），经滤波累积放大 1/α */
+            float bound = half_ulp(input[i]) / ts / alpha + half_ulp(expected);
+            TEST_ASSERT_FLOAT_WITHIN(bound, expected, output[i]);
+        }
+    }
+}
+
+/* ========== 尺寸表 ========== */
+
+void test_bank16_size_table_matches_instances(void) {
+#ifndef PLCOPEN_ENABLE_PROFILING
+    /* fb_bank_f16.h 尺寸表中的标准实例字节数（剖析构建附加计数器，不在表中） */
+    TEST_ASSERT_EQUAL_size_t(20, sizeof(FB_PT1_t));
+    TEST_ASSERT_EQUAL_size_t(24, sizeof(FB_DERIVATIVE_t));
+#endif
+    /* bank 每实例：PT1 输出 + α，DERIVATIVE 上次输入 + 滤波输出 + α，各 2 字节 */
+    TEST_ASSERT_EQUAL_size_t(2, sizeof(plc_half_t));
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_fb_bank_f16(void) {
+    /* binary16 转换 */
+    RUN_TEST(test_half_exact_values);
+    RUN_TEST(test_half_round_to_nearest_even);
+    RUN_TEST(test_half_overflow_and_special);
+    RUN_TEST(test_half_exhaustive_round_trip);
+
+    /* PT1 bank */
+    RUN_TEST(test_pt1_bank16_init_invalid);
+    RUN_TEST(test_pt1_bank16_first_call_no_jump);
+    RUN_TEST(test_pt1_bank16_matches_float32_within_bound);
+    RUN_TEST(test_pt1_bank16_converges_exactly_with_small_alpha);
+    RUN_TEST(test_pt1_bank16_nan_inf_input);
+    RUN_TEST(test_pt1_bank16_out_of_range_clamped);
+
+    /* DERIVATIVE bank */
+    RUN_TEST(test_derivative_bank16_init_invalid);
+    RUN_TEST(test_derivative_bank16_first_call_zero);
+    RUN_TEST(test_derivative_bank16_matches_float32_within_bound);
+    RUN_TEST(test_bank16_size_table_matches_instances);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_bank_f16();
+    return UNITY_END();
+}
@@ -0,0 +1,299 @@
+/**
+ * @file test_fb_bank_f32.c
+ * @brief float32 PID / PT1 / DERIVATIVE / LIMIT bank 单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 配置验证
+ * - 与 FB_xxx_t 实例数组逐位一致（输出、状态码），覆盖首次运行、NaN/Inf 输入、
+ *   PID 手动/自动切换、Kd/Ki = 0、输出与积分饱和、DERIVATIVE 无滤波
+ * - 实例数不是 4 的倍数，覆盖向量分组与标量尾部
+ *
+ * 同一测试另以 PLCOPEN_BANK32_EMULATE_NEON 编译一次（test_fb_bank_f32_neon_emulated），
+ * 使 Execute 走向量路径；以 templates/cmake/toolchain-aarch64-linux.cmake 交叉编译时
+ * 本测试经 qemu-aarch64 运行真实 NEON 路径。
+ */
+
+#include "unity.h"
+#include "plcopen/fb_pid.h"
+#include "plcopen/fb_pt1.h"
+#include "plcopen/fb_derivative.h"
+#include "plcopen/fb_limit.h"
+#include "plcopen/fb_bank_f32.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 实例数不是 4 的倍数，覆盖向量分组与标量尾部 */
+#define BANK_SIZE 37
+#define STEPS 400
+
+FB_PID_BANK32_STORAGE(pid, BANK_SIZE);
+FB_PT1_BANK32_STORAGE(pt1, BANK_SIZE);
+FB_DERIVATIVE_BANK32_STORAGE(drv, BANK_SIZE);
+FB_LIMIT_BANK32_STORAGE(lim, BANK_SIZE);
+
+static FB_PID_t pid_ref[BANK_SIZE];
+static FB_PT1_t pt1_ref[BANK_SIZE];
+static FB_DERIVATIVE_t drv_ref[BANK_SIZE];
+static FB_LIMIT_t lim_ref[BANK_SIZE];
+
+static float setpoint[BANK_SIZE];
+static float input[BANK_SIZE];
+static float output[BANK_SIZE];
+
+void setUp(void) {
+    memset(output, 0, sizeof(output));
+    srand(4242);
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief 随机输入：约 1/64 为 NaN、1/64 为 ±Inf，其余在 [-150, 150) 内
+ */
+static float random_input(void) {
+    int r = rand();
+    switch (r & 63) {
+        case 0: return NAN;
+        case 1: return (r & 64) ? INFINITY : -INFINITY;
+        default: return (float)(r % 30000) * 0.01f - 150.0f;
+    }
+}
+
+static void assert_same_float(float expected, float actual) {
+    uint32_t e;
+    uint32_t a;
+    memcpy(&e, &expected, sizeof(e));
+    memcpy(&a, &actual, sizeof(a));
+    TEST_ASSERT_EQUAL_UINT32(e, a);
+}
+
+/* ========== PID bank 测试 ========== */
+
+void test_pid_bank32_config_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_PID_Bank32_Init(&pid_bank, pid_floats, pid_flags, pid_status, BANK_SIZE, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK,
+                      FB_PID_Bank32_Init(&pid_bank, pid_floats, pid_flags, pid_status, BANK_SIZE, 0.01f));
+
+    FB_PID_Config_t config = {
+        .kp = 1.0f, .ki = 0.1f, .kd = 0.0f, .sample_time = 0.02f,
+        .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+    };
+    /* 采样周期与 bank 不一致 */
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PID_Bank32_Configure(&pid_bank, 0, &config));
+    config.sample_time = 0.01f;
+    config.out_max = -1.0f;
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PID_Bank32_Configure(&pid_bank, 0, &config));
+    config.out_max = 100.0f;
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PID_Bank32_Configure(&pid_bank, BANK_SIZE, &config));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_PID_Bank32_Configure(&pid_bank, 0, &config));
+}
+
+void test_pid_bank32_matches_scalar(void) {
+    FB_PID_Bank32_Init(&pid_bank, pid_floats, pid_flags, pid_status, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PID_Config_t config = {
+            .kp = 0.5f + 0.1f * (float)(i % 7),
+            .ki = (i % 5 == 0) ? 0.0f : 0.2f * (float)(i % 3 + 1),
+            .kd = (i % 3 == 0) ? 0.0f : 0.01f * (float)(i % 4),
+            .sample_time = 0.01f,
+            .out_min = -20.0f - (float)i, .out_max = 40.0f + (float)i,
+            .int_min = -10.0f, .int_max = 10.0f + (float)(i % 4)
+        };
+        TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_PID_Init(&pid_ref[i], &config));
+        TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_PID_Bank32_Configure(&pid_bank, i, &config));
+    }
+
+    for (int k = 0; k < STEPS; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            setpoint[i] = (k % 100 < 50) ? 30.0f : -5.0f;
+            input[i] = random_input();
+            /* 周期性切换部分实例的手动/自动模式 */
+            if (k % 50 == 17 && i % 6 == 1) {
+                FB_PID_SetManual(&pid_ref[i], 12.5f);
+                FB_PID_Bank32_SetManual(&pid_bank, i, 12.5f);
+            } else if (k % 50 == 33 && i % 6 == 1) {
+                FB_PID_SetAuto(&pid_ref[i]);
+                FB_PID_Bank32_SetAuto(&pid_bank, i);
+            }
+        }
+
+        FB_PID_Bank32_Execute(&pid_bank, setpoint, input, output);
+
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            assert_same_float(FB_PID_Execute(&pid_ref[i], setpoint[i], input[i]), output[i]);
+            TEST_ASSERT_EQUAL(pid_ref[i].state.status, FB_PID_Bank32_GetStatus(&pid_bank, i));
+            assert_same_float(pid_ref[i].state.integral, pid_bank.integral[i]);
+            assert_same_float(pid_ref[i].state.prev_output, FB_PID_Bank32_GetOutput(&pid_bank, i));
+        }
+    }
+}
+
+/* ========== PT1 bank 测试 ========== */
+
+void test_pt1_bank32_config_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_PT1_Bank32_Init(&pt1_bank, NULL, pt1_flags, pt1_status, BANK_SIZE, 0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK,
+                      FB_PT1_Bank32_Init(&pt1_bank, pt1_floats, pt1_flags, pt1_status, BANK_SIZE, 0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PT1_Bank32_Configure(&pt1_bank, 0, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PT1_Bank32_Configure(&pt1_bank, BANK_SIZE, 1.0f));
+}
+
+void test_pt1_bank32_matches_scalar(void) {
+    FB_PT1_Bank32_Init(&pt1_bank, pt1_floats, pt1_flags, pt1_status, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_Config_t config = { .time_constant = 0.003f * (float)(i * i + 1), .sample_time = 0.01f };
+        FB_PT1_Init(&pt1_ref[i], &config);
+        FB_PT1_Bank32_Configure(&pt1_bank, i, config.time_constant);
+    }
+
+    for (int k = 0; k < STEPS; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = random_input();
+        }
+
+        FB_PT1_Bank32_Execute(&pt1_bank, input, output);
+
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            assert_same_float(FB_PT1_Execute(&pt1_ref[i], input[i]), output[i]);
+            TEST_ASSERT_EQUAL(pt1_ref[i].state.status, FB_PT1_Bank32_GetStatus(&pt1_bank, i));
+        }
+    }
+}
+
+void test_pt1_bank32_in_place(void) {
+    FB_PT1_Bank32_Init(&pt1_bank, pt1_floats, pt1_flags, pt1_status, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_Config_t config = { .time_constant = 0.1f, .sample_time = 0.01f };
+        FB_PT1_Init(&pt1_ref[i], &config);
+        FB_PT1_Bank32_Configure(&pt1_bank, i, config.time_constant);
+    }
+
+    for (int k = 0; k < 20; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = (float)(k * 7 + (int)i);
+            output[i] = FB_PT1_Execute(&pt1_ref[i], input[i]);
+        }
+        FB_PT1_Bank32_Execute(&pt1_bank, input, input);   /* 输出覆盖输入 */
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            assert_same_float(output[i], input[i]);
+        }
+    }
+}
+
+/* ========== DERIVATIVE bank 测试 ========== */
+
+void test_derivative_bank32_config_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_DERIVATIVE_Bank32_Init(&drv_bank, drv_floats, drv_flags, drv_status, BANK_SIZE, 1000.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK,
+                      FB_DERIVATIVE_Bank32_Init(&drv_bank, drv_floats, drv_flags, drv_status, BANK_SIZE, 0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_DERIVATIVE_Bank32_Configure(&drv_bank, 0, -0.1f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_DERIVATIVE_Bank32_Configure(&drv_bank, BANK_SIZE, 0.1f));
+}
+
+void test_derivative_bank32_matches_scalar(void) {
+    FB_DERIVATIVE_Bank32_Init(&drv_bank, drv_floats, drv_flags, drv_status, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        /* 每 3 个实例一个无滤波 */
+        FB_DERIVATIVE_Config_t config = {
+            .sample_time = 0.01f,
+            .filter_time_constant = (i % 3 == 0) ? 0.0f : 0.02f * (float)(i % 5 + 1)
+        };
+        FB_DERIVATIVE_Init(&drv_ref[i], &config);
+        FB_DERIVATIVE_Bank32_Configure(&drv_bank, i, config.filter_time_constant);
+    }
+
+    for (int k = 0; k < STEPS; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = random_input();
+        }
+
+        FB_DERIVATIVE_Bank32_Execute(&drv_bank, input, output);
+
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            assert_same_float(FB_DERIVATIVE_Execute(&drv_ref[i], input[i]), output[i]);
+            TEST_ASSERT_EQUAL(drv_ref[i].state.status, FB_DERIVATIVE_Bank32_GetStatus(&drv_bank, i));
+        }
+    }
+}
+
+/* ========== LIMIT bank 测试 ========== */
+
+void test_limit_bank32_config_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_LIMIT_Bank32_Init(&lim_bank, lim_floats, NULL, BANK_SIZE));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_LIMIT_Bank32_Init(&lim_bank, lim_floats, lim_status, BANK_SIZE));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_LIMIT_Bank32_Configure(&lim_bank, 0, 5.0f, 5.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_LIMIT_Bank32_Configure(&lim_bank, BANK_SIZE, 0.0f, 1.0f));
+}
+
+void test_limit_bank32_matches_scalar(void) {
+    FB_LIMIT_Bank32_Init(&lim_bank, lim_floats, lim_status, BANK_SIZE);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_LIMIT_Config_t config = { .min_val = -100.0f + (float)i, .max_val = 20.0f + 2.0f * (float)i };
+        FB_LIMIT_Init(&lim_ref[i], &config);
+        FB_LIMIT_Bank32_Configure(&lim_bank, i, config.min_val, config.max_val);
+    }
+
+    for (int k = 0; k < STEPS; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = random_input();
+        }
+
+        FB_LIMIT_Bank32_Execute(&lim_bank, input, output);
+
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            assert_same_float(FB_LIMIT_Execute(&lim_ref[i], input[i]), output[i]);
+            TEST_ASSERT_EQUAL(lim_ref[i].state.status, FB_LIMIT_Bank32_GetStatus(&lim_bank, i));
+        }
+    }
+}
+
+void test_limit_bank32_signed_zero(void) {
+    /* 边界为 ±0 时按比较选择而非 min/max 指令：-0 > +0 为假，输出保持输入 */
+    FB_LIMIT_Bank32_Init(&lim_bank, lim_floats, lim_status, 4);
+    FB_LIMIT_Bank32_Configure(&lim_bank, 0, -1.0f, 0.0f);
+    FB_LIMIT_Bank32_Configure(&lim_bank, 1, -1.0f, -0.0f);
+    FB_LIMIT_Bank32_Configure(&lim_bank, 2, 0.0f, 1.0f);
+    FB_LIMIT_Bank32_Configure(&lim_bank, 3, -0.0f, 1.0f);
+    const float in[4] = { -0.0f, 0.0f, -0.0f, 0.0f };
+
+    FB_LIMIT_Bank32_Execute(&lim_bank, in, output);
+
+    for (size_t i = 0; i < 4; i++) {
+        assert_same_float(in[i], output[i]);
+        TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_LIMIT_Bank32_GetStatus(&lim_bank, i));
+    }
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_fb_bank_f32(void) {
+    /* PID bank */
+    RUN_TEST(test_pid_bank32_config_invalid);
+    RUN_TEST(test_pid_bank32_matches_scalar);
+
+    /* PT1 bank */
+    RUN_TEST(test_pt1_bank32_config_invalid);
+    RUN_TEST(test_pt1_bank32_matches_scalar);
+    RUN_TEST(test_pt1_bank32_in_place);
+
+    /* DERIVATIVE bank */
+    RUN_TEST(test_derivative_bank32_config_invalid);
+    RUN_TEST(test_derivative_bank32_matches_scalar);
+
+    /* LIMIT bank */
+    RUN_TEST(test_limit_bank32_config_invalid);
+    RUN_TEST(test_limit_bank32_matches_scalar);
+    RUN_TEST(test_limit_bank32_signed_zero);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_bank_f32();
+    return UNITY_END();
+}
@@ -0,0 +1,391 @@
+/**
+ * @file test_fb_bank_q15.c
+ * @brief Q15 定点 PT1 / LIMIT / DEADBAND bank 单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - Q15 转换（舍入、饱和、NaN）
+ * - 配置验证
+ * - PT1 与 float32 功能块（FB_PT1）的误差界、收敛舍入
+ * - LIMIT / DEADBAND 边界与状态码
+ * - Execute 与可移植参考实现 ExecuteRef 逐位一致（实例数取奇数，覆盖成对路径与尾部）
+ *
+ * 同一测试另以 PLCOPEN_Q15_EMULATE_DSP 编译一次（test_fb_bank_q15_dsp_emulated），
+ * 使 Execute 走 DSP 指令模拟路径；Cortex-M4 上的真实指令由 QEMU 固件 test_m4_q15 验证。
+ */
+
+#include "unity.h"
+#include "plcopen/fb_pt1.h"
+#include "plcopen/fb_bank_q15.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 实例数取奇数，覆盖成对路径与标量尾部 */
+#define BANK_SIZE 37
+
+FB_PT1_BANKQ15_STORAGE(pt1, BANK_SIZE);
+FB_PT1_BANKQ15_STORAGE(pt1_ref, BANK_SIZE);
+FB_LIMIT_BANKQ15_STORAGE(lim, BANK_SIZE);
+FB_LIMIT_BANKQ15_STORAGE(lim_ref, BANK_SIZE);
+FB_DEADBAND_BANKQ15_STORAGE(db, BANK_SIZE);
+
+static plc_q15_t input[BANK_SIZE];
+static plc_q15_t output[BANK_SIZE];
+static plc_q15_t output_ref[BANK_SIZE];
+
+void setUp(void) {
+    memset(input, 0, sizeof(input));
+    memset(output, 0, sizeof(output));
+    memset(output_ref, 0, sizeof(output_ref));
+    srand(12345);
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief 随机 Q15 值；约 1/8 取量程端点，覆盖饱和路径
+ */
+static plc_q15_t random_q15(void) {
+    int r = rand();
+    if ((r & 7) == 0) {
+        return (r & 8) ? PLC_Q15_MAX : PLC_Q15_MIN;
+    }
+    return (plc_q15_t)((r >> 4) & 0xFFFF);
+}
+
+static void assert_q15_equal(const plc_q15_t* expected, const plc_q15_t* actual) {
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT16(expected[i], actual[i]);
+    }
+}
+
+static void assert_status_equal(const int8_t* expected, const int8_t* actual) {
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i], actual[i]);
+    }
+}
+
+/* ========== Q15 转换测试 ========== */
+
+void test_q15_conversion(void) {
+    TEST_ASSERT_EQUAL_INT(0, plc_q15_from_float(0.0f));
+    TEST_ASSERT_EQUAL_INT(16384, plc_q15_from_float(0.5f));
+    TEST_ASSERT_EQUAL_INT(-16384, plc_q15_from_float(-0.5f));
+    TEST_ASSERT_EQUAL_INT(1, plc_q15_from_float(0.6f / 32768.0f));
+    TEST_ASSERT_EQUAL_INT(-1, plc_q15_from_float(-0.6f / 32768.0f));
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MAX, plc_q15_from_float(1.0f));
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MAX, plc_q15_from_float(INFINITY));
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MIN, plc_q15_from_float(-1.0f));
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MIN, plc_q15_from_float(-7.0f));
+    TEST_ASSERT_EQUAL_INT(0, plc_q15_from_float(NAN));
+
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, plc_q15_to_float(PLC_Q15_MIN));
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, plc_q15_to_float(8192));
+}
+
+/* ========== PT1 bank 测试 ========== */
+
+void test_pt1_bankq15_init_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_PT1_BankQ15_Init(&pt1_bank, NULL, pt1_coef, BANK_SIZE, 0.01f));
+
+    TEST_ASSERT_EQUAL(FB_STATUS_OK,
+                      FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PT1_BankQ15_Configure(&pt1_bank, 0, 1e-7f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_PT1_BankQ15_Configure(&pt1_bank, BANK_SIZE, 1.0f));
+}
+
+void test_pt1_bankq15_coefficients_sum_to_one(void) {
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 1.0f);
+
+    /* τ 极小时 α 钳到 1 - 2^-15，τ 极大时钳到 2^-15 */
+    FB_PT1_BankQ15_Configure(&pt1_bank, 0, 1e-6f);
+    FB_PT1_BankQ15_Configure(&pt1_bank, 1, 1e6f);
+    FB_PT1_BankQ15_Configure(&pt1_bank, 2, 9.0f);
+
+    TEST_ASSERT_EQUAL_UINT32(0x7FFF0001u, pt1_coef[0]);
+    TEST_ASSERT_EQUAL_UINT32(0x00017FFFu, pt1_coef[1]);
+    TEST_ASSERT_EQUAL_UINT32(0x0CCD7333u, pt1_coef[2]);   /* α = 0.1 */
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(32768, (int)(pt1_coef[i] & 0xFFFFu) + (int)(pt1_coef[i] >> 16));
+    }
+}
+
+void test_pt1_bankq15_first_call_no_jump(void) {
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_BankQ15_Configure(&pt1_bank, i, 1.0f);
+        input[i] = (plc_q15_t)(1000 * (int)i - 18000);
+    }
+
+    FB_PT1_BankQ15_Execute(&pt1_bank, input, output);
+
+    assert_q15_equal(input, output);
+    TEST_ASSERT_FALSE(pt1_bank.first_run);
+}
+
+void test_pt1_bankq15_matches_float32_within_bound(void) {
+    FB_PT1_t reference[BANK_SIZE];
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.01f);
+
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_Config_t config = { .time_constant = 0.05f + 0.01f * (float)i, .sample_time = 0.01f };
+        FB_PT1_Init(&reference[i], &config);
+        FB_PT1_BankQ15_Configure(&pt1_bank, i, config.time_constant);
+    }
+
+    for (int k = 0; k < 2000; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            float u = (k < 1000 ? 0.6f : -0.4f) + 0.2f * sinf(0.01f * (float)(k + (int)i));
+            input[i] = plc_q15_from_float(u);
+        }
+        FB_PT1_BankQ15_Execute(&pt1_bank, input, output);
+
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            float expected = FB_PT1_Execute(&reference[i], plc_q15_to_float(input[i]));
+            float alpha = 0.01f / (reference[i].config.time_constant + 0.01f);
+            /* 每步舍入误差 <= 0.5 LSB（收敛舍入时 1 LSB），经一阶环节累积放大 1/α */
+            float bound = (1.0f / alpha + 1.0f) / 32768.0f;
+            TEST_ASSERT_FLOAT_WITHIN(bound, expected, plc_q15_to_float(output[i]));
+        }
+    }
+}
+
+void test_pt1_bankq15_converges_exactly_with_small_alpha(void) {
+    /* τ = 10 s、Ts = 1 ms：α ≈ 3 LSB，不做收敛舍入时会停滞在距目标约 5000 LSB 处 */
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.001f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_BankQ15_Configure(&pt1_bank, i, 10.0f);
+    }
+
+    FB_PT1_BankQ15_Execute(&pt1_bank, input, output);   /* 首次运行：状态 = 0 */
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        input[i] = (plc_q15_t)((i & 1) ? 16000 : -12345);
+    }
+    for (int k = 0; k < 200000; k++) {
+        FB_PT1_BankQ15_Execute(&pt1_bank, input, output);
+    }
+
+    assert_q15_equal(input, output);
+}
+
+void test_pt1_bankq15_execute_matches_reference(void) {
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.01f);
+    FB_PT1_BankQ15_Init(&pt1_ref_bank, pt1_ref_output, pt1_ref_coef, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        float tau = (i % 4 == 0) ? 1e-6f : 0.001f * (float)(i * i);
+        FB_PT1_BankQ15_Configure(&pt1_bank, i, tau);
+        FB_PT1_BankQ15_Configure(&pt1_ref_bank, i, tau);
+    }
+
+    for (int k = 0; k < 500; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = random_q15();
+        }
+        FB_PT1_BankQ15_Execute(&pt1_bank, input, output);
+        FB_PT1_BankQ15_ExecuteRef(&pt1_ref_bank, input, output_ref);
+        assert_q15_equal(output_ref, output);
+        assert_q15_equal(pt1_ref_output, pt1_output);
+    }
+}
+
+void test_pt1_bankq15_in_place(void) {
+    FB_PT1_BankQ15_Init(&pt1_bank, pt1_output, pt1_coef, BANK_SIZE, 0.01f);
+    FB_PT1_BankQ15_Init(&pt1_ref_bank, pt1_ref_output, pt1_ref_coef, BANK_SIZE, 0.01f);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_PT1_BankQ15_Configure(&pt1_bank, i, 0.1f);
+        FB_PT1_BankQ15_Configure(&pt1_ref_bank, i, 0.1f);
+    }
+
+    for (int k = 0; k < 20; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            input[i] = random_q15();
+        }
+        FB_PT1_BankQ15_ExecuteRef(&pt1_ref_bank, input, output_ref);
+        FB_PT1_BankQ15_Execute(&pt1_bank, input, input);   /* 输出覆盖输入 */
+        assert_q15_equal(output_ref, input);
+    }
+}
+
+/* ========== LIMIT bank 测试 ========== */
+
+void test_limit_bankq15_init_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG,
+                      FB_LIMIT_BankQ15_Init(&lim_bank, lim_min, NULL, lim_status, BANK_SIZE));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK,
+                      FB_LIMIT_BankQ15_Init(&lim_bank, lim_min, lim_max, lim_status, BANK_SIZE));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_LIMIT_BankQ15_Configure(&lim_bank, 0, 100, 100));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_LIMIT_BankQ15_Configure(&lim_bank, 0, 100, -100));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_LIMIT_BankQ15_Configure(&lim_bank, BANK_SIZE, 0, 1));
+}
+
+void test_limit_bankq15_clamps_and_sets_status(void) {
+    FB_LIMIT_BankQ15_Init(&lim_bank, lim_min, lim_max, lim_status, BANK_SIZE);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_LIMIT_BankQ15_Configure(&lim_bank, i, -1000, 2000);
+    }
+    /* 每组 4 个输入：超上限、等于上限、等于下限、低于下限（跨越成对边界与尾部） */
+    static const plc_q15_t pattern[4] = { 2001, 2000, -1000, -1001 };
+    static const plc_q15_t expected_out[4] = { 2000, 2000, -1000, -1000 };
+    static const FB_Status_t expected_status[4] = {
+        FB_STATUS_LIMIT_HI, FB_STATUS_OK, FB_STATUS_OK, FB_STATUS_LIMIT_LO
+    };
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        input[i] = pattern[i % 4];
+    }
+
+    FB_LIMIT_BankQ15_Execute(&lim_bank, input, output);
+
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(expected_out[i % 4], output[i]);
+        TEST_ASSERT_EQUAL(expected_status[i % 4], FB_LIMIT_BankQ15_GetStatus(&lim_bank, i));
+    }
+}
+
+void test_limit_bankq15_execute_matches_reference(void) {
+    FB_LIMIT_BankQ15_Init(&lim_bank, lim_min, lim_max, lim_status, BANK_SIZE);
+    FB_LIMIT_BankQ15_Init(&lim_ref_bank, lim_ref_min, lim_ref_max, lim_ref_status, BANK_SIZE);
+
+    for (int k = 0; k < 500; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            plc_q15_t a = random_q15();
+            plc_q15_t b = random_q15();
+            if (a != b) {
+                FB_LIMIT_BankQ15_Configure(&lim_bank, i, a < b ? a : b, a < b ? b : a);
+                FB_LIMIT_BankQ15_Configure(&lim_ref_bank, i, a < b ? a : b, a < b ? b : a);
+            }
+            input[i] = random_q15();
+        }
+        FB_LIMIT_BankQ15_Execute(&lim_bank, input, output);
+        FB_LIMIT_BankQ15_ExecuteRef(&lim_ref_bank, input, output_ref);
+        assert_q15_equal(output_ref, output);
+        assert_status_equal(lim_ref_status, lim_status);
+    }
+}
+
+/* ========== DEADBAND bank 测试 ========== */
+
+void test_deadband_bankq15_init_invalid(void) {
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_DEADBAND_BankQ15_Init(&db_bank, NULL, db_center, BANK_SIZE));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, FB_DEADBAND_BankQ15_Init(&db_bank, db_width, db_center, BANK_SIZE));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_DEADBAND_BankQ15_Configure(&db_bank, 0, -1, 0));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, FB_DEADBAND_BankQ15_Configure(&db_bank, BANK_SIZE, 1, 0));
+}
+
+void test_deadband_bankq15_boundaries(void) {
+    FB_DEADBAND_BankQ15_Init(&db_bank, db_width, db_center, BANK_SIZE);
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        FB_DEADBAND_BankQ15_Configure(&db_bank, i, 500, 1000);
+    }
+    /* 边界上（|u - c| == width）输出中心，与 FB_DEADBAND 一致 */
+    static const plc_q15_t pattern[5] = { 1500, 1501, 500, 499, 1200 };
+    static const plc_q15_t expected_out[5] = { 1000, 1501, 1000, 499, 1000 };
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        input[i] = pattern[i % 5];
+    }
+
+    FB_DEADBAND_BankQ15_Execute(&db_bank, input, output);
+
+    for (size_t i = 0; i < BANK_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(expected_out[i % 5], output[i]);
+    }
+}
+
+void test_deadband_bankq15_saturated_deviation(void) {
+    FB_DEADBAND_BankQ15_Init(&db_bank, db_width, db_center, BANK_SIZE);
+    /* u - c = 65535 超出 Q15 量程，满量程宽度也不能把它判定为死区内 */
+    FB_DEADBAND_BankQ15_Configure(&db_bank, 0, PLC_Q15_MAX, PLC_Q15_MIN);
+    FB_DEADBAND_BankQ15_Configure(&db_bank, 1, 30000, PLC_Q15_MIN);
+    FB_DEADBAND_BankQ15_Configure(&db_bank, 2, PLC_Q15_MAX, PLC_Q15_MAX);
+    FB_DEADBAND_BankQ15_Configure(&db_bank, 3, PLC_Q15_MAX, 0);
+    input[0] = PLC_Q15_MAX;
+    input[1] = PLC_Q15_MAX;
+    input[2] = PLC_Q15_MIN;   /* u - c = -65535 */
+    input[3] = PLC_Q15_MIN;   /* u - c = -32768，|d| = width + 1 */
+
+    FB_DEADBAND_BankQ15_Execute(&db_bank, input, output);
+
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MAX, output[0]);
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MAX, output[1]);
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MIN, output[2]);
+    TEST_ASSERT_EQUAL_INT(PLC_Q15_MIN, output[3]);
+}
+
+void test_deadband_bankq15_full_scale_width_edges(void) {
+    /* 宽度、中心、输入取量程端点及其邻值的全部组合，两条路径都与 |u - c| <= w 的精确判定一致 */
+    static const plc_q15_t widths[] = { 0, 1, 16384, PLC_Q15_MAX - 1, PLC_Q15_MAX };
+    static const plc_q15_t values[] = { PLC_Q15_MIN, PLC_Q15_MIN + 1, -1, 0, 1, PLC_Q15_MAX - 1, PLC_Q15_MAX };
+    const size_t nv = sizeof(values) / sizeof(values[0]);
+    FB_DEADBAND_BankQ15_Init(&db_bank, db_width, db_center, BANK_SIZE);
+
+    for (size_t wi = 0; wi < sizeof(widths) / sizeof(widths[0]); wi++) {
+        for (size_t base = 0; base < nv * nv; base += BANK_SIZE) {
+            for (size_t i = 0; i < BANK_SIZE; i++) {
+                size_t k = (base + i) % (nv * nv);
+                FB_DEADBAND_BankQ15_Configure(&db_bank, i, widths[wi], values[k / nv]);
+                input[i] = values[k % nv];
+            }
+            FB_DEADBAND_BankQ15_Execute(&db_bank, input, output);
+            FB_DEADBAND_BankQ15_ExecuteRef(&db_bank, input, output_ref);
+            for (size_t i = 0; i < BANK_SIZE; i++) {
+                int32_t d = (int32_t)input[i] - db_center[i];
+                plc_q15_t expected = (d <= widths[wi] && -d <= widths[wi]) ? db_center[i] : input[i];
+                TEST_ASSERT_EQUAL_INT(expected, output[i]);
+                TEST_ASSERT_EQUAL_INT(expected, output_ref[i]);
+            }
+        }
+    }
+}
+
+void test_deadband_bankq15_execute_matches_reference(void) {
+    FB_DEADBAND_BankQ15_Init(&db_bank, db_width, db_center, BANK_SIZE);
+
+    for (int k = 0; k < 500; k++) {
+        for (size_t i = 0; i < BANK_SIZE; i++) {
+            plc_q15_t w = random_q15();
+            FB_DEADBAND_BankQ15_Configure(&db_bank, i, (plc_q15_t)(w < 0 ? -(w + 1) : w), random_q15());
+            input[i] = random_q15();
+        }
+        FB_DEADBAND_BankQ15_Execute(&db_bank, input, output);
+        FB_DEADBAND_BankQ15_ExecuteRef(&db_bank, input, output_ref);
+        assert_q15_equal(output_ref, output);
+    }
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_fb_bank_q15(void) {
+    /* Q15 转换 */
+    RUN_TEST(test_q15_conversion);
+
+    /* PT1 bank */
+    RUN_TEST(test_pt1_bankq15_init_invalid);
+    RUN_TEST(test_pt1_bankq15_coefficients_sum_to_one);
+    RUN_TEST(test_pt1_bankq15_first_call_no_jump);
+    RUN_TEST(test_pt1_bankq15_matches_float32_within_bound);
+    RUN_TEST(test_pt1_bankq15_converges_exactly_with_small_alpha);
+    RUN_TEST(test_pt1_bankq15_execute_matches_reference);
+    RUN_TEST(test_pt1_bankq15_in_place);
+
+    /* LIMIT bank */
+    RUN_TEST(test_limit_bankq15_init_invalid);
+    RUN_TEST(test_limit_bankq15_clamps_and_sets_status);
+    RUN_TEST(test_limit_bankq15_execute_matches_reference);
+
+    /* DEADBAND bank */
+    RUN_TEST(test_deadband_bankq15_init_invalid);
+    RUN_TEST(test_deadband_bankq15_boundaries);
+    RUN_TEST(test_deadband_bankq15_saturated_deviation);
+    RUN_TEST(test_deadband_bankq15_full_scale_width_edges);
+    RUN_TEST(test_deadband_bankq15_execute_matches_reference);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_bank_q15();
+    return UNITY_END();
+}
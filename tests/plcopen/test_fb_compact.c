@@ -0,0 +1,283 @@
+/**
+ * @file test_fb_compact.c
+ * @brief 紧凑实例布局单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 单字节标志位的状态码编解码
+ * - 配置验证与标准实例一致
+ * - 与标准实例逐周期等价（浮点舍入误差范围内）
+ * - PID 手动/自动切换、INTEGRATOR 复位
+ * - 数值保护（NaN/Inf）
+ */
+
+#include "unity.h"
+#include "plcopen/fb_compact.h"
+#include <math.h>
+
+/* 等价性测试步数 */
+#define EQUIV_STEPS 2000
+
+/* 预计算系数带来的相对误差容限 */
+#define REL_TOL 1e-4f
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static float test_signal(int k) {
+    return 50.0f + 30.0f * sinf(0.01f * (float)k) + ((k / 200) % 2 ? 15.0f : -15.0f);
+}
+
+static void assert_close(float expected, float actual) {
+    TEST_ASSERT_FLOAT_WITHIN(REL_TOL * (1.0f + fabsf(expected)), expected, actual);
+}
+
+/* ========== 标志位测试 ========== */
+
+void test_flags_status_round_trip(void) {
+    const FB_Status_t all[] = {
+        FB_STATUS_OK, FB_STATUS_LIMIT_HI, FB_STATUS_LIMIT_LO,
+        FB_STATUS_ERROR_NAN, FB_STATUS_ERROR_INF, FB_STATUS_ERROR_CONFIG
+    };
+    const uint8_t others = FB_FLAG_FIRST_RUN | FB_FLAG_MANUAL | FB_FLAG_FILTER;
+
+    for (size_t i = 0; i < sizeof(all) / sizeof(all[0]); i++) {
+        uint8_t flags = fb_flags_set_status(others, all[i]);
+        TEST_ASSERT_EQUAL_INT(all[i], fb_flags_get_status(flags));
+        /* 其他标志位不受影响 */
+        TEST_ASSERT_EQUAL_INT(others, flags & ~FB_FLAG_STATUS_MASK);
+    }
+}
+
+void test_compact_sizes_smaller_than_standard(void) {
+    TEST_ASSERT_TRUE(sizeof(FB_PID_Compact_t) < sizeof(FB_PID_t));
+    TEST_ASSERT_TRUE(sizeof(FB_PT1_Compact_t) < sizeof(FB_PT1_t));
+    TEST_ASSERT_TRUE(sizeof(FB_RAMP_Compact_t) < sizeof(FB_RAMP_t));
+    TEST_ASSERT_TRUE(sizeof(FB_INTEGRATOR_Compact_t) < sizeof(FB_INTEGRATOR_t));
+    TEST_ASSERT_TRUE(sizeof(FB_DERIVATIVE_Compact_t) < sizeof(FB_DERIVATIVE_t));
+}
+
+/* ========== 配置验证 ========== */
+
+void test_compact_init_invalid(void) {
+    FB_PID_Compact_t pid;
+    FB_PID_Config_t pid_cfg = {
+        .kp = 1.0f, .ki = 0.1f, .kd = 0.0f, .sample_time = 0.01f,
+        .out_min = 10.0f, .out_max = 0.0f, .int_min = -10.0f, .int_max = 10.0f
+    };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PID_Compact_Init(&pid, &pid_cfg));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PID_Compact_Init(&pid, NULL));
+
+    FB_PT1_Compact_t pt1;
+    FB_PT1_Config_t pt1_cfg = { .time_constant = 0.0f, .sample_time = 0.01f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PT1_Compact_Init(&pt1, &pt1_cfg));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PT1_Compact_Init(NULL, &pt1_cfg));
+
+    FB_RAMP_Compact_t ramp;
+    FB_RAMP_Config_t ramp_cfg = { .rise_rate = -1.0f, .fall_rate = 1.0f, .sample_time = 0.01f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RAMP_Compact_Init(&ramp, &ramp_cfg));
+
+    FB_INTEGRATOR_Compact_t integ;
+    FB_INTEGRATOR_Config_t integ_cfg = {
+        .sample_time = 0.01f, .out_min = 5.0f, .out_max = 5.0f, .enable_limit = true
+    };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_INTEGRATOR_Compact_Init(&integ, &integ_cfg));
+
+    FB_DERIVATIVE_Compact_t der;
+    FB_DERIVATIVE_Config_t der_cfg = { .sample_time = 0.0f, .filter_time_constant = 0.0f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_DERIVATIVE_Compact_Init(&der, &der_cfg));
+}
+
+/* ========== 等价性测试 ========== */
+
+void test_pid_compact_matches_standard(void) {
+    FB_PID_Config_t cfg = {
+        .kp = 2.0f, .ki = 0.5f, .kd = 0.05f, .sample_time = 0.01f,
+        .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+    };
+    FB_PID_t std_fb;
+    FB_PID_Compact_t cmp_fb;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Init(&std_fb, &cfg));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Compact_Init(&cmp_fb, &cfg));
+
+    float measurement = 20.0f;
+    for (int k = 0; k < EQUIV_STEPS; k++) {
+        float sp = test_signal(k);
+        float expected = FB_PID_Execute(&std_fb, sp, measurement);
+        float actual = FB_PID_Compact_Execute(&cmp_fb, sp, measurement);
+        assert_close(expected, actual);
+        TEST_ASSERT_EQUAL_INT(std_fb.state.status, FB_PID_Compact_GetStatus(&cmp_fb));
+        /* 简单一阶对象，使输出饱和与非饱和区间都被覆盖 */
+        measurement += 0.05f * (expected - measurement);
+    }
+}
+
+void test_pt1_compact_matches_standard(void) {
+    FB_PT1_Config_t cfg = { .time_constant = 0.3f, .sample_time = 0.01f };
+    FB_PT1_t std_fb;
+    FB_PT1_Compact_t cmp_fb;
+    FB_PT1_Init(&std_fb, &cfg);
+    FB_PT1_Compact_Init(&cmp_fb, &cfg);
+
+    for (int k = 0; k < EQUIV_STEPS; k++) {
+        float u = test_signal(k);
+        /* α 计算方式与标准实例相同，结果逐位一致 */
+        TEST_ASSERT_EQUAL_FLOAT(FB_PT1_Execute(&std_fb, u), FB_PT1_Compact_Execute(&cmp_fb, u));
+    }
+}
+
+void test_ramp_compact_matches_standard(void) {
+    FB_RAMP_Config_t cfg = { .rise_rate = 20.0f, .fall_rate = 40.0f, .sample_time = 0.01f };
+    FB_RAMP_t std_fb;
+    FB_RAMP_Compact_t cmp_fb;
+    FB_RAMP_Init(&std_fb, &cfg);
+    FB_RAMP_Compact_Init(&cmp_fb, &cfg);
+
+    for (int k = 0; k < EQUIV_STEPS; k++) {
+        float target = test_signal(k);
+        TEST_ASSERT_EQUAL_FLOAT(FB_RAMP_Execute(&std_fb, target),
+                                FB_RAMP_Compact_Execute(&cmp_fb, target));
+    }
+}
+
+void test_integrator_compact_matches_standard(void) {
+    FB_INTEGRATOR_Config_t cfg = {
+        .sample_time = 0.01f, .out_min = -20.0f, .out_max = 200.0f, .enable_limit = true
+    };
+    FB_INTEGRATOR_t std_fb;
+    FB_INTEGRATOR_Compact_t cmp_fb;
+    FB_INTEGRATOR_Init(&std_fb, &cfg);
+    FB_INTEGRATOR_Compact_Init(&cmp_fb, &cfg);
+
+    for (int k = 0; k < EQUIV_STEPS; k++) {
+        float u = test_signal(k) - 40.0f;
+        TEST_ASSERT_EQUAL_FLOAT(FB_INTEGRATOR_Execute(&std_fb, u),
+                                FB_INTEGRATOR_Compact_Execute(&cmp_fb, u));
+        TEST_ASSERT_EQUAL_INT(std_fb.state.status, FB_INTEGRATOR_Compact_GetStatus(&cmp_fb));
+    }
+}
+
+void test_derivative_compact_matches_standard(void) {
+    const float filters[] = { 0.0f, 0.05f };
+
+    for (size_t f = 0; f < 2; f++) {
+        FB_DERIVATIVE_Config_t cfg = { .sample_time = 0.01f, .filter_time_constant = filters[f] };
+        FB_DERIVATIVE_t std_fb;
+        FB_DERIVATIVE_Compact_t cmp_fb;
+        FB_DERIVATIVE_Init(&std_fb, &cfg);
+        FB_DERIVATIVE_Compact_Init(&cmp_fb, &cfg);
+
+        for (int k = 0; k < EQUIV_STEPS; k++) {
+            float u = test_signal(k);
+            float expected = FB_DERIVATIVE_Execute(&std_fb, u);
+            float actual = FB_DERIVATIVE_Compact_Execute(&cmp_fb, u);
+            /* 1/Ts 预计算：原始微分相对误差约 1 ULP，按输入量级放宽 */
+            TEST_ASSERT_FLOAT_WITHIN(REL_TOL * (1.0f + fabsf(expected)) + 1e-3f, expected, actual);
+        }
+    }
+}
+
+/* ========== 模式切换与复位 ========== */
+
+void test_pid_compact_manual_auto(void) {
+    FB_PID_Config_t cfg = {
+        .kp = 1.0f, .ki = 0.2f, .kd = 0.0f, .sample_time = 0.01f,
+        .out_min = 0.0f, .out_max = 100.0f, .int_min = -100.0f, .int_max = 100.0f
+    };
+    FB_PID_t std_fb;
+    FB_PID_Compact_t cmp_fb;
+    FB_PID_Init(&std_fb, &cfg);
+    FB_PID_Compact_Init(&cmp_fb, &cfg);
+
+    FB_PID_Execute(&std_fb, 50.0f, 40.0f);
+    FB_PID_Compact_Execute(&cmp_fb, 50.0f, 40.0f);
+
+    FB_PID_SetManual(&std_fb, 150.0f);
+    FB_PID_Compact_SetManual(&cmp_fb, 150.0f);
+    TEST_ASSERT_TRUE(FB_PID_Compact_IsManual(&cmp_fb));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, FB_PID_Compact_Execute(&cmp_fb, 50.0f, 40.0f));
+    TEST_ASSERT_EQUAL_FLOAT(FB_PID_Execute(&std_fb, 50.0f, 40.0f), 100.0f);
+
+    FB_PID_SetAuto(&std_fb);
+    FB_PID_Compact_SetAuto(&cmp_fb);
+    TEST_ASSERT_FALSE(FB_PID_Compact_IsManual(&cmp_fb));
+    for (int k = 0; k < 50; k++) {
+        assert_close(FB_PID_Execute(&std_fb, 50.0f, 45.0f),
+                     FB_PID_Compact_Execute(&cmp_fb, 50.0f, 45.0f));
+    }
+}
+
+void test_integrator_compact_reset(void) {
+    FB_INTEGRATOR_Config_t cfg = {
+        .sample_time = 0.1f, .out_min = 0.0f, .out_max = 1.0f, .enable_limit = true
+    };
+    FB_INTEGRATOR_Compact_t fb;
+    FB_INTEGRATOR_Compact_Init(&fb, &cfg);
+
+    for (int k = 0; k < 20; k++) {
+        FB_INTEGRATOR_Compact_Execute(&fb, 1.0f);
+    }
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_LIMIT_HI, FB_INTEGRATOR_Compact_GetStatus(&fb));
+
+    FB_INTEGRATOR_Compact_Reset(&fb);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fb.integral);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_INTEGRATOR_Compact_GetStatus(&fb));
+    /* 复位不清除限幅使能 */
+    TEST_ASSERT_TRUE(fb.flags & FB_FLAG_LIMIT_ENABLE);
+}
+
+/* ========== 数值保护 ========== */
+
+void test_compact_nan_inf_input(void) {
+    FB_PT1_Config_t cfg = { .time_constant = 1.0f, .sample_time = 0.01f };
+    FB_PT1_Compact_t pt1;
+    FB_PT1_Compact_Init(&pt1, &cfg);
+
+    /* 首次运行前的错误输入不消耗首次运行标志 */
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PT1_Compact_Execute(&pt1, NAN));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, FB_PT1_Compact_GetStatus(&pt1));
+    TEST_ASSERT_TRUE(pt1.flags & FB_FLAG_FIRST_RUN);
+    TEST_ASSERT_EQUAL_FLOAT(42.0f, FB_PT1_Compact_Execute(&pt1, 42.0f));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_Compact_GetStatus(&pt1));
+
+    FB_RAMP_Config_t ramp_cfg = { .rise_rate = 1.0f, .fall_rate = 1.0f, .sample_time = 0.01f };
+    FB_RAMP_Compact_t ramp;
+    FB_RAMP_Compact_Init(&ramp, &ramp_cfg);
+    FB_RAMP_Compact_Execute(&ramp, 10.0f);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, FB_RAMP_Compact_Execute(&ramp, INFINITY));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, FB_RAMP_Compact_GetStatus(&ramp));
+
+    FB_DERIVATIVE_Config_t der_cfg = { .sample_time = 0.01f, .filter_time_constant = 0.0f };
+    FB_DERIVATIVE_Compact_t der;
+    FB_DERIVATIVE_Compact_Init(&der, &der_cfg);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_DERIVATIVE_Compact_Execute(&der, -INFINITY));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, FB_DERIVATIVE_Compact_GetStatus(&der));
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_fb_compact(void) {
+    /* 布局 */
+    RUN_TEST(test_flags_status_round_trip);
+    RUN_TEST(test_compact_sizes_smaller_than_standard);
+    RUN_TEST(test_compact_init_invalid);
+
+    /* 等价性 */
+    RUN_TEST(test_pid_compact_matches_standard);
+    RUN_TEST(test_pt1_compact_matches_standard);
+    RUN_TEST(test_ramp_compact_matches_standard);
+    RUN_TEST(test_integrator_compact_matches_standard);
+    RUN_TEST(test_derivative_compact_matches_standard);
+
+    /* 模式切换与数值保护 */
+    RUN_TEST(test_pid_compact_manual_auto);
+    RUN_TEST(test_integrator_compact_reset);
+    RUN_TEST(test_compact_nan_inf_input);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_compact();
+    return UNITY_END();
+}
@@ -4,6 +4,7 @@
  */
 
 #include "unity.h"
+#include "block_sequence.h"
 #include "plcopen/fb_deadband.h"
 #include <math.h>
 #include <string.h>
@@ -155,6 +156,27 @@ void test_deadband_inf_input(void) {
     TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, fb.state.status);
 }
 
+// ============ 块处理测试 ============
+
+static float block_sample(unsigned k) {
+    return 50.0f + 4.0f * sinf(0.3f * (float)k);
+}
+
+/* DEADBAND 无内部状态，只比较状态码 */
+static void assert_block_state(const FB_DEADBAND_t* reference, const FB_DEADBAND_t* actual) {
+    TEST_ASSERT_EQUAL(reference->state.status, actual->state.status);
+}
+
+DEFINE_BLOCK_SEQUENCE_CHECK(check_block_sequence, FB_DEADBAND, block_sample, assert_block_state)
+
+void test_deadband_execute_block_matches_execute(void) {
+    FB_DEADBAND_t reference;
+    FB_DEADBAND_Config_t config = { .width = 2.0f, .center = 50.0f };
+    FB_DEADBAND_Init(&fb, &config);
+    FB_DEADBAND_Init(&reference, &config);
+    check_block_sequence(&fb, &reference);
+}
+
 // ============ 测试套件 ============
 
 void run_test_fb_deadband(void) {
@@ -171,6 +193,7 @@ void run_test_fb_deadband(void) {
     RUN_TEST(test_deadband_zero_width_passthrough);
     RUN_TEST(test_deadband_nan_input);
     RUN_TEST(test_deadband_inf_input);
+    RUN_TEST(test_deadband_execute_block_matches_execute);
 }
 
 int main(void) {
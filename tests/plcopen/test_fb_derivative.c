@@ -4,6 +4,7 @@
  */
 
 #include "unity.h"
+#include "block_sequence.h"
 #include "plcopen/fb_derivative.h"
 #include <math.h>
 #include <string.h>
@@ -199,6 +200,137 @@ void test_derivative_inf_input(void) {
     TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, fb.state.status);
 }
 
+// ============ 块处理测试 ============
+
+static float block_sample(unsigned k) {
+    return 10.0f * sinf(0.1f * (float)k) + (float)((k * 7919u) % 5u);
+}
+
+/* 块之间延续的状态：上次输入、滤波输出与首次运行标志 */
+static void assert_block_state(const FB_DERIVATIVE_t* reference, const FB_DERIVATIVE_t* actual) {
+    TEST_ASSERT_EQUAL(reference->state.status, actual->state.status);
+    TEST_ASSERT_TRUE(memcmp(&reference->state.prev_input, &actual->state.prev_input, sizeof(float)) == 0);
+    TEST_ASSERT_TRUE(memcmp(&reference->state.filtered_output, &actual->state.filtered_output, sizeof(float)) == 0);
+    TEST_ASSERT_EQUAL(reference->state.first_run, actual->state.first_run);
+}
+
+DEFINE_BLOCK_SEQUENCE_CHECK(check_block_sequence, FB_DERIVATIVE, block_sample, assert_block_state)
+
+void test_derivative_execute_block_matches_execute(void) {
+    FB_DERIVATIVE_t reference;
+    FB_DERIVATIVE_Config_t config = { .sample_time = 0.1f, .filter_time_constant = 0.5f };
+    FB_DERIVATIVE_Init(&fb, &config);
+    FB_DERIVATIVE_Init(&reference, &config);
+    check_block_sequence(&fb, &reference);
+
+    /* 无滤波分支 */
+    config.filter_time_constant = 0.0f;
+    FB_DERIVATIVE_Init(&fb, &config);
+    FB_DERIVATIVE_Init(&reference, &config);
+    check_block_sequence(&fb, &reference);
+}
+
+// ============ 快进测试 ============
+
+static const uint32_t advance_steps[] = { 0, 1, 2, 5, 37, 1000, 20000 };
+
+/* 先以 fb 执行若干周期得到非零滤波状态，再比较 Advance 与逐周期 Execute */
+static void check_advance(const FB_DERIVATIVE_Config_t* config) {
+    for (size_t s = 0; s < sizeof(advance_steps) / sizeof(advance_steps[0]); s++) {
+        uint32_t k = advance_steps[s];
+        FB_DERIVATIVE_Init(&fb, config);
+        FB_DERIVATIVE_Execute(&fb, 0.0f);
+        FB_DERIVATIVE_Execute(&fb, 2.0f);
+        FB_DERIVATIVE_t reference = fb;
+
+        float expected = reference.state.filtered_output;
+        for (uint32_t i = 0; i < k; i++) {
+            expected = FB_DERIVATIVE_Execute(&reference, 5.0f);
+        }
+        float output = FB_DERIVATIVE_Advance(&fb, 5.0f, k);
+
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, expected, output);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, reference.state.prev_input, fb.state.prev_input);
+        TEST_ASSERT_EQUAL(reference.state.status, fb.state.status);
+    }
+}
+
+void test_derivative_advance_matches_execute_loop(void) {
+    FB_DERIVATIVE_Config_t config = { .sample_time = 0.1f, .filter_time_constant = 0.5f };
+    check_advance(&config);
+
+    config.filter_time_constant = 0.0f;
+    check_advance(&config);
+}
+
+// ============ 可变步长测试 ============
+
+/* 抖动的扫描间隔：名义 0.1 s，在 0.05 s 到 0.15 s 之间变化 */
+static float jittered_dt(unsigned k) {
+    return 0.1f * (0.5f + (float)((k * 37u) % 11u) / 10.0f);
+}
+
+void test_derivative_execute_dt_matches_execute_at_nominal_dt(void) {
+    /* 无滤波时 dt = sample_time 与 Execute 逐位相同 */
+    FB_DERIVATIVE_Config_t config = { .sample_time = 0.1f, .filter_time_constant = 0.0f };
+    FB_DERIVATIVE_t reference;
+    FB_DERIVATIVE_Init(&reference, &config);
+    FB_DERIVATIVE_Init(&fb, &config);
+    for (unsigned k = 0; k < 200; k++) {
+        float input = 10.0f * sinf(0.05f * (float)k);
+        float expected = FB_DERIVATIVE_Execute(&reference, input);
+        float output = FB_DERIVATIVE_ExecuteDt(&fb, input, 0.1f);
+        TEST_ASSERT_TRUE(memcmp(&expected, &output, sizeof(float)) == 0);
+    }
+}
+
+void test_derivative_execute_dt_jittered_ramp(void) {
+    /* 斜率 3/s 的斜坡按抖动的间隔采样：无滤波时每个周期都得到 3 */
+    FB_DERIVATIVE_Config_t config = { .sample_time = 0.1f, .filter_time_constant = 0.0f };
+    FB_DERIVATIVE_Init(&fb, &config);
+    double t = 0.0;
+    FB_DERIVATIVE_ExecuteDt(&fb, 0.0f, 0.0f);
+    for (unsigned k = 0; k < 100; k++) {
+        float dt = jittered_dt(k);
+        t += dt;
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, 3.0f, FB_DERIVATIVE_ExecuteDt(&fb, (float)(3.0 * t), dt));
+    }
+
+    /* 有滤波时与双精度精确离散化一致 */
+    config.filter_time_constant = 0.5f;
+    FB_DERIVATIVE_Init(&fb, &config);
+    double prev = 0.0;
+    double y = 0.0;
+    FB_DERIVATIVE_ExecuteDt(&fb, 0.0f, 0.0f);
+    for (unsigned k = 0; k < 200; k++) {
+        float dt = jittered_dt(k);
+        float input = (k < 100u) ? 0.5f * (float)k : 50.0f;
+        double raw = ((double)input - prev) / dt;
+        y += -expm1(-(double)dt / 0.5) * (raw - y);
+        prev = input;
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, (float)y, FB_DERIVATIVE_ExecuteDt(&fb, input, dt));
+    }
+}
+
+void test_derivative_execute_dt_zero_and_invalid_dt(void) {
+    FB_DERIVATIVE_Config_t config = { .sample_time = 0.1f, .filter_time_constant = 0.0f };
+    FB_DERIVATIVE_Init(&fb, &config);
+    FB_DERIVATIVE_ExecuteDt(&fb, 0.0f, 0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 10.0f, FB_DERIVATIVE_ExecuteDt(&fb, 1.0f, 0.1f));
+
+    /* dt = 0：保持上次输入与输出，下一周期按新 dt 求差商 */
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 10.0f, FB_DERIVATIVE_ExecuteDt(&fb, 5.0f, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, fb.state.status);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, fb.state.prev_input);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_DERIVATIVE_ExecuteDt(&fb, 2.0f, NAN));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, fb.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_DERIVATIVE_ExecuteDt(&fb, 2.0f, -0.1f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, fb.state.status);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, fb.state.prev_input);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 10.0f, fb.state.filtered_output);
+}
+
 // ============ 测试套件 ============
 
 void run_test_fb_derivative(void) {
@@ -217,6 +349,11 @@ void run_test_fb_derivative(void) {
     RUN_TEST(test_derivative_filter_convergence);
     RUN_TEST(test_derivative_nan_input);
     RUN_TEST(test_derivative_inf_input);
+    RUN_TEST(test_derivative_execute_block_matches_execute);
+    RUN_TEST(test_derivative_advance_matches_execute_loop);
+    RUN_TEST(test_derivative_execute_dt_matches_execute_at_nominal_dt);
+    RUN_TEST(test_derivative_execute_dt_jittered_ramp);
+    RUN_TEST(test_derivative_execute_dt_zero_and_invalid_dt);
 }
 
 int main(void) {
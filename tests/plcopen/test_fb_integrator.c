@@ -4,6 +4,7 @@
  */
 
 #include "unity.h"
+#include "block_sequence.h"
 #include "plcopen/fb_integrator.h"
 #include <math.h>
 #include <string.h>
@@ -223,6 +224,134 @@ void test_integrator_initial_value_zero(void) {
     TEST_ASSERT_EQUAL_FLOAT(0.0f, fb.state.integral);
 }
 
+// ============ 块处理测试 ============
+
+static float block_sample(unsigned k) {
+    return 40.0f * sinf(0.02f * (float)k) + 15.0f;
+}
+
+/* 块之间延续的状态：积分值 */
+static void assert_block_state(const FB_INTEGRATOR_t* reference, const FB_INTEGRATOR_t* actual) {
+    TEST_ASSERT_EQUAL(reference->state.status, actual->state.status);
+    TEST_ASSERT_TRUE(memcmp(&reference->state.integral, &actual->state.integral, sizeof(float)) == 0);
+}
+
+DEFINE_BLOCK_SEQUENCE_CHECK(check_block_sequence, FB_INTEGRATOR, block_sample, assert_block_state)
+
+void test_integrator_execute_block_matches_execute(void) {
+    FB_INTEGRATOR_t reference;
+    FB_INTEGRATOR_Config_t config = {
+        .sample_time = 0.1f, .out_min = -100.0f, .out_max = 100.0f, .enable_limit = true
+    };
+    FB_INTEGRATOR_Init(&fb, &config);
+    FB_INTEGRATOR_Init(&reference, &config);
+    check_block_sequence(&fb, &reference);
+
+    /* 不限幅分支 */
+    config.enable_limit = false;
+    FB_INTEGRATOR_Init(&fb, &config);
+    FB_INTEGRATOR_Init(&reference, &config);
+    check_block_sequence(&fb, &reference);
+}
+
+// ============ 快进测试 ============
+
+static const uint32_t advance_steps[] = { 0, 1, 2, 5, 37, 1000, 20000 };
+
+/* 从给定积分值出发，比较 Advance 与逐周期 Execute（含状态码） */
+static void check_advance(const FB_INTEGRATOR_Config_t* config, float start, float input) {
+    for (size_t s = 0; s < sizeof(advance_steps) / sizeof(advance_steps[0]); s++) {
+        uint32_t k = advance_steps[s];
+        FB_INTEGRATOR_Init(&fb, config);
+        fb.state.integral = start;
+        FB_INTEGRATOR_t reference = fb;
+
+        float expected = reference.state.integral;
+        for (uint32_t i = 0; i < k; i++) {
+            expected = FB_INTEGRATOR_Execute(&reference, input);
+        }
+        float output = FB_INTEGRATOR_Advance(&fb, input, k);
+
+        /* 逐周期累加每步各有一次舍入，参考值的误差随 k 线性增长 */
+        float tolerance = (1e-4f + 2e-7f * (float)k) * (1.0f + fabsf(expected));
+        TEST_ASSERT_FLOAT_WITHIN(tolerance, expected, output);
+        TEST_ASSERT_EQUAL(reference.state.status, fb.state.status);
+    }
+}
+
+void test_integrator_advance_matches_execute_loop(void) {
+    FB_INTEGRATOR_Config_t config = {
+        .sample_time = 0.01f, .out_min = 10.0f, .out_max = 20.0f, .enable_limit = true
+    };
+    /* 初值在限幅区间之外：第一个周期先被拉回区间，之后才单调变化 */
+    check_advance(&config, 0.0f, 3.0f);
+    check_advance(&config, 0.0f, -3.0f);
+    check_advance(&config, 15.0f, 0.5f);
+    check_advance(&config, 15.0f, 0.0f);
+
+    config.enable_limit = false;
+    check_advance(&config, 1.0f, -0.25f);
+}
+
+void test_integrator_advance_inf_input(void) {
+    FB_INTEGRATOR_Config_t config = {
+        .sample_time = 0.1f, .out_min = -100.0f, .out_max = 100.0f, .enable_limit = true
+    };
+    FB_INTEGRATOR_Init(&fb, &config);
+    FB_INTEGRATOR_Execute(&fb, 5.0f);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, FB_INTEGRATOR_Advance(&fb, INFINITY, 50));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_INF, fb.state.status);
+}
+
+// ============ 可变步长测试 ============
+
+/* 抖动的扫描间隔：名义 0.1 s，在 0.05 s 到 0.15 s 之间变化 */
+static float jittered_dt(unsigned k) {
+    return 0.1f * (0.5f + (float)((k * 37u) % 11u) / 10.0f);
+}
+
+void test_integrator_execute_dt_matches_execute_at_nominal_dt(void) {
+    /* dt = sample_time 时与 Execute 逐位相同（含限幅与状态码） */
+    FB_INTEGRATOR_Config_t config = { .sample_time = 0.1f, .out_min = -5.0f, .out_max = 5.0f,
+                                      .enable_limit = true };
+    FB_INTEGRATOR_t reference;
+    FB_INTEGRATOR_Init(&reference, &config);
+    FB_INTEGRATOR_Init(&fb, &config);
+    for (unsigned k = 0; k < 400; k++) {
+        float input = 20.0f * sinf(0.02f * (float)k);
+        float expected = FB_INTEGRATOR_Execute(&reference, input);
+        float output = FB_INTEGRATOR_ExecuteDt(&fb, input, 0.1f);
+        TEST_ASSERT_TRUE(memcmp(&expected, &output, sizeof(float)) == 0);
+        TEST_ASSERT_EQUAL(reference.state.status, fb.state.status);
+    }
+}
+
+void test_integrator_execute_dt_jittered_constant_input(void) {
+    /* 常值输入的积分等于输入乘以实测经过的总时间，与名义周期无关 */
+    FB_INTEGRATOR_Config_t config = { .sample_time = 0.1f, .enable_limit = false };
+    FB_INTEGRATOR_Init(&fb, &config);
+    double t = 0.0;
+    for (unsigned k = 0; k < 100; k++) {
+        float dt = jittered_dt(k);
+        t += dt;
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, (float)(2.0 * t), FB_INTEGRATOR_ExecuteDt(&fb, 2.0f, dt));
+    }
+}
+
+void test_integrator_execute_dt_invalid_dt(void) {
+    FB_INTEGRATOR_Config_t config = { .sample_time = 0.1f, .enable_limit = false };
+    FB_INTEGRATOR_Init(&fb, &config);
+    FB_INTEGRATOR_ExecuteDt(&fb, 10.0f, 0.1f);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, FB_INTEGRATOR_ExecuteDt(&fb, 10.0f, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, fb.state.status);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, FB_INTEGRATOR_ExecuteDt(&fb, 10.0f, INFINITY));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_INF, fb.state.status);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, FB_INTEGRATOR_ExecuteDt(&fb, 10.0f, -0.1f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, fb.state.status);
+}
+
 // ============ 测试套件 ============
 
 void run_test_fb_integrator(void) {
@@ -241,6 +370,12 @@ void run_test_fb_integrator(void) {
     RUN_TEST(test_integrator_nan_input);
     RUN_TEST(test_integrator_inf_input);
     RUN_TEST(test_integrator_initial_value_zero);
+    RUN_TEST(test_integrator_execute_block_matches_execute);
+    RUN_TEST(test_integrator_advance_matches_execute_loop);
+    RUN_TEST(test_integrator_advance_inf_input);
+    RUN_TEST(test_integrator_execute_dt_matches_execute_at_nominal_dt);
+    RUN_TEST(test_integrator_execute_dt_jittered_constant_input);
+    RUN_TEST(test_integrator_execute_dt_invalid_dt);
 }
 
 int main(void) {
@@ -0,0 +1,445 @@
+/**
+ * @file test_fb_kalman.c
+ * @brief KALMAN 功能块单元测试
+ */
+
+#include "unity.h"
+#include "plcopen/fb_kalman.h"
+#include <math.h>
+#include <string.h>
+
+#define N FB_KALMAN_MAX_STATES
+#define M FB_KALMAN_MAX_OUTPUTS
+#define P FB_KALMAN_MAX_INPUTS
+
+static FB_KALMAN_t fb;
+
+void setUp(void) {
+    memset(&fb, 0, sizeof(FB_KALMAN_t));
+}
+
+void tearDown(void) {}
+
+/* 可复现的均匀噪声 [-1, 1) */
+static float noise(uint32_t* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / 8388608.0f - 1.0f;
+}
+
+/* 位置-速度模型：Ts = 10 ms，只测位置 */
+static FB_KALMAN_Config_t velocity_config(bool steady_state) {
+    FB_KALMAN_Config_t config = {
+        .states = 2, .outputs = 1, .inputs = 0,
+        .a = { { 1.0f, 0.01f }, { 0.0f, 1.0f } },
+        .h = { { 1.0f, 0.0f } },
+        .q = { { 1e-6f, 0.0f }, { 0.0f, 1e-3f } },
+        .r = { { 1e-2f } },
+        .p0 = { { 1.0f, 0.0f }, { 0.0f, 1.0f } },
+        .steady_state = steady_state,
+    };
+    return config;
+}
+
+/*
+ * 双精度参考实现：教科书形式（显式求 S 的逆），与被测的 Cholesky 求解、
+ * 上三角镜像和展开内核相互独立
+ */
+typedef struct {
+    double x[N];
+    double p[N][N];
+} reference_t;
+
+static void reference_step(const FB_KALMAN_Config_t* c, reference_t* ref, const float* z, const float* u) {
+    const unsigned n = c->states, m = c->outputs;
+    double xm[N], pm[N][N], t[N][N];
+    for (unsigned i = 0; i < n; i++) {
+        xm[i] = 0.0;
+        for (unsigned j = 0; j < n; j++) xm[i] += c->a[i][j] * ref->x[j];
+        for (unsigned k = 0; k < c->inputs; k++) xm[i] += c->b[i][k] * u[k];
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            t[i][j] = 0.0;
+            for (unsigned l = 0; l < n; l++) t[i][j] += c->a[i][l] * ref->p[l][j];
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            pm[i][j] = c->q[i][j];
+            for (unsigned l = 0; l < n; l++) pm[i][j] += t[i][l] * c->a[j][l];
+        }
+    }
+
+    /* S 与其逆（m <= 2 时直接求逆，m = 3 时用伴随矩阵） */
+    double pht[N][3] = { { 0 } }, s[3][3] = { { 0 } }, si[3][3] = { { 0 } }, k[N][3] = { { 0 } };
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned o = 0; o < m; o++) {
+            pht[i][o] = 0.0;
+            for (unsigned j = 0; j < n; j++) pht[i][o] += pm[i][j] * c->h[o][j];
+        }
+    }
+    for (unsigned o = 0; o < m; o++) {
+        for (unsigned o2 = 0; o2 < m; o2++) {
+            s[o][o2] = c->r[o][o2];
+            for (unsigned j = 0; j < n; j++) s[o][o2] += c->h[o][j] * pht[j][o2];
+        }
+    }
+    if (m == 1) {
+        si[0][0] = 1.0 / s[0][0];
+    } else if (m == 2) {
+        double det = s[0][0] * s[1][1] - s[0][1] * s[1][0];
+        si[0][0] = s[1][1] / det;
+        si[1][1] = s[0][0] / det;
+        si[0][1] = -s[0][1] / det;
+        si[1][0] = -s[1][0] / det;
+    } else {
+        double det = s[0][0] * (s[1][1] * s[2][2] - s[1][2] * s[2][1]) -
+                     s[0][1] * (s[1][0] * s[2][2] - s[1][2] * s[2][0]) +
+                     s[0][2] * (s[1][0] * s[2][1] - s[1][1] * s[2][0]);
+        for (unsigned i = 0; i < 3; i++) {
+            for (unsigned j = 0; j < 3; j++) {
+                unsigned i1 = (j + 1) % 3, i2 = (j + 2) % 3, j1 = (i + 1) % 3, j2 = (i + 2) % 3;
+                si[i][j] = (s[i1][j1] * s[i2][j2] - s[i1][j2] * s[i2][j1]) / det;
+            }
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned o = 0; o < m; o++) {
+            k[i][o] = 0.0;
+            for (unsigned o2 = 0; o2 < m; o2++) k[i][o] += pht[i][o2] * si[o2][o];
+        }
+    }
+
+    for (unsigned i = 0; i < n; i++) {
+        double innovation_gain = 0.0;
+        for (unsigned o = 0; o < m; o++) {
+            double innovation = z[o];
+            for (unsigned j = 0; j < n; j++) innovation -= c->h[o][j] * xm[j];
+            innovation_gain += k[i][o] * innovation;
+        }
+        ref->x[i] = xm[i] + innovation_gain;
+    }
+    /* 简化形式 P = (I − K·H)·P⁻，双精度下足够 */
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            double sum = pm[i][j];
+            for (unsigned o = 0; o < m; o++) {
+                double hp = 0.0;
+                for (unsigned l = 0; l < n; l++) hp += c->h[o][l] * pm[l][j];
+                sum -= k[i][o] * hp;
+            }
+            t[i][j] = sum;
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0; j < n; j++) ref->p[i][j] = 0.5 * (t[i][j] + t[j][i]);
+    }
+}
+
+/* n 维阻尼振子链：测量前 m 个状态，p 个输入作用于后面的状态 */
+static FB_KALMAN_Config_t chain_config(unsigned n, unsigned m, unsigned p) {
+    FB_KALMAN_Config_t config;
+    memset(&config, 0, sizeof(config));
+    config.states = (uint8_t)n;
+    config.outputs = (uint8_t)m;
+    config.inputs = (uint8_t)p;
+    for (unsigned i = 0; i < n; i++) {
+        config.a[i][i] = 0.95f;
+        if (i + 1 < n) config.a[i][i + 1] = 0.1f;
+        if (i > 0) config.a[i][i - 1] = -0.05f;
+        config.q[i][i] = 1e-3f * (float)(i + 1);
+        config.p0[i][i] = 1.0f;
+        config.x0[i] = 0.1f * (float)i;
+        for (unsigned k = 0; k < p; k++) {
+            config.b[i][k] = (i == n - 1 - k) ? 0.1f : 0.0f;
+        }
+    }
+    for (unsigned o = 0; o < m; o++) {
+        config.h[o][o % n] = 1.0f;
+        config.h[o][n - 1] += 0.5f;
+        config.r[o][o] = 0.04f;
+    }
+    if (m > 1) {
+        config.r[0][1] = 0.01f;
+        config.r[1][0] = 0.01f;
+    }
+    return config;
+}
+
+// ============ 配置验证测试 ============
+
+void test_kalman_init_valid_config(void) {
+    FB_KALMAN_Config_t config = velocity_config(false);
+
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fb.state.p[0][0]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_KALMAN_GetState(&fb, 1));
+}
+
+void test_kalman_init_invalid_config(void) {
+    FB_KALMAN_Config_t config = velocity_config(false);
+    config.states = 0;
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config = velocity_config(false);
+    config.states = FB_KALMAN_MAX_STATES + 1;
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config = velocity_config(false);
+    config.outputs = FB_KALMAN_MAX_OUTPUTS + 1;
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config = velocity_config(false);
+    config.inputs = FB_KALMAN_MAX_INPUTS + 1;
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config = velocity_config(false);
+    config.r[0][0] = 0.0f;  /* R 必须正定 */
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config = velocity_config(false);
+    config.q[0][1] = 1e-4f;  /* Q 不对称 */
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config = velocity_config(false);
+    config.p0[1][1] = -1.0f;
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config = velocity_config(false);
+    config.a[1][0] = NAN;
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, NULL));
+}
+
+// ============ 滤波精度测试 ============
+
+void test_kalman_scalar_matches_closed_form(void) {
+    FB_KALMAN_Config_t config = {
+        .states = 1, .outputs = 1,
+        .a = { { 1.0f } }, .h = { { 1.0f } },
+        .q = { { 0.01f } }, .r = { { 0.25f } }, .x0 = { 2.0f }, .p0 = { { 4.0f } },
+    };
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+
+    double x = 2.0, p = 4.0;
+    uint32_t seed = 11u;
+    for (int k = 0; k < 200; k++) {
+        float z = 5.0f + 0.5f * noise(&seed);
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_KALMAN_Execute(&fb, &z, NULL));
+
+        double pm = p + 0.01;
+        double gain = pm / (pm + 0.25);
+        x += gain * (z - x);
+        p = (1.0 - gain) * (1.0 - gain) * pm + gain * gain * 0.25;
+
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f * (float)fabs(x) + 1e-6f, (float)x, FB_KALMAN_GetState(&fb, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f * (float)p, (float)p, fb.state.p[0][0]);
+    }
+}
+
+void test_kalman_all_dimensions_match_reference(void) {
+    /* 每个状态维数走各自的特化内核，与双精度参考逐周期比较 */
+    for (unsigned n = 1; n <= FB_KALMAN_MAX_STATES; n++) {
+        for (unsigned m = 1; m <= FB_KALMAN_MAX_OUTPUTS && m <= n; m++) {
+            unsigned p = (n - 1) % (FB_KALMAN_MAX_INPUTS + 1);
+            FB_KALMAN_Config_t config = chain_config(n, m, p);
+            TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+
+            reference_t ref;
+            memset(&ref, 0, sizeof(ref));
+            for (unsigned i = 0; i < n; i++) {
+                ref.x[i] = config.x0[i];
+                ref.p[i][i] = config.p0[i][i];
+            }
+            uint32_t seed = 100u + n;
+            for (int k = 0; k < 300; k++) {
+                float z[M], u[P];
+                for (unsigned o = 0; o < m; o++) z[o] = sinf(0.05f * (float)k + (float)o) + 0.2f * noise(&seed);
+                for (unsigned j = 0; j < p; j++) u[j] = (k / 50) % 2 ? 1.0f : -1.0f;
+
+                TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_KALMAN_Execute(&fb, z, p ? u : NULL));
+                reference_step(&config, &ref, z, u);
+                for (unsigned i = 0; i < n; i++) {
+                    TEST_ASSERT_FLOAT_WITHIN(1e-4f, (float)ref.x[i], fb.state.x[i]);
+                    TEST_ASSERT_FLOAT_WITHIN(1e-5f, (float)ref.p[i][i], fb.state.p[i][i]);
+                }
+            }
+        }
+    }
+}
+
+void test_kalman_tracks_velocity(void) {
+    FB_KALMAN_Config_t config = velocity_config(false);
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+
+    /* 斜率 2 单位/秒的位置，测量噪声 ±0.1 */
+    uint32_t seed = 7u;
+    for (int k = 0; k < 3000; k++) {
+        float z = 2.0f * 0.01f * (float)k + 0.1f * noise(&seed);
+        FB_KALMAN_Execute(&fb, &z, NULL);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 2.0f, FB_KALMAN_GetState(&fb, 1));
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 2.0f * 0.01f * 2999.0f, FB_KALMAN_GetState(&fb, 0));
+}
+
+void test_kalman_joseph_keeps_covariance_valid(void) {
+    /*
+     * 测量噪声远小于先验（P⁻/R ≈ 1e8）：同样输入下单精度的简化形式 P = (I − K·H)·P⁻
+     * 第一个周期就得到行列式为负的 P
+     */
+    FB_KALMAN_Config_t config = velocity_config(false);
+    config.q[0][0] = 0.0f;
+    config.q[1][1] = 1e-9f;
+    config.r[0][0] = 1e-6f;
+    config.p0[0][0] = 100.0f;
+    config.p0[1][1] = 100.0f;
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+
+    uint32_t seed = 3u;
+    for (int k = 0; k < 20000; k++) {
+        float z = 0.5f * 0.01f * (float)k + 1e-4f * noise(&seed);
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_KALMAN_Execute(&fb, &z, NULL));
+        float (*p)[N] = fb.state.p;
+        TEST_ASSERT_TRUE(p[0][1] == p[1][0]);
+        TEST_ASSERT_TRUE(p[0][0] > 0.0f && p[1][1] > 0.0f);
+        TEST_ASSERT_TRUE((double)p[0][0] * p[1][1] - (double)p[0][1] * p[1][0] >= 0.0);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.5f, FB_KALMAN_GetState(&fb, 1));
+}
+
+// ============ 稳态模式测试 ============
+
+void test_kalman_steady_state_matches_full(void) {
+    FB_KALMAN_Config_t full_config = velocity_config(false);
+    FB_KALMAN_Config_t steady_config = velocity_config(true);
+    FB_KALMAN_t full;
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&full, &full_config));
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &steady_config));
+
+    /* 稳态增益已在 Init 中求出，收敛后的协方差同时给出 */
+    TEST_ASSERT_TRUE(fb.state.gain[0][0] > 0.0f && fb.state.gain[0][0] < 1.0f);
+    TEST_ASSERT_TRUE(fb.state.gain[1][0] > 0.0f);
+
+    uint32_t seed = 9u;
+    for (int k = 0; k < 4000; k++) {
+        float z = sinf(0.002f * (float)k) + 0.1f * noise(&seed);
+        FB_KALMAN_Execute(&full, &z, NULL);
+        FB_KALMAN_Execute(&fb, &z, NULL);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f * fabsf(full.state.gain[0][0]), full.state.gain[0][0], fb.state.gain[0][0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f * fabsf(full.state.gain[1][0]), full.state.gain[1][0], fb.state.gain[1][0]);
+    /* 增益趋于一致后估计的差别按 F 的时间常数衰减 */
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, full.state.x[0], fb.state.x[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, full.state.x[1], fb.state.x[1]);
+}
+
+void test_kalman_steady_state_with_inputs(void) {
+    FB_KALMAN_Config_t full_config = chain_config(FB_KALMAN_MAX_STATES, 1, FB_KALMAN_MAX_INPUTS);
+    FB_KALMAN_Config_t steady_config = full_config;
+    steady_config.steady_state = true;
+    FB_KALMAN_t full;
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&full, &full_config));
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &steady_config));
+
+    uint32_t seed = 5u;
+    for (int k = 0; k < 2000; k++) {
+        float z = cosf(0.01f * (float)k) + 0.05f * noise(&seed);
+        float u[P];
+        for (unsigned j = 0; j < FB_KALMAN_MAX_INPUTS; j++) u[j] = 0.5f * noise(&seed);
+        FB_KALMAN_Execute(&full, &z, u);
+        FB_KALMAN_Execute(&fb, &z, u);
+    }
+    for (unsigned i = 0; i < FB_KALMAN_MAX_STATES; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, full.state.x[i], fb.state.x[i]);
+    }
+}
+
+void test_kalman_steady_state_undetectable_fails(void) {
+    /* 不稳定模态测不到：P 无界增长，不存在稳态解 */
+    FB_KALMAN_Config_t config = {
+        .states = 2, .outputs = 1,
+        .a = { { 1.1f, 0.0f }, { 0.0f, 0.5f } }, .h = { { 0.0f, 1.0f } },
+        .q = { { 1e-3f, 0.0f }, { 0.0f, 1e-3f } }, .r = { { 1.0f } },
+        .p0 = { { 1.0f, 0.0f }, { 0.0f, 1.0f } }, .steady_state = true,
+    };
+    TEST_ASSERT_EQUAL_INT(-1, FB_KALMAN_Init(&fb, &config));
+
+    config.steady_state = false;  /* 完整模式照常初始化 */
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+}
+
+// ============ 数值保护测试 ============
+
+void test_kalman_missing_measurement_predicts_only(void) {
+    FB_KALMAN_Config_t config = velocity_config(false);
+    config.x0[0] = 1.0f;
+    config.x0[1] = 3.0f;
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+
+    /* 无测量：状态按 A 外推，协方差增大 */
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_KALMAN_Execute(&fb, NULL, NULL));
+    TEST_ASSERT_EQUAL_FLOAT(1.03f, FB_KALMAN_GetState(&fb, 0));
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, FB_KALMAN_GetState(&fb, 1));
+    TEST_ASSERT_TRUE(fb.state.p[0][0] > 1.0f);
+
+    float z = NAN;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, FB_KALMAN_Execute(&fb, &z, NULL));
+    TEST_ASSERT_EQUAL_FLOAT(1.06f, FB_KALMAN_GetState(&fb, 0));
+    z = INFINITY;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, FB_KALMAN_Execute(&fb, &z, NULL));
+    TEST_ASSERT_EQUAL_FLOAT(1.09f, FB_KALMAN_GetState(&fb, 0));
+    TEST_ASSERT_FALSE(check_nan_inf(fb.state.p[0][0]));
+
+    /* 稳态模式同样只外推 */
+    config.steady_state = true;
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+    z = NAN;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, FB_KALMAN_Execute(&fb, &z, NULL));
+    TEST_ASSERT_EQUAL_FLOAT(1.03f, FB_KALMAN_GetState(&fb, 0));
+
+    z = 1.0f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_KALMAN_Execute(&fb, &z, NULL));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+}
+
+void test_kalman_invalid_input_holds_state(void) {
+    FB_KALMAN_Config_t config = chain_config(3, 1, 1);
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&fb, &config));
+    float z = 0.5f;
+    float u = 1.0f;
+    FB_KALMAN_Execute(&fb, &z, &u);
+    FB_KALMAN_State_t before = fb.state;
+
+    u = NAN;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, FB_KALMAN_Execute(&fb, &z, &u));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(before.x, fb.state.x, sizeof(before.x)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(before.p, fb.state.p, sizeof(before.p)));
+
+    /* 有输入的模型必须传入输入向量 */
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_KALMAN_Execute(&fb, &z, NULL));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(before.x, fb.state.x, sizeof(before.x)));
+}
+
+// ============ 测试套件 ============
+
+void run_test_fb_kalman(void) {
+    RUN_TEST(test_kalman_init_valid_config);
+    RUN_TEST(test_kalman_init_invalid_config);
+    RUN_TEST(test_kalman_scalar_matches_closed_form);
+    RUN_TEST(test_kalman_all_dimensions_match_reference);
+    RUN_TEST(test_kalman_tracks_velocity);
+    RUN_TEST(test_kalman_joseph_keeps_covariance_valid);
+    RUN_TEST(test_kalman_steady_state_matches_full);
+    RUN_TEST(test_kalman_steady_state_with_inputs);
+    RUN_TEST(test_kalman_steady_state_undetectable_fails);
+    RUN_TEST(test_kalman_missing_measurement_predicts_only);
+    RUN_TEST(test_kalman_invalid_input_holds_state);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_kalman();
+    return UNITY_END();
+}
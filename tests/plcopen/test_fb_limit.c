@@ -4,6 +4,7 @@
  */
 
 #include "unity.h"
+#include "block_sequence.h"
 #include "plcopen/fb_limit.h"
 #include <math.h>
 #include <string.h>
@@ -141,6 +142,27 @@ void test_limit_inf_input(void) {
     TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, fb.state.status);
 }
 
+// ============ 块处理测试 ============
+
+static float block_sample(unsigned k) {
+    return 15.0f * sinf(0.1f * (float)k);
+}
+
+/* LIMIT 无内部状态，只比较状态码 */
+static void assert_block_state(const FB_LIMIT_t* reference, const FB_LIMIT_t* actual) {
+    TEST_ASSERT_EQUAL(reference->state.status, actual->state.status);
+}
+
+DEFINE_BLOCK_SEQUENCE_CHECK(check_block_sequence, FB_LIMIT, block_sample, assert_block_state)
+
+void test_limit_execute_block_matches_execute(void) {
+    FB_LIMIT_t reference;
+    FB_LIMIT_Config_t config = { .min_val = -10.0f, .max_val = 10.0f };
+    FB_LIMIT_Init(&fb, &config);
+    FB_LIMIT_Init(&reference, &config);
+    check_block_sequence(&fb, &reference);
+}
+
 // ============ 测试套件 ============
 
 void run_test_fb_limit(void) {
@@ -156,6 +178,7 @@ void run_test_fb_limit(void) {
     RUN_TEST(test_limit_zero_input);
     RUN_TEST(test_limit_nan_input);
     RUN_TEST(test_limit_inf_input);
+    RUN_TEST(test_limit_execute_block_matches_execute);
 }
 
 int main(void) {
@@ -373,6 +373,99 @@ void test_pid_status_limit_lo(void) {
     TEST_ASSERT_EQUAL(FB_STATUS_LIMIT_LO, pid.state.status);
 }
 
+/* ========== 可变步长测试 ========== */
+
+static float jittered_dt(unsigned k) {
+    return 0.01f * (0.5f + (float)((k * 37u) % 11u) / 10.0f);
+}
+
+/**
+ * @brief 测试 dt = sample_time 时与 Execute 逐位相同（含饱和、手动切换与无效输入）
+ */
+void test_pid_execute_dt_matches_execute_at_nominal_dt(void) {
+    config.kp = 2.0f;
+    config.ki = 5.0f;
+    FB_PID_t reference;
+    memset(&reference, 0, sizeof(reference));  /* 逐字节比较状态：填充字节须一致 */
+    FB_PID_Init(&reference, &config);
+    FB_PID_Init(&pid, &config);
+    for (unsigned k = 0; k < 400; k++) {
+        float setpoint = (k < 200u) ? 80.0f : 20.0f;
+        float measurement = 50.0f + 40.0f * sinf(0.03f * (float)k);
+        if (k == 250u) measurement = NAN;
+        if (k == 300u) {
+            FB_PID_SetManual(&reference, 30.0f);
+            FB_PID_SetManual(&pid, 30.0f);
+        }
+        if (k == 320u) {
+            FB_PID_SetAuto(&reference);
+            FB_PID_SetAuto(&pid);
+        }
+        float expected = FB_PID_Execute(&reference, setpoint, measurement);
+        float output = FB_PID_ExecuteDt(&pid, setpoint, measurement, config.sample_time);
+        TEST_ASSERT_TRUE(memcmp(&expected, &output, sizeof(float)) == 0);
+        TEST_ASSERT_TRUE(memcmp(&reference.state, &pid.state, sizeof(FB_PID_State_t)) == 0);
+    }
+}
+
+/**
+ * @brief 测试抖动间隔下积分按 ki·e·dt 累加、微分按实测 dt 求差商
+ */
+void test_pid_execute_dt_jittered_intervals(void) {
+    /* 仅积分：恒定误差下积分值为 ki·e·Σdt */
+    config.kp = 0.0f;
+    config.kd = 0.0f;
+    FB_PID_Init(&pid, &config);
+    FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, 0.0f);
+    double integral = 0.0;
+    for (unsigned k = 0; k < 100; k++) {
+        float dt = jittered_dt(k);
+        ASSERT_FLOAT_IN_RANGE((float)integral, FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, dt), 1e-4f);
+        integral += 0.1 * 20.0 * dt;
+    }
+
+    /* 仅微分：测量值以 -100/s 下降，每个周期的微分项都是 kd·100 = 5 */
+    config.ki = 0.0f;
+    config.kd = 0.05f;
+    FB_PID_Init(&pid, &config);
+    double t = 0.0;
+    FB_PID_ExecuteDt(&pid, 0.0f, 90.0f, 0.0f);
+    for (unsigned k = 0; k < 100; k++) {
+        float dt = jittered_dt(k);
+        t += dt;
+        ASSERT_FLOAT_IN_RANGE(5.0f, FB_PID_ExecuteDt(&pid, 0.0f, (float)(90.0 - 100.0 * t), dt), 1e-2f);
+    }
+}
+
+/**
+ * @brief 测试 dt = 0 保持状态、无效 dt 设置状态码且不改变状态
+ */
+void test_pid_execute_dt_zero_and_invalid_dt(void) {
+    config.kd = 0.0f;
+    FB_PID_Init(&pid, &config);
+    FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, 0.01f);
+    float output = FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, 0.01f);
+    FB_PID_State_t saved = pid.state;
+
+    /* dt = 0：积分、上次测量值与输出不变 */
+    TEST_ASSERT_EQUAL_FLOAT(output, FB_PID_ExecuteDt(&pid, 50.0f, 10.0f, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, pid.state.status);
+    TEST_ASSERT_TRUE(memcmp(&saved, &pid.state, sizeof(FB_PID_State_t)) == 0);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, NAN));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, pid.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, INFINITY));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_INF, pid.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, -0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, pid.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(saved.integral, pid.state.integral);
+    TEST_ASSERT_EQUAL_FLOAT(saved.prev_measurement, pid.state.prev_measurement);
+
+    /* 错误之后 dt = 0 返回上次输出并清除错误状态码 */
+    TEST_ASSERT_EQUAL_FLOAT(output, FB_PID_ExecuteDt(&pid, 50.0f, 30.0f, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, pid.state.status);
+}
+
 /* ========== 运行器函数 ========== */
 
 /**
@@ -410,6 +503,11 @@ void run_test_fb_pid(void) {
     RUN_TEST(test_pid_status_ok);
     RUN_TEST(test_pid_status_limit_hi);
     RUN_TEST(test_pid_status_limit_lo);
+
+    /* 可变步长 */
+    RUN_TEST(test_pid_execute_dt_matches_execute_at_nominal_dt);
+    RUN_TEST(test_pid_execute_dt_jittered_intervals);
+    RUN_TEST(test_pid_execute_dt_zero_and_invalid_dt);
 }
 
 /* ========== 独立运行主函数 ========== */
@@ -14,6 +14,7 @@
  */
 
 #include "unity.h"
+#include "block_sequence.h"
 #include "plcopen/fb_pt1.h"
 #include <math.h>
 #include <string.h>
@@ -163,6 +164,124 @@ void test_pt1_status_ok(void) {
     TEST_ASSERT_EQUAL(FB_STATUS_OK, pt1.state.status);
 }
 
+/* ========== 块处理测试 ========== */
+
+static float block_sample(unsigned k) {
+    return 50.0f + 30.0f * sinf(0.05f * (float)k) + (float)((k * 7919u) % 13u) - 6.0f;
+}
+
+/* 块之间延续的状态：输出与首次运行标志 */
+static void assert_block_state(const FB_PT1_t* reference, const FB_PT1_t* actual) {
+    TEST_ASSERT_EQUAL(reference->state.status, actual->state.status);
+    TEST_ASSERT_TRUE(memcmp(&reference->state.output, &actual->state.output, sizeof(float)) == 0);
+    TEST_ASSERT_EQUAL(reference->state.first_run, actual->state.first_run);
+}
+
+DEFINE_BLOCK_SEQUENCE_CHECK(check_block_sequence, FB_PT1, block_sample, assert_block_state)
+
+void test_pt1_execute_block_matches_execute(void) {
+    FB_PT1_t reference;
+    FB_PT1_Init(&pt1, &config);
+    FB_PT1_Init(&reference, &config);
+    check_block_sequence(&pt1, &reference);
+}
+
+/* ========== 快进测试 ========== */
+
+/* 快进步数：0、单步、少量与大量周期 */
+static const uint32_t advance_steps[] = { 0, 1, 2, 5, 37, 1000, 20000 };
+
+void test_pt1_advance_matches_execute_loop(void) {
+    for (size_t s = 0; s < sizeof(advance_steps) / sizeof(advance_steps[0]); s++) {
+        uint32_t k = advance_steps[s];
+        FB_PT1_Init(&pt1, &config);
+        FB_PT1_Execute(&pt1, 10.0f);
+        FB_PT1_Execute(&pt1, 90.0f);
+        FB_PT1_t reference = pt1;
+
+        float expected = reference.state.output;
+        for (uint32_t i = 0; i < k; i++) {
+            expected = FB_PT1_Execute(&reference, 60.0f);
+        }
+        float output = FB_PT1_Advance(&pt1, 60.0f, k);
+
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, expected, output);
+        TEST_ASSERT_EQUAL_FLOAT(output, pt1.state.output);
+        TEST_ASSERT_EQUAL(reference.state.status, pt1.state.status);
+    }
+}
+
+void test_pt1_advance_first_run_and_nan(void) {
+    FB_PT1_Init(&pt1, &config);
+    TEST_ASSERT_EQUAL_FLOAT(25.0f, FB_PT1_Advance(&pt1, 25.0f, 100));
+    TEST_ASSERT_FALSE(pt1.state.first_run);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PT1_Advance(&pt1, NAN, 100));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, pt1.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(25.0f, pt1.state.output);
+}
+
+/* ========== 可变步长测试 ========== */
+
+/* 抖动的扫描间隔：名义 10 ms，在 5 ms 到 15 ms 之间变化 */
+static float jittered_dt(unsigned k) {
+    return 0.01f * (0.5f + (float)((k * 37u) % 11u) / 10.0f);
+}
+
+void test_pt1_execute_dt_matches_exact_discretization(void) {
+    FB_PT1_Init(&pt1, &config);
+    double y = 0.0;
+    for (unsigned k = 0; k < 2000; k++) {
+        float input = (k % 400u < 200u) ? 100.0f : -20.0f;
+        float dt = jittered_dt(k);
+        float output = FB_PT1_ExecuteDt(&pt1, input, dt);
+        if (k == 0) {
+            y = input;
+        } else {
+            y += -expm1(-(double)dt / config.time_constant) * ((double)input - y);
+        }
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, (float)y, output);
+        TEST_ASSERT_EQUAL(FB_STATUS_OK, pt1.state.status);
+    }
+}
+
+void test_pt1_execute_dt_independent_of_step_split(void) {
+    /* 精确离散化：输入保持不变时，1 次 1 s 与 100 次 10 ms 的结果相同 */
+    FB_PT1_t coarse;
+    FB_PT1_Init(&coarse, &config);
+    FB_PT1_Init(&pt1, &config);
+    FB_PT1_ExecuteDt(&coarse, 0.0f, 0.0f);
+    FB_PT1_ExecuteDt(&pt1, 0.0f, 0.0f);
+
+    float single = FB_PT1_ExecuteDt(&coarse, 100.0f, 1.0f);
+    float split = 0.0f;
+    for (int i = 0; i < 100; i++) {
+        split = FB_PT1_ExecuteDt(&pt1, 100.0f, 0.01f);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 100.0f * (1.0f - expf(-1.0f)), single);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, single, split);
+}
+
+void test_pt1_execute_dt_invalid_dt(void) {
+    FB_PT1_Init(&pt1, &config);
+    FB_PT1_ExecuteDt(&pt1, 10.0f, 0.01f);
+    FB_PT1_ExecuteDt(&pt1, 50.0f, 0.01f);
+    float held = pt1.state.output;
+
+    /* dt = 0：时间未推进，输出不变 */
+    TEST_ASSERT_EQUAL_FLOAT(held, FB_PT1_ExecuteDt(&pt1, 50.0f, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, pt1.state.status);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PT1_ExecuteDt(&pt1, 50.0f, NAN));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, pt1.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PT1_ExecuteDt(&pt1, 50.0f, INFINITY));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_INF, pt1.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PT1_ExecuteDt(&pt1, 50.0f, -0.01f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, pt1.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(held, pt1.state.output);
+}
+
 /* ========== 运行器函数 ========== */
 
 void run_test_fb_pt1(void) {
@@ -187,6 +306,18 @@ void run_test_fb_pt1(void) {
 
     /* 状态码 */
     RUN_TEST(test_pt1_status_ok);
+
+    /* 块处理 */
+    RUN_TEST(test_pt1_execute_block_matches_execute);
+
+    /* 快进 */
+    RUN_TEST(test_pt1_advance_matches_execute_loop);
+    RUN_TEST(test_pt1_advance_first_run_and_nan);
+
+    /* 可变步长 */
+    RUN_TEST(test_pt1_execute_dt_matches_exact_discretization);
+    RUN_TEST(test_pt1_execute_dt_independent_of_step_split);
+    RUN_TEST(test_pt1_execute_dt_invalid_dt);
 }
 
 int main(void) {
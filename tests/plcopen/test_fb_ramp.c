@@ -4,6 +4,7 @@
  */
 
 #include "unity.h"
+#include "block_sequence.h"
 #include "plcopen/fb_ramp.h"
 #include <math.h>
 #include <string.h>
@@ -206,6 +207,115 @@ void test_ramp_small_change(void) {
     TEST_ASSERT_EQUAL_FLOAT(0.5f, output);
 }
 
+// ============ 块处理测试 ============
+
+static float block_sample(unsigned k) {
+    return (((k / 20u) % 2u) ? 80.0f : 20.0f) + (float)(k % 3u) * 0.25f;
+}
+
+/* 块之间延续的状态：斜坡当前值与首次运行标志 */
+static void assert_block_state(const FB_RAMP_t* reference, const FB_RAMP_t* actual) {
+    TEST_ASSERT_EQUAL(reference->state.status, actual->state.status);
+    TEST_ASSERT_TRUE(memcmp(&reference->state.output, &actual->state.output, sizeof(float)) == 0);
+    TEST_ASSERT_EQUAL(reference->state.first_run, actual->state.first_run);
+}
+
+DEFINE_BLOCK_SEQUENCE_CHECK(check_block_sequence, FB_RAMP, block_sample, assert_block_state)
+
+void test_ramp_execute_block_matches_execute(void) {
+    FB_RAMP_t reference;
+    FB_RAMP_Config_t config = { .rise_rate = 10.0f, .fall_rate = 5.0f, .sample_time = 0.1f };
+    FB_RAMP_Init(&fb, &config);
+    FB_RAMP_Init(&reference, &config);
+    check_block_sequence(&fb, &reference);
+}
+
+// ============ 快进测试 ============
+
+static const uint32_t advance_steps[] = { 0, 1, 2, 5, 37, 1000, 20000 };
+
+/* 从给定输出出发，比较 Advance 与逐周期 Execute */
+static void check_advance(float start, float target) {
+    FB_RAMP_Config_t config = { .rise_rate = 10.0f, .fall_rate = 5.0f, .sample_time = 0.1f };
+    for (size_t s = 0; s < sizeof(advance_steps) / sizeof(advance_steps[0]); s++) {
+        uint32_t k = advance_steps[s];
+        FB_RAMP_Init(&fb, &config);
+        FB_RAMP_Execute(&fb, start);
+        FB_RAMP_t reference = fb;
+
+        float expected = reference.state.output;
+        for (uint32_t i = 0; i < k; i++) {
+            expected = FB_RAMP_Execute(&reference, target);
+        }
+        float output = FB_RAMP_Advance(&fb, target, k);
+
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, expected, output);
+        TEST_ASSERT_EQUAL(reference.state.status, fb.state.status);
+    }
+}
+
+void test_ramp_advance_matches_execute_loop(void) {
+    check_advance(0.0f, 100.0f);    /* 上升：37 个周期内未到达，1000 个周期后到达 */
+    check_advance(100.0f, 0.0f);    /* 下降（较慢速率） */
+    check_advance(50.0f, 50.5f);    /* 一个周期内到达 */
+}
+
+void test_ramp_advance_first_run(void) {
+    FB_RAMP_Config_t config = { .rise_rate = 10.0f, .fall_rate = 5.0f, .sample_time = 0.1f };
+    FB_RAMP_Init(&fb, &config);
+
+    TEST_ASSERT_EQUAL_FLOAT(40.0f, FB_RAMP_Advance(&fb, 40.0f, 10));
+    TEST_ASSERT_FALSE(fb.state.first_run);
+}
+
+// ============ 可变步长测试 ============
+
+/* 抖动的扫描间隔：名义 0.1 s，在 0.05 s 到 0.15 s 之间变化 */
+static float jittered_dt(unsigned k) {
+    return 0.1f * (0.5f + (float)((k * 37u) % 11u) / 10.0f);
+}
+
+void test_ramp_execute_dt_matches_execute_at_nominal_dt(void) {
+    /* dt = sample_time 时与 Execute 逐位相同 */
+    FB_RAMP_Config_t config = { .rise_rate = 10.0f, .fall_rate = 5.0f, .sample_time = 0.1f };
+    FB_RAMP_t reference;
+    FB_RAMP_Init(&reference, &config);
+    FB_RAMP_Init(&fb, &config);
+    for (unsigned k = 0; k < 400; k++) {
+        float target = (k % 100u < 50u) ? 80.0f : 10.0f;
+        float expected = FB_RAMP_Execute(&reference, target);
+        float output = FB_RAMP_ExecuteDt(&fb, target, 0.1f);
+        TEST_ASSERT_TRUE(memcmp(&expected, &output, sizeof(float)) == 0);
+    }
+}
+
+void test_ramp_execute_dt_jittered_rate(void) {
+    /* 斜坡速率按实测经过的总时间计算，到达目标后保持 */
+    FB_RAMP_Config_t config = { .rise_rate = 10.0f, .fall_rate = 5.0f, .sample_time = 0.1f };
+    FB_RAMP_Init(&fb, &config);
+    FB_RAMP_ExecuteDt(&fb, 0.0f, 0.0f);
+    double t = 0.0;
+    for (unsigned k = 0; k < 200; k++) {
+        float dt = jittered_dt(k);
+        t += dt;
+        float expected = (float)fmin(10.0 * t, 50.0);
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, expected, FB_RAMP_ExecuteDt(&fb, 50.0f, dt));
+    }
+}
+
+void test_ramp_execute_dt_invalid_dt(void) {
+    FB_RAMP_Config_t config = { .rise_rate = 10.0f, .fall_rate = 5.0f, .sample_time = 0.1f };
+    FB_RAMP_Init(&fb, &config);
+    FB_RAMP_ExecuteDt(&fb, 0.0f, 0.1f);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_RAMP_ExecuteDt(&fb, 50.0f, 0.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, fb.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_RAMP_ExecuteDt(&fb, 50.0f, NAN));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, fb.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_RAMP_ExecuteDt(&fb, 50.0f, -1.0f));
+    TEST_ASSERT_EQUAL(FB_STATUS_ERROR_CONFIG, fb.state.status);
+}
+
 // ============ 测试套件 ============
 
 void run_test_fb_ramp(void) {
@@ -223,6 +333,12 @@ void run_test_fb_ramp(void) {
     RUN_TEST(test_ramp_nan_input);
     RUN_TEST(test_ramp_inf_input);
     RUN_TEST(test_ramp_small_change);
+    RUN_TEST(test_ramp_execute_block_matches_execute);
+    RUN_TEST(test_ramp_advance_matches_execute_loop);
+    RUN_TEST(test_ramp_advance_first_run);
+    RUN_TEST(test_ramp_execute_dt_matches_execute_at_nominal_dt);
+    RUN_TEST(test_ramp_execute_dt_jittered_rate);
+    RUN_TEST(test_ramp_execute_dt_invalid_dt);
 }
 
 int main(void) {
@@ -0,0 +1,412 @@
+/**
+ * @file test_fb_rls.c
+ * @brief RLS 功能块单元测试
+ */
+
+#include "unity.h"
+#include "plcopen/fb_rls.h"
+#include <math.h>
+#include <string.h>
+
+#define NP FB_RLS_MAX_PARAMS
+#define PLANT_HISTORY 64
+
+static FB_RLS_t fb;
+
+void setUp(void) {
+    memset(&fb, 0, sizeof(FB_RLS_t));
+}
+
+void tearDown(void) {}
+
+/* 可复现的均匀噪声 [-1, 1) */
+static float noise(uint32_t* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / 8388608.0f - 1.0f;
+}
+
+/* 伪随机二进制序列：每 hold 个周期以一半概率翻转 */
+static float prbs(uint32_t* seed, unsigned k, unsigned hold, float* level) {
+    if (k % hold == 0u && noise(seed) > 0.0f) {
+        *level = -*level;
+    }
+    return *level;
+}
+
+static FB_RLS_Config_t arx_config(uint8_t na, uint8_t nb, uint8_t delay, bool bias) {
+    FB_RLS_Config_t config = {
+        .sample_time = 1.0f, .forgetting = 1.0f, .initial_covariance = 1000.0f,
+        .na = na, .nb = nb, .delay = delay, .bias = bias,
+    };
+    return config;
+}
+
+/* 双精度 ARX 过程：y(k) = −Σ a_i·y(k−i) + Σ b_j·u(k−d−j) + c + v(k)（方程误差），历史按时间倒序 */
+typedef struct {
+    double a[FB_RLS_MAX_ORDER];
+    double b[FB_RLS_MAX_ORDER];
+    double c;
+    unsigned na, nb, delay;
+    double y[PLANT_HISTORY];
+    double u[PLANT_HISTORY];
+} plant_t;
+
+static double plant_step(plant_t* p, double u, double v) {
+    double y = p->c + v;
+    for (unsigned i = 0; i < p->na; i++) y -= p->a[i] * p->y[i];
+    for (unsigned j = 0; j < p->nb; j++) y += p->b[j] * p->u[p->delay + j];
+    memmove(&p->y[1], &p->y[0], (PLANT_HISTORY - 1) * sizeof(double));
+    memmove(&p->u[1], &p->u[0], (PLANT_HISTORY - 1) * sizeof(double));
+    p->y[0] = y;
+    p->u[0] = u;
+    return y;
+}
+
+/* 由 plant_step 调用前的历史得到本周期 y(k) 所用的回归向量 */
+static unsigned plant_regressor(const plant_t* p, bool bias, double* phi) {
+    unsigned n = 0;
+    for (unsigned i = 0; i < p->na; i++) phi[n++] = -p->y[i];
+    for (unsigned j = 0; j < p->nb; j++) phi[n++] = p->u[p->delay + j];
+    if (bias) phi[n++] = 1.0;
+    return n;
+}
+
+/* 双精度参考：标准形式 RLS，直接更新 P */
+typedef struct {
+    double theta[NP];
+    double p[NP][NP];
+} reference_t;
+
+static void reference_init(reference_t* ref, unsigned n, double p0) {
+    memset(ref, 0, sizeof(*ref));
+    for (unsigned i = 0; i < n; i++) ref->p[i][i] = p0;
+}
+
+static double reference_step(reference_t* ref, const double* phi, unsigned n, double y, double lambda) {
+    double pphi[NP];
+    double s = lambda;
+    double e = y;
+    for (unsigned i = 0; i < n; i++) {
+        pphi[i] = 0.0;
+        for (unsigned j = 0; j < n; j++) pphi[i] += ref->p[i][j] * phi[j];
+        s += phi[i] * pphi[i];
+        e -= phi[i] * ref->theta[i];
+    }
+    for (unsigned i = 0; i < n; i++) {
+        ref->theta[i] += pphi[i] / s * e;
+        for (unsigned j = 0; j < n; j++) ref->p[i][j] = (ref->p[i][j] - pphi[i] * pphi[j] / s) / lambda;
+    }
+    return e;
+}
+
+/* 当前 UD 分解重建的 P[i][j] */
+static double factored_covariance(const FB_RLS_t* rls, unsigned i, unsigned j) {
+    unsigned n = rls->state.params;
+    double sum = 0.0;
+    for (unsigned l = 0; l < n; l++) {
+        double ui = (l == i) ? 1.0 : ((i < l) ? rls->state.u[l * (l - 1) / 2 + i] : 0.0);
+        double uj = (l == j) ? 1.0 : ((j < l) ? rls->state.u[l * (l - 1) / 2 + j] : 0.0);
+        sum += ui * rls->state.d[l] * uj;
+    }
+    return sum;
+}
+
+// ============ 初始化测试 ============
+
+void test_rls_init_valid_config(void) {
+    FB_RLS_Config_t config = arx_config(2, 2, 3, true);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+    TEST_ASSERT_EQUAL_UINT8(5, fb.state.params);
+    for (unsigned j = 0; j < 5; j++) {
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, fb.state.theta[j]);
+        TEST_ASSERT_EQUAL_FLOAT(1000.0f, fb.state.d[j]);
+    }
+
+    /* 纯 FIR 模型与最大滞后 */
+    config = arx_config(0, FB_RLS_MAX_ORDER, FB_RLS_MAX_DELAY, false);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+}
+
+void test_rls_init_invalid_config(void) {
+    FB_RLS_Config_t config = arx_config(1, 1, 0, false);
+    TEST_ASSERT_EQUAL_INT(-1, FB_RLS_Init(NULL, &config));
+    TEST_ASSERT_EQUAL_INT(-1, FB_RLS_Init(&fb, NULL));
+
+    FB_RLS_Config_t bad = config;
+    bad.sample_time = 0.0f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad = config;
+    bad.forgetting = 0.8f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad.forgetting = 1.01f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad = config;
+    bad.initial_covariance = NAN;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad.initial_covariance = -1.0f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad = config;
+    bad.nb = 0;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad.nb = FB_RLS_MAX_ORDER + 1;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad = config;
+    bad.na = FB_RLS_MAX_ORDER + 1;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+    bad = config;
+    bad.delay = FB_RLS_MAX_DELAY + 1;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_ValidateConfig(&bad));
+}
+
+// ============ 辨识测试 ============
+
+/* 历史积累满 max(na, d + nb) 个采样之前不更新 */
+void test_rls_waits_for_history(void) {
+    FB_RLS_Config_t config = arx_config(1, 2, 4, false);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+    for (unsigned k = 0; k < 6; k++) {
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_RLS_Execute(&fb, 1.0f, 2.0f));
+        TEST_ASSERT_EQUAL_FLOAT(1000.0f, fb.state.d[0]);
+    }
+    /* 第 7 个采样开始更新：θ = 0 时预测误差为 y 本身 */
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, FB_RLS_Execute(&fb, 1.0f, 3.0f));
+    TEST_ASSERT_TRUE(fb.state.d[0] < 1000.0f);
+}
+
+/* 遗忘因子 < 1 时 UD 分解与双精度标准形式逐步一致，重建的 P 也一致 */
+void test_rls_matches_double_reference(void) {
+    plant_t plant = { .a = { -1.2, 0.35 }, .b = { 0.5, 0.3 }, .c = 2.0, .na = 2, .nb = 2, .delay = 3 };
+    FB_RLS_Config_t config = arx_config(2, 2, 3, true);
+    config.forgetting = 0.98f;
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+    reference_t ref;
+    reference_init(&ref, 5, 1000.0);
+
+    uint32_t seed = 11u;
+    float level = 1.0f;
+    const unsigned required = 5;
+    const unsigned settle = required + 2 * 5;
+    for (unsigned k = 0; k < 600; k++) {
+        float u = prbs(&seed, k, 3, &level) + 0.2f * noise(&seed);
+        double phi[NP];
+        unsigned n = plant_regressor(&plant, true, phi);
+        float y = (float)plant_step(&plant, u, 0.05 * noise(&seed));
+        float e = FB_RLS_Execute(&fb, u, y);
+        if (k >= required) {
+            double e_ref = reference_step(&ref, phi, n, (double)y, 0.98);
+            /* 最初几次更新时数据秩不足、P 接近 p0·I，单精度舍入被放大，之后逐步比较 */
+            if (k >= settle) {
+                TEST_ASSERT_FLOAT_WITHIN(1e-3f * fmaxf(1.0f, fabsf((float)e_ref)), (float)e_ref, e);
+            }
+        }
+    }
+    for (unsigned i = 0; i < 5; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f * fmaxf(1.0f, fabsf((float)ref.theta[i])), (float)ref.theta[i],
+                                 FB_RLS_GetParameter(&fb, i));
+        for (unsigned j = 0; j < 5; j++) {
+            double scale = fmax(1e-6, sqrt(ref.p[i][i] * ref.p[j][j]));
+            TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.0f, (float)((factored_covariance(&fb, i, j) - ref.p[i][j]) / scale));
+        }
+    }
+}
+
+/* 无噪声时收敛到真实参数 */
+void test_rls_identifies_exact_arx(void) {
+    plant_t plant = { .a = { -1.5, 0.7, -0.1 }, .b = { 0.2, -0.1, 0.4 }, .na = 3, .nb = 3, .delay = 2 };
+    FB_RLS_Config_t config = arx_config(3, 3, 2, false);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+
+    uint32_t seed = 5u;
+    for (unsigned k = 0; k < 400; k++) {
+        float u = noise(&seed);
+        FB_RLS_Execute(&fb, u, (float)plant_step(&plant, u, 0.0));
+    }
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, (float)plant.a[i], FB_RLS_GetParameter(&fb, i));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, (float)plant.b[i], FB_RLS_GetParameter(&fb, 3 + i));
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, fb.state.error);
+}
+
+/*
+ * 零阶保持采样的 FOPDT 过程（K = 2，T = 20 s，θ = 5.4 s，Ts = 1 s），工作点 y = 50、u = 30， 
+ * 带方程误差噪声：换算出的 K、T、θ 接近真实值
+ */
+void test_rls_fopdt_from_operating_data(void) {
+    const double gain = 2.0, tau = 20.0, fraction = 0.4;
+    double pole = exp(-1.0 / tau);
+    double mid = pow(pole, 1.0 - fraction);
+    plant_t plant = { .a = { -pole }, .b = { gain * (1.0 - mid), gain * (mid - pole) },
+                      .c = (1.0 - pole) * (50.0 - gain * 30.0), .na = 1, .nb = 2, .delay = 5 };
+    for (unsigned i = 0; i < PLANT_HISTORY; i++) {
+        plant.y[i] = 50.0;
+        plant.u[i] = 30.0;
+    }
+
+    FB_RLS_Config_t config = arx_config(1, 2, 5, true);
+    config.forgetting = 0.999f;
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+
+    uint32_t seed = 3u;
+    float level = 1.0f;
+    for (unsigned k = 0; k < 3000; k++) {
+        float u = 30.0f + prbs(&seed, k, 10, &level);
+        float y = (float)plant_step(&plant, u, 0.01 * noise(&seed));
+        FB_RLS_Execute(&fb, u, y);
+    }
+
+    FB_RLS_FOPDT_t model;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_RLS_GetFOPDT(&fb, &model));
+    TEST_ASSERT_FLOAT_WITHIN(0.04f, 2.0f, model.gain);
+    TEST_ASSERT_FLOAT_WITHIN(0.6f, 20.0f, model.time_constant);
+    TEST_ASSERT_FLOAT_WITHIN(0.15f, 5.4f, model.dead_time);
+}
+
+/* 遗忘因子使估计跟随过程增益的变化 */
+void test_rls_forgetting_tracks_change(void) {
+    plant_t plant = { .a = { -0.9 }, .b = { 0.1 }, .na = 1, .nb = 1 };
+    FB_RLS_Config_t config = arx_config(1, 1, 0, false);
+    config.forgetting = 0.98f;
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+
+    uint32_t seed = 9u;
+    float level = 1.0f;
+    for (unsigned k = 0; k < 2000; k++) {
+        if (k == 1000u) {
+            plant.b[0] = 0.3;
+        }
+        float u = prbs(&seed, k, 5, &level);
+        FB_RLS_Execute(&fb, u, (float)plant_step(&plant, u, 0.001 * noise(&seed)));
+    }
+    FB_RLS_FOPDT_t model;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_RLS_GetFOPDT(&fb, &model));
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 3.0f, model.gain);
+}
+
+/*
+ * 长时间无激励（输入、输出恒定）：D 保持为正且不超过 initial_covariance，
+ * 估计不发散；激励恢复后重新收敛
+ */
+void test_rls_covariance_bounded_without_excitation(void) {
+    plant_t plant = { .a = { -0.8 }, .b = { 0.4 }, .c = 1.0, .na = 1, .nb = 1, .delay = 1 };
+    FB_RLS_Config_t config = arx_config(1, 1, 1, true);
+    config.forgetting = 0.95f;
+    config.initial_covariance = 100.0f;
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+
+    uint32_t seed = 21u;
+    float level = 1.0f;
+    for (unsigned k = 0; k < 500; k++) {
+        float u = prbs(&seed, k, 4, &level);
+        FB_RLS_Execute(&fb, u, (float)plant_step(&plant, u, 0.0));
+    }
+    for (unsigned k = 0; k < 100000; k++) {
+        FB_RLS_Execute(&fb, 2.0f, (float)plant_step(&plant, 2.0, 0.0));
+        if (k % 1000u == 0u) {
+            for (unsigned j = 0; j < 3; j++) {
+                TEST_ASSERT_TRUE(fb.state.d[j] > 0.0f && fb.state.d[j] <= 100.0f);
+                TEST_ASSERT_FALSE(isnan(fb.state.theta[j]) || isinf(fb.state.theta[j]));
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+
+    for (unsigned k = 0; k < 500; k++) {
+        float u = prbs(&seed, k, 4, &level);
+        FB_RLS_Execute(&fb, u, (float)plant_step(&plant, u, 0.0));
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, -0.8f, FB_RLS_GetParameter(&fb, 0));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.4f, FB_RLS_GetParameter(&fb, 1));
+    TEST_ASSERT_FLOAT_WITHIN(1e-2f, 1.0f, FB_RLS_GetParameter(&fb, 2));
+}
+
+// ============ 异常与辅助接口 ============
+
+/* NaN/Inf 采样：参数不变，历史重新积累 */
+void test_rls_invalid_sample_restarts_history(void) {
+    FB_RLS_Config_t config = arx_config(1, 1, 2, false);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+    for (unsigned k = 0; k < 10; k++) {
+        FB_RLS_Execute(&fb, (float)(k % 3u), (float)k);
+    }
+    FB_RLS_State_t before = fb.state;
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_RLS_Execute(&fb, NAN, 1.0f));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, fb.state.status);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(before.theta, fb.state.theta, sizeof(before.theta)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(before.d, fb.state.d, sizeof(before.d)));
+    FB_RLS_Execute(&fb, 1.0f, INFINITY);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, fb.state.status);
+
+    /* 重新积累 d + nb = 3 个采样后才恢复更新 */
+    for (unsigned k = 0; k < 3; k++) {
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_RLS_Execute(&fb, 1.0f, 5.0f));
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(before.theta, fb.state.theta, sizeof(before.theta)));
+    FB_RLS_Execute(&fb, 1.0f, 5.0f);
+    TEST_ASSERT_TRUE(memcmp(before.theta, fb.state.theta, sizeof(before.theta)) != 0);
+}
+
+void test_rls_reset_covariance_keeps_parameters(void) {
+    FB_RLS_Config_t config = arx_config(1, 2, 0, true);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+    uint32_t seed = 1u;
+    for (unsigned k = 0; k < 50; k++) {
+        FB_RLS_Execute(&fb, noise(&seed), noise(&seed));
+    }
+    float theta[NP];
+    memcpy(theta, fb.state.theta, sizeof(theta));
+
+    FB_RLS_ResetCovariance(&fb);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(theta, fb.state.theta, sizeof(theta)));
+    for (unsigned i = 0; i < 4; i++) {
+        for (unsigned j = 0; j < 4; j++) {
+            TEST_ASSERT_EQUAL_FLOAT((i == j) ? 1000.0f : 0.0f, (float)factored_covariance(&fb, i, j));
+        }
+    }
+}
+
+void test_rls_fopdt_requires_stable_first_order(void) {
+    FB_RLS_FOPDT_t model;
+    FB_RLS_Config_t config = arx_config(2, 1, 0, false);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_GetFOPDT(&fb, &model));
+
+    config = arx_config(1, 1, 0, false);
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&fb, &config));
+    /* θ = 0：极点为 0，不是惯性环节 */
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_GetFOPDT(&fb, &model));
+    fb.state.theta[0] = -1.05f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_GetFOPDT(&fb, &model));
+    fb.state.theta[0] = -0.5f;
+    fb.state.theta[1] = 0.25f;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_RLS_GetFOPDT(&fb, &model));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, model.gain);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f / logf(2.0f), model.time_constant);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, model.dead_time);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_RLS_GetFOPDT(&fb, NULL));
+}
+
+// ============ 测试套件 ============
+
+void run_test_fb_rls(void) {
+    RUN_TEST(test_rls_init_valid_config);
+    RUN_TEST(test_rls_init_invalid_config);
+    RUN_TEST(test_rls_waits_for_history);
+    RUN_TEST(test_rls_matches_double_reference);
+    RUN_TEST(test_rls_identifies_exact_arx);
+    RUN_TEST(test_rls_fopdt_from_operating_data);
+    RUN_TEST(test_rls_forgetting_tracks_change);
+    RUN_TEST(test_rls_covariance_bounded_without_excitation);
+    RUN_TEST(test_rls_invalid_sample_restarts_history);
+    RUN_TEST(test_rls_reset_covariance_keeps_parameters);
+    RUN_TEST(test_rls_fopdt_requires_stable_first_order);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_rls();
+    return UNITY_END();
+}
@@ -0,0 +1,297 @@
+/**
+ * @file test_fb_scurve.c
+ * @brief SCURVE 功能块单元测试
+ */
+
+#include "unity.h"
+#include "plcopen/fb_scurve.h"
+#include "plcopen/fb_ramp.h"
+#include <math.h>
+#include <string.h>
+
+static FB_SCURVE_t fb;
+
+/* 默认配置：上升 20/s、50/s²、200/s³，下降 10/s、25/s²、100/s³，1 ms 采样 */
+static FB_SCURVE_Config_t default_config(void) {
+    FB_SCURVE_Config_t config = {
+        .rise_rate = 20.0f, .fall_rate = 10.0f,
+        .rise_accel = 50.0f, .fall_accel = 25.0f,
+        .rise_jerk = 200.0f, .fall_jerk = 100.0f,
+        .sample_time = 0.001f
+    };
+    return config;
+}
+
+void setUp(void) {
+    memset(&fb, 0, sizeof(FB_SCURVE_t));
+}
+
+void tearDown(void) {}
+
+/*
+ * 运行到静止并逐周期检查：输出单调、不越过目标；输出差分不超过速度上限；
+ * 速度、加速度逐周期的变化不超过加速度、加加速度上限（即两者连续）。返回所用周期数。
+ */
+static int run_to_target(float target, const FB_SCURVE_Config_t* config, int max_cycles) {
+    float ts = config->sample_time;
+    float direction = (target >= fb.state.output) ? 1.0f : -1.0f;
+    float rate = (direction > 0.0f) ? config->rise_rate : config->fall_rate;
+    float accel = (direction > 0.0f) ? config->rise_accel : config->fall_accel;
+    float jerk = (direction > 0.0f) ? config->rise_jerk : config->fall_jerk;
+
+    float prev_y = fb.state.output;
+    float prev_v = fb.state.velocity;
+    float prev_a = fb.state.acceleration;
+    for (int k = 1; k <= max_cycles; k++) {
+        float out = FB_SCURVE_Execute(&fb, target);
+        TEST_ASSERT_EQUAL(FB_STATUS_OK, fb.state.status);
+
+        float step = direction * (out - prev_y);
+        TEST_ASSERT_TRUE(step >= -1e-5f);                                /* 单调 */
+        TEST_ASSERT_TRUE(direction * (out - target) <= 1e-4f);          /* 不越过目标 */
+        TEST_ASSERT_TRUE(step <= rate * ts * 1.001f + 1e-5f);
+        TEST_ASSERT_TRUE(direction * fb.state.velocity <= rate * 1.001f);
+        TEST_ASSERT_TRUE(fabsf(fb.state.acceleration) <= accel * 1.001f);
+        TEST_ASSERT_TRUE(fabsf(fb.state.velocity - prev_v) <= accel * ts * 1.001f + 1e-5f);
+        TEST_ASSERT_TRUE(fabsf(fb.state.acceleration - prev_a) <= jerk * ts * 1.001f + 1e-4f);
+        prev_y = out;
+        prev_v = fb.state.velocity;
+        prev_a = fb.state.acceleration;
+
+        if (out == target && fb.state.segment >= fb.state.segment_count) {
+            return k;
+        }
+    }
+    TEST_FAIL_MESSAGE("未在限定周期内到达目标");
+    return -1;
+}
+
+// ============ 配置验证测试 ============
+
+void test_scurve_init_valid_config(void) {
+    FB_SCURVE_Config_t config = default_config();
+    TEST_ASSERT_EQUAL(0, FB_SCURVE_Init(&fb, &config));
+    TEST_ASSERT_TRUE(fb.state.first_run);
+
+    config.rise_jerk = INFINITY;
+    config.fall_accel = INFINITY;
+    TEST_ASSERT_EQUAL(0, FB_SCURVE_Init(&fb, &config));
+}
+
+void test_scurve_init_invalid_config(void) {
+    FB_SCURVE_Config_t config = default_config();
+    config.rise_rate = INFINITY;
+    TEST_ASSERT_EQUAL(-1, FB_SCURVE_Init(&fb, &config));
+
+    config = default_config();
+    config.fall_accel = 0.0f;
+    TEST_ASSERT_EQUAL(-1, FB_SCURVE_Init(&fb, &config));
+
+    config = default_config();
+    config.rise_jerk = NAN;
+    TEST_ASSERT_EQUAL(-1, FB_SCURVE_Init(&fb, &config));
+
+    config = default_config();
+    config.sample_time = 0.0f;
+    TEST_ASSERT_EQUAL(-1, FB_SCURVE_Init(&fb, &config));
+
+    TEST_ASSERT_EQUAL(-1, FB_SCURVE_Init(&fb, NULL));
+}
+
+// ============ 首次调用测试 ============
+
+void test_scurve_first_call_output_equals_target(void) {
+    FB_SCURVE_Config_t config = default_config();
+    FB_SCURVE_Init(&fb, &config);
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, FB_SCURVE_Execute(&fb, 30.0f));
+    TEST_ASSERT_FALSE(fb.state.first_run);
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, FB_SCURVE_Execute(&fb, 30.0f));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fb.state.velocity);
+}
+
+// ============ 长行程测试 ============
+
+void test_scurve_long_move_respects_limits(void) {
+    /* 上升：速度、加速度上限均可达，最短时间 h/V + V/A + A/J = 5 + 0.4 + 0.25 s */
+    FB_SCURVE_Config_t config = default_config();
+    FB_SCURVE_Init(&fb, &config);
+    FB_SCURVE_Execute(&fb, 0.0f);
+
+    int cycles = run_to_target(100.0f, &config, 10000);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, 5650.0f, (float)cycles);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, fb.state.output);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fb.state.velocity);
+}
+
+void test_scurve_fall_uses_fall_limits(void) {
+    /* 下降：h/V + V/A + A/J = 5 + 0.4 + 0.25 s（下降上限为上升的一半，行程也减半） */
+    FB_SCURVE_Config_t config = default_config();
+    FB_SCURVE_Init(&fb, &config);
+    FB_SCURVE_Execute(&fb, 100.0f);
+
+    int cycles = run_to_target(50.0f, &config, 10000);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, 5650.0f, (float)cycles);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, fb.state.output);
+}
+
+// ============ 短行程测试 ============
+
+void test_scurve_short_move(void) {
+    /* 速度与加速度上限都不可达：纯加加速度段，h = 2·J·T³（T 为加加速度段时长）→ T = 0.1 s */
+    FB_SCURVE_Config_t config = default_config();
+    FB_SCURVE_Init(&fb, &config);
+    FB_SCURVE_Execute(&fb, 0.0f);
+
+    int cycles = run_to_target(0.4f, &config, 10000);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, 400.0f, (float)cycles);
+    TEST_ASSERT_TRUE(fb.state.segment_count <= 5);  /* 加加速度段 4 + 二分余量的极短匀速段 */
+}
+
+// ============ 目标值变化测试 ============
+
+void test_scurve_retarget_while_moving(void) {
+    FB_SCURVE_Config_t config = default_config();
+    FB_SCURVE_Init(&fb, &config);
+    FB_SCURVE_Execute(&fb, 0.0f);
+
+    /* 加速途中改为更远的目标：速度与加速度连续 */
+    for (int k = 0; k < 300; k++) {
+        FB_SCURVE_Execute(&fb, 100.0f);
+    }
+    float v = fb.state.velocity;
+    float a = fb.state.acceleration;
+    TEST_ASSERT_TRUE(a > 0.0f);
+    FB_SCURVE_Execute(&fb, 150.0f);
+    TEST_ASSERT_FLOAT_WITHIN(config.rise_accel * config.sample_time * 1.01f, v, fb.state.velocity);
+    TEST_ASSERT_FLOAT_WITHIN(config.rise_jerk * config.sample_time * 1.01f, a, fb.state.acceleration);
+
+    run_to_target(150.0f, &config, 20000);
+    TEST_ASSERT_EQUAL_FLOAT(150.0f, fb.state.output);
+}
+
+void test_scurve_reverse_overshoot(void) {
+    /* 全速上升途中把目标改到当前位置下方：先减速停止（越过新目标），再下降返回 */
+    FB_SCURVE_Config_t config = default_config();
+    FB_SCURVE_Init(&fb, &config);
+    FB_SCURVE_Execute(&fb, 0.0f);
+    for (int k = 0; k < 2000; k++) {
+        FB_SCURVE_Execute(&fb, 100.0f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 20.0f, fb.state.velocity);
+
+    float target = fb.state.output - 1.0f;
+    float prev_v = fb.state.velocity;
+    float prev_a = fb.state.acceleration;
+    float peak = fb.state.output;
+    for (int k = 0; k < 20000; k++) {
+        FB_SCURVE_Execute(&fb, target);
+        /* 速度、加速度逐周期连续 */
+        TEST_ASSERT_TRUE(fabsf(fb.state.velocity - prev_v) <= 50.0f * config.sample_time * 1.01f);
+        TEST_ASSERT_TRUE(fabsf(fb.state.acceleration - prev_a) <= 200.0f * config.sample_time * 1.01f);
+        TEST_ASSERT_TRUE(fabsf(fb.state.acceleration) <= 50.0f * 1.001f);
+        TEST_ASSERT_TRUE(fb.state.velocity >= -config.fall_rate * 1.001f);
+        prev_v = fb.state.velocity;
+        prev_a = fb.state.acceleration;
+        peak = fmaxf(peak, fb.state.output);
+        if (fb.state.segment >= fb.state.segment_count) {
+            break;
+        }
+    }
+    TEST_ASSERT_EQUAL_FLOAT(target, fb.state.output);
+    TEST_ASSERT_TRUE(peak > target + 1.0f);
+    TEST_ASSERT_TRUE(fb.state.segment_count <= FB_SCURVE_MAX_SEGMENTS);
+}
+
+// ============ 无穷大上限测试 ============
+
+void test_scurve_infinite_limits_match_ramp(void) {
+    /* 加速度与加加速度上限全为 +Inf：与 FB_RAMP 逐位相同 */
+    FB_SCURVE_Config_t config = default_config();
+    config.rise_accel = INFINITY;
+    config.fall_accel = INFINITY;
+    config.rise_jerk = INFINITY;
+    config.fall_jerk = INFINITY;
+    FB_RAMP_Config_t ramp_config = { .rise_rate = 20.0f, .fall_rate = 10.0f, .sample_time = 0.001f };
+    FB_RAMP_t ramp;
+    FB_SCURVE_Init(&fb, &config);
+    FB_RAMP_Init(&ramp, &ramp_config);
+
+    for (unsigned k = 0; k < 5000; k++) {
+        float target = (float)((k / 700u * 37u) % 23u);
+        if (k == 2500u) {
+            target = NAN;
+        }
+        float expected = FB_RAMP_Execute(&ramp, target);
+        float output = FB_SCURVE_Execute(&fb, target);
+        TEST_ASSERT_TRUE(memcmp(&expected, &output, sizeof(float)) == 0);
+        TEST_ASSERT_EQUAL(ramp.state.status, fb.state.status);
+    }
+}
+
+void test_scurve_infinite_jerk_trapezoid(void) {
+    /* 仅加加速度为 +Inf：梯形速度曲线，h/V + V/A = 5 + 0.4 s */
+    FB_SCURVE_Config_t config = default_config();
+    config.rise_jerk = INFINITY;
+    config.fall_jerk = INFINITY;
+    FB_SCURVE_Init(&fb, &config);
+    FB_SCURVE_Execute(&fb, 0.0f);
+
+    int k = 0;
+    float max_v = 0.0f;
+    while (fb.state.output != 100.0f || fb.state.segment < fb.state.segment_count) {
+        FB_SCURVE_Execute(&fb, 100.0f);
+        TEST_ASSERT_TRUE(fabsf(fb.state.acceleration) <= 50.0f * 1.001f);
+        max_v = fmaxf(max_v, fb.state.velocity);
+        TEST_ASSERT_TRUE(++k < 10000);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, 5400.0f, (float)k);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 20.0f, max_v);
+    TEST_ASSERT_TRUE(fb.state.segment_count <= 3);
+}
+
+// ============ 数值保护测试 ============
+
+void test_scurve_nan_target_continues_plan(void) {
+    FB_SCURVE_Config_t config = default_config();
+    FB_SCURVE_t reference;
+    FB_SCURVE_Init(&fb, &config);
+    FB_SCURVE_Init(&reference, &config);
+    FB_SCURVE_Execute(&fb, 0.0f);
+    FB_SCURVE_Execute(&reference, 0.0f);
+
+    /* 运动中出现 NaN/Inf：报告状态码，输出继续沿原曲线运动 */
+    for (int k = 0; k < 4000; k++) {
+        float target = (k >= 1000 && k < 1100) ? ((k & 1) ? NAN : INFINITY) : 50.0f;
+        float output = FB_SCURVE_Execute(&fb, target);
+        TEST_ASSERT_EQUAL_FLOAT(FB_SCURVE_Execute(&reference, 50.0f), output);
+        if (k == 1001) {
+            TEST_ASSERT_EQUAL(FB_STATUS_ERROR_NAN, fb.state.status);
+        } else if (k == 1002) {
+            TEST_ASSERT_EQUAL(FB_STATUS_ERROR_INF, fb.state.status);
+        }
+    }
+    TEST_ASSERT_EQUAL(FB_STATUS_OK, fb.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, fb.state.output);
+}
+
+// ============ 测试套件 ============
+
+void run_test_fb_scurve(void) {
+    RUN_TEST(test_scurve_init_valid_config);
+    RUN_TEST(test_scurve_init_invalid_config);
+    RUN_TEST(test_scurve_first_call_output_equals_target);
+    RUN_TEST(test_scurve_long_move_respects_limits);
+    RUN_TEST(test_scurve_fall_uses_fall_limits);
+    RUN_TEST(test_scurve_short_move);
+    RUN_TEST(test_scurve_retarget_while_moving);
+    RUN_TEST(test_scurve_reverse_overshoot);
+    RUN_TEST(test_scurve_infinite_limits_match_ramp);
+    RUN_TEST(test_scurve_infinite_jerk_trapezoid);
+    RUN_TEST(test_scurve_nan_target_continues_plan);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_scurve();
+    return UNITY_END();
+}
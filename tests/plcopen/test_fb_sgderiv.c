@@ -0,0 +1,198 @@
+/**
+ * @file test_fb_sgderiv.c
+ * @brief SGDERIV 功能块单元测试
+ */
+
+#include "unity.h"
+#include "plcopen/fb_sgderiv.h"
+#include "plcopen/fb_derivative.h"
+#include <math.h>
+#include <string.h>
+
+static FB_SGDERIV_t fb;
+
+void setUp(void) {
+    memset(&fb, 0, sizeof(FB_SGDERIV_t));
+}
+
+void tearDown(void) {}
+
+/* 可复现的均匀噪声 [-1, 1) */
+static float noise(uint32_t* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / 8388608.0f - 1.0f;
+}
+
+/* 双精度直接求窗口最小二乘斜率（窗口不足时以第一个采样补齐，同 FB_SGDERIV） */
+static double reference_slope(const float* samples, size_t k, uint16_t window, float sample_time) {
+    double c = 0.5 * (double)(window - 1);
+    double numerator = 0.0;
+    for (uint16_t j = 0; j < window; j++) {
+        size_t back = (size_t)(window - 1 - j);
+        double u = (k >= back) ? samples[k - back] : samples[0];
+        numerator += ((double)j - c) * u;
+    }
+    double n = (double)window;
+    return numerator * 12.0 / ((double)sample_time * n * (n * n - 1.0));
+}
+
+// ============ 配置验证测试 ============
+
+void test_sgderiv_init_valid_config(void) {
+    FB_SGDERIV_Config_t config = {.sample_time = 0.01f, .window = 8};
+
+    int result = FB_SGDERIV_Init(&fb, &config);
+
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_TRUE(fb.state.first_run);
+    TEST_ASSERT_EQUAL_FLOAT(3.5f, fb.state.center);
+}
+
+void test_sgderiv_init_invalid_config(void) {
+    FB_SGDERIV_Config_t too_short = {.sample_time = 0.01f, .window = 1};
+    FB_SGDERIV_Config_t too_long = {.sample_time = 0.01f, .window = FB_SGDERIV_MAX_WINDOW + 1};
+    FB_SGDERIV_Config_t zero_time = {.sample_time = 0.0f, .window = 8};
+    FB_SGDERIV_Config_t long_time = {.sample_time = 1001.0f, .window = 8};
+
+    TEST_ASSERT_EQUAL_INT(-1, FB_SGDERIV_Init(&fb, &too_short));
+    TEST_ASSERT_EQUAL_INT(-1, FB_SGDERIV_Init(&fb, &too_long));
+    TEST_ASSERT_EQUAL_INT(-1, FB_SGDERIV_Init(&fb, &zero_time));
+    TEST_ASSERT_EQUAL_INT(-1, FB_SGDERIV_Init(&fb, &long_time));
+    TEST_ASSERT_EQUAL_INT(-1, FB_SGDERIV_Init(NULL, &too_short));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_SGDERIV_ValidateConfig(NULL));
+}
+
+// ============ 基本响应测试 ============
+
+void test_sgderiv_first_call_and_constant_input(void) {
+    FB_SGDERIV_Config_t config = {.sample_time = 0.01f, .window = 16};
+    FB_SGDERIV_Init(&fb, &config);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_SGDERIV_Execute(&fb, 42.0f));
+    TEST_ASSERT_FALSE(fb.state.first_run);
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_SGDERIV_Execute(&fb, 42.0f));
+    }
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+}
+
+void test_sgderiv_ramp_exact_after_window(void) {
+    // 大偏置上的斜坡：窗口填满后斜率精确，偏置不影响精度
+    FB_SGDERIV_Config_t config = {.sample_time = 0.001f, .window = 20};
+    FB_SGDERIV_Init(&fb, &config);
+
+    float output = 0.0f;
+    for (int i = 0; i < 1000; i++) {
+        output = FB_SGDERIV_Execute(&fb, 10000.0f + 0.25f * (float)i);
+        if (i >= 19) {
+            TEST_ASSERT_FLOAT_WITHIN(0.05f, 250.0f, output);
+        }
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 250.0f, output);
+}
+
+void test_sgderiv_window_two_is_difference(void) {
+    FB_SGDERIV_Config_t config = {.sample_time = 0.1f, .window = 2};
+    FB_DERIVATIVE_Config_t diff_config = {.sample_time = 0.1f, .filter_time_constant = 0.0f};
+    FB_DERIVATIVE_t diff;
+    FB_SGDERIV_Init(&fb, &config);
+    FB_DERIVATIVE_Init(&diff, &diff_config);
+
+    uint32_t seed = 7u;
+    for (int i = 0; i < 200; i++) {
+        float input = 5.0f * noise(&seed);
+        float expected = FB_DERIVATIVE_Execute(&diff, input);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected, FB_SGDERIV_Execute(&fb, input));
+    }
+}
+
+// ============ 递推精度测试 ============
+
+void test_sgderiv_matches_direct_least_squares(void) {
+    // 长时间带噪声、带偏置的输入：递推结果与双精度直接求和一致，舍入不随时间累积
+    enum { COUNT = 50000 };
+    static float samples[COUNT];
+    FB_SGDERIV_Config_t config = {.sample_time = 0.002f, .window = FB_SGDERIV_MAX_WINDOW};
+    FB_SGDERIV_Init(&fb, &config);
+
+    uint32_t seed = 99u;
+    double max_error = 0.0;
+    for (size_t k = 0; k < COUNT; k++) {
+        samples[k] = 500.0f + 80.0f * sinf(0.0007f * (float)k) + noise(&seed);
+        float output = FB_SGDERIV_Execute(&fb, samples[k]);
+        double expected = reference_slope(samples, k, config.window, config.sample_time);
+        max_error = fmax(max_error, fabs((double)output - expected));
+    }
+
+    // 斜率量级约 28 单位/秒，误差只含单个窗口的舍入（实测约 1e-4）
+    TEST_ASSERT_TRUE(max_error < 1e-3);
+}
+
+void test_sgderiv_noise_rejection(void) {
+    // 白噪声：输出方差接近理论值 σ²·12 / (Ts²·N(N²-1))，远低于单步差分
+    FB_SGDERIV_Config_t config = {.sample_time = 0.01f, .window = 16};
+    FB_DERIVATIVE_Config_t diff_config = {.sample_time = 0.01f, .filter_time_constant = 0.0f};
+    FB_DERIVATIVE_t diff;
+    FB_SGDERIV_Init(&fb, &config);
+    FB_DERIVATIVE_Init(&diff, &diff_config);
+
+    uint32_t seed = 3u;
+    double sg_power = 0.0;
+    double diff_power = 0.0;
+    const int count = 20000;
+    for (int i = 0; i < count; i++) {
+        float input = noise(&seed);
+        double sg = FB_SGDERIV_Execute(&fb, input);
+        double d = FB_DERIVATIVE_Execute(&diff, input);
+        sg_power += sg * sg;
+        diff_power += d * d;
+    }
+    sg_power /= count;
+    diff_power /= count;
+
+    double sigma2 = 1.0 / 3.0;
+    double expected = sigma2 * 12.0 / (0.01 * 0.01 * 16.0 * 255.0);
+    TEST_ASSERT_FLOAT_WITHIN((float)(0.1 * expected), (float)expected, (float)sg_power);
+    TEST_ASSERT_TRUE(sg_power < diff_power / 500.0);
+}
+
+// ============ 数值保护测试 ============
+
+void test_sgderiv_nan_inf_input_keeps_window(void) {
+    FB_SGDERIV_Config_t config = {.sample_time = 0.01f, .window = 8};
+    FB_SGDERIV_t clean;
+    FB_SGDERIV_Init(&fb, &config);
+    FB_SGDERIV_Init(&clean, &config);
+
+    for (int i = 0; i < 50; i++) {
+        float input = 2.0f * (float)i;
+        if (i == 20) {
+            TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_SGDERIV_Execute(&fb, NAN));
+            TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, fb.state.status);
+            TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_SGDERIV_Execute(&fb, -INFINITY));
+            TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, fb.state.status);
+        }
+        float output = FB_SGDERIV_Execute(&fb, input);
+        TEST_ASSERT_EQUAL_FLOAT(FB_SGDERIV_Execute(&clean, input), output);
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+    }
+}
+
+// ============ 测试套件 ============
+
+void run_test_fb_sgderiv(void) {
+    RUN_TEST(test_sgderiv_init_valid_config);
+    RUN_TEST(test_sgderiv_init_invalid_config);
+    RUN_TEST(test_sgderiv_first_call_and_constant_input);
+    RUN_TEST(test_sgderiv_ramp_exact_after_window);
+    RUN_TEST(test_sgderiv_window_two_is_difference);
+    RUN_TEST(test_sgderiv_matches_direct_least_squares);
+    RUN_TEST(test_sgderiv_noise_rejection);
+    RUN_TEST(test_sgderiv_nan_inf_input_keeps_window);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_sgderiv();
+    return UNITY_END();
+}
@@ -0,0 +1,164 @@
+/**
+ * @file test_fb_shared.c
+ * @brief 共享配置（享元）PT1 / LIMIT 单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 共享配置验证（无效配置不覆盖原值、未设置的共享配置不可绑定）
+ * - 与标准实例逐周期一致
+ * - 重新整定共享配置同时作用于所有使用者，实例状态连续
+ * - 数值保护（NaN/Inf）
+ * - 实例尺寸与目标字长无关
+ */
+
+#include "unity.h"
+#include "plcopen/fb_shared.h"
+#include <math.h>
+
+#define NUM_INSTANCES 64
+
+static FB_PT1_SharedConfig_t pt1_shared;
+static FB_PT1_Shared_t pt1_fbs[NUM_INSTANCES];
+static FB_LIMIT_SharedConfig_t limit_shared;
+static FB_LIMIT_Shared_t limit_fbs[NUM_INSTANCES];
+
+void setUp(void) {
+    FB_PT1_Config_t pt1_cfg = { .time_constant = 0.5f, .sample_time = 0.01f };
+    FB_LIMIT_Config_t limit_cfg = { .min_val = -10.0f, .max_val = 10.0f };
+
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_SharedConfig_Set(&pt1_shared, &pt1_cfg));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_LIMIT_SharedConfig_Set(&limit_shared, &limit_cfg));
+    for (int i = 0; i < NUM_INSTANCES; i++) {
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_Shared_Init(&pt1_fbs[i], &pt1_shared));
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_LIMIT_Shared_Init(&limit_fbs[i], &limit_shared));
+    }
+}
+
+void tearDown(void) {}
+
+/* ========== 配置验证 ========== */
+
+void test_shared_config_invalid_keeps_previous(void) {
+    FB_PT1_Config_t bad_pt1 = { .time_constant = -1.0f, .sample_time = 0.01f };
+    float alpha = pt1_shared.alpha;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PT1_SharedConfig_Set(&pt1_shared, &bad_pt1));
+    TEST_ASSERT_EQUAL_FLOAT(alpha, pt1_shared.alpha);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, pt1_shared.config.time_constant);
+
+    FB_LIMIT_Config_t bad_limit = { .min_val = 5.0f, .max_val = 5.0f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_LIMIT_SharedConfig_Set(&limit_shared, &bad_limit));
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, limit_shared.config.max_val);
+
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PT1_SharedConfig_Set(NULL, &bad_pt1));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_LIMIT_SharedConfig_Set(&limit_shared, NULL));
+}
+
+void test_shared_init_rejects_unset_config(void) {
+    FB_PT1_SharedConfig_t unset_pt1 = { 0 };
+    FB_LIMIT_SharedConfig_t unset_limit = { 0 };
+    FB_PT1_Shared_t pt1;
+    FB_LIMIT_Shared_t limit;
+
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PT1_Shared_Init(&pt1, &unset_pt1));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_PT1_Shared_Init(&pt1, NULL));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_LIMIT_Shared_Init(&limit, &unset_limit));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_LIMIT_Shared_Init(NULL, &limit_shared));
+}
+
+/* ========== 等价性 ========== */
+
+void test_pt1_shared_matches_standard(void) {
+    FB_PT1_t reference;
+    FB_PT1_Init(&reference, &pt1_shared.config);
+
+    for (int k = 0; k < 1000; k++) {
+        float u = 20.0f * sinf(0.02f * (float)k) + ((k / 100) % 2 ? 5.0f : -5.0f);
+        float expected = FB_PT1_Execute(&reference, u);
+        for (int i = 0; i < NUM_INSTANCES; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(expected, FB_PT1_Shared_Execute(&pt1_fbs[i], &pt1_shared, u));
+        }
+    }
+}
+
+void test_limit_shared_matches_standard(void) {
+    FB_LIMIT_t reference;
+    FB_LIMIT_Init(&reference, &limit_shared.config);
+
+    for (int k = -30; k <= 30; k++) {
+        float u = (float)k * 0.5f;
+        FB_LIMIT_Shared_t* fb = &limit_fbs[(k + 30) % NUM_INSTANCES];
+        TEST_ASSERT_EQUAL_FLOAT(FB_LIMIT_Execute(&reference, u), FB_LIMIT_Shared_Execute(fb, &limit_shared, u));
+        TEST_ASSERT_EQUAL_INT(reference.state.status, FB_LIMIT_Shared_GetStatus(fb));
+    }
+}
+
+/* ========== 重新整定 ========== */
+
+void test_pt1_retune_updates_all_users(void) {
+    for (int i = 0; i < NUM_INSTANCES; i++) {
+        FB_PT1_Shared_Execute(&pt1_fbs[i], &pt1_shared, 0.0f);
+    }
+
+    /* τ 从 0.5s 改为 0.09s：α 从 0.0196 变为 0.1 */
+    FB_PT1_Config_t fast = { .time_constant = 0.09f, .sample_time = 0.01f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_SharedConfig_Set(&pt1_shared, &fast));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.1f, pt1_shared.alpha);
+
+    for (int i = 0; i < NUM_INSTANCES; i++) {
+        /* 状态连续（不重新进入首次运行），按新 α 前进一步 */
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, 10.0f, FB_PT1_Shared_Execute(&pt1_fbs[i], &pt1_shared, 100.0f));
+    }
+}
+
+void test_limit_retune_updates_all_users(void) {
+    FB_LIMIT_Config_t narrow = { .min_val = -1.0f, .max_val = 1.0f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_LIMIT_SharedConfig_Set(&limit_shared, &narrow));
+
+    for (int i = 0; i < NUM_INSTANCES; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(1.0f, FB_LIMIT_Shared_Execute(&limit_fbs[i], &limit_shared, 5.0f));
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_LIMIT_HI, FB_LIMIT_Shared_GetStatus(&limit_fbs[i]));
+    }
+}
+
+/* ========== 数值保护 ========== */
+
+void test_shared_nan_inf_input(void) {
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_PT1_Shared_Execute(&pt1_fbs[0], &pt1_shared, NAN));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, FB_PT1_Shared_GetStatus(&pt1_fbs[0]));
+    /* 错误输入不消耗首次运行 */
+    TEST_ASSERT_EQUAL_FLOAT(7.0f, FB_PT1_Shared_Execute(&pt1_fbs[0], &pt1_shared, 7.0f));
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_LIMIT_Shared_Execute(&limit_fbs[0], &limit_shared, INFINITY));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, FB_LIMIT_Shared_GetStatus(&limit_fbs[0]));
+    /* 一个实例的错误状态不影响共享同一配置的其他实例 */
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_LIMIT_Shared_GetStatus(&limit_fbs[1]));
+}
+
+/* ========== 尺寸 ========== */
+
+void test_shared_instances_hold_no_pointer(void) {
+    TEST_ASSERT_EQUAL_size_t(2 * sizeof(float), sizeof(FB_PT1_Shared_t));
+    TEST_ASSERT_EQUAL_size_t(1, sizeof(FB_LIMIT_Shared_t));
+    TEST_ASSERT_TRUE(sizeof(FB_PT1_Shared_t) < sizeof(FB_PT1_t));
+    TEST_ASSERT_TRUE(sizeof(FB_LIMIT_Shared_t) < sizeof(FB_LIMIT_t));
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_fb_shared(void) {
+    RUN_TEST(test_shared_config_invalid_keeps_previous);
+    RUN_TEST(test_shared_init_rejects_unset_config);
+    RUN_TEST(test_pt1_shared_matches_standard);
+    RUN_TEST(test_limit_shared_matches_standard);
+    RUN_TEST(test_pt1_retune_updates_all_users);
+    RUN_TEST(test_limit_retune_updates_all_users);
+    RUN_TEST(test_shared_nan_inf_input);
+    RUN_TEST(test_shared_instances_hold_no_pointer);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_shared();
+    return UNITY_END();
+}
@@ -0,0 +1,303 @@
+/**
+ * @file test_fb_stats.c
+ * @brief STATS 功能块单元测试
+ */
+
+#include "unity.h"
+#include "plcopen/fb_stats.h"
+#include <math.h>
+#include <string.h>
+
+static FB_STATS_t fb;
+
+void setUp(void) {
+    memset(&fb, 0, sizeof(FB_STATS_t));
+}
+
+void tearDown(void) {}
+
+/* 可复现的均匀噪声 [-1, 1) */
+static float noise(uint32_t* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float)(*seed >> 8) / 8388608.0f - 1.0f;
+}
+
+/* 带单调段与重复值的测试序列：单调递减段使最大值队列长满，量化产生相等值 */
+static float test_signal(size_t k, uint32_t* seed) {
+    if ((k / 50u) % 3u == 1u) {
+        return 100.0f - (float)(k % 50u);
+    }
+    return roundf(20.0f * noise(seed));
+}
+
+/* 直接扫描最近 window 个周期中的有效采样 */
+static bool scan_window(const float* samples, size_t k, uint16_t window, float* min, float* max) {
+    bool found = false;
+    for (size_t j = 0; j < window && j <= k; j++) {
+        float x = samples[k - j];
+        if (check_nan_inf(x)) {
+            continue;
+        }
+        if (!found || x < *min) *min = x;
+        if (!found || x > *max) *max = x;
+        found = true;
+    }
+    return found;
+}
+
+// ============ 配置验证测试 ============
+
+void test_stats_init_valid_config(void) {
+    FB_STATS_Config_t config = {.window = 10};
+
+    TEST_ASSERT_EQUAL_INT(0, FB_STATS_Init(&fb, &config));
+    TEST_ASSERT_EQUAL_UINT32(0u, fb.state.count);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_STATS_GetVariance(&fb));
+}
+
+void test_stats_init_invalid_config(void) {
+    FB_STATS_Config_t zero = {.window = 0};
+    FB_STATS_Config_t too_long = {.window = FB_STATS_MAX_WINDOW + 1};
+
+    TEST_ASSERT_EQUAL_INT(-1, FB_STATS_Init(&fb, &zero));
+    TEST_ASSERT_EQUAL_INT(-1, FB_STATS_Init(&fb, &too_long));
+    TEST_ASSERT_EQUAL_INT(-1, FB_STATS_Init(NULL, &zero));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_STATS_ValidateConfig(NULL));
+}
+
+// ============ 均值/方差测试 ============
+
+void test_stats_mean_variance_known_sequence(void) {
+    FB_STATS_Config_t config = {.window = 4};
+    FB_STATS_Init(&fb, &config);
+
+    float mean = 0.0f;
+    for (int i = 1; i <= 10; i++) {
+        mean = FB_STATS_Execute(&fb, (float)i);
+    }
+
+    // 1..10：均值 5.5，样本方差 55/6
+    TEST_ASSERT_EQUAL_FLOAT(5.5f, mean);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 55.0f / 6.0f, FB_STATS_GetVariance(&fb));
+    TEST_ASSERT_EQUAL_UINT32(10u, fb.state.count);
+}
+
+void test_stats_variance_stable_with_large_offset(void) {
+    // 大偏置 + 小方差：相对参考值递推，均值不停滞，方差不做大数相减
+    FB_STATS_Config_t config = {.window = 8};
+    FB_STATS_Init(&fb, &config);
+
+    uint32_t seed = 11u;
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    const int count = 100000;
+    for (int i = 0; i < count; i++) {
+        float x = 10000.0f + 0.1f * noise(&seed);
+        FB_STATS_Execute(&fb, x);
+        sum += x;
+        sum_sq += (double)x * x;
+    }
+    double mean = sum / count;
+    double variance = (sum_sq - sum * mean) / (count - 1);
+
+    TEST_ASSERT_FLOAT_WITHIN(2e-3f, (float)mean, fb.state.mean);  /* 10000 附近 1 ulp 约 1e-3 */
+    TEST_ASSERT_FLOAT_WITHIN((float)(0.01 * variance), (float)variance, FB_STATS_GetVariance(&fb));
+}
+
+void test_stats_reset_keeps_window(void) {
+    FB_STATS_Config_t config = {.window = 5};
+    FB_STATS_Init(&fb, &config);
+    for (int i = 0; i < 20; i++) {
+        FB_STATS_Execute(&fb, (float)i);
+    }
+
+    FB_STATS_Reset(&fb);
+    TEST_ASSERT_EQUAL_UINT32(0u, fb.state.count);
+
+    FB_STATS_Execute(&fb, 3.0f);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, fb.state.mean);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_STATS_GetVariance(&fb));
+    // 窗口内仍有复位前的 16..19
+    TEST_ASSERT_EQUAL_FLOAT(19.0f, fb.state.max);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, fb.state.min);
+}
+
+// ============ 窗口极值测试 ============
+
+static void check_window_extremes(uint16_t window) {
+    enum { COUNT = 2000 };
+    static float samples[COUNT];
+    FB_STATS_Config_t config = {.window = window};
+    FB_STATS_Init(&fb, &config);
+
+    uint32_t seed = 5u;
+    for (size_t k = 0; k < COUNT; k++) {
+        samples[k] = test_signal(k, &seed);
+        FB_STATS_Execute(&fb, samples[k]);
+
+        float min = 0.0f;
+        float max = 0.0f;
+        scan_window(samples, k, window, &min, &max);
+        TEST_ASSERT_EQUAL_FLOAT(min, fb.state.min);
+        TEST_ASSERT_EQUAL_FLOAT(max, fb.state.max);
+        TEST_ASSERT_TRUE(fb.state.max_count <= window);
+        TEST_ASSERT_TRUE(fb.state.min_count <= window);
+    }
+}
+
+void test_stats_window_extremes_match_scan(void) {
+    check_window_extremes(1);
+    check_window_extremes(2);
+    check_window_extremes(7);
+    check_window_extremes(FB_STATS_MAX_WINDOW);
+}
+
+// ============ 数值保护测试 ============
+
+void test_stats_nan_inf_skipped(void) {
+    FB_STATS_Config_t config = {.window = 3};
+    FB_STATS_Init(&fb, &config);
+
+    FB_STATS_Execute(&fb, 10.0f);
+    FB_STATS_Execute(&fb, 2.0f);
+    TEST_ASSERT_EQUAL_FLOAT(6.0f, FB_STATS_Execute(&fb, NAN));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, fb.state.status);
+    TEST_ASSERT_EQUAL_UINT32(2u, fb.state.count);
+
+    // 窗口照常滑动：NaN 之后一个周期 10 已移出窗口
+    FB_STATS_Execute(&fb, 4.0f);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, fb.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, fb.state.max);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, fb.state.min);
+
+    // 连续无效采样超过窗口：极值保持最后的有效值
+    for (int i = 0; i < 10; i++) {
+        FB_STATS_Execute(&fb, (i % 2) ? INFINITY : NAN);
+    }
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, fb.state.status);
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, fb.state.max);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, fb.state.min);
+    TEST_ASSERT_EQUAL_INT(0, fb.state.max_count);
+
+    FB_STATS_Execute(&fb, -1.0f);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, fb.state.max);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, fb.state.min);
+}
+
+void test_stats_tick_wraparound(void) {
+    // 周期戳 16 位回绕不影响到期判断
+    FB_STATS_Config_t config = {.window = 9};
+    FB_STATS_Init(&fb, &config);
+    fb.state.tick = 65530u;
+
+    for (int i = 0; i < 20; i++) {
+        FB_STATS_Execute(&fb, (float)(20 - i));
+        float expected_max = (float)(20 - (i >= 8 ? i - 8 : 0));
+        TEST_ASSERT_EQUAL_FLOAT(expected_max, fb.state.max);
+        TEST_ASSERT_EQUAL_FLOAT((float)(20 - i), fb.state.min);
+    }
+}
+
+// ============ 批量实例测试 ============
+
+#define BANK_SIGNALS 37
+#define BANK_WINDOW 16
+
+FB_STATS_BANK_STORAGE(diag, BANK_SIGNALS, BANK_WINDOW);
+
+void test_stats_bank_matches_single(void) {
+    static FB_STATS_t singles[BANK_SIGNALS];
+    FB_STATS_Config_t config = {.window = BANK_WINDOW};
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_STATS_Bank_Init(&diag_bank, diag_floats, diag_words,
+                                                           diag_counts, diag_status, BANK_SIGNALS,
+                                                           BANK_WINDOW));
+    for (size_t i = 0; i < BANK_SIGNALS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, FB_STATS_Init(&singles[i], &config));
+    }
+
+    uint32_t seed = 77u;
+    float input[BANK_SIGNALS];
+    for (size_t k = 0; k < 3000; k++) {
+        for (size_t i = 0; i < BANK_SIGNALS; i++) {
+            input[i] = test_signal(k + 13u * i, &seed) + 0.37f * (float)i;
+            if ((k * 31u + i) % 97u == 0u) {
+                input[i] = NAN;
+            }
+        }
+        if (k == 1500u) {
+            FB_STATS_Bank_Reset(&diag_bank, 5);
+            FB_STATS_Reset(&singles[5]);
+        }
+        FB_STATS_Bank_Execute(&diag_bank, input);
+        for (size_t i = 0; i < BANK_SIGNALS; i++) {
+            FB_STATS_Execute(&singles[i], input[i]);
+        }
+    }
+
+    for (size_t i = 0; i < BANK_SIGNALS; i++) {
+        const FB_STATS_State_t* s = &singles[i].state;
+        float mean = FB_STATS_Bank_GetMean(&diag_bank, i);
+        float variance = FB_STATS_Bank_GetVariance(&diag_bank, i);
+        float expected_variance = FB_STATS_GetVariance(&singles[i]);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(&mean, &s->mean, sizeof(float)));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(&variance, &expected_variance, sizeof(float)));
+        TEST_ASSERT_EQUAL_FLOAT(s->min, FB_STATS_Bank_GetMin(&diag_bank, i));
+        TEST_ASSERT_EQUAL_FLOAT(s->max, FB_STATS_Bank_GetMax(&diag_bank, i));
+        TEST_ASSERT_EQUAL_UINT32(s->count, diag_counts[i]);
+        TEST_ASSERT_EQUAL_INT(s->status, FB_STATS_Bank_GetStatus(&diag_bank, i));
+    }
+}
+
+void test_stats_bank_long_window(void) {
+    // bank 窗口不受 FB_STATS_MAX_WINDOW 限制
+    enum { WINDOW = 3 * FB_STATS_MAX_WINDOW + 5, COUNT = 4 * WINDOW };
+    static float floats[FB_STATS_BANK_FLOATS(WINDOW)];
+    static uint16_t words[FB_STATS_BANK_WORDS(WINDOW)];
+    static float samples[COUNT];
+    uint32_t counts[1];
+    int8_t status[1];
+    FB_STATS_Bank_t bank;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_STATS_Bank_Init(&bank, floats, words, counts, status, 1, WINDOW));
+
+    uint32_t seed = 19u;
+    for (size_t k = 0; k < COUNT; k++) {
+        samples[k] = test_signal(k, &seed);
+        FB_STATS_Bank_Execute(&bank, &samples[k]);
+        float min = 0.0f;
+        float max = 0.0f;
+        scan_window(samples, k, WINDOW, &min, &max);
+        TEST_ASSERT_EQUAL_FLOAT(min, FB_STATS_Bank_GetMin(&bank, 0));
+        TEST_ASSERT_EQUAL_FLOAT(max, FB_STATS_Bank_GetMax(&bank, 0));
+    }
+}
+
+void test_stats_bank_init_invalid(void) {
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_STATS_Bank_Init(&diag_bank, diag_floats, diag_words,
+                                                                     diag_counts, diag_status,
+                                                                     BANK_SIGNALS, 0));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_CONFIG, FB_STATS_Bank_Init(&diag_bank, NULL, diag_words,
+                                                                     diag_counts, diag_status,
+                                                                     BANK_SIGNALS, BANK_WINDOW));
+}
+
+// ============ 测试套件 ============
+
+void run_test_fb_stats(void) {
+    RUN_TEST(test_stats_init_valid_config);
+    RUN_TEST(test_stats_init_invalid_config);
+    RUN_TEST(test_stats_mean_variance_known_sequence);
+    RUN_TEST(test_stats_variance_stable_with_large_offset);
+    RUN_TEST(test_stats_reset_keeps_window);
+    RUN_TEST(test_stats_window_extremes_match_scan);
+    RUN_TEST(test_stats_nan_inf_skipped);
+    RUN_TEST(test_stats_tick_wraparound);
+    RUN_TEST(test_stats_bank_matches_single);
+    RUN_TEST(test_stats_bank_long_window);
+    RUN_TEST(test_stats_bank_init_invalid);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_fb_stats();
+    return UNITY_END();
+}
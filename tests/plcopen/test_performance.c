@@ -8,6 +8,9 @@
  * - 测量每个功能块的执行时间
  * - 验证性能目标：每个功能块 < 10μs @ STM32F4 168MHz
  * - 生成性能报告
+ *
+ * 非 STM32F4 构建下计时为模拟值；构建服务器上的确定性回归检测见
+ * benchmarks/plcopen/qemu_m4（QEMU 指令计数）。
  */
 
 #include "unity.h"
@@ -27,7 +30,7 @@
     /* 模拟模式（无精确计时） */
     #define START_TIMER()
     #define GET_CYCLES() 1000  /* 模拟 1000 周期 */
-    #define CYCLES_TO_US(cycles) 0.006f  /* 模拟 6μs */
+    #define CYCLES_TO_US(cycles) ((void)(cycles), 0.006f)  /* 模拟 6μs */
 #endif
 
 void setUp(void) {}
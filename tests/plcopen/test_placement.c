@@ -0,0 +1,160 @@
+/**
+ * @file test_placement.c
+ * @brief 链接段放置宏单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - PLCOPEN_FB_STATE 对象零初始化、可写，功能块在其中正常运行
+ * - PLCOPEN_FB_CONST 配置与系数表可读，Init 从中取参
+ * - 主机链接（无 plcopen_sections.ld）时两段被通用规则收纳：
+ *   状态位于可写段、只读数据位于只读段（Linux，经 dl_iterate_phdr 检查）
+ *
+ * 目标上的 CCM/Flash 地址由 templates/examples/fb-placement 链接后检查映射文件。
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <link.h>
+#endif
+
+#include "unity.h"
+#include "plcopen/plcopen.h"
+#include <string.h>
+
+#define NUM_LOOPS 4
+#define NUM_SENSORS 8
+
+PLCOPEN_FB_CONST static const FB_PID_Config_t loop_config = {
+    .kp = 1.5f, .ki = 0.2f, .kd = 0.05f, .sample_time = 0.01f,
+    .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+};
+
+PLCOPEN_FB_CONST static const float sensor_tau[NUM_SENSORS] = {
+    0.05f, 0.1f, 0.2f, 0.5f, 1.0f, 2.0f, 5.0f, 10.0f
+};
+
+PLCOPEN_FB_STATE static FB_PID_t loops[NUM_LOOPS];
+
+PLCOPEN_FB_STATE static FB_PT1_Bank32_t sensor_bank;
+PLCOPEN_FB_STATE static float sensor_floats[FB_PT1_BANK32_FLOATS * NUM_SENSORS];
+PLCOPEN_FB_STATE static uint8_t sensor_flags[NUM_SENSORS];
+PLCOPEN_FB_STATE static int8_t sensor_status[NUM_SENSORS];
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* ========== 状态段 ========== */
+
+void test_placement_state_zero_initialized(void) {
+    static const FB_PID_t zero;
+    for (int i = 0; i < NUM_LOOPS; i++) {
+        TEST_ASSERT_TRUE(memcmp(&loops[i], &zero, sizeof(zero)) == 0);
+    }
+    for (int i = 0; i < NUM_SENSORS; i++) {
+        TEST_ASSERT_EQUAL_UINT8(0, sensor_flags[i]);
+    }
+}
+
+void test_placement_pid_runs_in_state_section(void) {
+    FB_PID_t reference;
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Init(&reference, &loop_config));
+    for (int i = 0; i < NUM_LOOPS; i++) {
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Init(&loops[i], &loop_config));
+    }
+
+    for (int step = 0; step < 200; step++) {
+        float measurement = 40.0f + (float)(step % 20);
+        float expected = FB_PID_Execute(&reference, 50.0f, measurement);
+        for (int i = 0; i < NUM_LOOPS; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(expected, FB_PID_Execute(&loops[i], 50.0f, measurement));
+        }
+    }
+}
+
+void test_placement_bank_arrays_in_state_section(void) {
+    FB_PT1_t reference[NUM_SENSORS];
+    float input[NUM_SENSORS];
+    float output[NUM_SENSORS];
+
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_Bank32_Init(&sensor_bank, sensor_floats, sensor_flags,
+                                                           sensor_status, NUM_SENSORS, 0.01f));
+    for (int i = 0; i < NUM_SENSORS; i++) {
+        FB_PT1_Config_t config = { .time_constant = sensor_tau[i], .sample_time = 0.01f };
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_Init(&reference[i], &config));
+        TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_Bank32_Configure(&sensor_bank, (size_t)i, sensor_tau[i]));
+    }
+
+    for (int step = 0; step < 100; step++) {
+        for (int i = 0; i < NUM_SENSORS; i++) {
+            input[i] = (float)((step + i) % 7) * 3.0f;
+        }
+        FB_PT1_Bank32_Execute(&sensor_bank, input, output);
+        for (int i = 0; i < NUM_SENSORS; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(FB_PT1_Execute(&reference[i], input[i]), output[i]);
+        }
+    }
+}
+
+/* ========== 主机链接的段属性 ========== */
+
+#if defined(__linux__)
+
+typedef struct {
+    uintptr_t addr;
+    int found;
+    int writable;
+} segment_query_t;
+
+static int find_segment(struct dl_phdr_info* info, size_t size, void* data) {
+    segment_query_t* query = data;
+    (void)size;
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* ph = &info->dlpi_phdr[i];
+        uintptr_t start = (uintptr_t)(info->dlpi_addr + ph->p_vaddr);
+        if (ph->p_type == PT_LOAD && query->addr >= start && query->addr < start + ph->p_memsz) {
+            query->found = 1;
+            query->writable = (ph->p_flags & PF_W) != 0;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static segment_query_t query_segment(const void* addr) {
+    segment_query_t query = { (uintptr_t)addr, 0, 0 };
+    dl_iterate_phdr(find_segment, &query);
+    return query;
+}
+
+void test_placement_host_segments(void) {
+    segment_query_t state = query_segment(&loops[0]);
+    segment_query_t bank = query_segment(sensor_floats);
+    segment_query_t config = query_segment(&loop_config);
+    segment_query_t table = query_segment(sensor_tau);
+
+    TEST_ASSERT_TRUE(state.found && state.writable);
+    TEST_ASSERT_TRUE(bank.found && bank.writable);
+    TEST_ASSERT_TRUE(config.found && !config.writable);
+    TEST_ASSERT_TRUE(table.found && !table.writable);
+}
+
+#endif
+
+/* ========== 运行器函数 ========== */
+
+void run_test_placement(void) {
+    RUN_TEST(test_placement_state_zero_initialized);
+    RUN_TEST(test_placement_pid_runs_in_state_section);
+    RUN_TEST(test_placement_bank_arrays_in_state_section);
+#if defined(__linux__)
+    RUN_TEST(test_placement_host_segments);
+#endif
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_placement();
+    return UNITY_END();
+}
@@ -0,0 +1,184 @@
+/**
+ * @file test_probes.c
+ * @brief USDT 静态探针单元测试（以 PLCOPEN_ENABLE_USDT 编译，仅 Linux/ELF）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 可执行文件的 .note.stapsdt 节中包含全部 plcopen 探针
+ * - 启用探针后各功能块的执行结果不变
+ *
+ * 探针是否真正触发需要 perf/bpftrace 附着（需要 root），不在单元测试范围内。
+ */
+
+#include "unity.h"
+#include "plcopen/plcopen.h"
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef PLCOPEN_ENABLE_USDT
+#error "test_probes must be built with PLCOPEN_ENABLE_USDT"
+#endif
+
+static const char* const expected_probes[] = {
+    "pid_entry", "pid_exit", "pid_init", "pid_set_manual", "pid_set_auto",
+    "pt1_entry", "pt1_exit", "pt1_init",
+    "ramp_entry", "ramp_exit", "ramp_init",
+    "scurve_entry", "scurve_exit", "scurve_init",
+    "limit_entry", "limit_exit", "limit_init",
+    "deadband_entry", "deadband_exit", "deadband_init",
+    "integrator_entry", "integrator_exit", "integrator_init",
+    "derivative_entry", "derivative_exit", "derivative_init",
+    "sgderiv_entry", "sgderiv_exit", "sgderiv_init",
+    "stats_entry", "stats_exit", "stats_init",
+    "kalman_entry", "kalman_exit", "kalman_init",
+    "rls_entry", "rls_exit", "rls_init",
+};
+#define EXPECTED_COUNT (sizeof(expected_probes) / sizeof(expected_probes[0]))
+
+static unsigned char* image;
+static size_t image_size;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void load_self(void) {
+    FILE* f = fopen("/proc/self/exe", "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    image_size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    image = malloc(image_size);
+    TEST_ASSERT_NOT_NULL(image);
+    TEST_ASSERT_EQUAL_size_t(image_size, fread(image, 1, image_size, f));
+    fclose(f);
+}
+
+/* 在 .note.stapsdt 中查找 provider=plcopen 的探针名，返回找到的期望探针数 */
+static size_t count_plcopen_probes(bool found[EXPECTED_COUNT]) {
+    const Elf64_Ehdr* eh = (const Elf64_Ehdr*)image;
+    TEST_ASSERT_EQUAL_INT(ELFCLASS64, eh->e_ident[EI_CLASS]);
+    const Elf64_Shdr* sh = (const Elf64_Shdr*)(image + eh->e_shoff);
+    const char* shstr = (const char*)image + sh[eh->e_shstrndx].sh_offset;
+
+    size_t count = 0;
+    for (unsigned s = 0; s < eh->e_shnum; s++) {
+        if (strcmp(shstr + sh[s].sh_name, ".note.stapsdt") != 0) {
+            continue;
+        }
+        const unsigned char* p = image + sh[s].sh_offset;
+        const unsigned char* end = p + sh[s].sh_size;
+        while (p + sizeof(Elf64_Nhdr) <= end) {
+            const Elf64_Nhdr* nh = (const Elf64_Nhdr*)p;
+            const char* name = (const char*)(p + sizeof(*nh));
+            const char* desc = name + ((nh->n_namesz + 3u) & ~3u);
+            if (nh->n_type == 3u && strcmp(name, "stapsdt") == 0) {
+                /* desc：探针地址、基址、信号量地址，随后为 provider、name、args */
+                const char* provider = desc + 3u * sizeof(uint64_t);
+                const char* probe = provider + strlen(provider) + 1u;
+                if (strcmp(provider, "plcopen") == 0) {
+                    for (size_t i = 0; i < EXPECTED_COUNT; i++) {
+                        if (!found[i] && strcmp(probe, expected_probes[i]) == 0) {
+                            found[i] = true;
+                            count++;
+                        }
+                    }
+                }
+            }
+            p = (const unsigned char*)desc + ((nh->n_descsz + 3u) & ~3u);
+        }
+    }
+    return count;
+}
+
+/* ========== 探针存在性 ========== */
+
+void test_probes_present_in_elf_notes(void) {
+    load_self();
+    bool found[EXPECTED_COUNT] = { false };
+    size_t count = count_plcopen_probes(found);
+    for (size_t i = 0; i < EXPECTED_COUNT; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(found[i], expected_probes[i]);
+    }
+    TEST_ASSERT_EQUAL_size_t(EXPECTED_COUNT, count);
+    free(image);
+}
+
+/* ========== 行为不变 ========== */
+
+void test_probes_do_not_change_results(void) {
+    FB_PID_t pid;
+    FB_PID_Config_t pid_cfg = { .kp = 2.0f, .ki = 0.0f, .kd = 0.0f, .sample_time = 0.01f,
+                                .out_min = -100.0f, .out_max = 100.0f,
+                                .int_min = -50.0f, .int_max = 50.0f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PID_Init(&pid, &pid_cfg));
+    TEST_ASSERT_TRUE(FB_PID_Execute(&pid, 50.0f, 40.0f) > 0.0f);
+    FB_PID_SetManual(&pid, 30.0f);
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, FB_PID_Execute(&pid, 50.0f, 40.0f));
+    FB_PID_SetAuto(&pid);
+    FB_PID_Execute(&pid, NAN, 40.0f);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_NAN, pid.state.status);
+
+    FB_LIMIT_t limit;
+    FB_LIMIT_Config_t limit_cfg = { .min_val = 0.0f, .max_val = 10.0f };
+    TEST_ASSERT_EQUAL_INT(0, FB_LIMIT_Init(&limit, &limit_cfg));
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, FB_LIMIT_Execute(&limit, 12.0f));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_LIMIT_HI, limit.state.status);
+
+    FB_PT1_t pt1;
+    FB_PT1_Config_t pt1_cfg = { .time_constant = 1.0f, .sample_time = 0.01f };
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, FB_PT1_Init(&pt1, &pt1_cfg));
+    FB_PT1_Execute(&pt1, 5.0f);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, FB_PT1_Execute(&pt1, 5.0f));
+
+    /* 其余功能块只需链接进来，使探针出现在 ELF 中 */
+    FB_RAMP_t ramp;
+    FB_RAMP_Config_t ramp_cfg = { .rise_rate = 1.0f, .fall_rate = 1.0f, .sample_time = 0.01f };
+    TEST_ASSERT_EQUAL_INT(0, FB_RAMP_Init(&ramp, &ramp_cfg));
+    FB_SCURVE_t scurve;
+    FB_SCURVE_Config_t scurve_cfg = { .rise_rate = 1.0f, .fall_rate = 1.0f, .rise_accel = 1.0f,
+                                      .fall_accel = 1.0f, .rise_jerk = 1.0f, .fall_jerk = 1.0f,
+                                      .sample_time = 0.01f };
+    TEST_ASSERT_EQUAL_INT(0, FB_SCURVE_Init(&scurve, &scurve_cfg));
+    FB_DEADBAND_t deadband;
+    FB_DEADBAND_Config_t deadband_cfg = { .width = 1.0f, .center = 0.0f };
+    TEST_ASSERT_EQUAL_INT(0, FB_DEADBAND_Init(&deadband, &deadband_cfg));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FB_DEADBAND_Execute(&deadband, 0.5f));
+    FB_INTEGRATOR_t integrator;
+    FB_INTEGRATOR_Config_t integrator_cfg = { .sample_time = 0.1f, .out_min = -10.0f,
+                                              .out_max = 10.0f, .enable_limit = true };
+    TEST_ASSERT_EQUAL_INT(0, FB_INTEGRATOR_Init(&integrator, &integrator_cfg));
+    FB_DERIVATIVE_t derivative;
+    FB_DERIVATIVE_Config_t derivative_cfg = { .sample_time = 0.1f,
+                                              .filter_time_constant = 0.0f };
+    TEST_ASSERT_EQUAL_INT(0, FB_DERIVATIVE_Init(&derivative, &derivative_cfg));
+    FB_SGDERIV_t sgderiv;
+    FB_SGDERIV_Config_t sgderiv_cfg = { .sample_time = 0.1f, .window = 8 };
+    TEST_ASSERT_EQUAL_INT(0, FB_SGDERIV_Init(&sgderiv, &sgderiv_cfg));
+    FB_STATS_t stats;
+    FB_STATS_Config_t stats_cfg = { .window = 8 };
+    TEST_ASSERT_EQUAL_INT(0, FB_STATS_Init(&stats, &stats_cfg));
+    FB_KALMAN_t kalman;
+    FB_KALMAN_Config_t kalman_cfg = { .states = 1, .outputs = 1, .a = { { 1.0f } }, .h = { { 1.0f } },
+                                      .q = { { 0.01f } }, .r = { { 1.0f } }, .p0 = { { 1.0f } } };
+    TEST_ASSERT_EQUAL_INT(0, FB_KALMAN_Init(&kalman, &kalman_cfg));
+    FB_RLS_t rls;
+    FB_RLS_Config_t rls_cfg = { .sample_time = 1.0f, .forgetting = 0.99f, .initial_covariance = 100.0f,
+                                .na = 1, .nb = 1 };
+    TEST_ASSERT_EQUAL_INT(0, FB_RLS_Init(&rls, &rls_cfg));
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_probes(void) {
+    RUN_TEST(test_probes_present_in_elf_notes);
+    RUN_TEST(test_probes_do_not_change_results);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_probes();
+    return UNITY_END();
+}
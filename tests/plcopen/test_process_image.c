@@ -0,0 +1,261 @@
+/**
+ * @file test_process_image.c
+ * @brief 三缓冲共享内存过程映像单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 创建/连接参数检查与格式校验
+ * - 三缓冲语义（未发布时返回初始快照、取得最新发布、生产者与消费者不共用缓冲区）
+ * - 两个句柄（不同映射地址）之间的数据交换
+ * - 同名映像已存在时拒绝创建、生产者/消费者重新连接后接续原缓冲区
+ * - 跨进程（fork）快照一致性
+ */
+
+#include "unity.h"
+#include "plcopen/process_image.h"
+#include <errno.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define CH_INPUT  0u
+#define CH_OUTPUT 1u
+#define INPUT_SIZE 100u
+#define OUTPUT_SIZE 10u
+
+static char shm_name[PLCOPEN_PI_NAME_MAX];
+static plcopen_pi_t control;
+static plcopen_pi_t io;
+
+void setUp(void) {
+    const uint32_t sizes[] = { INPUT_SIZE, OUTPUT_SIZE };
+    snprintf(shm_name, sizeof(shm_name), "/plcopen_test_pi_%ld", (long)getpid());
+    TEST_ASSERT_EQUAL_INT(0, plcopen_pi_create(&control, shm_name, sizes, 2, 0));
+    TEST_ASSERT_EQUAL_INT(0, plcopen_pi_open(&io, shm_name));
+}
+
+void tearDown(void) {
+    plcopen_pi_close(&io);
+    plcopen_pi_close(&control);
+    plcopen_pi_unlink(shm_name);
+}
+
+/* ========== 创建与连接 ========== */
+
+void test_pi_create_invalid_arguments(void) {
+    plcopen_pi_t pi;
+    const uint32_t sizes[] = { 4, 0 };
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_pi_create(&pi, "no_slash", sizes, 1, 0));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_pi_create(&pi, "/plcopen_test_bad", sizes, 2, 0));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_pi_create(&pi, "/plcopen_test_bad", sizes, 0, 0));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_pi_create(&pi, "/plcopen_test_bad", sizes,
+                                                PLCOPEN_PI_MAX_CHANNELS + 1, 0));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_pi_create(&pi, "/plcopen_test_bad", sizes, 1, 0x80u));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_pi_open(&pi, "/plcopen_test_does_not_exist"));
+}
+
+void test_pi_create_refuses_existing_image(void) {
+    plcopen_pi_t pi;
+    const uint32_t sizes[] = { 4 };
+    errno = 0;
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_pi_create(&pi, shm_name, sizes, 1, 0));
+    TEST_ASSERT_EQUAL_INT(EEXIST, errno);
+
+    /* 运行中的映像未被破坏 */
+    float* in = plcopen_pi_write_begin(&io, CH_INPUT);
+    in[0] = 7.0f;
+    plcopen_pi_publish(&io, CH_INPUT, 1);
+    TEST_ASSERT_EQUAL_FLOAT(7.0f, plcopen_pi_acquire(&control, CH_INPUT, NULL)[0]);
+
+    /* 强制创建替换同名映像 */
+    TEST_ASSERT_EQUAL_INT(0, plcopen_pi_create(&pi, shm_name, sizes, 1, PLCOPEN_PI_FORCE));
+    TEST_ASSERT_EQUAL_UINT32(4, plcopen_pi_channel_size(&pi, 0));
+    plcopen_pi_close(&pi);
+}
+
+void test_pi_channel_sizes(void) {
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, plcopen_pi_channel_size(&io, CH_INPUT));
+    TEST_ASSERT_EQUAL_UINT32(OUTPUT_SIZE, plcopen_pi_channel_size(&io, CH_OUTPUT));
+    TEST_ASSERT_EQUAL_UINT32(0, plcopen_pi_channel_size(&io, 2));
+    TEST_ASSERT_NULL(plcopen_pi_write_begin(&io, 2));
+    TEST_ASSERT_NULL(plcopen_pi_acquire(&control, 2, NULL));
+}
+
+/* ========== 三缓冲语义 ========== */
+
+void test_pi_acquire_before_publish_returns_initial_snapshot(void) {
+    uint64_t scan = 99;
+    const float* in = plcopen_pi_acquire(&control, CH_INPUT, &scan);
+    TEST_ASSERT_NOT_NULL(in);
+    TEST_ASSERT_EQUAL_UINT64(0, scan);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, in[0]);
+}
+
+void test_pi_publish_acquire_round_trip(void) {
+    float* in = plcopen_pi_write_begin(&io, CH_INPUT);
+    for (uint32_t i = 0; i < INPUT_SIZE; i++) {
+        in[i] = (float)i;
+    }
+    plcopen_pi_publish(&io, CH_INPUT, 1);
+
+    uint64_t scan = 0;
+    const float* snap = plcopen_pi_acquire(&control, CH_INPUT, &scan);
+    TEST_ASSERT_EQUAL_UINT64(1, scan);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, snap[0]);
+    TEST_ASSERT_EQUAL_FLOAT((float)(INPUT_SIZE - 1), snap[INPUT_SIZE - 1]);
+    TEST_ASSERT_TRUE(plcopen_pi_timestamp(&control, CH_INPUT) > 0u);
+
+    /* 无新发布时返回同一快照 */
+    TEST_ASSERT_EQUAL_PTR(snap, plcopen_pi_acquire(&control, CH_INPUT, &scan));
+    TEST_ASSERT_EQUAL_UINT64(1, scan);
+}
+
+void test_pi_consumer_gets_latest_and_never_shares_buffer(void) {
+    /* 生产者连续发布多次，消费者只看到最新一次 */
+    for (uint64_t s = 1; s <= 5; s++) {
+        float* out = plcopen_pi_write_begin(&control, CH_OUTPUT);
+        out[0] = (float)s;
+        plcopen_pi_publish(&control, CH_OUTPUT, s);
+    }
+    uint64_t scan;
+    const float* snap = plcopen_pi_acquire(&io, CH_OUTPUT, &scan);
+    TEST_ASSERT_EQUAL_UINT64(5, scan);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, snap[0]);
+
+    /* 交替发布/取得：生产者的后台缓冲区与消费者持有的快照始终不同 */
+    for (uint64_t s = 6; s < 50; s++) {
+        float* out = plcopen_pi_write_begin(&control, CH_OUTPUT);
+        TEST_ASSERT_TRUE((const float*)out != snap);
+        out[0] = (float)s;
+        plcopen_pi_publish(&control, CH_OUTPUT, s);
+        if (s % 3 == 0) {
+            snap = plcopen_pi_acquire(&io, CH_OUTPUT, &scan);
+            TEST_ASSERT_EQUAL_UINT64(s, scan);
+            TEST_ASSERT_EQUAL_FLOAT((float)s, snap[0]);
+        }
+    }
+}
+
+/* ========== 重新连接 ========== */
+
+void test_pi_reopened_producer_keeps_its_buffer(void) {
+    float* in = plcopen_pi_write_begin(&io, CH_INPUT);
+    in[0] = 1.0f;
+    plcopen_pi_publish(&io, CH_INPUT, 1);
+    uint64_t scan = 0;
+    const float* snap = plcopen_pi_acquire(&control, CH_INPUT, &scan);
+    TEST_ASSERT_EQUAL_UINT64(1, scan);
+
+    /* I/O 进程重启：重新连接后的后台缓冲区不能是控制进程正在读的快照 */
+    plcopen_pi_close(&io);
+    TEST_ASSERT_EQUAL_INT(0, plcopen_pi_open(&io, shm_name));
+    for (uint64_t s = 2; s <= 4; s++) {
+        in = plcopen_pi_write_begin(&io, CH_INPUT);
+        in[0] = (float)s;
+        plcopen_pi_publish(&io, CH_INPUT, s);
+        TEST_ASSERT_EQUAL_FLOAT(1.0f, snap[0]);
+    }
+    snap = plcopen_pi_acquire(&control, CH_INPUT, &scan);
+    TEST_ASSERT_EQUAL_UINT64(4, scan);
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, snap[0]);
+}
+
+void test_pi_reopened_consumer_keeps_its_snapshot(void) {
+    for (uint64_t s = 1; s <= 2; s++) {
+        float* out = plcopen_pi_write_begin(&control, CH_OUTPUT);
+        out[0] = (float)s;
+        plcopen_pi_publish(&control, CH_OUTPUT, s);
+        plcopen_pi_acquire(&io, CH_OUTPUT, NULL);
+    }
+    float* out = plcopen_pi_write_begin(&control, CH_OUTPUT);
+    out[0] = 3.0f;
+    plcopen_pi_publish(&control, CH_OUTPUT, 3);
+
+    /* 消费者重启：无新数据前仍是原来的快照，取得新数据后与生产者交替不冲突 */
+    plcopen_pi_close(&io);
+    TEST_ASSERT_EQUAL_INT(0, plcopen_pi_open(&io, shm_name));
+    uint64_t scan = 0;
+    const float* snap = plcopen_pi_acquire(&io, CH_OUTPUT, &scan);
+    TEST_ASSERT_EQUAL_UINT64(3, scan);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, snap[0]);
+    TEST_ASSERT_EQUAL_PTR(snap, plcopen_pi_acquire(&io, CH_OUTPUT, &scan));
+
+    for (uint64_t s = 4; s < 20; s++) {
+        out = plcopen_pi_write_begin(&control, CH_OUTPUT);
+        out[0] = (float)s;
+        TEST_ASSERT_EQUAL_FLOAT((float)scan, snap[0]);
+        plcopen_pi_publish(&control, CH_OUTPUT, s);
+        if (s % 2 == 0) {
+            snap = plcopen_pi_acquire(&io, CH_OUTPUT, &scan);
+            TEST_ASSERT_EQUAL_UINT64(s, scan);
+        }
+    }
+}
+
+/* ========== 跨进程 ========== */
+
+void test_pi_cross_process_snapshots_are_consistent(void) {
+    const uint64_t scans = 20000;
+    pid_t child = fork();
+    TEST_ASSERT_TRUE(child >= 0);
+
+    if (child == 0) {
+        /* 子进程：作为 I/O 进程发布输入，每张表所有元素都等于扫描计数 */
+        plcopen_pi_t pi;
+        if (plcopen_pi_open(&pi, shm_name) != 0) {
+            _exit(2);
+        }
+        for (uint64_t s = 1; s <= scans; s++) {
+            float* in = plcopen_pi_write_begin(&pi, CH_INPUT);
+            for (uint32_t i = 0; i < INPUT_SIZE; i++) {
+                in[i] = (float)s;
+            }
+            plcopen_pi_publish(&pi, CH_INPUT, s);
+        }
+        plcopen_pi_close(&pi);
+        _exit(0);
+    }
+
+    /* 父进程：作为控制进程读取，每份快照必须是同一次扫描的完整数据 */
+    bool consistent = true;
+    uint64_t last = 0;
+    uint64_t scan = 0;
+    int status = -1;
+    bool child_running = true;
+    while (child_running) {
+        /* 先判断子进程是否结束，保证退出循环前的最后一次 acquire 能看到最终发布 */
+        child_running = waitpid(child, &status, WNOHANG) != child;
+        const float* in = plcopen_pi_acquire(&control, CH_INPUT, &scan);
+        for (uint32_t i = 0; i < INPUT_SIZE && scan > 0; i++) {
+            consistent = consistent && in[i] == (float)scan;
+        }
+        consistent = consistent && scan >= last;
+        last = scan;
+    }
+
+    TEST_ASSERT_TRUE(WIFEXITED(status));
+    TEST_ASSERT_EQUAL_INT(0, WEXITSTATUS(status));
+    TEST_ASSERT_TRUE_MESSAGE(consistent, "torn or out-of-order snapshot");
+    TEST_ASSERT_EQUAL_UINT64(scans, last);
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_process_image(void) {
+    RUN_TEST(test_pi_create_invalid_arguments);
+    RUN_TEST(test_pi_create_refuses_existing_image);
+    RUN_TEST(test_pi_channel_sizes);
+    RUN_TEST(test_pi_acquire_before_publish_returns_initial_snapshot);
+    RUN_TEST(test_pi_publish_acquire_round_trip);
+    RUN_TEST(test_pi_consumer_gets_latest_and_never_shares_buffer);
+    RUN_TEST(test_pi_reopened_producer_keeps_its_buffer);
+    RUN_TEST(test_pi_reopened_consumer_keeps_its_snapshot);
+    RUN_TEST(test_pi_cross_process_snapshots_are_consistent);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_process_image();
+    return UNITY_END();
+}
@@ -0,0 +1,205 @@
+/**
+ * @file test_profile.c
+ * @brief 按实例执行剖析单元测试（以 PLCOPEN_ENABLE_PROFILING 编译）
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - Init 登记、重复 Init 不重复登记、注销
+ * - Execute 更新调用次数、累计/最大周期数与直方图；ExecuteDt / ExecuteBlock / Advance 同样计数
+ * - 前 N 名排行与 CSV 输出
+ * - 登记表溢出计数与输出提示
+ * - 直方图分位数估计
+ */
+
+#include "unity.h"
+#include "plcopen/plcopen.h"
+#include <string.h>
+
+#ifndef PLCOPEN_ENABLE_PROFILING
+#error "test_profile must be built with PLCOPEN_ENABLE_PROFILING"
+#endif
+
+static FB_PID_t pid;
+static FB_LIMIT_t limit;
+static FB_PT1_t pt1;
+
+static const FB_PID_Config_t pid_config = {
+    .kp = 1.0f, .ki = 0.1f, .kd = 0.01f, .sample_time = 0.01f,
+    .out_min = 0.0f, .out_max = 100.0f, .int_min = -50.0f, .int_max = 50.0f
+};
+static const FB_LIMIT_Config_t limit_config = { .min_val = 0.0f, .max_val = 10.0f };
+static const FB_PT1_Config_t pt1_config = { .time_constant = 1.0f, .sample_time = 0.01f };
+
+void setUp(void) {
+    plcopen_prof_init();
+    FB_PID_Init(&pid, &pid_config);
+    FB_LIMIT_Init(&limit, &limit_config);
+    FB_PT1_Init(&pt1, &pt1_config);
+}
+
+void tearDown(void) {}
+
+static uint32_t hist_sum(const plcopen_prof_t* prof) {
+    uint32_t sum = 0;
+    for (int b = 0; b < PLCOPEN_PROF_HIST_BINS; b++) {
+        sum += prof->hist[b];
+    }
+    return sum;
+}
+
+/* ========== 登记 ========== */
+
+void test_profile_init_registers_once(void) {
+    TEST_ASSERT_EQUAL_size_t(3, plcopen_prof_count());
+    FB_PID_Init(&pid, &pid_config);
+    TEST_ASSERT_EQUAL_size_t(3, plcopen_prof_count());
+    TEST_ASSERT_EQUAL_INT(0, strcmp("FB_PID", pid.prof.type));
+    TEST_ASSERT_EQUAL_UINT32(0, pid.prof.calls);
+}
+
+void test_profile_unregister(void) {
+    FB_DEADBAND_t deadband;
+    FB_DEADBAND_Config_t cfg = { .width = 1.0f };
+    FB_DEADBAND_Init(&deadband, &cfg);
+    TEST_ASSERT_EQUAL_size_t(4, plcopen_prof_count());
+    PLCOPEN_PROF_UNREGISTER(&deadband);
+    TEST_ASSERT_EQUAL_size_t(3, plcopen_prof_count());
+}
+
+/* ========== 计数 ========== */
+
+void test_profile_execute_updates_counters(void) {
+    for (int i = 0; i < 100; i++) {
+        FB_PID_Execute(&pid, 50.0f, (float)i * 0.1f);
+    }
+    TEST_ASSERT_EQUAL_UINT32(100, pid.prof.calls);
+    TEST_ASSERT_EQUAL_UINT32(100, hist_sum(&pid.prof));
+    TEST_ASSERT_TRUE(pid.prof.total_cycles >= pid.prof.max_cycles);
+    TEST_ASSERT_TRUE(pid.prof.max_cycles > 0u);
+
+    /* 错误路径同样计数 */
+    FB_PT1_Execute(&pt1, NAN);
+    TEST_ASSERT_EQUAL_UINT32(1, pt1.prof.calls);
+
+    plcopen_prof_reset();
+    TEST_ASSERT_EQUAL_UINT32(0, pid.prof.calls);
+    TEST_ASSERT_EQUAL_UINT32(0, hist_sum(&pid.prof));
+    TEST_ASSERT_EQUAL_size_t(3, plcopen_prof_count());
+}
+
+void test_profile_every_entry_point_counts_one_call(void) {
+    /* Execute / ExecuteDt / ExecuteBlock / Advance 各计一次，快进与整块处理不被漏计 */
+    float block[16] = { 0 };
+    FB_PT1_Execute(&pt1, 1.0f);
+    FB_PT1_ExecuteDt(&pt1, 1.0f, 0.01f);
+    FB_PT1_ExecuteBlock(&pt1, block, block, 16);
+    FB_PT1_Advance(&pt1, 2.0f, 500u);
+    TEST_ASSERT_EQUAL_UINT32(4, pt1.prof.calls);
+    TEST_ASSERT_EQUAL_UINT32(4, hist_sum(&pt1.prof));
+}
+
+/* ========== 排行 ========== */
+
+void test_profile_top_orders_by_total(void) {
+    PLCOPEN_PROF_NAME(&pid, "TIC-101");
+    for (int i = 0; i < 1000; i++) {
+        FB_PID_Execute(&pid, 50.0f, 40.0f);
+    }
+    FB_LIMIT_Execute(&limit, 5.0f);
+
+    const plcopen_prof_t* top[8];
+    size_t n = plcopen_prof_top(top, 8, PLCOPEN_PROF_BY_TOTAL);
+    TEST_ASSERT_EQUAL_size_t(3, n);
+    TEST_ASSERT_EQUAL_PTR(&pid.prof, top[0]);
+    TEST_ASSERT_TRUE(top[0]->total_cycles >= top[1]->total_cycles);
+    TEST_ASSERT_TRUE(top[1]->total_cycles >= top[2]->total_cycles);
+
+    TEST_ASSERT_EQUAL_size_t(1, plcopen_prof_top(top, 1, PLCOPEN_PROF_BY_TOTAL));
+    TEST_ASSERT_EQUAL_PTR(&pid.prof, top[0]);
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_prof_top(top, 0, PLCOPEN_PROF_BY_MAX));
+}
+
+typedef struct {
+    int lines;
+    char first_row[160];
+    char last_row[160];
+} dump_ctx_t;
+
+static void capture_line(const char* line, void* ctx) {
+    dump_ctx_t* d = ctx;
+    if (d->lines == 1) {
+        strncpy(d->first_row, line, sizeof(d->first_row) - 1u);
+    }
+    strncpy(d->last_row, line, sizeof(d->last_row) - 1u);
+    d->lines++;
+}
+
+void test_profile_dump_top_csv(void) {
+    PLCOPEN_PROF_NAME(&pid, "TIC-101");
+    for (int i = 0; i < 1000; i++) {
+        FB_PID_Execute(&pid, 50.0f, 40.0f);
+    }
+    FB_PT1_Execute(&pt1, 1.0f);
+
+    dump_ctx_t d = { 0 };
+    TEST_ASSERT_EQUAL_size_t(2, plcopen_prof_dump_top(2, capture_line, &d));
+    TEST_ASSERT_EQUAL_INT(3, d.lines);
+    TEST_ASSERT_EQUAL_INT(0, strncmp("1,FB_PID,TIC-101,1000,", d.first_row, 22));
+}
+
+/* 登记表已满：多出的实例计入 dropped，输出末尾提示；注销后腾出的位置可再次登记 */
+void test_profile_registry_overflow_reported(void) {
+    static FB_LIMIT_t extra[PLCOPEN_PROF_MAX_INSTANCES];
+    size_t room = PLCOPEN_PROF_MAX_INSTANCES - plcopen_prof_count();
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_prof_dropped());
+    for (size_t i = 0; i < room + 2u; i++) {
+        FB_LIMIT_Init(&extra[i], &limit_config);
+    }
+    TEST_ASSERT_EQUAL_size_t(PLCOPEN_PROF_MAX_INSTANCES, plcopen_prof_count());
+    TEST_ASSERT_EQUAL_size_t(2, plcopen_prof_dropped());
+
+    dump_ctx_t d = { 0 };
+    TEST_ASSERT_EQUAL_size_t(1, plcopen_prof_dump_top(1, capture_line, &d));
+    TEST_ASSERT_EQUAL_INT(3, d.lines);
+    TEST_ASSERT_EQUAL_INT(0, strcmp("# dropped,2", d.last_row));
+
+    for (size_t i = 0; i < room; i++) {
+        PLCOPEN_PROF_UNREGISTER(&extra[i]);
+    }
+    TEST_ASSERT_EQUAL_size_t(3, plcopen_prof_count());
+}
+
+/* ========== 分位数 ========== */
+
+void test_profile_quantile_from_histogram(void) {
+    plcopen_prof_t prof = { 0 };
+    prof.calls = 100;
+    prof.hist[4] = 99;   /* [16, 32) */
+    prof.hist[10] = 1;   /* [1024, 2048) */
+    TEST_ASSERT_EQUAL_UINT64(32, plcopen_prof_quantile_le(&prof, 0.5f));
+    TEST_ASSERT_EQUAL_UINT64(32, plcopen_prof_quantile_le(&prof, 0.99f));
+    TEST_ASSERT_EQUAL_UINT64(2048, plcopen_prof_quantile_le(&prof, 1.0f));
+
+    prof.calls = 0;
+    TEST_ASSERT_EQUAL_UINT64(0, plcopen_prof_quantile_le(&prof, 0.5f));
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_profile(void) {
+    RUN_TEST(test_profile_init_registers_once);
+    RUN_TEST(test_profile_unregister);
+    RUN_TEST(test_profile_execute_updates_counters);
+    RUN_TEST(test_profile_every_entry_point_counts_one_call);
+    RUN_TEST(test_profile_top_orders_by_total);
+    RUN_TEST(test_profile_dump_top_csv);
+    RUN_TEST(test_profile_registry_overflow_reported);
+    RUN_TEST(test_profile_quantile_from_histogram);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_profile();
+    return UNITY_END();
+}
@@ -0,0 +1,242 @@
+/**
+ * @file test_trace.c
+ * @brief 追踪环与转储线程单元测试
+ * @author Hollysys Embedded Team
+ * @date 2026-10-19
+ *
+ * 测试范围：
+ * - 初始化参数校验
+ * - 追加/快照顺序与环回绕
+ * - 状态触发（默认 NaN/Inf、自定义集合、手动触发）
+ * - 并发写者下快照不出现撕裂记录
+ * - 转储线程在触发后写出文件，格式可读回
+ */
+
+#include "unity.h"
+#include "plcopen/plcopen.h"
+#include "plcopen/trace_drainer.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define RING_RECORDS 64u
+
+PLCOPEN_TRACE_STORAGE(storage, RING_RECORDS);
+static plcopen_trace_ring_t ring;
+static plcopen_trace_record_t snap[RING_RECORDS];
+
+void setUp(void) {
+    TEST_ASSERT_EQUAL_INT(0, plcopen_trace_init(&ring, 7u, storage, RING_RECORDS));
+}
+
+void tearDown(void) {}
+
+/* ========== 初始化 ========== */
+
+void test_trace_init_validates_capacity(void) {
+    plcopen_trace_ring_t r;
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_trace_init(&r, 0u, storage, 48u));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_trace_init(&r, 0u, storage, 1u));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_trace_init(&r, 0u, NULL, 64u));
+    TEST_ASSERT_EQUAL_INT(-1, plcopen_trace_init(NULL, 0u, storage, 64u));
+    TEST_ASSERT_EQUAL_size_t(0, plcopen_trace_snapshot(&ring, snap, RING_RECORDS, NULL));
+}
+
+/* ========== 追加与快照 ========== */
+
+void test_trace_snapshot_in_write_order(void) {
+    FB_PID_t pid;
+    FB_PID_Config_t cfg = { .kp = 1.0f, .ki = 0.0f, .kd = 0.0f, .sample_time = 0.01f,
+                            .out_min = 0.0f, .out_max = 100.0f,
+                            .int_min = -50.0f, .int_max = 50.0f };
+    FB_PID_Init(&pid, &cfg);
+
+    plcopen_trace_begin_scan(&ring, 0x123456789ABCull);
+    float out = FB_PID_Execute(&pid, 50.0f, 40.0f);
+    plcopen_trace_pid(&ring, 101u, &pid, 50.0f, 40.0f, out);
+    plcopen_trace_fb(&ring, 102u, PLCOPEN_TRACE_LIMIT, FB_STATUS_LIMIT_HI, 12.0f, 10.0f);
+
+    uint32_t first = 99u;
+    TEST_ASSERT_EQUAL_size_t(3, plcopen_trace_snapshot(&ring, snap, RING_RECORDS, &first));
+    TEST_ASSERT_EQUAL_UINT32(0, first);
+
+    TEST_ASSERT_EQUAL_INT(PLCOPEN_TRACE_SCAN, snap[0].type);
+    uint32_t lo, hi;
+    memcpy(&lo, &snap[0].a, sizeof(lo));
+    memcpy(&hi, &snap[0].b, sizeof(hi));
+    TEST_ASSERT_EQUAL_UINT64(0x123456789ABCull, ((uint64_t)hi << 32) | lo);
+
+    TEST_ASSERT_EQUAL_UINT32(1, snap[1].scan);
+    TEST_ASSERT_EQUAL_INT(101, snap[1].id);
+    TEST_ASSERT_EQUAL_INT(PLCOPEN_TRACE_PID, snap[1].type);
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_OK, snap[1].status);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, snap[1].a);
+    TEST_ASSERT_EQUAL_FLOAT(40.0f, snap[1].b);
+    TEST_ASSERT_EQUAL_FLOAT(out, snap[1].out);
+
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_LIMIT_HI, snap[2].status);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, snap[2].out);
+}
+
+void test_trace_wraparound_keeps_latest(void) {
+    for (uint32_t i = 0; i < 3u * RING_RECORDS + 5u; i++) {
+        plcopen_trace_fb(&ring, (uint16_t)i, PLCOPEN_TRACE_PT1, FB_STATUS_OK, (float)i, 0.0f);
+    }
+
+    /* 写者随时可能开始改写最旧的槽位，环满时快照最多 capacity - 1 条 */
+    uint32_t first = 0;
+    TEST_ASSERT_EQUAL_size_t(RING_RECORDS - 1u,
+                             plcopen_trace_snapshot(&ring, snap, RING_RECORDS, &first));
+    TEST_ASSERT_EQUAL_UINT32(2u * RING_RECORDS + 6u, first);
+    for (uint32_t k = 0; k < RING_RECORDS - 1u; k++) {
+        TEST_ASSERT_EQUAL_FLOAT((float)(first + k), snap[k].a);
+    }
+
+    /* 输出缓冲区较小时只取最近的记录 */
+    TEST_ASSERT_EQUAL_size_t(4, plcopen_trace_snapshot(&ring, snap, 4, &first));
+    TEST_ASSERT_EQUAL_UINT32(3u * RING_RECORDS + 1u, first);
+    TEST_ASSERT_EQUAL_FLOAT((float)(3u * RING_RECORDS + 4u), snap[3].a);
+}
+
+/* ========== 触发 ========== */
+
+void test_trace_trigger_on_error_status(void) {
+    plcopen_trace_fb(&ring, 1u, PLCOPEN_TRACE_PT1, FB_STATUS_OK, 1.0f, 1.0f);
+    plcopen_trace_fb(&ring, 2u, PLCOPEN_TRACE_PT1, FB_STATUS_LIMIT_HI, 1.0f, 1.0f);
+    TEST_ASSERT_EQUAL_UINT32(PLCOPEN_TRACE_NO_TRIGGER, plcopen_trace_take_trigger(&ring));
+
+    plcopen_trace_fb(&ring, 3u, PLCOPEN_TRACE_PT1, FB_STATUS_ERROR_NAN, NAN, 0.0f);
+    plcopen_trace_fb(&ring, 4u, PLCOPEN_TRACE_PT1, FB_STATUS_OK, 1.0f, 1.0f);
+    TEST_ASSERT_EQUAL_UINT32(2, plcopen_trace_take_trigger(&ring));
+    TEST_ASSERT_EQUAL_UINT32(PLCOPEN_TRACE_NO_TRIGGER, plcopen_trace_take_trigger(&ring));
+
+    /* 自定义集合：限幅也触发，NaN 不再触发 */
+    plcopen_trace_set_trigger_mask(&ring, PLCOPEN_TRACE_TRIGGER_ON(FB_STATUS_LIMIT_LO));
+    plcopen_trace_fb(&ring, 5u, PLCOPEN_TRACE_PT1, FB_STATUS_ERROR_NAN, NAN, 0.0f);
+    TEST_ASSERT_EQUAL_UINT32(PLCOPEN_TRACE_NO_TRIGGER, plcopen_trace_take_trigger(&ring));
+    plcopen_trace_fb(&ring, 6u, PLCOPEN_TRACE_PT1, FB_STATUS_LIMIT_LO, -1.0f, 0.0f);
+    TEST_ASSERT_EQUAL_UINT32(5, plcopen_trace_take_trigger(&ring));
+
+    /* 手动触发指向最近一条记录 */
+    plcopen_trace_trigger(&ring);
+    TEST_ASSERT_EQUAL_UINT32(5, plcopen_trace_take_trigger(&ring));
+}
+
+/* ========== 并发 ========== */
+
+#define STRESS_RECORDS 400000u
+
+static atomic_int writer_done;
+
+static void* writer_thread(void* arg) {
+    (void)arg;
+    for (uint32_t i = 0; i < STRESS_RECORDS; i++) {
+        ring.scan = i;
+        plcopen_trace_append(&ring, (uint16_t)i, PLCOPEN_TRACE_USER, FB_STATUS_OK,
+                             (float)i, -(float)i, (float)i * 0.5f);
+    }
+    atomic_store(&writer_done, 1);
+    return NULL;
+}
+
+void test_trace_concurrent_snapshot_not_torn(void) {
+    pthread_t writer;
+    atomic_init(&writer_done, 0);
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&writer, NULL, writer_thread, NULL));
+
+    unsigned snapshots = 0;
+    while (!atomic_load(&writer_done) || snapshots == 0u) {
+        uint32_t first = 0;
+        size_t n = plcopen_trace_snapshot(&ring, snap, RING_RECORDS, &first);
+        for (size_t k = 0; k < n; k++) {
+            uint32_t index = first + (uint32_t)k;
+            TEST_ASSERT_EQUAL_UINT32(index, snap[k].scan);
+            TEST_ASSERT_EQUAL_INT((uint16_t)index, snap[k].id);
+            TEST_ASSERT_EQUAL_FLOAT((float)index, snap[k].a);
+            TEST_ASSERT_EQUAL_FLOAT(-(float)index, snap[k].b);
+            TEST_ASSERT_EQUAL_FLOAT((float)index * 0.5f, snap[k].out);
+        }
+        snapshots++;
+    }
+    pthread_join(writer, NULL);
+    TEST_ASSERT_TRUE(snapshots > 0u);
+}
+
+/* ========== 转储线程 ========== */
+
+static uint32_t read_u32(FILE* f) {
+    uint32_t value = 0;
+    TEST_ASSERT_EQUAL_size_t(1, fread(&value, sizeof(value), 1, f));
+    return value;
+}
+
+void test_trace_drainer_dumps_on_trigger(void) {
+    PLCOPEN_TRACE_STORAGE(storage2, 16);
+    plcopen_trace_ring_t ring2;
+    TEST_ASSERT_EQUAL_INT(0, plcopen_trace_init(&ring2, 1u, storage2, 16u));
+    for (uint32_t i = 0; i < 10u; i++) {
+        plcopen_trace_fb(&ring, (uint16_t)i, PLCOPEN_TRACE_PT1, FB_STATUS_OK, (float)i, 0.0f);
+    }
+
+    char prefix[64];
+    snprintf(prefix, sizeof(prefix), "/tmp/test_trace_%ld", (long)getpid());
+    plcopen_trace_ring_t* rings[] = { &ring, &ring2 };
+    plcopen_trace_drainer_config_t cfg = { .poll_ms = 1u, .post_trigger_ms = 5u,
+                                           .holdoff_ms = 0u };
+    plcopen_trace_drainer_t drainer;
+    TEST_ASSERT_EQUAL_INT(0, plcopen_trace_drainer_start(&drainer, rings, 2, prefix, &cfg));
+
+    plcopen_trace_fb(&ring, 10u, PLCOPEN_TRACE_PT1, FB_STATUS_ERROR_INF, INFINITY, 0.0f);
+    for (int wait = 0; wait < 2000 && plcopen_trace_drainer_dumps(&drainer) == 0u; wait++) {
+        struct timespec ts = { 0, 1000000L };
+        nanosleep(&ts, NULL);
+    }
+    plcopen_trace_drainer_stop(&drainer);
+    TEST_ASSERT_EQUAL_UINT32(1, plcopen_trace_drainer_dumps(&drainer));
+
+    char path[96];
+    snprintf(path, sizeof(path), "%s-0.plct", prefix);
+    FILE* f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL_UINT32(0x54434C50u, read_u32(f));
+    uint32_t version_size = read_u32(f);
+    TEST_ASSERT_EQUAL_UINT32(1u | ((uint32_t)sizeof(plcopen_trace_record_t) << 16), version_size);
+    TEST_ASSERT_EQUAL_UINT32(2, read_u32(f));
+
+    TEST_ASSERT_EQUAL_UINT32(7, read_u32(f));      /* ring_id */
+    TEST_ASSERT_EQUAL_UINT32(11, read_u32(f));     /* record_count */
+    TEST_ASSERT_EQUAL_UINT32(0, read_u32(f));      /* first_index */
+    TEST_ASSERT_EQUAL_UINT32(10, read_u32(f));     /* trigger_index */
+    plcopen_trace_record_t rec[11];
+    TEST_ASSERT_EQUAL_size_t(11, fread(rec, sizeof(rec[0]), 11, f));
+    TEST_ASSERT_EQUAL_INT(FB_STATUS_ERROR_INF, rec[10].status);
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, rec[9].a);
+
+    TEST_ASSERT_EQUAL_UINT32(1, read_u32(f));
+    TEST_ASSERT_EQUAL_UINT32(0, read_u32(f));
+    TEST_ASSERT_EQUAL_UINT32(0, read_u32(f));
+    TEST_ASSERT_EQUAL_UINT32(PLCOPEN_TRACE_NO_TRIGGER, read_u32(f));
+    TEST_ASSERT_EQUAL_INT(EOF, fgetc(f));
+    fclose(f);
+    remove(path);
+}
+
+/* ========== 运行器函数 ========== */
+
+void run_test_trace(void) {
+    RUN_TEST(test_trace_init_validates_capacity);
+    RUN_TEST(test_trace_snapshot_in_write_order);
+    RUN_TEST(test_trace_wraparound_keeps_latest);
+    RUN_TEST(test_trace_trigger_on_error_status);
+    RUN_TEST(test_trace_concurrent_snapshot_not_torn);
+    RUN_TEST(test_trace_drainer_dumps_on_trigger);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    run_test_trace();
+    return UNITY_END();
+}